@@ -260,7 +260,8 @@ int main(int argc, char const ** argv)
     seqan::BamHeader header;
     readHeader(header, bamFile);
 
-    seqan::BamAlignmentRecord record;
+    // Only the fixed-size fields are needed, so avoid decoding names, sequences etc.
+    seqan::BamAlignmentRecordView record;
     while (!atEnd(bamFile))
     {
         readRecord(record, bamFile);
@@ -1151,6 +1151,10 @@ public:
     // Open the output files.
     void _initOpenOutputFiles()
     {
+        // compressed output uses as many compression threads as simulation threads
+        outSeqsLeft.stream.numThreads = options.numThreads;
+        outSeqsRight.stream.numThreads = options.numThreads;
+
         std::cerr << "Opening output file " << options.outFileNameLeft << " ...";
         if (!open(outSeqsLeft, toCString(options.outFileNameLeft)))
             throw MasonIOException("Could not open left/single-end output file.");
@@ -13,30 +13,24 @@
 
 namespace seqan {
 
-#if defined(PLATFORM_GCC) && __GNUC__ >= 4 && __GNUC_MINOR__ >= 3
-
-// use MCSTL which is part of the GCC since version 4.3
-
 template <typename TAlign, typename TFunctorLess>
 inline void
 sortAlignedReads(TAlign & alignStore, TFunctorLess const & less, Parallel)
 {
-    __gnu_parallel::sort(
-        begin(alignStore, Standard()),
-        end(alignStore, Standard()),
-        less);
+    sort(alignStore, less, Parallel());
 }
 
 template <typename TAlign, typename TFunctorLess>
 inline void
 sortAlignedReads(TAlign const & alignStore, TFunctorLess const & less, Parallel)
 {
-    __gnu_parallel::sort(
-        begin(const_cast<TAlign &>(alignStore), Standard()),
-        end(const_cast<TAlign &>(alignStore), Standard()),
-        less);
+    sort(const_cast<TAlign &>(alignStore), less, Parallel());
 }
 
+#if defined(PLATFORM_GCC) && __GNUC__ >= 4 && __GNUC_MINOR__ >= 3
+
+// use MCSTL which is part of the GCC since version 4.3
+
 template <typename TIntString>
 inline void
 partialSum(TIntString & intString)
@@ -51,20 +45,6 @@ partialSum(TIntString & intString)
 
 // sequential fallback
 
-template <typename TAlign, typename TFunctorLess>
-inline void
-sortAlignedReads(TAlign & alignStore, TFunctorLess const & less, Parallel)
-{
-    std::sort(begin(alignStore, Standard()), end(alignStore, Standard()), less);
-}
-
-template <typename TAlign, typename TFunctorLess>
-inline void
-sortAlignedReads(TAlign const & alignStore, TFunctorLess const & less, Parallel)
-{
-    std::sort(begin(alignStore, Standard()), end(alignStore, Standard()), less);
-}
-
 template <typename TIntString>
 inline void
 partialSum(TIntString & intString)
@@ -108,7 +108,6 @@ void catBamFiles(TWriter &writer, StringSet<CharString> &inFiles, AppOptions con
     writeHeader(writer, header);
 
     // Step 3: Read and output alignment records
-    BamAlignmentRecord record;
     String<BamAlignmentRecord> records;
     __uint64 numRecords = 0;
     double start = sysTime();
@@ -119,25 +118,12 @@ void catBamFiles(TWriter &writer, StringSet<CharString> &inFiles, AppOptions con
 
         BamFileIn &reader = *readerPtr[i];
 
-        // copy all alignment records
-        if (isEqual(format(writer), Sam()))
+        // copy all alignment records, records are decoded and encoded in parallel batches
+        while (!atEnd(reader))
         {
-            // For Sam parallel batch processing is faster
-            while (!atEnd(reader))
-            {
-                unsigned size = readRecords(records, reader, 100000);
-                writeRecords(writer, prefix(records, size));
-                numRecords += size;
-            }
-        }
-        else
-        {
-            while (!atEnd(reader))
-            {
-                readRecord(record, reader);
-                writeRecord(writer, record);
-                ++numRecords;
-            }
+            unsigned size = readRecords(records, reader, 100000);
+            writeRecords(writer, prefix(records, size));
+            numRecords += size;
         }
         close(reader);
         delete readerPtr[i];
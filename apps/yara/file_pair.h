@@ -87,6 +87,16 @@ inline void readRecords(TRecords & records,
     readRecords(records, me.i2, maxRecords);
 }
 
+template <typename TRecords, typename TFileType, typename TDirection, typename TSpec, typename TSize, typename TThreading>
+inline void readRecords(TRecords & records,
+                        Pair<FormattedFile<TFileType, TDirection, TSpec> > & me,
+                        TSize maxRecords,
+                        Tag<TThreading> const & threading)
+{
+    readRecords(records, me.i1, maxRecords, threading);
+    readRecords(records, me.i2, maxRecords, threading);
+}
+
 }
 
 #endif  // #ifndef APP_YARA_FILE_PAIR_H_
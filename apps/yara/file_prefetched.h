@@ -126,18 +126,19 @@ inline void close(PrefetchedFile<TFile, TRecords, TThreading> & me)
 template <typename TFile, typename TRecords, typename TThreading>
 inline void readRecords(TRecords & records, PrefetchedFile<TFile, TRecords, TThreading> & me)
 {
-    readRecords(records, me.file, me.maxRecords);
+    readRecords(records, me.file, me.maxRecords, Serial());
 }
 
 // ----------------------------------------------------------------------------
 // Function _prefetchRecords<Parallel>()
 // ----------------------------------------------------------------------------
-// Prefetches the first batch of records.
+// Prefetches the next batch of records in the background.  The records are parsed serially, so that the reader thread
+// does not compete with the OpenMP threads of the mapper.
 
 template <typename TFile, typename TRecords>
 inline void _prefetchRecords(PrefetchedFile<TFile, TRecords, Parallel> & me)
 {
-    me.reader = std::thread([&me]() { readRecords(me.records, me.file, me.maxRecords); });
+    me.reader = std::thread([&me]() { readRecords(me.records, me.file, me.maxRecords, Serial()); });
 }
 
 // ----------------------------------------------------------------------------
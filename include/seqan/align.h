@@ -50,6 +50,9 @@
 // ============================================================================
 
 #include <seqan/basic.h>
+#ifdef __SSE4_1__
+#include <seqan/basic/basic_simd_vector.h>
+#endif  // #ifdef __SSE4_1__
 #include <seqan/modifier.h>  // ModifiedAlphabet<>.
 #include <seqan/align/align_metafunctions.h>
 #include <seqan/graph_align.h>  // TODO(holtgrew): We should not have to depend on this.
@@ -157,6 +160,10 @@
 #include <seqan/align/dp_traceback_impl.h>
 #include <seqan/align/dp_algorithm_impl.h>
 
+// The inter-sequence vectorized dynamic programming for batches of alignments.
+#include <seqan/align/dp_algorithm_simd_impl.h>
+#include <seqan/align/dp_algorithm_simd_antidiagonal_impl.h>
+
 //################################################################################
 // Old module
 //################################################################################
@@ -119,6 +119,25 @@ typedef Tag<MyersBitVector_> MyersBitVector;
 struct MyersHirschberg_;
 typedef Tag<MyersHirschberg_> MyersHirschberg;
 
+/*!
+ * @tag AlignmentAlgorithmTags#AntiDiagonalSimd
+ * @headerfile <seqan/align.h>
+ * @brief Tag for computing one long DP alignment along the anti-diagonals in the lanes of a SIMD vector.
+ *
+ * @signature struct AntiDiagonalSimd_;
+ * @signature typedef Tag<AntiDiagonalSimd_> AntiDiagonalSimd;
+ *
+ * Can be passed to @link globalAlignment @endlink, @link globalAlignmentScore @endlink, @link localAlignment
+ * @endlink and @link localAlignmentScore @endlink in place of the gap model tag.  The gap model is selected from
+ * the scoring scheme.  Unbanded alignments with <tt>short</tt> or <tt>int</tt> scores and linear or affine gap costs
+ * are vectorized.  The scoring scheme must be a Simple score or a score matrix over alphabets with at most 32
+ * characters, other configurations are rejected at compile time.  Scores and traces equal the ones of the scalar
+ * algorithm, which is used for banded alignments and if SIMD is not available.
+ */
+
+struct AntiDiagonalSimd_;
+typedef Tag<AntiDiagonalSimd_> AntiDiagonalSimd;
+
 // ----------------------------------------------------------------------------
 // Local Alignment Algorithm Tags
 // ----------------------------------------------------------------------------
@@ -1374,8 +1374,10 @@ _correctTraceValue(TTraceNavigator & traceNavigator,
 // Function _computeAligmnment()
 // ----------------------------------------------------------------------------
 
+// The kernel tag selects the implementation of unbanded alignments, Default for the column-wise algorithm or
+// AntiDiagonalSimd for the anti-diagonal kernel.
 template <typename TScoreValue, typename TGapScheme, typename TTraceTarget, typename TScoutState, typename TSequenceH, typename TSequenceV,
-          typename TScoreScheme, typename TBandSwitch, typename TAlignmentAlgorithm, typename TTraceFlag>
+          typename TScoreScheme, typename TBandSwitch, typename TAlignmentAlgorithm, typename TTraceFlag, typename TKernelTag>
 inline typename Value<TScoreScheme>::Type
 _computeAlignment(DPContext<TScoreValue, TGapScheme> & dpContext,
                   TTraceTarget & traceSegments,
@@ -1384,7 +1386,8 @@ _computeAlignment(DPContext<TScoreValue, TGapScheme> & dpContext,
                   TSequenceV const & seqV,
                   TScoreScheme const & scoreScheme,
                   DPBandConfig<TBandSwitch> const & band,
-                  DPProfile_<TAlignmentAlgorithm, TGapScheme, TTraceFlag> const & dpProfile)
+                  DPProfile_<TAlignmentAlgorithm, TGapScheme, TTraceFlag> const & dpProfile,
+                  TKernelTag const & /*kernelTag*/)
 {
     typedef typename GetDPScoreMatrix<DPContext<TScoreValue, TGapScheme> >::Type TDPScoreMatrixHost;
     typedef typename Value<TDPScoreMatrixHost>::Type TDPScoreValue;
@@ -1443,9 +1446,17 @@ _computeAlignment(DPContext<TScoreValue, TGapScheme> & dpContext,
 
     TDPScout dpScout(scoutState);
 
+    // Banded alignments always use the column-wise algorithm.
+    typedef typename If<IsSameType<TBandSwitch, BandOff>, TKernelTag, Default>::Type TUnbandedKernelTag;
+
     // Execute the alignment.
     if (!_isBandEnabled(band))
-        _computeUnbandedAlignment(dpScout, dpScoreMatrixNavigator, dpTraceMatrixNavigator, seqH, seqV, scoreScheme, dpProfile);
+    {
+        if (!_computeUnbandedAlignmentAntiDiagonal(dpScout, dpTraceMatrix, seqH, seqV, scoreScheme, dpProfile,
+                                                   TUnbandedKernelTag()))
+            _computeUnbandedAlignment(dpScout, dpScoreMatrixNavigator, dpTraceMatrixNavigator, seqH, seqV, scoreScheme,
+                                      dpProfile);
+    }
     else if (upperDiagonal(band) == lowerDiagonal(band))
         _computeHammingDistance(dpScout, dpScoreMatrixNavigator, dpTraceMatrixNavigator, seqH, seqV, scoreScheme, band, dpProfile);
     else
@@ -1471,6 +1482,22 @@ _computeAlignment(DPContext<TScoreValue, TGapScheme> & dpContext,
     return maxScore(dpScout);
 }
 
+template <typename TScoreValue, typename TGapScheme, typename TTraceTarget, typename TScoutState, typename TSequenceH, typename TSequenceV,
+          typename TScoreScheme, typename TBandSwitch, typename TAlignmentAlgorithm, typename TTraceFlag>
+inline typename Value<TScoreScheme>::Type
+_computeAlignment(DPContext<TScoreValue, TGapScheme> & dpContext,
+                  TTraceTarget & traceSegments,
+                  TScoutState & scoutState,
+                  TSequenceH const & seqH,
+                  TSequenceV const & seqV,
+                  TScoreScheme const & scoreScheme,
+                  DPBandConfig<TBandSwitch> const & band,
+                  DPProfile_<TAlignmentAlgorithm, TGapScheme, TTraceFlag> const & dpProfile)
+{
+    return _computeAlignment(dpContext, traceSegments, scoutState, seqH, seqV, scoreScheme, band, dpProfile,
+                             Default());
+}
+
 }  // namespace seqan
 
 #endif  // #ifndef SEQAN_INCLUDE_SEQAN_ALIGN_DP_ALGORITHM_IMPL_H_
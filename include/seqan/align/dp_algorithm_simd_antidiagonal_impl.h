@@ -0,0 +1,750 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2015, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: SeqAn Team <seqan-dev@lists.fu-berlin.de>
+// ==========================================================================
+// Implements the intra-sequence vectorized dp algorithm.
+//
+// Anti-diagonal vectorization:
+// The cells of one anti-diagonal d = row + column only depend on the cells
+// of the anti-diagonals d - 1 and d - 2. Thus, a single long alignment is
+// computed by sweeping over the anti-diagonals of the dp matrix while the
+// inner cells of one anti-diagonal are computed in the lanes of a
+// SimdVector. The three active anti-diagonals are stored in buffers that
+// are indexed by the row of a cell, such that the neighbouring cells of a
+// vector are loaded with unaligned loads from consecutive memory. The
+// horizontal sequence is stored in reversed order for the same reason.
+// The cells of the first row and the first column are computed separately.
+//
+// The recursion is the one of the inter-sequence kernel, see
+// dp_algorithm_simd_impl.h. The trace values of the last anti-diagonals are
+// collected in a small buffer indexed by the row, which is copied into the
+// common column-wise trace matrix in runs of consecutive rows whenever it is
+// full. Since the cells are visited in a different
+// order than by the scalar algorithm, the scout selects among cells with the
+// same score the one that comes first in column-major order. Scores and
+// tracebacks are therefore identical to the ones of the scalar
+// implementation.
+//
+// Dispatch:
+// The kernel is only used if the caller passes the AntiDiagonalSimd tag,
+// which reaches _computeAlignment() as its kernel tag. It supports unbanded
+// global alignments with free end-gaps and the standard local alignment
+// with linear or affine gap costs. Simple scores compare the characters of
+// both sequences, score matrices of small alphabets blend the scores of a
+// vector from the rows of a substitution profile. Other scores and profiles
+// are rejected at compile time. Banded alignments are computed by the scalar
+// algorithm.
+// ==========================================================================
+
+#ifndef SEQAN_INCLUDE_SEQAN_ALIGN_DP_ALGORITHM_SIMD_ANTIDIAGONAL_IMPL_H_
+#define SEQAN_INCLUDE_SEQAN_ALIGN_DP_ALGORITHM_SIMD_ANTIDIAGONAL_IMPL_H_
+
+namespace seqan {
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Class AntiDiagonalSubstitution_
+// ----------------------------------------------------------------------------
+
+// Computes the substitution scores for consecutive cells of one anti-diagonal.
+template <typename TSimdVector, typename TScoringScheme, typename TSpec = void>
+struct AntiDiagonalSubstitution_;
+
+// For other scores we precompute the scores of every character of the horizontal alphabet against the vertical
+// sequence.  The scores of consecutive rows are then blended together from the profile rows of the horizontal
+// characters of the lanes.
+template <typename TSimdVector, typename TScoringScheme>
+struct AntiDiagonalSubstitution_<TSimdVector, TScoringScheme, SimdSubstitutionProfile_>
+{
+    String<typename Value<TSimdVector>::Type> _seqHReversed;
+    String<typename Value<TSimdVector>::Type> _profile;
+    unsigned _profileRowSize;
+};
+
+// For simple scores we compare the ordinal values of the vertical and the reversed horizontal sequence.
+template <typename TSimdVector, typename TScoringScheme>
+struct AntiDiagonalSubstitution_<TSimdVector, TScoringScheme, SimdSubstitutionCompare_>
+{
+    String<typename Value<TSimdVector>::Type> _seqHReversed;
+    String<typename Value<TSimdVector>::Type> _seqV;
+    TSimdVector _match;
+    TSimdVector _mismatch;
+};
+
+// ----------------------------------------------------------------------------
+// Class AntiDiagonalTraceBuffer_
+// ----------------------------------------------------------------------------
+
+// Collects the trace values of BLOCK consecutive anti-diagonals, indexed by the row of the cell.
+template <typename TTraceValue>
+struct AntiDiagonalTraceBuffer_
+{
+    enum { BLOCK = 64 };
+
+    String<TTraceValue> _buffer;
+    unsigned            _stride;
+    unsigned            _diagonalBegin;   // The first anti-diagonal that is not copied yet.
+};
+
+// ----------------------------------------------------------------------------
+// Class AntiDiagonalScout_
+// ----------------------------------------------------------------------------
+
+// Stores the best cell found so far and its host position within the column-wise dp matrix.
+template <typename TScoreValue, typename TPosition>
+struct AntiDiagonalScout_
+{
+    TScoreValue _score;
+    TScoreValue _horizontalScore;
+    TScoreValue _verticalScore;
+    TPosition   _hostPosition;
+
+    AntiDiagonalScout_() :
+        _score(DPCellDefaultInfinity<DPCell_<TScoreValue, AffineGaps> >::VALUE),
+        _horizontalScore(DPCellDefaultInfinity<DPCell_<TScoreValue, AffineGaps> >::VALUE),
+        _verticalScore(DPCellDefaultInfinity<DPCell_<TScoreValue, AffineGaps> >::VALUE),
+        _hostPosition(0)
+    {}
+};
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Metafunction IsAntiDiagonalProfile_
+// ----------------------------------------------------------------------------
+
+// Returns True if the alignment described by the scout and the dp profile can be computed by the anti-diagonal kernel.
+// Global and local alignments have no termination criterium, their scouts are the default specialization whatever
+// the scout spec is.
+template <typename TDPScout, typename TDPProfile>
+struct IsAntiDiagonalProfile_ : False {};
+
+#ifdef SEQAN_SIMD_ENABLED
+
+template <typename TScoreValue, typename TGapModel, typename TTraceFlag>
+struct IsAntiDiagonalTraceProfile_ :
+    And<And<IsSimdGapModel_<TGapModel>, IsSimdScoreValue_<TScoreValue> >,
+        Or<IsSameType<TTraceFlag, TracebackOff>, IsSingleTrace_<TTraceFlag> > > {};
+
+template <typename TScoreValue, typename TGapModel, typename TScoutSpec, typename TFirstRow, typename TFirstColumn,
+          typename TLastRow, typename TLastColumn, typename TTraceFlag>
+struct IsAntiDiagonalProfile_<DPScout_<DPCell_<TScoreValue, TGapModel>, TScoutSpec>,
+                              DPProfile_<GlobalAlignment_<FreeEndGaps_<TFirstRow, TFirstColumn, TLastRow, TLastColumn> >,
+                                         TGapModel, TTraceFlag> > :
+    IsAntiDiagonalTraceProfile_<TScoreValue, TGapModel, TTraceFlag> {};
+
+template <typename TScoreValue, typename TGapModel, typename TScoutSpec, typename TTraceFlag>
+struct IsAntiDiagonalProfile_<DPScout_<DPCell_<TScoreValue, TGapModel>, TScoutSpec>,
+                              DPProfile_<LocalAlignment_<Default>, TGapModel, TTraceFlag> > :
+    IsAntiDiagonalTraceProfile_<TScoreValue, TGapModel, TTraceFlag> {};
+
+#endif  // #ifdef SEQAN_SIMD_ENABLED
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+#ifdef SEQAN_SIMD_ENABLED
+
+// ----------------------------------------------------------------------------
+// Function _initAntiDiagonalSubstitution()
+// ----------------------------------------------------------------------------
+
+template <typename TSimdVector, typename TScoringScheme, typename TSequenceH, typename TSequenceV>
+inline void
+_initAntiDiagonalSubstitution(AntiDiagonalSubstitution_<TSimdVector, TScoringScheme, SimdSubstitutionProfile_> & sub,
+                              TScoringScheme const & scoringScheme,
+                              TSequenceH const & seqH,
+                              TSequenceV const & seqV)
+{
+    typedef typename Value<TSimdVector>::Type TValue;
+    typedef typename Value<TSequenceH>::Type TValueH;
+
+    const unsigned SIGMA = ValueSize<TValueH>::VALUE;
+
+    // The padding is only read by lanes beyond the end of the anti-diagonal.
+    unsigned lenH = length(seqH);
+    resize(sub._seqHReversed, lenH + LENGTH<TSimdVector>::VALUE, -1, Exact());
+    for (unsigned j = 0; j < lenH; ++j)
+        sub._seqHReversed[lenH - 1 - j] = static_cast<TValue>(ordValue(seqH[j]));
+
+    sub._profileRowSize = length(seqV) + LENGTH<TSimdVector>::VALUE;
+    resize(sub._profile, SIGMA * sub._profileRowSize, 0, Exact());
+    for (unsigned c = 0; c < SIGMA; ++c)
+        for (unsigned i = 0; i < length(seqV); ++i)
+            sub._profile[c * sub._profileRowSize + i] = static_cast<TValue>(score(scoringScheme, TValueH(c), seqV[i]));
+}
+
+template <typename TSimdVector, typename TScoringScheme, typename TSequenceH, typename TSequenceV>
+inline void
+_initAntiDiagonalSubstitution(AntiDiagonalSubstitution_<TSimdVector, TScoringScheme, SimdSubstitutionCompare_> & sub,
+                              TScoringScheme const & scoringScheme,
+                              TSequenceH const & seqH,
+                              TSequenceV const & seqV)
+{
+    typedef typename Value<TSimdVector>::Type TValue;
+
+    fillVector(sub._match, scoreMatch(scoringScheme));
+    fillVector(sub._mismatch, scoreMismatch(scoringScheme));
+
+    // The padding is only read by lanes beyond the end of the anti-diagonal.
+    unsigned lenH = length(seqH);
+    resize(sub._seqHReversed, lenH + LENGTH<TSimdVector>::VALUE, -1, Exact());
+    for (unsigned j = 0; j < lenH; ++j)
+        sub._seqHReversed[lenH - 1 - j] = static_cast<TValue>(ordValue(seqH[j]));
+    resize(sub._seqV, length(seqV) + LENGTH<TSimdVector>::VALUE, -2, Exact());
+    for (unsigned i = 0; i < length(seqV); ++i)
+        sub._seqV[i] = static_cast<TValue>(ordValue(seqV[i]));
+}
+
+// ----------------------------------------------------------------------------
+// Function _antiDiagonalSubstitutionScore()
+// ----------------------------------------------------------------------------
+
+// Returns the substitution scores of the cells (row + k, diagonal - row - k) with k in [0, count).
+template <typename TSimdVector, typename TScoringScheme, typename TSequenceH, typename TSequenceV>
+inline TSimdVector
+_antiDiagonalSubstitutionScore(AntiDiagonalSubstitution_<TSimdVector, TScoringScheme, SimdSubstitutionProfile_> & sub,
+                               TScoringScheme const & /*scoringScheme*/,
+                               TSequenceH const & seqH,
+                               TSequenceV const & /*seqV*/,
+                               unsigned diagonal,
+                               unsigned row,
+                               unsigned /*count*/)
+{
+    const unsigned SIGMA = ValueSize<typename Value<TSequenceH>::Type>::VALUE;
+
+    TSimdVector valH = loadu<TSimdVector>(begin(sub._seqHReversed, Standard()) + length(seqH) - diagonal + row);
+    typename Value<TSimdVector>::Type const * profile = begin(sub._profile, Standard()) + row - 1;
+
+    // Lanes beyond the end of the anti-diagonal keep the scores of the first character.
+    TSimdVector scores = loadu<TSimdVector>(profile);
+    for (unsigned c = 1; c < SIGMA; ++c)
+    {
+        profile += sub._profileRowSize;
+        scores = blend(scores, loadu<TSimdVector>(profile),
+                       static_cast<TSimdVector>(valH == createVector<TSimdVector>(c)));
+    }
+    return scores;
+}
+
+template <typename TSimdVector, typename TScoringScheme, typename TSequenceH, typename TSequenceV>
+inline TSimdVector
+_antiDiagonalSubstitutionScore(AntiDiagonalSubstitution_<TSimdVector, TScoringScheme, SimdSubstitutionCompare_> & sub,
+                               TScoringScheme const & /*scoringScheme*/,
+                               TSequenceH const & seqH,
+                               TSequenceV const & /*seqV*/,
+                               unsigned diagonal,
+                               unsigned row,
+                               unsigned /*count*/)
+{
+    TSimdVector valH = loadu<TSimdVector>(begin(sub._seqHReversed, Standard()) + length(seqH) - diagonal + row);
+    TSimdVector valV = loadu<TSimdVector>(begin(sub._seqV, Standard()) + row - 1);
+    return blend(sub._mismatch, sub._match, static_cast<TSimdVector>(valH == valV));
+}
+
+// ----------------------------------------------------------------------------
+// Function _scoutAntiDiagonal()
+// ----------------------------------------------------------------------------
+
+// Tracks the cell if it has a better score than the current maximum or the same score but comes first in
+// column-major order, which is the cell the scalar scout would keep.
+template <typename TScoreValue, typename TPosition>
+inline void
+_scoutAntiDiagonal(AntiDiagonalScout_<TScoreValue, TPosition> & scout,
+                   TScoreValue score,
+                   TScoreValue horizontalScore,
+                   TScoreValue verticalScore,
+                   TPosition hostPosition)
+{
+    if (score > scout._score || (score == scout._score && hostPosition < scout._hostPosition))
+    {
+        scout._score = score;
+        scout._horizontalScore = horizontalScore;
+        scout._verticalScore = verticalScore;
+        scout._hostPosition = hostPosition;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _initAntiDiagonalTraceBuffer()
+// ----------------------------------------------------------------------------
+
+template <typename TTraceValue>
+inline void
+_initAntiDiagonalTraceBuffer(AntiDiagonalTraceBuffer_<TTraceValue> & traceBuffer, unsigned stride)
+{
+    traceBuffer._stride = stride;
+    traceBuffer._diagonalBegin = 0;
+    resize(traceBuffer._buffer, AntiDiagonalTraceBuffer_<TTraceValue>::BLOCK * stride, +TraceBitMap_::NONE, Exact());
+}
+
+// ----------------------------------------------------------------------------
+// Function _antiDiagonalTrace()
+// ----------------------------------------------------------------------------
+
+// Returns the trace values of the given anti-diagonal, indexed by the row.
+template <typename TTraceValue>
+inline TTraceValue *
+_antiDiagonalTrace(AntiDiagonalTraceBuffer_<TTraceValue> & traceBuffer, unsigned diagonal)
+{
+    return begin(traceBuffer._buffer, Standard()) +
+           (diagonal % AntiDiagonalTraceBuffer_<TTraceValue>::BLOCK) * traceBuffer._stride;
+}
+
+// ----------------------------------------------------------------------------
+// Function _flushAntiDiagonalTrace()
+// ----------------------------------------------------------------------------
+
+// Copies the trace values of the anti-diagonals [traceBuffer._diagonalBegin, diagonalEnd) into the column-wise trace
+// matrix.  The cells of these anti-diagonals form a run of consecutive rows in each column.
+template <typename TTraceValue, typename TTraceIterator>
+inline void
+_flushAntiDiagonalTrace(AntiDiagonalTraceBuffer_<TTraceValue> & traceBuffer,
+                        TTraceIterator traceBegin,
+                        unsigned lenH,
+                        unsigned lenV,
+                        unsigned diagonalEnd)
+{
+    typedef typename Position<String<TTraceValue> >::Type TPosition;
+
+    unsigned diagonalBegin = traceBuffer._diagonalBegin;
+    unsigned columnBegin = (diagonalBegin > lenV) ? diagonalBegin - lenV : 0;
+    unsigned columnEnd = _min(lenH + 1, diagonalEnd);
+    for (unsigned column = columnBegin; column < columnEnd; ++column)
+    {
+        unsigned rowBegin = (diagonalBegin > column) ? diagonalBegin - column : 0;
+        unsigned rowEnd = _min(lenV + 1, diagonalEnd - column);
+        TTraceIterator it = traceBegin + static_cast<TPosition>(column) * (lenV + 1) + rowBegin;
+        for (unsigned row = rowBegin; row < rowEnd; ++row, ++it)
+            *it = _antiDiagonalTrace(traceBuffer, row + column)[row];
+    }
+    traceBuffer._diagonalBegin = diagonalEnd;
+}
+
+// ----------------------------------------------------------------------------
+// Function _computeAntiDiagonalGapCell()
+// ----------------------------------------------------------------------------
+
+// Computes a cell of the first row or the first column, see _computeGapCellSimd().
+template <typename TScoreValue>
+inline typename TraceBitMap_::TTraceValue
+_computeAntiDiagonalGapCell(TScoreValue & activeScore,
+                            TScoreValue & activeGap,
+                            TScoreValue prevScore,
+                            TScoreValue prevGap,
+                            TScoreValue gapExtend,
+                            TScoreValue /*gapOpen*/,
+                            typename TraceBitMap_::TTraceValue gapTrace,
+                            typename TraceBitMap_::TTraceValue /*gapOpenTrace*/,
+                            typename TraceBitMap_::TTraceValue maxTrace,
+                            LinearGaps const &)
+{
+    activeGap = prevGap;
+    activeScore = prevScore + gapExtend;
+    return gapTrace | maxTrace;
+}
+
+template <typename TScoreValue>
+inline typename TraceBitMap_::TTraceValue
+_computeAntiDiagonalGapCell(TScoreValue & activeScore,
+                            TScoreValue & activeGap,
+                            TScoreValue prevScore,
+                            TScoreValue prevGap,
+                            TScoreValue gapExtend,
+                            TScoreValue gapOpen,
+                            typename TraceBitMap_::TTraceValue gapTrace,
+                            typename TraceBitMap_::TTraceValue gapOpenTrace,
+                            typename TraceBitMap_::TTraceValue maxTrace,
+                            AffineGaps const &)
+{
+    activeGap = prevGap + gapExtend;
+    typename TraceBitMap_::TTraceValue trace = gapTrace;
+    if (activeGap < static_cast<TScoreValue>(prevScore + gapOpen))
+    {
+        activeGap = prevScore + gapOpen;
+        trace = gapOpenTrace;
+    }
+    activeScore = activeGap;
+    return trace | maxTrace;
+}
+
+// ----------------------------------------------------------------------------
+// Function _computeAntiDiagonalAlignment()
+// ----------------------------------------------------------------------------
+
+// Computes the alignment along the anti-diagonals and stores the best cell in the scout.
+template <typename TScoreValue, typename TGapModel, typename TScoutSpec, typename TDPTraceMatrix, typename TSequenceH,
+          typename TSequenceV, typename TScoringScheme, typename TAlgorithm, typename TTraceFlag>
+inline void
+_computeAntiDiagonalAlignment(DPScout_<DPCell_<TScoreValue, TGapModel>, TScoutSpec> & dpScout,
+                              TDPTraceMatrix & dpTraceMatrix,
+                              TSequenceH const & seqH,
+                              TSequenceV const & seqV,
+                              TScoringScheme const & scoringScheme,
+                              DPProfile_<TAlgorithm, TGapModel, TTraceFlag> const &)
+{
+    typedef typename SimdVector<TScoreValue>::Type TSimdVector;
+    typedef DPProfile_<TAlgorithm, TGapModel, TTraceFlag> TDPProfile;
+    typedef typename TraceBitMap_::TTraceValue TTraceValue;
+    typedef typename Position<TDPTraceMatrix>::Type TPosition;
+    typedef AntiDiagonalSubstitution_<TSimdVector, TScoringScheme,
+                                      typename SimdSubstitutionSpec_<TScoringScheme, TSequenceH,
+                                                                     TSequenceV>::Type> TSubstitution;
+
+    const bool IS_LOCAL = IsLocalAlignment_<TDPProfile>::VALUE;
+    const bool IS_AFFINE = IsSameType<TGapModel, AffineGaps>::VALUE;
+    const bool FREE_FIRST_ROW = IS_LOCAL || IsFreeEndGap_<TDPProfile, DPFirstRow>::VALUE;
+    const bool FREE_FIRST_COLUMN = IS_LOCAL || IsFreeEndGap_<TDPProfile, DPFirstColumn>::VALUE;
+    const bool FREE_LAST_ROW = IsFreeEndGap_<TDPProfile, DPLastRow>::VALUE;
+    const bool FREE_LAST_COLUMN = IsFreeEndGap_<TDPProfile, DPLastColumn>::VALUE;
+    const bool TRACEBACK = IsTracebackEnabled_<TTraceFlag>::VALUE;
+    const unsigned LANES = LENGTH<TSimdVector>::VALUE;
+
+    unsigned lenH = length(seqH);
+    unsigned lenV = length(seqV);
+    unsigned colSize = lenV + 1;
+    TPosition hostColSize = colSize;
+
+    TSubstitution substitution;
+    _initAntiDiagonalSubstitution(substitution, scoringScheme, seqH, seqV);
+
+    TScoreValue infValue = DPCellDefaultInfinity<DPCell_<TScoreValue, TGapModel> >::VALUE;
+    // The vectorized kernel assumes that the gap costs do not depend on the sequence positions.
+    typename Value<TSequenceH>::Type seqHVal = typename Value<TSequenceH>::Type();
+    typename Value<TSequenceV>::Type seqVVal = typename Value<TSequenceV>::Type();
+    TScoreValue gapExtendH = scoreGapExtendHorizontal(scoringScheme, seqHVal, seqVVal);
+    TScoreValue gapOpenH = scoreGapOpenHorizontal(scoringScheme, seqHVal, seqVVal);
+    TScoreValue gapExtendV = scoreGapExtendVertical(scoringScheme, seqHVal, seqVVal);
+    TScoreValue gapOpenV = scoreGapOpenVertical(scoringScheme, seqHVal, seqVVal);
+    TSimdVector gapExtendHVec = createVector<TSimdVector>(gapExtendH);
+    TSimdVector gapOpenHVec = createVector<TSimdVector>(gapOpenH);
+    TSimdVector gapExtendVVec = createVector<TSimdVector>(gapExtendV);
+    TSimdVector gapOpenVVec = createVector<TSimdVector>(gapOpenV);
+
+    // ------------------------------------------------------------------------
+    // Allocate the anti-diagonal buffers.
+    // ------------------------------------------------------------------------
+
+    // The scores of the anti-diagonals d - 2, d - 1 and d and the gap scores of the anti-diagonals d - 1 and d,
+    // indexed by the row of the cell.  The padding is written by lanes beyond the end of an anti-diagonal.
+    String<TScoreValue> scoreBuffer[3];
+    String<TScoreValue> horizontalBuffer[2];
+    String<TScoreValue> verticalBuffer[2];
+    for (unsigned k = 0; k < 3; ++k)
+        resize(scoreBuffer[k], colSize + LANES, infValue, Exact());
+    for (unsigned k = 0; k < 2; ++k)
+    {
+        resize(horizontalBuffer[k], colSize + LANES, infValue, Exact());
+        resize(verticalBuffer[k], colSize + LANES, infValue, Exact());
+    }
+
+    TScoreValue * prevPrevScore = begin(scoreBuffer[0], Standard());
+    TScoreValue * prevScore = begin(scoreBuffer[1], Standard());
+    TScoreValue * activeScore = begin(scoreBuffer[2], Standard());
+    TScoreValue * prevHorizontal = begin(horizontalBuffer[0], Standard());
+    TScoreValue * activeHorizontal = begin(horizontalBuffer[1], Standard());
+    TScoreValue * prevVertical = begin(verticalBuffer[0], Standard());
+    TScoreValue * activeVertical = begin(verticalBuffer[1], Standard());
+
+    AntiDiagonalTraceBuffer_<TTraceValue> traceBuffer;
+    if (TRACEBACK)
+        _initAntiDiagonalTraceBuffer(traceBuffer, colSize + LANES);
+    TTraceValue * trace = 0;
+
+    TSimdVector zero = createVector<TSimdVector>(0);
+    TSimdVector laneIndex;
+    for (unsigned k = 0; k < LANES; ++k)
+        laneIndex[k] = k;
+
+    AntiDiagonalScout_<TScoreValue, TPosition> scout;
+
+    // ------------------------------------------------------------------------
+    // Sweep over the anti-diagonals.
+    // ------------------------------------------------------------------------
+
+    for (unsigned diagonal = 0; diagonal <= lenH + lenV; ++diagonal)
+    {
+        // The inner cells with row in [rowBegin, rowEnd).
+        unsigned rowBegin = (diagonal > lenH) ? diagonal - lenH : 1;
+        unsigned rowEnd = (diagonal > lenV) ? lenV + 1 : diagonal;
+        if (TRACEBACK)
+        {
+            if (diagonal - traceBuffer._diagonalBegin == AntiDiagonalTraceBuffer_<TTraceValue>::BLOCK)
+                _flushAntiDiagonalTrace(traceBuffer, begin(dpTraceMatrix, Standard()), lenH, lenV, diagonal);
+            trace = _antiDiagonalTrace(traceBuffer, diagonal);
+        }
+        for (unsigned row = rowBegin; row < rowEnd; row += LANES)
+        {
+            unsigned count = _min(LANES, rowEnd - row);
+
+            TSimdVector score;
+            TSimdVector horizontal = zero;
+            TSimdVector vertical = zero;
+            if (IS_AFFINE)
+                vertical = loadu<TSimdVector>(prevVertical + row - 1);
+            TSimdVector cellTrace = _computeCellSimd(score, horizontal, vertical,
+                                                 loadu<TSimdVector>(prevPrevScore + row - 1),
+                                                 loadu<TSimdVector>(prevScore + row),
+                                                 (IS_AFFINE) ? loadu<TSimdVector>(prevHorizontal + row) : zero,
+                                                 loadu<TSimdVector>(prevScore + row - 1),
+                                                 _antiDiagonalSubstitutionScore(substitution, scoringScheme, seqH,
+                                                                                seqV, diagonal, row, count),
+                                                 gapExtendHVec, gapOpenHVec, gapExtendVVec, gapOpenVVec,
+                                                 TGapModel());
+            if (IS_LOCAL)
+                _clampLocalSimd(score, horizontal, vertical, cellTrace);
+
+            storeu(activeScore + row, score);
+            if (IS_AFFINE)
+            {
+                storeu(activeHorizontal + row, horizontal);
+                storeu(activeVertical + row, vertical);
+            }
+            if (TRACEBACK)
+                for (unsigned k = 0; k < count; ++k)
+                    trace[row + k] = static_cast<TTraceValue>(cellTrace[k]);
+
+            if (IS_LOCAL)
+            {
+                // Ties can only replace the current maximum if it is not the first cell.
+                TSimdVector maxScore = createVector<TSimdVector>(scout._score);
+                TSimdVector cmp = static_cast<TSimdVector>(score > maxScore);
+                if (scout._hostPosition != 0)
+                    cmp |= static_cast<TSimdVector>(score == maxScore);
+                cmp &= static_cast<TSimdVector>(laneIndex < createVector<TSimdVector>(count));
+                if (!testAllZeros(cmp, cmp))
+                    for (unsigned k = 0; k < count; ++k)
+                        if (cmp[k])
+                            _scoutAntiDiagonal(scout, static_cast<TScoreValue>(score[k]),
+                                               static_cast<TScoreValue>(horizontal[k]),
+                                               static_cast<TScoreValue>(vertical[k]),
+                                               (diagonal - row - k) * hostColSize + row + k);
+            }
+        }
+
+        // The cell of the first row.
+        if (diagonal <= lenH)
+        {
+            TTraceValue cellTrace = TraceBitMap_::NONE;
+            if (diagonal == 0)
+            {
+                activeScore[0] = 0;
+                activeHorizontal[0] = activeVertical[0] = (IS_LOCAL) ? 0 : infValue;
+            }
+            else if (FREE_FIRST_ROW)
+            {
+                activeScore[0] = 0;
+                activeHorizontal[0] = prevHorizontal[0];
+                activeVertical[0] = prevVertical[0];
+            }
+            else
+            {
+                cellTrace = _computeAntiDiagonalGapCell(activeScore[0], activeHorizontal[0], prevScore[0],
+                                                        prevHorizontal[0], gapExtendH, gapOpenH,
+                                                        +TraceBitMap_::HORIZONTAL, +TraceBitMap_::HORIZONTAL_OPEN,
+                                                        +TraceBitMap_::MAX_FROM_HORIZONTAL_MATRIX, TGapModel());
+                activeVertical[0] = infValue;
+            }
+            if (TRACEBACK)
+                trace[0] = cellTrace;
+            if (IS_LOCAL)
+                _scoutAntiDiagonal(scout, activeScore[0], activeHorizontal[0], activeVertical[0],
+                                   diagonal * hostColSize);
+        }
+
+        // The cell of the first column.
+        if (diagonal >= 1 && diagonal <= lenV)
+        {
+            TTraceValue cellTrace = TraceBitMap_::NONE;
+            if (FREE_FIRST_COLUMN)
+            {
+                activeScore[diagonal] = 0;
+                activeHorizontal[diagonal] = (IS_LOCAL) ? 0 : infValue;
+                activeVertical[diagonal] = prevVertical[diagonal - 1];
+            }
+            else
+            {
+                cellTrace = _computeAntiDiagonalGapCell(activeScore[diagonal], activeVertical[diagonal],
+                                                        prevScore[diagonal - 1], prevVertical[diagonal - 1],
+                                                        gapExtendV, gapOpenV, +TraceBitMap_::VERTICAL,
+                                                        +TraceBitMap_::VERTICAL_OPEN,
+                                                        +TraceBitMap_::MAX_FROM_VERTICAL_MATRIX, TGapModel());
+                activeHorizontal[diagonal] = infValue;
+            }
+            if (TRACEBACK)
+                trace[diagonal] = cellTrace;
+            if (IS_LOCAL)
+                _scoutAntiDiagonal(scout, activeScore[diagonal], activeHorizontal[diagonal],
+                                   activeVertical[diagonal], static_cast<TPosition>(diagonal));
+        }
+
+        // The tracked cells of the global alignment in the last row and the last column.
+        if (!IS_LOCAL)
+        {
+            if ((FREE_LAST_ROW || diagonal == lenH + lenV) && diagonal >= lenV)
+                _scoutAntiDiagonal(scout, activeScore[lenV], activeHorizontal[lenV], activeVertical[lenV],
+                                   (diagonal - lenV) * hostColSize + lenV);
+            if (FREE_LAST_COLUMN && diagonal >= lenH && diagonal - lenH <= lenV)
+                _scoutAntiDiagonal(scout, activeScore[diagonal - lenH], activeHorizontal[diagonal - lenH],
+                                   activeVertical[diagonal - lenH], lenH * hostColSize + diagonal - lenH);
+        }
+
+        // Rotate the buffers.
+        TScoreValue * tmp = prevPrevScore;
+        prevPrevScore = prevScore;
+        prevScore = activeScore;
+        activeScore = tmp;
+        std::swap(prevHorizontal, activeHorizontal);
+        std::swap(prevVertical, activeVertical);
+    }
+
+    if (TRACEBACK)
+        _flushAntiDiagonalTrace(traceBuffer, begin(dpTraceMatrix, Standard()), lenH, lenV, lenH + lenV + 1);
+
+    _setScoreOfCell(dpScout._maxScore, scout._score);
+    _setHorizontalScoreOfCell(dpScout._maxScore, scout._horizontalScore);
+    _setVerticalScoreOfCell(dpScout._maxScore, scout._verticalScore);
+    dpScout._maxHostPosition = scout._hostPosition;
+}
+
+#endif  // #ifdef SEQAN_SIMD_ENABLED
+
+// ----------------------------------------------------------------------------
+// Function _computeUnbandedAlignmentAntiDiagonal()
+// ----------------------------------------------------------------------------
+
+// Computes the unbanded alignment with the anti-diagonal kernel and returns true, or returns false if the alignment
+// has to be computed by _computeUnbandedAlignment().
+
+// The column-wise algorithm is selected.
+template <typename TDPScout, typename TDPTraceMatrix, typename TSequenceH, typename TSequenceV,
+          typename TScoringScheme, typename TDPProfile>
+inline bool
+_computeUnbandedAlignmentAntiDiagonal(TDPScout & /*dpScout*/,
+                                      TDPTraceMatrix & /*dpTraceMatrix*/,
+                                      TSequenceH const & /*seqH*/,
+                                      TSequenceV const & /*seqV*/,
+                                      TScoringScheme const & /*scoringScheme*/,
+                                      TDPProfile const & /*dpProfile*/,
+                                      Default const & /*kernelTag*/)
+{
+    return false;
+}
+
+#ifdef SEQAN_SIMD_ENABLED
+
+// The alignment is not supported by the kernel, the static assertions of the caller fail.
+template <typename TDPScout, typename TDPTraceMatrix, typename TSequenceH, typename TSequenceV,
+          typename TScoringScheme, typename TDPProfile>
+inline bool
+_computeUnbandedAlignmentAntiDiagonal(TDPScout & /*dpScout*/,
+                                      TDPTraceMatrix & /*dpTraceMatrix*/,
+                                      TSequenceH const & /*seqH*/,
+                                      TSequenceV const & /*seqV*/,
+                                      TScoringScheme const & /*scoringScheme*/,
+                                      TDPProfile const & /*dpProfile*/,
+                                      False const & /*isSupported*/)
+{
+    return false;
+}
+
+template <typename TDPScout, typename TDPTraceMatrix, typename TSequenceH, typename TSequenceV,
+          typename TScoringScheme, typename TDPProfile>
+inline bool
+_computeUnbandedAlignmentAntiDiagonal(TDPScout & dpScout,
+                                      TDPTraceMatrix & dpTraceMatrix,
+                                      TSequenceH const & seqH,
+                                      TSequenceV const & seqV,
+                                      TScoringScheme const & scoringScheme,
+                                      TDPProfile const & dpProfile,
+                                      True const & /*isSupported*/)
+{
+    // Matrices whose host positions do not fit into the unsigned int of the scout are left to the column-wise
+    // algorithm.
+    __uint64 numCells = (static_cast<__uint64>(length(seqH)) + 1) * (static_cast<__uint64>(length(seqV)) + 1);
+    if (numCells > static_cast<__uint64>(MaxValue<unsigned>::VALUE))
+        return false;
+
+    _computeAntiDiagonalAlignment(dpScout, dpTraceMatrix, seqH, seqV, scoringScheme, dpProfile);
+    return true;
+}
+
+#endif  // #ifdef SEQAN_SIMD_ENABLED
+
+// The anti-diagonal kernel is selected.  Without SIMD the column-wise algorithm is used.
+template <typename TDPScout, typename TDPTraceMatrix, typename TSequenceH, typename TSequenceV,
+          typename TScoringScheme, typename TDPProfile>
+inline bool
+_computeUnbandedAlignmentAntiDiagonal(TDPScout & dpScout,
+                                      TDPTraceMatrix & dpTraceMatrix,
+                                      TSequenceH const & seqH,
+                                      TSequenceV const & seqV,
+                                      TScoringScheme const & scoringScheme,
+                                      TDPProfile const & dpProfile,
+                                      AntiDiagonalSimd const & /*kernelTag*/)
+{
+#ifdef SEQAN_SIMD_ENABLED
+    typedef IsAntiDiagonalProfile_<TDPScout, TDPProfile> TIsSupportedProfile;
+    typedef IsSimdSubstitution_<TScoringScheme, TSequenceH, TSequenceV> TIsSupportedScore;
+
+    SEQAN_STATIC_ASSERT_MSG(TIsSupportedProfile::VALUE,
+                            "AntiDiagonalSimd supports global and local alignments with short or int scores, linear "
+                            "or affine gaps and at most one traceback.");
+    SEQAN_STATIC_ASSERT_MSG(TIsSupportedScore::VALUE,
+                            "AntiDiagonalSimd supports Simple scores and score matrices over small alphabets.");
+
+    return _computeUnbandedAlignmentAntiDiagonal(dpScout, dpTraceMatrix, seqH, seqV, scoringScheme, dpProfile,
+                                                 typename And<TIsSupportedProfile, TIsSupportedScore>::Type());
+#else
+    ignoreUnusedVariableWarning(dpScout);
+    ignoreUnusedVariableWarning(dpTraceMatrix);
+    ignoreUnusedVariableWarning(seqH);
+    ignoreUnusedVariableWarning(seqV);
+    ignoreUnusedVariableWarning(scoringScheme);
+    ignoreUnusedVariableWarning(dpProfile);
+    return false;
+#endif  // #ifdef SEQAN_SIMD_ENABLED
+}
+
+}  // namespace seqan
+
+#endif  // #ifndef SEQAN_INCLUDE_SEQAN_ALIGN_DP_ALGORITHM_SIMD_ANTIDIAGONAL_IMPL_H_
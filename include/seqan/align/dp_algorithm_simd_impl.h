@@ -0,0 +1,1000 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2015, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: SeqAn Team <seqan-dev@lists.fu-berlin.de>
+// ==========================================================================
+// Implements the batch version of the dp algorithms.
+//
+// Inter-sequence vectorization:
+// A batch of pairwise alignments is computed by mapping each pair to one
+// lane of a SimdVector. All pairs of one chunk are computed simultaneously
+// within one padded dp matrix whose dimensions are given by the longest
+// horizontal and the longest vertical sequence of the chunk. Since every
+// cell only depends on cells with smaller coordinates the padding never
+// influences the valid part of the matrix of a lane. The cells that are
+// tracked by the scout are selected with masks derived from the individual
+// sequence lengths of each lane.
+//
+// The recursion mirrors the scalar formulas in dp_formula_linear.h and
+// dp_formula_affine.h including the trace values that are written into the
+// trace matrix. Thus, the traceback of a lane is computed by extracting the
+// lane into a scalar DPMatrix_ and running the common _computeTraceback().
+// Scores and alignments are therefore identical to the ones of the scalar
+// implementation.
+//
+// The lane type is the value type of the scoring scheme, e.g. a
+// Score<short> computes 16 alignments at once with AVX2 and 8 with SSE4.
+//
+// Fallback:
+// If SIMD is not enabled, the gap model is not supported by the vectorized
+// kernel, the alphabets are too large for a substitution profile, or the
+// sequence lengths or the possible scores do not fit into the lane type, the
+// batch is computed pair by pair with the scalar implementation while the
+// DPContext is reused for all pairs.
+// ==========================================================================
+
+#ifndef SEQAN_INCLUDE_SEQAN_ALIGN_DP_ALGORITHM_SIMD_IMPL_H_
+#define SEQAN_INCLUDE_SEQAN_ALIGN_DP_ALGORITHM_SIMD_IMPL_H_
+
+namespace seqan {
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Class SimdSubstitution_
+// ----------------------------------------------------------------------------
+
+// Computes the substitution scores of one column for all lanes.
+template <typename TSimdVector, typename TScoringScheme, typename TSpec = void>
+struct SimdSubstitution_;
+
+struct SimdSubstitutionCompare_;
+struct SimdSubstitutionProfile_;
+
+// For other scores we precompute the scores of every character of the horizontal alphabet against the vertical
+// sequences of all lanes.  The scores of a column are then blended together from the profile rows of the characters
+// that occur in the column.
+template <typename TSimdVector, typename TScoringScheme>
+struct SimdSubstitution_<TSimdVector, TScoringScheme, SimdSubstitutionProfile_>
+{
+    String<TSimdVector, Alloc<OverAligned> > _profile;
+    String<TSimdVector, Alloc<OverAligned> > _seqH;
+    String<TSimdVector, Alloc<OverAligned> > _column;
+    unsigned            _colSize;
+};
+
+// For simple scores we compare the ordinal values of both sequences.
+template <typename TSimdVector, typename TScoringScheme>
+struct SimdSubstitution_<TSimdVector, TScoringScheme, SimdSubstitutionCompare_>
+{
+    String<TSimdVector, Alloc<OverAligned> > _seqH;
+    String<TSimdVector, Alloc<OverAligned> > _seqV;
+    TSimdVector         _match;
+    TSimdVector         _mismatch;
+    TSimdVector         _current;
+};
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Metafunction SimdSubstitutionSpec_
+// ----------------------------------------------------------------------------
+
+// Alphabets with at most this many characters use a substitution profile.  Other scores of larger alphabets are not
+// supported by the batch kernel.
+#ifndef SEQAN_SIMD_PROFILE_MAX_VALUE_SIZE
+#define SEQAN_SIMD_PROFILE_MAX_VALUE_SIZE 32
+#endif
+
+template <typename TSeqH, typename TSeqV>
+struct SimdSubstitutionProfileSpec_
+{
+    typedef typename IfC<ValueSize<typename Value<TSeqH>::Type>::VALUE <= SEQAN_SIMD_PROFILE_MAX_VALUE_SIZE &&
+                         ValueSize<typename Value<TSeqV>::Type>::VALUE <= SEQAN_SIMD_PROFILE_MAX_VALUE_SIZE,
+                         SimdSubstitutionProfile_, void>::Type Type;
+};
+
+template <typename TScoringScheme, typename TSeqH, typename TSeqV>
+struct SimdSubstitutionSpec_ : SimdSubstitutionProfileSpec_<TSeqH, TSeqV> {};
+
+template <typename TScoreValue, typename TSeqH, typename TSeqV>
+struct SimdSubstitutionSpec_<Score<TScoreValue, Simple>, TSeqH, TSeqV>
+{
+    typedef typename If<IsSameType<typename Value<TSeqH>::Type, typename Value<TSeqV>::Type>,
+                        SimdSubstitutionCompare_,
+                        typename SimdSubstitutionProfileSpec_<TSeqH, TSeqV>::Type>::Type Type;
+};
+
+// ----------------------------------------------------------------------------
+// Metafunction IsSimdSubstitution_
+// ----------------------------------------------------------------------------
+
+// The batch kernel needs a vectorized substitution for the scoring scheme and the alphabets.
+template <typename TScoringScheme, typename TSeqH, typename TSeqV>
+struct IsSimdSubstitution_ :
+    Not<IsSameType<typename SimdSubstitutionSpec_<TScoringScheme, TSeqH, TSeqV>::Type, void> > {};
+
+// ----------------------------------------------------------------------------
+// Metafunction IsSimdGapModel_
+// ----------------------------------------------------------------------------
+
+// The vectorized kernel supports linear and affine gap costs.
+template <typename TGapModel>
+struct IsSimdGapModel_ : False {};
+
+template <>
+struct IsSimdGapModel_<LinearGaps> : True {};
+
+template <>
+struct IsSimdGapModel_<AffineGaps> : True {};
+
+// ----------------------------------------------------------------------------
+// Metafunction IsSimdScoreValue_
+// ----------------------------------------------------------------------------
+
+// The score types that are computed in the lanes of a SimdVector.
+template <typename TScoreValue>
+struct IsSimdScoreValue_ : False {};
+
+template <>
+struct IsSimdScoreValue_<short> : True {};
+
+template <>
+struct IsSimdScoreValue_<int> : True {};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+#ifdef SEQAN_SIMD_ENABLED
+
+// ----------------------------------------------------------------------------
+// Function _initSimdSubstitution()
+// ----------------------------------------------------------------------------
+
+template <typename TSimdVector, typename TScoringScheme, typename TSetH, typename TSetV, typename TPos>
+inline void
+_initSimdSubstitution(SimdSubstitution_<TSimdVector, TScoringScheme, SimdSubstitutionProfile_> & sub,
+                      TScoringScheme const & scoringScheme,
+                      TSetH const & setH,
+                      TSetV const & setV,
+                      TPos chunkBegin,
+                      unsigned lanes,
+                      unsigned maxLenH,
+                      unsigned maxLenV)
+{
+    typedef typename Value<TSimdVector>::Type TValue;
+    typedef typename Value<typename Value<TSetH const>::Type>::Type TValueH;
+
+    const unsigned SIGMA = ValueSize<TValueH>::VALUE;
+
+    sub._colSize = maxLenV + 1;
+    resize(sub._column, sub._colSize, createVector<TSimdVector>(0), Exact());
+    resize(sub._profile, SIGMA * sub._colSize, createVector<TSimdVector>(0), Exact());
+    // Padded positions get an invalid character.  They never influence a valid cell.
+    resize(sub._seqH, maxLenH, createVector<TSimdVector>(-1), Exact());
+    for (unsigned lane = 0; lane < lanes; ++lane)
+    {
+        typename Reference<TSetH const>::Type seqH = value(setH, chunkBegin + lane);
+        typename Reference<TSetV const>::Type seqV = value(setV, chunkBegin + lane);
+        for (unsigned j = 0; j < length(seqH); ++j)
+            sub._seqH[j][lane] = static_cast<TValue>(ordValue(seqH[j]));
+        for (unsigned c = 0; c < SIGMA; ++c)
+        {
+            TSimdVector * profile = begin(sub._profile, Standard()) + c * sub._colSize;
+            for (unsigned i = 0; i < length(seqV); ++i)
+                profile[i + 1][lane] = static_cast<TValue>(score(scoringScheme, TValueH(c), seqV[i]));
+        }
+    }
+}
+
+template <typename TSimdVector, typename TScoringScheme, typename TSetH, typename TSetV, typename TPos>
+inline void
+_initSimdSubstitution(SimdSubstitution_<TSimdVector, TScoringScheme, SimdSubstitutionCompare_> & sub,
+                      TScoringScheme const & scoringScheme,
+                      TSetH const & setH,
+                      TSetV const & setV,
+                      TPos chunkBegin,
+                      unsigned lanes,
+                      unsigned maxLenH,
+                      unsigned maxLenV)
+{
+    typedef typename Value<TSimdVector>::Type TValue;
+
+    fillVector(sub._match, scoreMatch(scoringScheme));
+    fillVector(sub._mismatch, scoreMismatch(scoringScheme));
+
+    // Padded positions get different values in both sequences. They never influence a valid cell.
+    resize(sub._seqH, maxLenH, createVector<TSimdVector>(-1), Exact());
+    resize(sub._seqV, maxLenV, createVector<TSimdVector>(-2), Exact());
+    for (unsigned lane = 0; lane < lanes; ++lane)
+    {
+        typename Reference<TSetH const>::Type seqH = value(setH, chunkBegin + lane);
+        typename Reference<TSetV const>::Type seqV = value(setV, chunkBegin + lane);
+        for (unsigned j = 0; j < length(seqH); ++j)
+            sub._seqH[j][lane] = static_cast<TValue>(ordValue(seqH[j]));
+        for (unsigned i = 0; i < length(seqV); ++i)
+            sub._seqV[i][lane] = static_cast<TValue>(ordValue(seqV[i]));
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _setSimdSubstitutionColumn()
+// ----------------------------------------------------------------------------
+
+// Prepares the substitution scores for the given column (column > 0).
+template <typename TSimdVector, typename TScoringScheme, typename TSetH, typename TSetV, typename TPos>
+inline void
+_setSimdSubstitutionColumn(SimdSubstitution_<TSimdVector, TScoringScheme, SimdSubstitutionProfile_> & sub,
+                           TScoringScheme const & /*scoringScheme*/,
+                           TSetH const & /*setH*/,
+                           TSetV const & /*setV*/,
+                           TPos /*chunkBegin*/,
+                           unsigned lanes,
+                           unsigned column)
+{
+    typedef typename Value<typename Value<TSetH const>::Type>::Type TValueH;
+
+    const unsigned SIGMA = ValueSize<TValueH>::VALUE;
+
+    // Collect the characters of the column, each one is blended in once.
+    TSimdVector current = sub._seqH[column - 1];
+    bool seen[SIGMA];
+    for (unsigned c = 0; c < SIGMA; ++c)
+        seen[c] = false;
+    for (unsigned lane = 0; lane < lanes; ++lane)
+        if (current[lane] >= 0)
+            seen[current[lane]] = true;
+
+    TSimdVector * columnBegin = begin(sub._column, Standard());
+    TSimdVector * columnEnd = columnBegin + sub._colSize;
+    bool first = true;
+    for (unsigned c = 0; c < SIGMA; ++c)
+    {
+        if (!seen[c])
+            continue;
+        TSimdVector const * profile = begin(sub._profile, Standard()) + c * sub._colSize;
+        if (first)
+        {
+            arrayCopyForward(profile, profile + sub._colSize, columnBegin);
+            first = false;
+            continue;
+        }
+        TSimdVector cmp = static_cast<TSimdVector>(current == createVector<TSimdVector>(c));
+        for (TSimdVector * it = columnBegin; it != columnEnd; ++it, ++profile)
+            *it = blend(*it, *profile, cmp);
+    }
+}
+
+template <typename TSimdVector, typename TScoringScheme, typename TSetH, typename TSetV, typename TPos>
+inline void
+_setSimdSubstitutionColumn(SimdSubstitution_<TSimdVector, TScoringScheme, SimdSubstitutionCompare_> & sub,
+                           TScoringScheme const & /*scoringScheme*/,
+                           TSetH const & /*setH*/,
+                           TSetV const & /*setV*/,
+                           TPos /*chunkBegin*/,
+                           unsigned /*lanes*/,
+                           unsigned column)
+{
+    sub._current = sub._seqH[column - 1];
+}
+
+// ----------------------------------------------------------------------------
+// Function _simdSubstitutionScore()
+// ----------------------------------------------------------------------------
+
+// Returns the substitution scores of the given row (row > 0) in the current column.
+template <typename TSimdVector, typename TScoringScheme>
+inline TSimdVector
+_simdSubstitutionScore(SimdSubstitution_<TSimdVector, TScoringScheme, SimdSubstitutionProfile_> const & sub,
+                       unsigned row)
+{
+    return sub._column[row];
+}
+
+template <typename TSimdVector, typename TScoringScheme>
+inline TSimdVector
+_simdSubstitutionScore(SimdSubstitution_<TSimdVector, TScoringScheme, SimdSubstitutionCompare_> const & sub,
+                       unsigned row)
+{
+    return blend(sub._mismatch, sub._match, static_cast<TSimdVector>(sub._current == sub._seqV[row - 1]));
+}
+
+// ----------------------------------------------------------------------------
+// Function _maxSimdScoreStep()
+// ----------------------------------------------------------------------------
+
+// Returns the largest absolute score difference between a cell and its predecessor in the dp matrix.
+template <typename TScoringScheme, typename TValueH, typename TValueV>
+inline __int64
+_maxSimdGapScoreStep(TScoringScheme const & scoringScheme, TValueH const & valH, TValueV const & valV)
+{
+    __int64 step = _abs(static_cast<__int64>(scoreGapOpenHorizontal(scoringScheme, valH, valV)));
+    step = _max(step, _abs(static_cast<__int64>(scoreGapExtendHorizontal(scoringScheme, valH, valV))));
+    step = _max(step, _abs(static_cast<__int64>(scoreGapOpenVertical(scoringScheme, valH, valV))));
+    return _max(step, _abs(static_cast<__int64>(scoreGapExtendVertical(scoringScheme, valH, valV))));
+}
+
+template <typename TScoringScheme, typename TValueH, typename TValueV>
+inline __int64
+_maxSimdScoreStep(TScoringScheme const & scoringScheme, TValueH const & valH, TValueV const & valV)
+{
+    __int64 step = _maxSimdGapScoreStep(scoringScheme, valH, valV);
+    for (unsigned c = 0; c < ValueSize<TValueH>::VALUE; ++c)
+        for (unsigned d = 0; d < ValueSize<TValueV>::VALUE; ++d)
+            step = _max(step, _abs(static_cast<__int64>(score(scoringScheme, TValueH(c), TValueV(d)))));
+    return step;
+}
+
+template <typename TScoreValue, typename TValueH, typename TValueV>
+inline __int64
+_maxSimdScoreStep(Score<TScoreValue, Simple> const & scoringScheme, TValueH const & valH, TValueV const & valV)
+{
+    __int64 step = _maxSimdGapScoreStep(scoringScheme, valH, valV);
+    step = _max(step, _abs(static_cast<__int64>(scoreMatch(scoringScheme))));
+    return _max(step, _abs(static_cast<__int64>(scoreMismatch(scoringScheme))));
+}
+
+// ----------------------------------------------------------------------------
+// Function _scoutBestScoreSimd()
+// ----------------------------------------------------------------------------
+
+// Stores the cells of all lanes in mask whose score is better than the current maximum.
+template <typename TSimdVector, typename TLanePos>
+inline void
+_scoutBestScoreSimd(TSimdVector & maxScore,
+                    TSimdVector & maxHorizontal,
+                    TSimdVector & maxVertical,
+                    TLanePos & maxColumn,
+                    TLanePos & maxRow,
+                    TSimdVector const & mask,
+                    TSimdVector const & score,
+                    TSimdVector const & horizontal,
+                    TSimdVector const & vertical,
+                    unsigned column,
+                    unsigned row)
+{
+    TSimdVector cmp = mask & static_cast<TSimdVector>(score > maxScore);
+    if (testAllZeros(cmp, cmp))
+        return;
+
+    maxScore = blend(maxScore, score, cmp);
+    maxHorizontal = blend(maxHorizontal, horizontal, cmp);
+    maxVertical = blend(maxVertical, vertical, cmp);
+    for (unsigned lane = 0; lane < LENGTH<TSimdVector>::VALUE; ++lane)
+        if (cmp[lane])
+        {
+            maxColumn[lane] = column;
+            maxRow[lane] = row;
+        }
+}
+
+// ----------------------------------------------------------------------------
+// Function _computeCellSimd()                                     [LinearGaps]
+// ----------------------------------------------------------------------------
+
+// Computes an inner cell, see _doComputeScore() [RecursionDirectionAll, LinearGaps].
+template <typename TSimdVector>
+inline TSimdVector
+_computeCellSimd(TSimdVector & activeScore,
+                 TSimdVector & /*activeHorizontal*/,
+                 TSimdVector & /*activeVertical*/,
+                 TSimdVector const & prevDiagonal,
+                 TSimdVector const & prevHorizontal,
+                 TSimdVector const & /*prevHorizontalGap*/,
+                 TSimdVector const & prevVertical,
+                 TSimdVector const & substitution,
+                 TSimdVector const & gapExtendH,
+                 TSimdVector const & /*gapOpenH*/,
+                 TSimdVector const & gapExtendV,
+                 TSimdVector const & /*gapOpenV*/,
+                 LinearGaps const &)
+{
+    activeScore = prevDiagonal + substitution;
+    TSimdVector trace = createVector<TSimdVector>(+TraceBitMap_::DIAGONAL);
+
+    TSimdVector tmp = prevVertical + gapExtendV;
+    TSimdVector cmp = static_cast<TSimdVector>(activeScore < tmp);
+    activeScore = blend(activeScore, tmp, cmp);
+    trace = blend(trace, createVector<TSimdVector>(TraceBitMap_::VERTICAL | TraceBitMap_::MAX_FROM_VERTICAL_MATRIX),
+                  cmp);
+
+    tmp = prevHorizontal + gapExtendH;
+    cmp = static_cast<TSimdVector>(activeScore < tmp);
+    activeScore = blend(activeScore, tmp, cmp);
+    return blend(trace, createVector<TSimdVector>(TraceBitMap_::HORIZONTAL | TraceBitMap_::MAX_FROM_HORIZONTAL_MATRIX),
+                 cmp);
+}
+
+// ----------------------------------------------------------------------------
+// Function _computeCellSimd()                                     [AffineGaps]
+// ----------------------------------------------------------------------------
+
+// Computes an inner cell, see _doComputeScore() [RecursionDirectionAll, AffineGaps].
+template <typename TSimdVector>
+inline TSimdVector
+_computeCellSimd(TSimdVector & activeScore,
+                 TSimdVector & activeHorizontal,
+                 TSimdVector & activeVertical,
+                 TSimdVector const & prevDiagonal,
+                 TSimdVector const & prevHorizontal,
+                 TSimdVector const & prevHorizontalGap,
+                 TSimdVector const & prevVertical,
+                 TSimdVector const & substitution,
+                 TSimdVector const & gapExtendH,
+                 TSimdVector const & gapOpenH,
+                 TSimdVector const & gapExtendV,
+                 TSimdVector const & gapOpenV,
+                 AffineGaps const &)
+{
+    activeHorizontal = prevHorizontalGap + gapExtendH;
+    TSimdVector tmp = prevHorizontal + gapOpenH;
+    TSimdVector cmp = static_cast<TSimdVector>(activeHorizontal < tmp);
+    activeHorizontal = blend(activeHorizontal, tmp, cmp);
+    TSimdVector traceGap = blend(createVector<TSimdVector>(+TraceBitMap_::HORIZONTAL),
+                                 createVector<TSimdVector>(+TraceBitMap_::HORIZONTAL_OPEN), cmp);
+
+    activeVertical = activeVertical + gapExtendV;
+    tmp = prevVertical + gapOpenV;
+    cmp = static_cast<TSimdVector>(activeVertical < tmp);
+    activeVertical = blend(activeVertical, tmp, cmp);
+    traceGap |= blend(createVector<TSimdVector>(+TraceBitMap_::VERTICAL),
+                      createVector<TSimdVector>(+TraceBitMap_::VERTICAL_OPEN), cmp);
+
+    cmp = static_cast<TSimdVector>(activeVertical < activeHorizontal);
+    activeScore = blend(activeVertical, activeHorizontal, cmp);
+    TSimdVector traceMax = blend(createVector<TSimdVector>(+TraceBitMap_::MAX_FROM_VERTICAL_MATRIX),
+                                 createVector<TSimdVector>(+TraceBitMap_::MAX_FROM_HORIZONTAL_MATRIX), cmp);
+
+    tmp = prevDiagonal + substitution;
+    cmp = static_cast<TSimdVector>(activeScore <= tmp);
+    activeScore = blend(activeScore, tmp, cmp);
+    return blend(traceGap | traceMax, traceGap | createVector<TSimdVector>(+TraceBitMap_::DIAGONAL), cmp);
+}
+
+// ----------------------------------------------------------------------------
+// Function _computeGapCellSimd()
+// ----------------------------------------------------------------------------
+
+// Computes a cell of the first row or the first column, where only one gap direction is possible.
+// See _doComputeScore() [RecursionDirectionHorizontal] and [RecursionDirectionVertical].
+template <typename TSimdVector>
+inline TSimdVector
+_computeGapCellSimd(TSimdVector & activeScore,
+                    TSimdVector & activeGap,
+                    TSimdVector prevScore,
+                    TSimdVector prevGap,
+                    TSimdVector const & gapExtend,
+                    TSimdVector const & /*gapOpen*/,
+                    typename TraceBitMap_::TTraceValue gapTrace,
+                    typename TraceBitMap_::TTraceValue /*gapOpenTrace*/,
+                    typename TraceBitMap_::TTraceValue maxTrace,
+                    LinearGaps const &)
+{
+    activeGap = prevGap;
+    activeScore = prevScore + gapExtend;
+    return createVector<TSimdVector>(gapTrace | maxTrace);
+}
+
+template <typename TSimdVector>
+inline TSimdVector
+_computeGapCellSimd(TSimdVector & activeScore,
+                    TSimdVector & activeGap,
+                    TSimdVector prevScore,
+                    TSimdVector prevGap,
+                    TSimdVector const & gapExtend,
+                    TSimdVector const & gapOpen,
+                    typename TraceBitMap_::TTraceValue gapTrace,
+                    typename TraceBitMap_::TTraceValue gapOpenTrace,
+                    typename TraceBitMap_::TTraceValue maxTrace,
+                    AffineGaps const &)
+{
+    activeGap = prevGap + gapExtend;
+    TSimdVector tmp = prevScore + gapOpen;
+    TSimdVector cmp = static_cast<TSimdVector>(activeGap < tmp);
+    activeGap = blend(activeGap, tmp, cmp);
+    activeScore = activeGap;
+    return blend(createVector<TSimdVector>(gapTrace), createVector<TSimdVector>(gapOpenTrace), cmp) |
+           createVector<TSimdVector>(maxTrace);
+}
+
+// ----------------------------------------------------------------------------
+// Function _clampLocalSimd()
+// ----------------------------------------------------------------------------
+
+// Implements the local alignment case of _computeScore().
+template <typename TSimdVector>
+inline void
+_clampLocalSimd(TSimdVector & activeScore,
+                TSimdVector & activeHorizontal,
+                TSimdVector & activeVertical,
+                TSimdVector & trace)
+{
+    TSimdVector zero = createVector<TSimdVector>(0);
+    TSimdVector cmp = static_cast<TSimdVector>(activeScore <= zero);
+    activeScore = blend(activeScore, zero, cmp);
+    activeHorizontal = blend(activeHorizontal, zero, cmp);
+    activeVertical = blend(activeVertical, zero, cmp);
+    trace = blend(trace, zero, cmp);
+}
+
+// ----------------------------------------------------------------------------
+// Function _computeAlignmentSimdChunk()
+// ----------------------------------------------------------------------------
+
+// Computes the alignments [chunkBegin, chunkBegin + lanes) of the batch in the lanes of one SimdVector.
+template <typename TScoreValue, typename TTraceSegments, typename TSetH, typename TSetV, typename TPos,
+          typename TScoringScheme, typename TAlgorithm, typename TGapModel, typename TTraceFlag>
+inline void
+_computeAlignmentSimdChunk(String<TScoreValue> & scores,
+                           TTraceSegments & traces,
+                           TSetH const & setH,
+                           TSetV const & setV,
+                           TPos chunkBegin,
+                           unsigned lanes,
+                           TScoringScheme const & scoringScheme,
+                           DPProfile_<TAlgorithm, TGapModel, TTraceFlag> const & dpProfile)
+{
+    typedef typename SimdVector<TScoreValue>::Type TSimdVector;
+    typedef DPProfile_<TAlgorithm, TGapModel, TTraceFlag> TDPProfile;
+    typedef typename TraceBitMap_::TTraceValue TTraceValue;
+    typedef typename Value<TSetH const>::Type TSeqH;
+    typedef typename Value<TSetV const>::Type TSeqV;
+    typedef SimdSubstitution_<TSimdVector, TScoringScheme,
+                              typename SimdSubstitutionSpec_<TScoringScheme, TSeqH, TSeqV>::Type> TSubstitution;
+
+    const bool IS_LOCAL = IsLocalAlignment_<TDPProfile>::VALUE;
+    const bool IS_AFFINE = IsSameType<TGapModel, AffineGaps>::VALUE;
+    const bool FREE_FIRST_ROW = IS_LOCAL || IsFreeEndGap_<TDPProfile, DPFirstRow>::VALUE;
+    const bool FREE_FIRST_COLUMN = IS_LOCAL || IsFreeEndGap_<TDPProfile, DPFirstColumn>::VALUE;
+    const bool FREE_LAST_ROW = IsFreeEndGap_<TDPProfile, DPLastRow>::VALUE;
+    const bool FREE_LAST_COLUMN = IsFreeEndGap_<TDPProfile, DPLastColumn>::VALUE;
+    const bool TRACEBACK = IsTracebackEnabled_<TTraceFlag>::VALUE;
+    const unsigned LANES = LENGTH<TSimdVector>::VALUE;
+
+    // ------------------------------------------------------------------------
+    // Collect the lane dimensions.
+    // ------------------------------------------------------------------------
+
+    TSimdVector lenH = createVector<TSimdVector>(0);
+    TSimdVector lenV = createVector<TSimdVector>(0);
+    unsigned maxLenH = 0;
+    unsigned maxLenV = 0;
+    for (unsigned lane = 0; lane < lanes; ++lane)
+    {
+        lenH[lane] = length(value(setH, chunkBegin + lane));
+        lenV[lane] = length(value(setV, chunkBegin + lane));
+        maxLenH = _max(maxLenH, static_cast<unsigned>(length(value(setH, chunkBegin + lane))));
+        maxLenV = _max(maxLenV, static_cast<unsigned>(length(value(setV, chunkBegin + lane))));
+    }
+    // Unused lanes get an empty matrix that is never tracked.
+    for (unsigned lane = lanes; lane < LANES; ++lane)
+        lenH[lane] = lenV[lane] = -1;
+
+    unsigned colSize = maxLenV + 1;
+
+    // Per row masks for the valid part of the lane and for the last row of the lane.
+    String<TSimdVector, Alloc<OverAligned> > rowValid;
+    String<TSimdVector, Alloc<OverAligned> > rowLast;
+    resize(rowValid, colSize, Exact());
+    resize(rowLast, colSize, Exact());
+    for (unsigned row = 0; row < colSize; ++row)
+    {
+        TSimdVector pos = createVector<TSimdVector>(row);
+        rowValid[row] = static_cast<TSimdVector>(pos <= lenV);
+        rowLast[row] = static_cast<TSimdVector>(pos == lenV);
+    }
+
+    TSubstitution substitution;
+    _initSimdSubstitution(substitution, scoringScheme, setH, setV, chunkBegin, lanes, maxLenH, maxLenV);
+
+    TScoreValue infValue = DPCellDefaultInfinity<DPCell_<TScoreValue, TGapModel> >::VALUE;
+    TSimdVector infinity = createVector<TSimdVector>(infValue);
+    // The vectorized kernel assumes that the gap costs do not depend on the sequence positions.
+    typename Value<TSeqH>::Type seqHVal = typename Value<TSeqH>::Type();
+    typename Value<TSeqV>::Type seqVVal = typename Value<TSeqV>::Type();
+    TSimdVector gapExtendH = createVector<TSimdVector>(scoreGapExtendHorizontal(scoringScheme, seqHVal, seqVVal));
+    TSimdVector gapOpenH = createVector<TSimdVector>(scoreGapOpenHorizontal(scoringScheme, seqHVal, seqVVal));
+    TSimdVector gapExtendV = createVector<TSimdVector>(scoreGapExtendVertical(scoringScheme, seqHVal, seqVVal));
+    TSimdVector gapOpenV = createVector<TSimdVector>(scoreGapOpenVertical(scoringScheme, seqHVal, seqVVal));
+
+    // ------------------------------------------------------------------------
+    // Allocate the column buffers and the trace matrix.
+    // ------------------------------------------------------------------------
+
+    // The score and horizontal gap values of the previous column, overwritten while the current column is computed.
+    String<TSimdVector, Alloc<OverAligned> > columnScore;
+    String<TSimdVector, Alloc<OverAligned> > columnHorizontal;
+    resize(columnScore, colSize, Exact());
+    if (IS_AFFINE)
+        resize(columnHorizontal, colSize, infinity, Exact());
+    else
+        resize(columnHorizontal, colSize, createVector<TSimdVector>(0), Exact());
+
+    String<TSimdVector, Alloc<OverAligned> > traceMatrix;
+    if (TRACEBACK)
+        resize(traceMatrix, (maxLenH + 1) * colSize, Exact());
+
+    TSimdVector maxScore = infinity;
+    TSimdVector maxHorizontal = infinity;
+    TSimdVector maxVertical = infinity;
+    String<unsigned> maxColumn;
+    String<unsigned> maxRow;
+    resize(maxColumn, LANES, 0, Exact());
+    resize(maxRow, LANES, 0, Exact());
+
+    TSimdVector zero = createVector<TSimdVector>(0);
+    TSimdVector allOnes = createVector<TSimdVector>(-1);
+    TSimdVector trace;
+    TSimdVector activeVertical;
+
+    // ------------------------------------------------------------------------
+    // Compute the initial column.
+    // ------------------------------------------------------------------------
+
+    {
+        TSimdVector colLast = static_cast<TSimdVector>(zero == lenH);
+        TSimdVector colTrack = (IS_LOCAL) ? allOnes : static_cast<TSimdVector>((FREE_LAST_COLUMN) ? colLast : zero);
+        TSimdVector rowTrack = (IS_LOCAL || FREE_LAST_ROW) ? allOnes : colLast;
+
+        // The first cell.
+        TSimdVector activeScore = zero;
+        activeVertical = (IS_LOCAL) ? zero : infinity;
+        columnScore[0] = activeScore;
+        columnHorizontal[0] = (IS_LOCAL) ? zero : columnHorizontal[0];
+        if (TRACEBACK)
+            traceMatrix[0] = zero;
+        _scoutBestScoreSimd(maxScore, maxHorizontal, maxVertical, maxColumn, maxRow,
+                            (colTrack & rowValid[0]) | (rowTrack & rowLast[0]),
+                            activeScore, columnHorizontal[0], activeVertical, 0u, 0u);
+
+        // The remaining cells.
+        for (unsigned row = 1; row < colSize; ++row)
+        {
+            if (FREE_FIRST_COLUMN)
+            {
+                activeScore = zero;
+                trace = zero;
+            }
+            else
+            {
+                trace = _computeGapCellSimd(activeScore, activeVertical, activeScore, activeVertical,
+                                            gapExtendV, gapOpenV, +TraceBitMap_::VERTICAL,
+                                            +TraceBitMap_::VERTICAL_OPEN, +TraceBitMap_::MAX_FROM_VERTICAL_MATRIX,
+                                            TGapModel());
+            }
+            columnScore[row] = activeScore;
+            if (IS_LOCAL)
+                columnHorizontal[row] = zero;
+            if (TRACEBACK)
+                traceMatrix[row] = trace;
+
+            _scoutBestScoreSimd(maxScore, maxHorizontal, maxVertical, maxColumn, maxRow,
+                                (colTrack & rowValid[row]) | (rowTrack & rowLast[row]),
+                                activeScore, columnHorizontal[row], activeVertical, 0u, row);
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    // Compute the remaining columns.
+    // ------------------------------------------------------------------------
+
+    for (unsigned column = 1; column <= maxLenH; ++column)
+    {
+        TSimdVector pos = createVector<TSimdVector>(column);
+        TSimdVector colValid = static_cast<TSimdVector>(pos <= lenH);
+        TSimdVector colLast = static_cast<TSimdVector>(pos == lenH);
+        TSimdVector colTrack = (IS_LOCAL) ? colValid : static_cast<TSimdVector>((FREE_LAST_COLUMN) ? colLast : zero);
+        TSimdVector rowTrack = (IS_LOCAL) ? colValid : static_cast<TSimdVector>((FREE_LAST_ROW) ? colValid : colLast);
+
+        _setSimdSubstitutionColumn(substitution, scoringScheme, setH, setV, chunkBegin, lanes, column);
+
+        TSimdVector * traceColumn = (TRACEBACK) ? begin(traceMatrix, Standard()) + column * colSize : 0;
+
+        // The first cell.
+        TSimdVector prevDiagonal = columnScore[0];
+        TSimdVector activeScore;
+        TSimdVector activeHorizontal;
+        if (FREE_FIRST_ROW)
+        {
+            activeScore = zero;
+            activeHorizontal = columnHorizontal[0];
+            activeVertical = (IS_LOCAL) ? zero : infinity;
+            trace = zero;
+            if (IS_LOCAL)
+                activeHorizontal = zero;
+        }
+        else
+        {
+            trace = _computeGapCellSimd(activeScore, activeHorizontal, columnScore[0], columnHorizontal[0],
+                                        gapExtendH, gapOpenH, +TraceBitMap_::HORIZONTAL,
+                                        +TraceBitMap_::HORIZONTAL_OPEN, +TraceBitMap_::MAX_FROM_HORIZONTAL_MATRIX,
+                                        TGapModel());
+            activeVertical = infinity;
+        }
+        columnScore[0] = activeScore;
+        columnHorizontal[0] = activeHorizontal;
+        if (TRACEBACK)
+            traceColumn[0] = trace;
+        _scoutBestScoreSimd(maxScore, maxHorizontal, maxVertical, maxColumn, maxRow,
+                            (colTrack & rowValid[0]) | (rowTrack & rowLast[0]),
+                            activeScore, activeHorizontal, activeVertical, column, 0u);
+
+        // The inner cells and the last cell.
+        for (unsigned row = 1; row < colSize; ++row)
+        {
+            TSimdVector prevHorizontal = columnScore[row];
+            trace = _computeCellSimd(activeScore, activeHorizontal, activeVertical, prevDiagonal, prevHorizontal,
+                                     columnHorizontal[row], columnScore[row - 1],
+                                     _simdSubstitutionScore(substitution, row), gapExtendH, gapOpenH, gapExtendV,
+                                     gapOpenV, TGapModel());
+            if (IS_LOCAL)
+                _clampLocalSimd(activeScore, activeHorizontal, activeVertical, trace);
+
+            prevDiagonal = prevHorizontal;
+            columnScore[row] = activeScore;
+            columnHorizontal[row] = activeHorizontal;
+            if (TRACEBACK)
+                traceColumn[row] = trace;
+
+            _scoutBestScoreSimd(maxScore, maxHorizontal, maxVertical, maxColumn, maxRow,
+                                (colTrack & rowValid[row]) | (rowTrack & rowLast[row]),
+                                activeScore, activeHorizontal, activeVertical, column, row);
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    // Write back the scores and compute the traceback for each lane.
+    // ------------------------------------------------------------------------
+
+    for (unsigned lane = 0; lane < lanes; ++lane)
+        scores[chunkBegin + lane] = maxScore[lane];
+
+    if (!TRACEBACK)
+        return;
+
+    typedef DPMatrix_<TTraceValue, FullDPMatrix> TDPTraceMatrix;
+    typedef DPMatrixNavigator_<TDPTraceMatrix, DPTraceMatrix<TTraceFlag>, NavigateColumnWise> TDPTraceMatrixNavigator;
+    typedef DPCell_<TScoreValue, TGapModel> TDPCell;
+    typedef DPScout_<TDPCell, Default> TDPScout;
+
+    TDPTraceMatrix laneTraceMatrix;
+    for (unsigned lane = 0; lane < lanes; ++lane)
+    {
+        typename Reference<TSetH const>::Type seqH = value(setH, chunkBegin + lane);
+        typename Reference<TSetV const>::Type seqV = value(setV, chunkBegin + lane);
+        unsigned laneColSize = length(seqV) + 1;
+
+        setLength(laneTraceMatrix, +DPMatrixDimension_::HORIZONTAL, length(seqH) + 1);
+        setLength(laneTraceMatrix, +DPMatrixDimension_::VERTICAL, laneColSize);
+        resize(laneTraceMatrix);
+
+        for (unsigned column = 0; column <= length(seqH); ++column)
+            for (unsigned row = 0; row < laneColSize; ++row)
+                value(laneTraceMatrix, column * laneColSize + row) =
+                    static_cast<TTraceValue>(traceMatrix[column * colSize + row][lane]);
+
+        TDPTraceMatrixNavigator navigator;
+        _init(navigator, laneTraceMatrix, DPBandConfig<BandOff>());
+
+        TDPScout scout;
+        _setScoreOfCell(scout._maxScore, static_cast<TScoreValue>(maxScore[lane]));
+        _setHorizontalScoreOfCell(scout._maxScore, static_cast<TScoreValue>(maxHorizontal[lane]));
+        _setVerticalScoreOfCell(scout._maxScore, static_cast<TScoreValue>(maxVertical[lane]));
+        scout._maxHostPosition = maxColumn[lane] * laneColSize + maxRow[lane];
+
+        if (IsSingleTrace_<TTraceFlag>::VALUE)
+            _correctTraceValue(navigator, scout);
+        _computeTraceback(value(traces, chunkBegin + lane), navigator, scout, seqH, seqV, DPBandConfig<BandOff>(),
+                          dpProfile);
+    }
+}
+
+#endif  // #ifdef SEQAN_SIMD_ENABLED
+
+// ----------------------------------------------------------------------------
+// Function _computeAlignmentBatchScalar()
+// ----------------------------------------------------------------------------
+
+// Computes all alignments of the batch one after another using the scalar implementation.
+template <typename TScoreValue, typename TTraceSegments, typename TSetH, typename TSetV, typename TScoringScheme,
+          typename TDPType, typename TBand, typename TFreeEndGaps, typename TTraceConfig, typename TGapModel>
+inline void
+_computeAlignmentBatchScalar(String<TScoreValue> & scores,
+                             TTraceSegments & traces,
+                             TSetH const & setH,
+                             TSetV const & setV,
+                             TScoringScheme const & scoringScheme,
+                             AlignConfig2<TDPType, TBand, TFreeEndGaps, TTraceConfig> const & alignConfig,
+                             TGapModel const & /*gapModel*/)
+{
+    typedef typename Size<TSetH>::Type TSize;
+
+    // The dp context is shared by all alignments of the batch to reuse the allocated matrices.
+    DPContext<TScoreValue, TGapModel> dpContext;
+    for (TSize i = 0; i < length(setH); ++i)
+    {
+        // Cells computed with the zero recursion do not overwrite their gap scores, so the score matrix of the
+        // previous alignment is reset while keeping its memory.
+        clear(getDpScoreMatrix(dpContext));
+
+        DPScoutState_<Default> dpScoutState;
+        scores[i] = _setUpAndRunAlignment(dpContext, value(traces, i), dpScoutState, value(setH, i), value(setV, i),
+                                          scoringScheme, alignConfig);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _computeAlignmentBatch()
+// ----------------------------------------------------------------------------
+
+// The gap model, the score type or the scoring scheme is not supported by the vectorized kernel.
+template <typename TScoreValue, typename TTraceSegments, typename TSetH, typename TSetV, typename TScoringScheme,
+          typename TAlignConfig, typename TGapModel>
+inline void
+_computeAlignmentBatch(String<TScoreValue> & scores,
+                       TTraceSegments & traces,
+                       TSetH const & setH,
+                       TSetV const & setV,
+                       TScoringScheme const & scoringScheme,
+                       TAlignConfig const & alignConfig,
+                       TGapModel const & gapModel,
+                       False const & /*isSimdGapModel*/)
+{
+    _computeAlignmentBatchScalar(scores, traces, setH, setV, scoringScheme, alignConfig, gapModel);
+}
+
+template <typename TScoreValue, typename TTraceSegments, typename TSetH, typename TSetV, typename TScoringScheme,
+          typename TDPType, typename TBand, typename TFreeEndGaps, typename TTraceConfig, typename TGapModel>
+inline void
+_computeAlignmentBatch(String<TScoreValue> & scores,
+                       TTraceSegments & traces,
+                       TSetH const & setH,
+                       TSetV const & setV,
+                       TScoringScheme const & scoringScheme,
+                       AlignConfig2<TDPType, TBand, TFreeEndGaps, TTraceConfig> const & alignConfig,
+                       TGapModel const & gapModel,
+                       True const & /*isSimdGapModel*/)
+{
+#ifdef SEQAN_SIMD_ENABLED
+    typedef typename Size<TSetH>::Type TSize;
+    typedef typename SetupAlignmentProfile_<TDPType, TFreeEndGaps, TGapModel, TTraceConfig>::Type TDPProfile;
+    typedef typename SimdVector<TScoreValue>::Type TSimdVector;
+
+    const unsigned LANES = LENGTH<TSimdVector>::VALUE;
+
+    typedef typename Value<typename Value<TSetH const>::Type>::Type TValueH;
+    typedef typename Value<typename Value<TSetV const>::Type>::Type TValueV;
+
+    // The lane type must be able to represent all sequence positions and, since the vectorized additions do not
+    // saturate, every score on a path through the padded matrix must stay above the infinity value.
+    __uint64 maxLenH = 0;
+    __uint64 maxLenV = 0;
+    for (TSize i = 0; i < length(setH); ++i)
+    {
+        maxLenH = _max(maxLenH, static_cast<__uint64>(length(value(setH, i))));
+        maxLenV = _max(maxLenV, static_cast<__uint64>(length(value(setV, i))));
+    }
+    __int64 infValue = DPCellDefaultInfinity<DPCell_<TScoreValue, TGapModel> >::VALUE;
+    __int64 maxStep = _maxSimdScoreStep(scoringScheme, TValueH(), TValueV());
+    bool fitsLanes = _max(maxLenH, maxLenV) < static_cast<__uint64>(MaxValue<TScoreValue>::VALUE) &&
+                     static_cast<__int64>(maxLenH + maxLenV + 1) * maxStep < -infValue;
+
+    if (fitsLanes)
+    {
+        for (TSize chunkBegin = 0; chunkBegin < length(setH); chunkBegin += LANES)
+        {
+            unsigned lanes = _min(static_cast<TSize>(LANES), length(setH) - chunkBegin);
+            _computeAlignmentSimdChunk(scores, traces, setH, setV, chunkBegin, lanes, scoringScheme, TDPProfile());
+        }
+        return;
+    }
+#endif  // #ifdef SEQAN_SIMD_ENABLED
+
+    _computeAlignmentBatchScalar(scores, traces, setH, setV, scoringScheme, alignConfig, gapModel);
+}
+
+// Computes the alignments of all pairs (setH[i], setV[i]) and stores their scores and, if the traceback is enabled,
+// their trace segments.  Uses the vectorized kernel whenever possible.
+template <typename TScoreValue, typename TTraceSegments, typename TSetH, typename TSetV, typename TScoringScheme,
+          typename TAlignConfig, typename TGapModel>
+inline void
+_computeAlignmentBatch(String<TScoreValue> & scores,
+                       TTraceSegments & traces,
+                       TSetH const & setH,
+                       TSetV const & setV,
+                       TScoringScheme const & scoringScheme,
+                       TAlignConfig const & alignConfig,
+                       TGapModel const & gapModel)
+{
+    SEQAN_ASSERT_EQ(length(setH), length(setV));
+
+    resize(scores, length(setH), Exact());
+    resize(traces, length(setH), Exact());
+
+    typedef typename Value<TSetH const>::Type TSeqH;
+    typedef typename Value<TSetV const>::Type TSeqV;
+
+    _computeAlignmentBatch(scores, traces, setH, setV, scoringScheme, alignConfig, gapModel,
+                           typename And<And<IsSimdGapModel_<TGapModel>, IsSimdScoreValue_<TScoreValue> >,
+                                        IsSimdSubstitution_<TScoringScheme, TSeqH, TSeqV> >::Type());
+}
+
+// ----------------------------------------------------------------------------
+// Function _alignBatch()
+// ----------------------------------------------------------------------------
+
+// Computes the alignments of all pairwise Align objects of the set and writes the traceback into their rows.
+template <typename TSequence, typename TAlignSpec, typename TSetSpec, typename TScoreValue, typename TScoreSpec,
+          typename TAlignConfig, typename TGapModel>
+inline String<TScoreValue>
+_alignBatch(StringSet<Align<TSequence, TAlignSpec>, TSetSpec> & alignSet,
+            Score<TScoreValue, TScoreSpec> const & scoringScheme,
+            TAlignConfig const & alignConfig,
+            TGapModel const & gapModel)
+{
+    typedef Align<TSequence, TAlignSpec> TAlign;
+    typedef typename Size<TAlign>::Type TSize;
+    typedef typename Position<TAlign>::Type TPosition;
+    typedef TraceSegment_<TPosition, TSize> TTraceSegment;
+    typedef typename Size<StringSet<TAlign, TSetSpec> >::Type TSetSize;
+
+    StringSet<TSequence, Dependent<> > setH;
+    StringSet<TSequence, Dependent<> > setV;
+    reserve(setH, length(alignSet), Exact());
+    reserve(setV, length(alignSet), Exact());
+    for (TSetSize i = 0; i < length(alignSet); ++i)
+    {
+        SEQAN_ASSERT_EQ(length(rows(alignSet[i])), 2u);
+        appendValue(setH, source(row(alignSet[i], 0)));
+        appendValue(setV, source(row(alignSet[i], 1)));
+    }
+
+    String<TScoreValue> scores;
+    String<String<TTraceSegment> > traces;
+    _computeAlignmentBatch(scores, traces, setH, setV, scoringScheme, alignConfig, gapModel);
+
+    for (TSetSize i = 0; i < length(alignSet); ++i)
+        _adaptTraceSegmentsTo(row(alignSet[i], 0), row(alignSet[i], 1), traces[i]);
+    return scores;
+}
+
+}  // namespace seqan
+
+#endif  // #ifndef SEQAN_INCLUDE_SEQAN_ALIGN_DP_ALGORITHM_SIMD_IMPL_H_
@@ -53,10 +53,48 @@ template <typename T>
 struct GetDPTraceMatrix
 {};
 
+template <typename TDPContext>
+struct DPContextPool_;
+
+template <typename TDPContext>
+inline DPContextPool_<TDPContext> &
+_dpContextPool();
+
 // ============================================================================
 // Tags, Classes, Enums
 // ============================================================================
 
+/*!
+ * @class DPContext
+ * @headerfile <seqan/align.h>
+ * @brief Reusable storage for the dynamic programming matrices of pairwise alignments.
+ *
+ * @signature template <typename TScoreValue, typename TGapCosts>
+ *            struct DPContext;
+ *
+ * @tparam TScoreValue The score value type, must be the value type of the @link Score @endlink.
+ * @tparam TGapCosts   The gap cost model, one of <tt>LinearGaps</tt>, <tt>AffineGaps</tt> or <tt>DynamicGaps</tt>.
+ *                     It selects the alignment algorithm, e.g. <tt>LinearGaps</tt> for Needleman-Wunsch and
+ *                     <tt>AffineGaps</tt> for Gotoh.
+ *
+ * Pass a context to @link globalAlignment @endlink, @link globalAlignmentScore @endlink, @link localAlignment
+ * @endlink or @link localAlignmentScore @endlink to keep the score and trace matrices between calls.  Repeated
+ * alignments of similar size then reuse the matrix memory instead of allocating it anew.  The memory is kept until
+ * the context is destroyed or cleared with @link DPContext#clear @endlink.  A context must not be used by two
+ * threads at the same time.
+ *
+ * The overloads without a context use a context cached per thread.  Contexts holding large matrices are released
+ * after each such call.
+ *
+ * @section Example
+ *
+ * @code{.cpp}
+ * DPContext<int, AffineGaps> dpContext;
+ * for (unsigned i = 0; i < length(readsH); ++i)
+ *     scores[i] = globalAlignmentScore(readsH[i], readsV[i], Score<int, Simple>(2, -1, -1, -3), dpContext);
+ * @endcode
+ */
+
 template <typename TScoreValue, typename TGapCosts>
 struct DPContext
 {
@@ -70,6 +108,58 @@ struct DPContext
     {}
 };
 
+// ----------------------------------------------------------------------------
+// Class DPContextPool_
+// ----------------------------------------------------------------------------
+
+// Caches one DPContext per thread for the alignment functions that are called
+// without a context.
+template <typename TDPContext>
+struct DPContextPool_
+{
+    // Contexts larger than this are cleared after use, so that a single large
+    // alignment does not pin its matrices for the lifetime of the thread.
+    enum { MAX_CAPACITY_IN_BYTES = 64 * 1024 * 1024 };
+
+    TDPContext context;
+    bool inUse;
+
+    DPContextPool_() : context(), inUse(false)
+    {}
+};
+
+// Borrows the context of the calling thread's pool.  Falls back to a local
+// context if the pooled one is already in use further up the call stack.
+template <typename TDPContext>
+struct DPContextLease_
+{
+    DPContextPool_<TDPContext> & pool;
+    TDPContext localContext;
+    TDPContext * context;
+
+    DPContextLease_() : pool(_dpContextPool<TDPContext>()), localContext(), context(&localContext)
+    {
+        if (!pool.inUse)
+        {
+            pool.inUse = true;
+            context = &pool.context;
+            // Cells computed with the zero recursion do not overwrite their gap scores, so the score matrix of the
+            // previous alignment is reset while keeping its memory.
+            clear(pool.context._scoreMatrix);
+        }
+    }
+
+    ~DPContextLease_()
+    {
+        if (context != &pool.context)
+            return;
+
+        if (_capacityInBytes(pool.context) > static_cast<size_t>(DPContextPool_<TDPContext>::MAX_CAPACITY_IN_BYTES))
+            clear(pool.context);
+        pool.inUse = false;
+    }
+};
+
 // ============================================================================
 // Metafunctions
 // ============================================================================
@@ -182,6 +272,63 @@ setDpTraceMatrix(DPContext<TScoreValue, TGapCosts> & dpContext,
     dpContext._tarceMatrix = traceMatrix;
 }
 
+// ----------------------------------------------------------------------------
+// Function clear()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn DPContext#clear
+ * @brief Releases the memory of the matrices held by a DPContext.
+ *
+ * @signature void clear(dpContext);
+ *
+ * @param[in,out] dpContext The DPContext to clear.
+ */
+
+template <typename TScoreValue, typename TGapCosts>
+inline void
+clear(DPContext<TScoreValue, TGapCosts> & dpContext)
+{
+    clear(dpContext._scoreMatrix);
+    shrinkToFit(dpContext._scoreMatrix);
+    clear(dpContext._traceMatrix);
+    shrinkToFit(dpContext._traceMatrix);
+}
+
+// ----------------------------------------------------------------------------
+// Function _capacityInBytes()
+// ----------------------------------------------------------------------------
+
+template <typename TScoreValue, typename TGapCosts>
+inline size_t
+_capacityInBytes(DPContext<TScoreValue, TGapCosts> const & dpContext)
+{
+    typedef DPContext<TScoreValue, TGapCosts> TDPContext;
+
+    return capacity(dpContext._scoreMatrix) * sizeof(typename Value<typename TDPContext::TScoreMatrixHost>::Type) +
+           capacity(dpContext._traceMatrix) * sizeof(typename Value<typename TDPContext::TTraceMatrixHost>::Type);
+}
+
+// ----------------------------------------------------------------------------
+// Function _dpContextPool()
+// ----------------------------------------------------------------------------
+
+// Returns the DPContextPool_ of the calling thread.
+template <typename TDPContext>
+inline DPContextPool_<TDPContext> &
+_dpContextPool()
+{
+#if defined(SEQAN_CXX11_STANDARD) && (!defined(_MSC_VER) || _MSC_VER >= 1900)
+    static thread_local DPContextPool_<TDPContext> pool;
+    return pool;
+#else
+    static SEQAN_THREAD_LOCAL DPContextPool_<TDPContext> * pool = NULL;
+    if (SEQAN_UNLIKELY(!pool))
+        pool = new DPContextPool_<TDPContext>();
+    return *pool;
+#endif
+}
+
 }
 
 #endif // INCLUDE_SEQAN_ALIGN_DP_CONTEXT_H_
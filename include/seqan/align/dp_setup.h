@@ -323,6 +323,7 @@ _setUpAndRunAlignment(DPContext<TScoreValue, DynamicGaps> & dpContext,
                              TDPProfile());
 }
 
+// Runs the alignment with the DPContext cached for the calling thread, see DPContextLease_.
 template <typename TTraceSegment, typename TSpec, typename TDPScoutStateSpec,
           typename TSequenceH, typename TSequenceV, typename TScoreValue2, typename TScoreSpec, typename TDPType,
           typename TBand, typename TFreeEndGaps, typename TTraceConfig, typename TGapModel>
@@ -337,18 +338,54 @@ _setUpAndRunAlignment(String<TTraceSegment, TSpec> & traceSegments,
 {
     if (IsSameType<TGapModel, LinearGaps>::VALUE)
     {
-        DPContext<TScoreValue2, LinearGaps> dpContext;
-        return _setUpAndRunAlignment(dpContext, traceSegments, dpScoutState, seqH, seqV, scoringScheme, alignConfig);
+        DPContextLease_<DPContext<TScoreValue2, LinearGaps> > lease;
+        return _setUpAndRunAlignment(*lease.context, traceSegments, dpScoutState, seqH, seqV, scoringScheme,
+                                     alignConfig);
     }
     else if (IsSameType<TGapModel, AffineGaps>::VALUE)
     {
-        DPContext<TScoreValue2, AffineGaps> dpContext;
-        return _setUpAndRunAlignment(dpContext, traceSegments, dpScoutState, seqH, seqV, scoringScheme, alignConfig);
+        DPContextLease_<DPContext<TScoreValue2, AffineGaps> > lease;
+        return _setUpAndRunAlignment(*lease.context, traceSegments, dpScoutState, seqH, seqV, scoringScheme,
+                                     alignConfig);
     }
     else
     {
-        DPContext<TScoreValue2, DynamicGaps> dpContext;
-        return _setUpAndRunAlignment(dpContext, traceSegments, dpScoutState, seqH, seqV, scoringScheme, alignConfig);
+        DPContextLease_<DPContext<TScoreValue2, DynamicGaps> > lease;
+        return _setUpAndRunAlignment(*lease.context, traceSegments, dpScoutState, seqH, seqV, scoringScheme,
+                                     alignConfig);
+    }
+}
+
+// Runs the alignment with the anti-diagonal kernel, see AntiDiagonalSimd.
+template <typename TTraceSegment, typename TSpec, typename TDPScoutStateSpec,
+          typename TSequenceH, typename TSequenceV, typename TScoreValue2, typename TScoreSpec, typename TDPType,
+          typename TBand, typename TFreeEndGaps, typename TTraceConfig>
+typename Value<Score<TScoreValue2, TScoreSpec> >::Type
+_setUpAndRunAlignment(String<TTraceSegment, TSpec> & traceSegments,
+                      DPScoutState_<TDPScoutStateSpec> & dpScoutState,
+                      TSequenceH const & seqH,
+                      TSequenceV const & seqV,
+                      Score<TScoreValue2, TScoreSpec> const & scoringScheme,
+                      AlignConfig2<TDPType, TBand, TFreeEndGaps, TTraceConfig> const & alignConfig,
+                      AntiDiagonalSimd const & kernelTag)
+{
+    SEQAN_ASSERT_GEQ(length(seqH), 1u);
+    SEQAN_ASSERT_GEQ(length(seqV), 1u);
+
+    typedef typename SetupAlignmentProfile_<TDPType, TFreeEndGaps, AffineGaps, TTraceConfig>::Type TAffineProfile;
+    typedef typename SetupAlignmentProfile_<TDPType, TFreeEndGaps, LinearGaps, TTraceConfig>::Type TLinearProfile;
+
+    if (_usesAffineGaps(scoringScheme, seqH, seqV))
+    {
+        DPContextLease_<DPContext<TScoreValue2, AffineGaps> > lease;
+        return _computeAlignment(*lease.context, traceSegments, dpScoutState, seqH, seqV, scoringScheme,
+                                 alignConfig._band, TAffineProfile(), kernelTag);
+    }
+    else
+    {
+        DPContextLease_<DPContext<TScoreValue2, LinearGaps> > lease;
+        return _computeAlignment(*lease.context, traceSegments, dpScoutState, seqH, seqV, scoringScheme,
+                                 alignConfig._band, TLinearProfile(), kernelTag);
     }
 }
 
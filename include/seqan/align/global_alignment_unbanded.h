@@ -82,6 +82,9 @@ class Fragment;
  * @signature TScoreVal globalAlignment(gapsH, gapsV,   scoringScheme, [alignConfig,] [lowerDiag, upperDiag,] [algorithmTag]);
  * @signature TScoreVal globalAlignment(frags, strings, scoringScheme, [alignConfig,] [lowerDiag, upperDiag,] [algorithmTag]);
  * @signature TScoreVal globalAlignment(alignGraph,     scoringScheme, [alignConfig,] [lowerDiag, upperDiag,] [algorithmTag]);
+ * @signature TScoreString globalAlignment(alignSet,    scoringScheme, [alignConfig,] [algorithmTag]);
+ * @signature TScoreVal globalAlignment(align,          scoringScheme, [alignConfig,] dpContext);
+ * @signature TScoreVal globalAlignment(gapsH, gapsV,   scoringScheme, [alignConfig,] dpContext);
  *
  * @param[in,out] align        The @link Align @endlink object to use for storing the pairwise alignment.
  * @param[in,out] gapsH        The @link Gaps @endlink object for the first row (horizontal in the DP matrix).
@@ -89,15 +92,21 @@ class Fragment;
  * @param[in,out] frags        String of @link Fragment @endlink objects to store alignment in.
  * @param[in]     strings      StringSet of length two with the strings to align.
  * @param[in,out] alignGraph   Alignment Graph for the resulting alignment.  Must be initialized with two strings.
+ * @param[in,out] alignSet     A @link StringSet @endlink of @link Align @endlink objects with two rows each.  All pairs
+ *                             are aligned in one batch.
  * @param[in]     scoringScheme The @link Score scoring scheme @endlink to use for the alignment.  Note that
  *                              the user is responsible for ensuring that the scoring scheme is compatible with <tt>algorithmTag</tt>.
  * @param[in]     alignConfig  @link AlignConfig @endlink instance to use for the alignment configuration.
  * @param[in]     lowerDiag    Optional lower diagonal (<tt>int</tt>).
  * @param[in]     upperDiag    Optional upper diagonal (<tt>int</tt>).
  * @param[in]     algorithmTag Tag to select the alignment algorithm (see @link AlignmentAlgorithmTags @endlink).
+ * @param[in,out] dpContext    A @link DPContext @endlink whose matrices are reused between calls.  Its gap cost type
+ *                             selects the algorithm.
  *
  * @return TScoreVal   Score value of the resulting alignment  (Metafunction: @link Score#Value @endlink of
  *                     the type of <tt>scoringScheme</tt>).
+ * @return TScoreString A @link String @endlink of <tt>TScoreVal</tt> with the score of each alignment in
+ *                      <tt>alignSet</tt>.
  *
  * There exist multiple overloads for this function with four configuration dimensions.
  *
@@ -105,12 +114,16 @@ class Fragment;
  *
  * Second, you can select the type of the target storing the alignment. This can be either an @link Align @endlink
  * object, two @link Gaps @endlink objects, a @link AlignmentGraph @endlink, or a string of @link Fragment @endlink
- * objects. @link Align @endlink objects provide an interface to tabular alignments with the restriction of all rows
- * having the same type. Using two @link Gaps @endlink objects has the advantage that you an align sequences with
- * different types, for example @link DnaString @endlink and @link Dna5String @endlink. @link AlignmentGraph Alignment
- * Graphs @endlink provide a graph-based representation of segment-based colinear alignments. Using @link Fragment
- * @endlink strings is useful for collecting many pairwise alignments, for example in the construction of @link
- * AlignmentGraph Alignment Graphs @endlink for multiple-sequence alignments (MSA).
+ * objects, or a @link StringSet @endlink of @link Align @endlink objects. @link Align @endlink objects provide an
+ * interface to tabular alignments with the restriction of all rows having the same type. Using two @link Gaps @endlink
+ * objects has the advantage that you an align sequences with different types, for example @link DnaString @endlink and
+ * @link Dna5String @endlink. @link AlignmentGraph Alignment Graphs @endlink provide a graph-based representation of
+ * segment-based colinear alignments. Using @link Fragment @endlink strings is useful for collecting many pairwise
+ * alignments, for example in the construction of @link AlignmentGraph Alignment Graphs @endlink for multiple-sequence
+ * alignments (MSA).  A @link StringSet @endlink of @link Align @endlink objects computes many independent pairwise
+ * alignments at once.  If SIMD is available, the alignments are computed inter-sequence vectorized, i.e. each alignment
+ * is mapped to one lane of a @link SimdVector @endlink whose value type is the score type of <tt>scoringScheme</tt>.
+ * Banded alignments are not supported in this mode.
  *
  * Third, you can optionally give a band for the alignment using <tt>lowerDiag</tt> and <tt>upperDiag</tt>. The center
  * diagonal has index <tt>0</tt>, the <tt>i</tt>th diagonal below has index <tt>-i</tt>, the <tt>i</tt>th above has
@@ -121,6 +134,10 @@ class Fragment;
  * Needleman-Wunsch algorithm supports scoring schemes with linear gap costs only while Gotoh's algorithm also allows
  * affine gap costs.
  *
+ * Instead of <tt>algorithmTag</tt>, you can pass a @link DPContext @endlink to unbanded alignments.  Its gap cost type
+ * selects the algorithm and its matrices are reused by subsequent calls, so that many alignments of similar size do
+ * not allocate the DP matrices again.
+ *
  * The available alignment algorithms all have some restrictions.  Gotoh's algorithm can handle arbitrary substitution
  * and affine gap scores.  Needleman-Wunsch is limited to linear gap scores.  The implementation of Hirschberg's
  * algorithm is further limited that it does not support <tt>alignConfig</tt> objects or banding.  The implementation of
@@ -230,6 +247,42 @@ TScoreValue globalAlignment(Align<TSequence, TAlignSpec> & align,
     return globalAlignment(align, scoringScheme, alignConfig);
 }
 
+// Interface with a reusable DPContext.
+template <typename TSequence, typename TAlignSpec, typename TScoreValue, typename TScoreSpec,
+          bool TOP, bool LEFT, bool RIGHT, bool BOTTOM, typename TACSpec, typename TGapCosts>
+TScoreValue globalAlignment(Align<TSequence, TAlignSpec> & align,
+                            Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                            AlignConfig<TOP, LEFT, RIGHT, BOTTOM, TACSpec> const & /*alignConfig*/,
+                            DPContext<TScoreValue, TGapCosts> & dpContext)
+{
+    typedef Align<TSequence, TAlignSpec> TAlign;
+    typedef typename Size<TAlign>::Type TSize;
+    typedef typename Position<TAlign>::Type TPosition;
+    typedef TraceSegment_<TPosition, TSize> TTraceSegment;
+
+    typedef AlignConfig<TOP, LEFT, RIGHT, BOTTOM, TACSpec> TAlignConfig;
+    typedef typename SubstituteAlignConfig_<TAlignConfig>::Type TFreeEndGaps;
+    typedef AlignConfig2<DPGlobal, DPBandConfig<BandOff>, TFreeEndGaps> TAlignConfig2;
+
+    String<TTraceSegment> trace;
+    DPScoutState_<Default> dpScoutState;
+    TScoreValue res = _setUpAndRunAlignment(dpContext, trace, dpScoutState, source(row(align, 0)),
+                                            source(row(align, 1)), scoringScheme, TAlignConfig2());
+
+    _adaptTraceSegmentsTo(row(align, 0), row(align, 1), trace);
+    return res;
+}
+
+// Interface with a reusable DPContext but without AlignConfig<>.
+template <typename TSequence, typename TAlignSpec, typename TScoreValue, typename TScoreSpec, typename TGapCosts>
+TScoreValue globalAlignment(Align<TSequence, TAlignSpec> & align,
+                            Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                            DPContext<TScoreValue, TGapCosts> & dpContext)
+{
+    AlignConfig<> alignConfig;
+    return globalAlignment(align, scoringScheme, alignConfig, dpContext);
+}
+
 // ----------------------------------------------------------------------------
 // Function globalAlignment()                                  [unbanded, Gaps]
 // ----------------------------------------------------------------------------
@@ -303,6 +356,104 @@ TScoreValue globalAlignment(Gaps<TSequenceH, TGapsSpecH> & gapsH,
     return globalAlignment(gapsH, gapsV, scoringScheme, alignConfig);
 }
 
+// Interface with a reusable DPContext.
+template <typename TSequenceH, typename TGapsSpecH,
+          typename TSequenceV, typename TGapsSpecV,
+          typename TScoreValue, typename TScoreSpec,
+          bool TOP, bool LEFT, bool RIGHT, bool BOTTOM, typename TACSpec,
+          typename TGapCosts>
+TScoreValue globalAlignment(Gaps<TSequenceH, TGapsSpecH> & gapsH,
+                            Gaps<TSequenceV, TGapsSpecV> & gapsV,
+                            Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                            AlignConfig<TOP, LEFT, RIGHT, BOTTOM, TACSpec> const & /*alignConfig*/,
+                            DPContext<TScoreValue, TGapCosts> & dpContext)
+{
+    typedef typename Size<TSequenceH>::Type TSize;
+    typedef typename Position<TSequenceH>::Type TPosition;
+    typedef TraceSegment_<TPosition, TSize> TTraceSegment;
+    typedef AlignConfig<TOP, LEFT, RIGHT, BOTTOM, TACSpec> TAlignConfig;
+    typedef typename SubstituteAlignConfig_<TAlignConfig>::Type TFreeEndGaps;
+    typedef AlignConfig2<DPGlobal, DPBandConfig<BandOff>, TFreeEndGaps> TAlignConfig2;
+
+    String<TTraceSegment> traceSegments;
+    DPScoutState_<Default> dpScoutState;
+    TScoreValue res = _setUpAndRunAlignment(dpContext, traceSegments, dpScoutState, source(gapsH), source(gapsV),
+                                            scoringScheme, TAlignConfig2());
+    _adaptTraceSegmentsTo(gapsH, gapsV, traceSegments);
+    return res;
+}
+
+// Interface with a reusable DPContext but without AlignConfig<>.
+template <typename TSequenceH, typename TGapsSpecH,
+          typename TSequenceV, typename TGapsSpecV,
+          typename TScoreValue, typename TScoreSpec,
+          typename TGapCosts>
+TScoreValue globalAlignment(Gaps<TSequenceH, TGapsSpecH> & gapsH,
+                            Gaps<TSequenceV, TGapsSpecV> & gapsV,
+                            Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                            DPContext<TScoreValue, TGapCosts> & dpContext)
+{
+    AlignConfig<> alignConfig;
+    return globalAlignment(gapsH, gapsV, scoringScheme, alignConfig, dpContext);
+}
+
+// ----------------------------------------------------------------------------
+// Function globalAlignment()                      [unbanded, StringSet<Align>]
+// ----------------------------------------------------------------------------
+
+template <typename TSequence, typename TAlignSpec, typename TSetSpec,
+          typename TScoreValue, typename TScoreSpec,
+          bool TOP, bool LEFT, bool RIGHT, bool BOTTOM, typename TACSpec,
+          typename TAlgoTag>
+String<TScoreValue> globalAlignment(StringSet<Align<TSequence, TAlignSpec>, TSetSpec> & alignSet,
+                                    Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                                    AlignConfig<TOP, LEFT, RIGHT, BOTTOM, TACSpec> const & /*alignConfig*/,
+                                    TAlgoTag const & /*algoTag*/)
+{
+    typedef AlignConfig<TOP, LEFT, RIGHT, BOTTOM, TACSpec> TAlignConfig;
+    typedef typename SubstituteAlignConfig_<TAlignConfig>::Type TFreeEndGaps;
+    typedef AlignConfig2<DPGlobal, DPBandConfig<BandOff>, TFreeEndGaps> TAlignConfig2;
+    typedef typename SubstituteAlgoTag_<TAlgoTag>::Type TGapModel;
+
+    return _alignBatch(alignSet, scoringScheme, TAlignConfig2(), TGapModel());
+}
+
+// Interface without AlignConfig<>.
+template <typename TSequence, typename TAlignSpec, typename TSetSpec,
+          typename TScoreValue, typename TScoreSpec,
+          typename TAlgoTag>
+String<TScoreValue> globalAlignment(StringSet<Align<TSequence, TAlignSpec>, TSetSpec> & alignSet,
+                                    Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                                    TAlgoTag const & algoTag)
+{
+    AlignConfig<> alignConfig;
+    return globalAlignment(alignSet, scoringScheme, alignConfig, algoTag);
+}
+
+// Interface without algorithm tag.
+template <typename TSequence, typename TAlignSpec, typename TSetSpec,
+          typename TScoreValue, typename TScoreSpec,
+          bool TOP, bool LEFT, bool RIGHT, bool BOTTOM, typename TACSpec>
+String<TScoreValue> globalAlignment(StringSet<Align<TSequence, TAlignSpec>, TSetSpec> & alignSet,
+                                    Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                                    AlignConfig<TOP, LEFT, RIGHT, BOTTOM, TACSpec> const & alignConfig)
+{
+    if (scoreGapOpen(scoringScheme) == scoreGapExtend(scoringScheme))
+        return globalAlignment(alignSet, scoringScheme, alignConfig, NeedlemanWunsch());
+    else
+        return globalAlignment(alignSet, scoringScheme, alignConfig, Gotoh());
+}
+
+// Interface without AlignConfig<> and algorithm tag.
+template <typename TSequence, typename TAlignSpec, typename TSetSpec,
+          typename TScoreValue, typename TScoreSpec>
+String<TScoreValue> globalAlignment(StringSet<Align<TSequence, TAlignSpec>, TSetSpec> & alignSet,
+                                    Score<TScoreValue, TScoreSpec> const & scoringScheme)
+{
+    AlignConfig<> alignConfig;
+    return globalAlignment(alignSet, scoringScheme, alignConfig);
+}
+
 // ----------------------------------------------------------------------------
 // Function globalAlignment()                   [unbanded, Graph<Alignment<> >]
 // ----------------------------------------------------------------------------
@@ -461,10 +612,15 @@ TScoreValue globalAlignment(String<Fragment<TSize, TFragmentSpec>, TStringSpec>
  * @signature TScoreVal globalAlignmentScore(strings,    scoringScheme[, alignConfig][, lowerDiag, upperDiag][, algorithmTag]);
  * @signature TScoreVal globalAlignmentScore(seqH, seqV, {MyersBitVector | MyersHirschberg});
  * @signature TScoreVal globalAlignmentScore(strings,    {MyersBitVector | MyersHirschberg});
+ * @signature TScoreString globalAlignmentScore(stringsH, stringsV, scoringScheme[, alignConfig][, algorithmTag]);
+ * @signature TScoreVal globalAlignmentScore(seqH, seqV, scoringScheme[, alignConfig], dpContext);
  *
  * @param[in] seqH          Horizontal gapped sequence in alignment matrix.  Types: String
  * @param[in] seqV          Vertical gapped sequence in alignment matrix.  Types: String
  * @param[in] strings       A @link StringSet @endlink containing two sequences.  Type: StringSet.
+ * @param[in] stringsH      The horizontal sequences of a batch of alignments.  Type: StringSet.
+ * @param[in] stringsV      The vertical sequences of a batch of alignments, must have the same length as
+ *                          <tt>stringsH</tt>.  Type: StringSet.
  * @param[in] alignConfig   The @link AlignConfig @endlink to use for the alignment.  Type: AlignConfig
  * @param[in] scoringScheme The scoring scheme to use for the alignment.  Note that the user is responsible for ensuring
  *                          that the scoring scheme is compatible with <tt>algorithmTag</tt>.  Type: @link Score @endlink.
@@ -472,9 +628,14 @@ TScoreValue globalAlignment(String<Fragment<TSize, TFragmentSpec>, TStringSpec>
  * @param[in] upperDiag     Optional upper diagonal.  Types: <tt>int</tt>
  * @param[in] algorithmTag  The Tag for picking the alignment algorithm. Types: @link PairwiseLocalAlignmentAlgorithms
  *                          @endlink.
+ * @param[in,out] dpContext A @link DPContext @endlink whose score matrix is reused between calls.  Its gap cost type
+ *                          selects the algorithm.
  *
  * @return TScoreVal   Score value of the resulting alignment  (Metafunction: @link Score#Value @endlink of
  *                     the type of <tt>scoringScheme</tt>).
+ * @return TScoreString A @link String @endlink of <tt>TScoreVal</tt> holding the score of the alignment of
+ *                      <tt>stringsH[i]</tt> and <tt>stringsV[i]</tt> at position <tt>i</tt>.  The batch is computed
+ *                      SIMD vectorized if available.
  *
  * This function does not perform the (linear time) traceback step after the (mostly quadratic time) dynamic programming
  * step.  Note that Myers' bit-vector algorithm does not compute an alignment (only in the Myers-Hirschberg variant) but
@@ -554,6 +715,41 @@ TScoreValue globalAlignmentScore(TSequenceH const & seqH,
     return globalAlignmentScore(seqH, seqV, scoringScheme, alignConfig);
 }
 
+// Interface with a reusable DPContext.
+template <typename TSequenceH,
+          typename TSequenceV,
+          typename TScoreValue, typename TScoreSpec,
+          bool TOP, bool LEFT, bool RIGHT, bool BOTTOM, typename TACSpec,
+          typename TGapCosts>
+TScoreValue globalAlignmentScore(TSequenceH const & seqH,
+                                 TSequenceV const & seqV,
+                                 Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                                 AlignConfig<TOP, LEFT, RIGHT, BOTTOM, TACSpec> const & /*alignConfig*/,
+                                 DPContext<TScoreValue, TGapCosts> & dpContext)
+{
+    typedef AlignConfig<TOP, LEFT, RIGHT, BOTTOM, TACSpec> TAlignConfig;
+    typedef typename SubstituteAlignConfig_<TAlignConfig>::Type TFreeEndGaps;
+    typedef AlignConfig2<DPGlobal, DPBandConfig<BandOff>, TFreeEndGaps, TracebackOff> TAlignConfig2;
+
+    DPScoutState_<Default> dpScoutState;
+    String<TraceSegment_<unsigned, unsigned> > traceSegments;  // Dummy segments.
+    return _setUpAndRunAlignment(dpContext, traceSegments, dpScoutState, seqH, seqV, scoringScheme, TAlignConfig2());
+}
+
+// Interface with a reusable DPContext but without AlignConfig<>.
+template <typename TSequenceH,
+          typename TSequenceV,
+          typename TScoreValue, typename TScoreSpec,
+          typename TGapCosts>
+TScoreValue globalAlignmentScore(TSequenceH const & seqH,
+                                 TSequenceV const & seqV,
+                                 Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                                 DPContext<TScoreValue, TGapCosts> & dpContext)
+{
+    AlignConfig<> alignConfig;
+    return globalAlignmentScore(seqH, seqV, scoringScheme, alignConfig, dpContext);
+}
+
 // ----------------------------------------------------------------------------
 // Function globalAlignmentScore()                        [unbanded, StringSet]
 // ----------------------------------------------------------------------------
@@ -622,6 +818,74 @@ TScoreValue globalAlignmentScore(StringSet<TString, TSpec> const & strings,
     return globalAlignmentScore(strings[0], strings[1], scoringScheme, alignConfig);
 }
 
+// ----------------------------------------------------------------------------
+// Function globalAlignmentScore()                     [unbanded, 2 StringSets]
+// ----------------------------------------------------------------------------
+
+template <typename TStringH, typename TSpecH,
+          typename TStringV, typename TSpecV,
+          typename TScoreValue, typename TScoreSpec,
+          bool TOP, bool LEFT, bool RIGHT, bool BOTTOM, typename TACSpec,
+          typename TAlgoTag>
+String<TScoreValue> globalAlignmentScore(StringSet<TStringH, TSpecH> const & stringsH,
+                                         StringSet<TStringV, TSpecV> const & stringsV,
+                                         Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                                         AlignConfig<TOP, LEFT, RIGHT, BOTTOM, TACSpec> const & /*alignConfig*/,
+                                         TAlgoTag const & /*algoTag*/)
+{
+    typedef AlignConfig<TOP, LEFT, RIGHT, BOTTOM, TACSpec> TAlignConfig;
+    typedef typename SubstituteAlignConfig_<TAlignConfig>::Type TFreeEndGaps;
+    typedef AlignConfig2<DPGlobal, DPBandConfig<BandOff>, TFreeEndGaps, TracebackOff> TAlignConfig2;
+    typedef typename SubstituteAlgoTag_<TAlgoTag>::Type TGapModel;
+
+    String<TScoreValue> scores;
+    String<String<TraceSegment_<unsigned, unsigned> > > traceSegments;  // Dummy segments.
+    _computeAlignmentBatch(scores, traceSegments, stringsH, stringsV, scoringScheme, TAlignConfig2(), TGapModel());
+    return scores;
+}
+
+// Interface without AlignConfig<>.
+template <typename TStringH, typename TSpecH,
+          typename TStringV, typename TSpecV,
+          typename TScoreValue, typename TScoreSpec,
+          typename TAlgoTag>
+String<TScoreValue> globalAlignmentScore(StringSet<TStringH, TSpecH> const & stringsH,
+                                         StringSet<TStringV, TSpecV> const & stringsV,
+                                         Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                                         TAlgoTag const & algoTag)
+{
+    AlignConfig<> alignConfig;
+    return globalAlignmentScore(stringsH, stringsV, scoringScheme, alignConfig, algoTag);
+}
+
+// Interface without algorithm tag.
+template <typename TStringH, typename TSpecH,
+          typename TStringV, typename TSpecV,
+          typename TScoreValue, typename TScoreSpec,
+          bool TOP, bool LEFT, bool RIGHT, bool BOTTOM, typename TACSpec>
+String<TScoreValue> globalAlignmentScore(StringSet<TStringH, TSpecH> const & stringsH,
+                                         StringSet<TStringV, TSpecV> const & stringsV,
+                                         Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                                         AlignConfig<TOP, LEFT, RIGHT, BOTTOM, TACSpec> const & alignConfig)
+{
+    if (scoreGapOpen(scoringScheme) == scoreGapExtend(scoringScheme))
+        return globalAlignmentScore(stringsH, stringsV, scoringScheme, alignConfig, NeedlemanWunsch());
+    else
+        return globalAlignmentScore(stringsH, stringsV, scoringScheme, alignConfig, Gotoh());
+}
+
+// Interface without AlignConfig<> and algorithm tag.
+template <typename TStringH, typename TSpecH,
+          typename TStringV, typename TSpecV,
+          typename TScoreValue, typename TScoreSpec>
+String<TScoreValue> globalAlignmentScore(StringSet<TStringH, TSpecH> const & stringsH,
+                                         StringSet<TStringV, TSpecV> const & stringsV,
+                                         Score<TScoreValue, TScoreSpec> const & scoringScheme)
+{
+    AlignConfig<> alignConfig;
+    return globalAlignmentScore(stringsH, stringsV, scoringScheme, alignConfig);
+}
+
 }  // namespace seqan
 
 #endif  // #ifndef SEQAN_INCLUDE_SEQAN_ALIGN_GLOBAL_ALIGNMENT_UNBANDED_H_
@@ -67,6 +67,9 @@ namespace seqan {
  * @signature TScoreVal localAlignment(align,          scoringScheme, [lowerDiag, upperDiag]);
  * @signature TScoreVal localAlignment(gapsH, gapsV,   scoringScheme, [lowerDiag, upperDiag]);
  * @signature TScoreVal localAlignment(fragmentString, scoringScheme, [lowerDiag, upperDiag]);
+ * @signature TScoreString localAlignment(alignSet, scoringScheme);
+ * @signature TScoreVal localAlignment(align,          scoringScheme, dpContext);
+ * @signature TScoreVal localAlignment(gapsH, gapsV,   scoringScheme, dpContext);
  *
  * @param[in,out] gapsH Horizontal gapped sequence in alignment matrix. Types: @link Gaps @endlink
  * @param[in,out] gapsV Vertical gapped sequence in alignment matrix. Types: @link Gaps @endlink
@@ -79,13 +82,21 @@ namespace seqan {
  *                      String of @link Fragment @endlink objects. The sequence
  *                      with id <tt>0</tt> is the horizontal one, the sequence
  *                      with id <tt>1</tt> is the vertical one.
+ * @param[in,out] alignSet
+ *                      A @link StringSet @endlink of @link Align @endlink objects with two rows each.  All pairs
+ *                      are aligned in one batch, SIMD vectorized if available.
  * @param[in] scoringScheme
  *                      The @link Score scoring scheme @endlink to use for the alignment.
  * @param[in] lowerDiag Optional lower diagonal (<tt>int</tt>).
  * @param[in] upperDiag Optional upper diagonal (<tt>int</tt>).
+ * @param[in,out] dpContext
+ *                      A @link DPContext @endlink whose matrices are reused between calls.  Its gap cost type selects
+ *                      between linear and affine gap costs.
  *
  * @return TScoreVal Score value of the resulting alignment  (Metafunction @link Score#Value @endlink of the type of
  *                   <tt>scoringScheme</tt>).
+ * @return TScoreString A @link String @endlink of <tt>TScoreVal</tt> with the score of each alignment in
+ *                      <tt>alignSet</tt>.
  *
  * The Waterman-Eggert algorithm (local alignment with declumping) is available through the @link
  * LocalAlignmentEnumerator @endlink class.
@@ -191,6 +202,27 @@ TScoreValue localAlignment(Align<TSequence, TAlignSpec> & align,
          return localAlignment(align, scoringScheme, LinearGaps());
  }
 
+template <typename TSequence, typename TAlignSpec, typename TScoreValue, typename TScoreSpec, typename TGapCosts>
+TScoreValue localAlignment(Align<TSequence, TAlignSpec> & align,
+                           Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                           DPContext<TScoreValue, TGapCosts> & dpContext)
+{
+    SEQAN_ASSERT_EQ(length(rows(align)), 2u);
+    typedef Align<TSequence, TAlignSpec> TAlign;
+    typedef typename Size<TAlign>::Type TSize;
+    typedef typename Position<TAlign>::Type TPosition;
+    typedef TraceSegment_<TPosition, TSize> TTraceSegment;
+    typedef AlignConfig2<DPLocal, DPBandConfig<BandOff>, FreeEndGaps_<> > TAlignConfig2;
+
+    String<TTraceSegment> trace;
+    DPScoutState_<Default> dpScoutState;
+    TScoreValue res = _setUpAndRunAlignment(dpContext, trace, dpScoutState, source(row(align, 0)),
+                                            source(row(align, 1)), scoringScheme, TAlignConfig2());
+
+    _adaptTraceSegmentsTo(row(align, 0), row(align, 1), trace);
+    return res;
+}
+
 // ----------------------------------------------------------------------------
 // Function localAlignment()                                   [unbanded, Gaps]
 // ----------------------------------------------------------------------------
@@ -228,6 +260,51 @@ TScoreValue localAlignment(Gaps<TSequenceH, TGapsSpecH> & gapsH,
          return localAlignment(gapsH, gapsV, scoringScheme, LinearGaps());
 }
 
+template <typename TSequenceH, typename TGapsSpecH, typename TSequenceV, typename TGapsSpecV, typename TScoreValue,
+          typename TScoreSpec, typename TGapCosts>
+TScoreValue localAlignment(Gaps<TSequenceH, TGapsSpecH> & gapsH,
+                           Gaps<TSequenceV, TGapsSpecV> & gapsV,
+                           Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                           DPContext<TScoreValue, TGapCosts> & dpContext)
+{
+    typedef typename Size<TSequenceH>::Type TSize;
+    typedef typename Position<TSequenceH>::Type TPosition;
+    typedef TraceSegment_<TPosition, TSize> TTraceSegment;
+    typedef AlignConfig2<DPLocal, DPBandConfig<BandOff>, FreeEndGaps_<> > TAlignConfig2;
+
+    String<TTraceSegment> trace;
+    DPScoutState_<Default> dpScoutState;
+    TScoreValue res = _setUpAndRunAlignment(dpContext, trace, dpScoutState, source(gapsH), source(gapsV),
+                                            scoringScheme, TAlignConfig2());
+    _adaptTraceSegmentsTo(gapsH, gapsV, trace);
+    return res;
+}
+
+// ----------------------------------------------------------------------------
+// Function localAlignment()                       [unbanded, StringSet<Align>]
+// ----------------------------------------------------------------------------
+
+template <typename TSequence, typename TAlignSpec, typename TSetSpec, typename TScoreValue, typename TScoreSpec,
+          typename TTag>
+String<TScoreValue> localAlignment(StringSet<Align<TSequence, TAlignSpec>, TSetSpec> & alignSet,
+                                   Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                                   TTag const & tag)
+{
+    typedef AlignConfig2<DPLocal, DPBandConfig<BandOff>, FreeEndGaps_<> > TAlignConfig2;
+
+    return _alignBatch(alignSet, scoringScheme, TAlignConfig2(), tag);
+}
+
+template <typename TSequence, typename TAlignSpec, typename TSetSpec, typename TScoreValue, typename TScoreSpec>
+String<TScoreValue> localAlignment(StringSet<Align<TSequence, TAlignSpec>, TSetSpec> & alignSet,
+                                   Score<TScoreValue, TScoreSpec> const & scoringScheme)
+{
+    if (scoreGapOpen(scoringScheme) == scoreGapExtend(scoringScheme))
+        return localAlignment(alignSet, scoringScheme, LinearGaps());
+    else
+        return localAlignment(alignSet, scoringScheme, AffineGaps());
+}
+
 // ----------------------------------------------------------------------------
 // Function localAlignment()                     [unbanded, Graph<Alignment<>>]
 // ----------------------------------------------------------------------------
@@ -312,6 +389,111 @@ TScoreValue localAlignment(String<Fragment<TSize, TFragmentSpec>, TStringSpec> &
         return localAlignment(fragmentString, strings, scoringScheme, LinearGaps());
 }
 
+// ----------------------------------------------------------------------------
+// Function localAlignmentScore()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn localAlignmentScore
+ * @headerfile <seqan/align.h>
+ * @brief Computes the best pairwise local alignment score using the Smith-Waterman algorithm.
+ *
+ * @signature TScoreVal    localAlignmentScore(seqH, seqV, scoringScheme);
+ * @signature TScoreString localAlignmentScore(stringsH, stringsV, scoringScheme);
+ * @signature TScoreVal    localAlignmentScore(seqH, seqV, scoringScheme, dpContext);
+ *
+ * @param[in] seqH          Horizontal sequence in the alignment matrix.  Types: @link ContainerConcept @endlink
+ * @param[in] seqV          Vertical sequence in the alignment matrix.  Types: @link ContainerConcept @endlink
+ * @param[in] stringsH      The horizontal sequences of a batch of alignments.  Types: @link StringSet @endlink
+ * @param[in] stringsV      The vertical sequences of a batch of alignments, must have the same length as
+ *                          <tt>stringsH</tt>.  Types: @link StringSet @endlink
+ * @param[in] scoringScheme The @link Score scoring scheme @endlink to use for the alignment.
+ * @param[in,out] dpContext A @link DPContext @endlink whose score matrix is reused between calls.
+ *
+ * @return TScoreVal    Score value of the resulting alignment  (Metafunction @link Score#Value @endlink of the type
+ *                      of <tt>scoringScheme</tt>).
+ * @return TScoreString A @link String @endlink of <tt>TScoreVal</tt> holding the score of the alignment of
+ *                      <tt>stringsH[i]</tt> and <tt>stringsV[i]</tt> at position <tt>i</tt>.  The batch is computed
+ *                      SIMD vectorized if available.
+ *
+ * This function does not perform the traceback step.
+ *
+ * @see localAlignment
+ * @see globalAlignmentScore
+ */
+
+// ----------------------------------------------------------------------------
+// Function localAlignmentScore()                         [unbanded, 2 Strings]
+// ----------------------------------------------------------------------------
+
+template <typename TSequenceH, typename TSequenceV, typename TScoreValue, typename TScoreSpec, typename TTag>
+TScoreValue localAlignmentScore(TSequenceH const & seqH,
+                                TSequenceV const & seqV,
+                                Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                                TTag const & tag)
+{
+    typedef AlignConfig2<DPLocal, DPBandConfig<BandOff>, FreeEndGaps_<>, TracebackOff> TAlignConfig2;
+
+    DPScoutState_<Default> dpScoutState;
+    String<TraceSegment_<unsigned, unsigned> > traceSegments;  // Dummy segments.
+    return _setUpAndRunAlignment(traceSegments, dpScoutState, seqH, seqV, scoringScheme, TAlignConfig2(), tag);
+}
+
+template <typename TSequenceH, typename TSequenceV, typename TScoreValue, typename TScoreSpec>
+TScoreValue localAlignmentScore(TSequenceH const & seqH,
+                                TSequenceV const & seqV,
+                                Score<TScoreValue, TScoreSpec> const & scoringScheme)
+{
+    if (_usesAffineGaps(scoringScheme, seqH, seqV))
+        return localAlignmentScore(seqH, seqV, scoringScheme, AffineGaps());
+    else
+        return localAlignmentScore(seqH, seqV, scoringScheme, LinearGaps());
+}
+
+template <typename TSequenceH, typename TSequenceV, typename TScoreValue, typename TScoreSpec, typename TGapCosts>
+TScoreValue localAlignmentScore(TSequenceH const & seqH,
+                                TSequenceV const & seqV,
+                                Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                                DPContext<TScoreValue, TGapCosts> & dpContext)
+{
+    typedef AlignConfig2<DPLocal, DPBandConfig<BandOff>, FreeEndGaps_<>, TracebackOff> TAlignConfig2;
+
+    DPScoutState_<Default> dpScoutState;
+    String<TraceSegment_<unsigned, unsigned> > traceSegments;  // Dummy segments.
+    return _setUpAndRunAlignment(dpContext, traceSegments, dpScoutState, seqH, seqV, scoringScheme, TAlignConfig2());
+}
+
+// ----------------------------------------------------------------------------
+// Function localAlignmentScore()                      [unbanded, 2 StringSets]
+// ----------------------------------------------------------------------------
+
+template <typename TStringH, typename TSpecH, typename TStringV, typename TSpecV, typename TScoreValue,
+          typename TScoreSpec, typename TTag>
+String<TScoreValue> localAlignmentScore(StringSet<TStringH, TSpecH> const & stringsH,
+                                        StringSet<TStringV, TSpecV> const & stringsV,
+                                        Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                                        TTag const & tag)
+{
+    typedef AlignConfig2<DPLocal, DPBandConfig<BandOff>, FreeEndGaps_<>, TracebackOff> TAlignConfig2;
+
+    String<TScoreValue> scores;
+    String<String<TraceSegment_<unsigned, unsigned> > > traceSegments;  // Dummy segments.
+    _computeAlignmentBatch(scores, traceSegments, stringsH, stringsV, scoringScheme, TAlignConfig2(), tag);
+    return scores;
+}
+
+template <typename TStringH, typename TSpecH, typename TStringV, typename TSpecV, typename TScoreValue,
+          typename TScoreSpec>
+String<TScoreValue> localAlignmentScore(StringSet<TStringH, TSpecH> const & stringsH,
+                                        StringSet<TStringV, TSpecV> const & stringsV,
+                                        Score<TScoreValue, TScoreSpec> const & scoringScheme)
+{
+    if (scoreGapOpen(scoringScheme) == scoreGapExtend(scoringScheme))
+        return localAlignmentScore(stringsH, stringsV, scoringScheme, LinearGaps());
+    else
+        return localAlignmentScore(stringsH, stringsV, scoringScheme, AffineGaps());
+}
+
 }  // namespace seqan
 
 #endif  // #ifndef SEQAN_INCLUDE_SEQAN_ALIGN_LOCAL_ALIGNMENT_UNBANDED_H_
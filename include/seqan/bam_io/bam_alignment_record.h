@@ -314,7 +314,7 @@ clear(BamAlignmentRecord & record)
  */
 
 inline bool
-hasFlagMultiple(BamAlignmentRecord const & record)
+hasFlagMultiple(BamAlignmentRecordCore const & record)
 {
     return (record.flag & BAM_FLAG_MULTIPLE) == BAM_FLAG_MULTIPLE;
 }
@@ -338,7 +338,7 @@ hasFlagMultiple(BamAlignmentRecord const & record)
  */
 
 inline bool
-hasFlagAllProper(BamAlignmentRecord const & record)
+hasFlagAllProper(BamAlignmentRecordCore const & record)
 {
     return (record.flag & BAM_FLAG_ALL_PROPER) == BAM_FLAG_ALL_PROPER;
 }
@@ -362,7 +362,7 @@ hasFlagAllProper(BamAlignmentRecord const & record)
  */
 
 inline bool
-hasFlagUnmapped(BamAlignmentRecord const & record)
+hasFlagUnmapped(BamAlignmentRecordCore const & record)
 {
     return (record.flag & BAM_FLAG_UNMAPPED) == BAM_FLAG_UNMAPPED;
 }
@@ -386,7 +386,7 @@ hasFlagUnmapped(BamAlignmentRecord const & record)
  */
 
 inline bool
-hasFlagNextUnmapped(BamAlignmentRecord const & record)
+hasFlagNextUnmapped(BamAlignmentRecordCore const & record)
 {
     return (record.flag & BAM_FLAG_NEXT_UNMAPPED) == BAM_FLAG_NEXT_UNMAPPED;
 }
@@ -410,7 +410,7 @@ hasFlagNextUnmapped(BamAlignmentRecord const & record)
  */
 
 inline bool
-hasFlagRC(BamAlignmentRecord const & record)
+hasFlagRC(BamAlignmentRecordCore const & record)
 {
     return (record.flag & BAM_FLAG_RC) == BAM_FLAG_RC;
 }
@@ -434,7 +434,7 @@ hasFlagRC(BamAlignmentRecord const & record)
  */
 
 inline bool
-hasFlagNextRC(BamAlignmentRecord const & record)
+hasFlagNextRC(BamAlignmentRecordCore const & record)
 {
     return (record.flag & BAM_FLAG_NEXT_RC) == BAM_FLAG_NEXT_RC;
 }
@@ -458,7 +458,7 @@ hasFlagNextRC(BamAlignmentRecord const & record)
  */
 
 inline bool
-hasFlagFirst(BamAlignmentRecord const & record)
+hasFlagFirst(BamAlignmentRecordCore const & record)
 {
     return (record.flag & BAM_FLAG_FIRST) == BAM_FLAG_FIRST;
 }
@@ -482,7 +482,7 @@ hasFlagFirst(BamAlignmentRecord const & record)
  */
 
 inline bool
-hasFlagLast(BamAlignmentRecord const & record)
+hasFlagLast(BamAlignmentRecordCore const & record)
 {
     return (record.flag & BAM_FLAG_LAST) == BAM_FLAG_LAST;
 }
@@ -506,7 +506,7 @@ hasFlagLast(BamAlignmentRecord const & record)
  */
 
 inline bool
-hasFlagSecondary(BamAlignmentRecord const & record)
+hasFlagSecondary(BamAlignmentRecordCore const & record)
 {
     return (record.flag & BAM_FLAG_SECONDARY) == BAM_FLAG_SECONDARY;
 }
@@ -530,7 +530,7 @@ hasFlagSecondary(BamAlignmentRecord const & record)
  */
 
 inline bool
-hasFlagQCNoPass(BamAlignmentRecord const & record)
+hasFlagQCNoPass(BamAlignmentRecordCore const & record)
 {
     return (record.flag & BAM_FLAG_QC_NO_PASS) == BAM_FLAG_QC_NO_PASS;
 }
@@ -554,7 +554,7 @@ hasFlagQCNoPass(BamAlignmentRecord const & record)
  */
 
 inline bool
-hasFlagDuplicate(BamAlignmentRecord const & record)
+hasFlagDuplicate(BamAlignmentRecordCore const & record)
 {
     return (record.flag & BAM_FLAG_DUPLICATE) == BAM_FLAG_DUPLICATE;
 }
@@ -576,7 +576,7 @@ hasFlagDuplicate(BamAlignmentRecord const & record)
  */
 
 inline bool
-hasFlagSupplementary(BamAlignmentRecord const & record)
+hasFlagSupplementary(BamAlignmentRecordCore const & record)
 {
     return (record.flag & BAM_FLAG_SUPPLEMENTARY) == BAM_FLAG_SUPPLEMENTARY;
 }
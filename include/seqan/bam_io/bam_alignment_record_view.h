@@ -0,0 +1,462 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2015, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: SeqAn Team <seqan-dev@lists.fu-berlin.de>
+// ==========================================================================
+// Lightweight BAM record that references the raw record bytes and decodes
+// the variable-length fields (name, CIGAR, sequence, qualities, tags) only
+// on request.
+// ==========================================================================
+
+#ifndef INCLUDE_SEQAN_BAM_IO_BAM_ALIGNMENT_RECORD_VIEW_H_
+#define INCLUDE_SEQAN_BAM_IO_BAM_ALIGNMENT_RECORD_VIEW_H_
+
+namespace seqan {
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+class BamAlignmentRecordView;
+inline void clear(BamAlignmentRecordView & view);
+
+// ============================================================================
+// Classes
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Class BamAlignmentRecordView
+// ----------------------------------------------------------------------------
+
+/*!
+ * @class BamAlignmentRecordView
+ * @headerfile <seqan/bam_io.h>
+ * @signature class BamAlignmentRecordView;
+ * @brief Lazy view on a BAM record.
+ *
+ * The fixed-size fields (<tt>rID</tt>, <tt>beginPos</tt>, <tt>mapQ</tt>, <tt>flag</tt>, <tt>rNextId</tt>,
+ * <tt>pNext</tt>, <tt>tLen</tt>) are accessible as members like in @link BamAlignmentRecord @endlink.  The query
+ * name, CIGAR, sequence, qualities and tags are kept in BAM encoding and decoded only when requested via
+ * @link BamAlignmentRecordView#getQName @endlink, @link BamAlignmentRecordView#getCigar @endlink, etc.
+ *
+ * Whenever the record lies completely in the current buffer of the input stream, the view points directly into
+ * that buffer and no bytes are copied.  The view is only valid until the next record is read from the same file.
+ * Use @link BamAlignmentRecordView#assign @endlink to obtain a persistent @link BamAlignmentRecord @endlink.
+ *
+ * SAM records are supported as well but they are parsed and re-encoded, which is no faster than reading a
+ * @link BamAlignmentRecord @endlink.
+ *
+ * @see BamAlignmentRecord
+ * @see BamFileIn
+ */
+
+class BamAlignmentRecordView : public BamAlignmentRecordCore
+{
+public:
+    char const * _data;     // variable-length part of the record, i.e. name, cigar, seq, qual, tags
+    __uint32 _dataLen;
+    CharString _buffer;     // fallback copy, used if the record spans multiple stream buffers
+
+    BamAlignmentRecordView() : _data(NULL), _dataLen(0) { clear(*this); }
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function clear()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn BamAlignmentRecordView#clear
+ * @brief Reset a BamAlignmentRecordView to an empty record.
+ *
+ * @signature void clear(view);
+ *
+ * @param[in,out] view The BamAlignmentRecordView to clear.
+ */
+
+inline void
+clear(BamAlignmentRecordView & view)
+{
+    view.rID = BamAlignmentRecord::INVALID_REFID;
+    view.beginPos = BamAlignmentRecord::INVALID_POS;
+    view._l_qname = 1;
+    view.mapQ = 255;
+    view.bin = 0;
+    view._n_cigar = 0;
+    view.flag = 0;
+    view._l_qseq = 0;
+    view.rNextId = BamAlignmentRecord::INVALID_REFID;
+    view.pNext = BamAlignmentRecord::INVALID_POS;
+    view.tLen = BamAlignmentRecord::INVALID_LEN;
+    view._data = "";
+    view._dataLen = 1;
+}
+
+// ----------------------------------------------------------------------------
+// Function _cigarBegin(), _seqBegin(), _qualBegin(), _tagsBegin()
+// ----------------------------------------------------------------------------
+
+inline char const *
+_cigarBegin(BamAlignmentRecordView const & view)
+{
+    return view._data + view._l_qname;
+}
+
+inline char const *
+_seqBegin(BamAlignmentRecordView const & view)
+{
+    return _cigarBegin(view) + view._n_cigar * 4;
+}
+
+inline char const *
+_qualBegin(BamAlignmentRecordView const & view)
+{
+    return _seqBegin(view) + (view._l_qseq + 1) / 2;
+}
+
+inline char const *
+_tagsBegin(BamAlignmentRecordView const & view)
+{
+    return _qualBegin(view) + view._l_qseq;
+}
+
+// ----------------------------------------------------------------------------
+// Function getQName()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn BamAlignmentRecordView#getQName
+ * @brief Return the query name of a BamAlignmentRecordView without copying it.
+ *
+ * @signature Range<char const *> getQName(view);
+ *
+ * @param[in] view The BamAlignmentRecordView to query.
+ *
+ * @return Range<char const *> The query name.
+ */
+
+inline Range<char const *>
+getQName(BamAlignmentRecordView const & view)
+{
+    return Range<char const *>(view._data, view._data + view._l_qname - 1);
+}
+
+// ----------------------------------------------------------------------------
+// Function getCigar()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn BamAlignmentRecordView#getCigar
+ * @brief Decode the CIGAR string of a BamAlignmentRecordView.
+ *
+ * @signature void getCigar(cigar, view);
+ *
+ * @param[out] cigar The decoded CIGAR string, a <tt>String&lt;CigarElement&lt;&gt; &gt;</tt>.
+ * @param[in]  view  The BamAlignmentRecordView to decode.
+ */
+
+template <typename TCigarString>
+inline void
+getCigar(TCigarString & cigar, BamAlignmentRecordView const & view)
+{
+    char const * it = _cigarBegin(view);
+    _decodeBamCigar(cigar, it, view._n_cigar);
+}
+
+// ----------------------------------------------------------------------------
+// Function getSeq()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn BamAlignmentRecordView#getSeq
+ * @brief Decode the read sequence of a BamAlignmentRecordView.
+ *
+ * @signature void getSeq(seq, view);
+ *
+ * @param[out] seq  The decoded sequence, e.g. an @link IupacString @endlink.
+ * @param[in]  view The BamAlignmentRecordView to decode.
+ */
+
+template <typename TSequence>
+inline void
+getSeq(TSequence & seq, BamAlignmentRecordView const & view)
+{
+    char const * it = _seqBegin(view);
+    _decodeBamSeq(seq, it, view._l_qseq);
+}
+
+// ----------------------------------------------------------------------------
+// Function getQual()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn BamAlignmentRecordView#getQual
+ * @brief Decode the PHRED qualities of a BamAlignmentRecordView (as in SAM, empty for '*').
+ *
+ * @signature void getQual(qual, view);
+ *
+ * @param[out] qual The decoded qualities, e.g. a @link CharString @endlink.
+ * @param[in]  view The BamAlignmentRecordView to decode.
+ */
+
+template <typename TQualString>
+inline void
+getQual(TQualString & qual, BamAlignmentRecordView const & view)
+{
+    char const * it = _qualBegin(view);
+    _decodeBamQual(qual, it, view._l_qseq);
+}
+
+// ----------------------------------------------------------------------------
+// Function getTags()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn BamAlignmentRecordView#getTags
+ * @brief Return the raw BAM tags of a BamAlignmentRecordView without copying them.
+ *
+ * @signature Range<char const *> getTags(view);
+ *
+ * @param[in] view The BamAlignmentRecordView to query.
+ *
+ * @return Range<char const *> The tags in BAM format.
+ */
+
+inline Range<char const *>
+getTags(BamAlignmentRecordView const & view)
+{
+    return Range<char const *>(_tagsBegin(view), view._data + view._dataLen);
+}
+
+// ----------------------------------------------------------------------------
+// Function getAlignmentLengthInRef()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn BamAlignmentRecordView#getAlignmentLengthInRef
+ * @brief Return the alignment length in the record's projection in the reference.
+ *
+ * @signature unsigned getAlignmentLengthInRef(view);
+ *
+ * @param[in] view The BamAlignmentRecordView to compute length for.
+ *
+ * @return unsigned The alignment length.
+ */
+
+inline unsigned
+getAlignmentLengthInRef(BamAlignmentRecordView const & view)
+{
+    // all operations except I, S and H consume the reference
+    static const unsigned CONSUMES_NO_REF = (1u << 1) | (1u << 4) | (1u << 5);
+
+    char const * it = _cigarBegin(view);
+    unsigned l = 0;
+    for (unsigned i = 0; i < view._n_cigar; ++i)
+    {
+        __uint32 opAndCnt;
+        arrayCopyForward(it, it + sizeof(opAndCnt), reinterpret_cast<char*>(&opAndCnt));
+        it += sizeof(opAndCnt);
+        if (((CONSUMES_NO_REF >> (opAndCnt & 15)) & 1) == 0)
+            l += opAndCnt >> 4;
+    }
+    return l;
+}
+
+// ----------------------------------------------------------------------------
+// Function assign()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn BamAlignmentRecordView#assign
+ * @brief Decode all fields of a BamAlignmentRecordView into a BamAlignmentRecord.
+ *
+ * @signature void assign(record, view);
+ *
+ * @param[out] record The resulting @link BamAlignmentRecord @endlink.
+ * @param[in]  view   The BamAlignmentRecordView to decode.
+ */
+
+inline void
+assign(BamAlignmentRecord & record, BamAlignmentRecordView const & view)
+{
+    static_cast<BamAlignmentRecordCore &>(record) = view;
+
+    Range<char const *> qName = getQName(view);
+    assign(record.qName, qName);
+    getCigar(record.cigar, view);
+    getSeq(record.seq, view);
+    getQual(record.qual, view);
+    Range<char const *> tags = getTags(view);
+    assign(record.tags, tags);
+}
+
+// ----------------------------------------------------------------------------
+// Function _referenceBamRecordData()
+// ----------------------------------------------------------------------------
+
+// non-chunked iterator: copy the record into the view's buffer
+template <typename TForwardIter>
+inline void
+_referenceBamRecordData(BamAlignmentRecordView & view, TForwardIter & iter, __uint32 len, Nothing)
+{
+    clear(view._buffer);
+    write(view._buffer, iter, (size_t)len);
+    view._data = begin(view._buffer, Standard());
+}
+
+// chunked iterator: reference the record in place if it fits into the current chunk
+template <typename TForwardIter, typename TValue>
+inline void
+_referenceBamRecordData(BamAlignmentRecordView & view, TForwardIter & iter, __uint32 len, Range<TValue *>)
+{
+    Range<TValue *> ichunk;
+    getChunk(ichunk, iter, Input());
+    if (length(ichunk) == 0u)
+    {
+        reserveChunk(iter, len, Input());
+        getChunk(ichunk, iter, Input());
+    }
+
+    if (length(ichunk) >= len)
+    {
+        view._data = ichunk.begin;
+        advanceChunk(iter, len);
+    }
+    else
+    {
+        _referenceBamRecordData(view, iter, len, Nothing());
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function readRecord()                                 BamAlignmentRecordView
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn BamAlignmentRecordView#readRecord
+ * @brief Read the next BAM record into a BamAlignmentRecordView.
+ *
+ * @signature void readRecord(view, bamFileIn);
+ *
+ * @param[out]    view      The BamAlignmentRecordView to read into.  It stays valid until the next read.
+ * @param[in,out] bamFileIn The @link BamFileIn @endlink to read from.
+ *
+ * @throw IOError On low-level I/O errors.
+ * @throw ParseError On high-level file format errors.
+ */
+
+template <typename TForwardIter, typename TNameStore, typename TNameStoreCache, typename TStorageSpec>
+inline void
+readRecord(BamAlignmentRecordView & view,
+           BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & context,
+           TForwardIter & iter,
+           Bam const & /* tag */)
+{
+    __int32 recordLen = 0;
+    readRawPod(recordLen, iter);
+
+    // fail, if we read "BAM\1" (did you miss to call readRecord(header, bamFile) first?)
+    if (recordLen == 0x014D4142)
+        SEQAN_THROW(ParseError("Unexpected BAM header encountered."));
+    if (recordLen < (__int32)sizeof(BamAlignmentRecordCore))
+        SEQAN_THROW(ParseError("BAM record is too short."));
+
+    // BamAlignmentRecordCore.
+    write(reinterpret_cast<char*>(static_cast<BamAlignmentRecordCore *>(&view)), iter, sizeof(BamAlignmentRecordCore));
+    _translateBamRefIds(view, context);
+
+    // Remaining variable-length block.
+    view._dataLen = recordLen - sizeof(BamAlignmentRecordCore);
+    if (view._dataLen < view._l_qname + view._n_cigar * 4u + (view._l_qseq + 1) / 2 + view._l_qseq)
+        SEQAN_THROW(ParseError("BAM record is too short."));
+    _referenceBamRecordData(view, iter, view._dataLen, typename Chunk<TForwardIter>::Type());
+}
+
+// support for dynamically chosen file formats
+template <typename TForwardIter, typename TNameStore, typename TNameStoreCache, typename TStorageSpec>
+inline void
+readRecord(BamAlignmentRecordView & /* view */,
+           BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & /* context */,
+           TForwardIter & /* iter */,
+           TagSelector<> const & /* format */)
+{
+    SEQAN_FAIL("BamFileIn: File format not specified.");
+}
+
+template <typename TForwardIter, typename TNameStore, typename TNameStoreCache, typename TStorageSpec, typename TTagList>
+inline void
+readRecord(BamAlignmentRecordView & view,
+           BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & context,
+           TForwardIter & iter,
+           TagSelector<TTagList> const & format)
+{
+    typedef typename TTagList::Type TFormat;
+
+    if (isEqual(format, TFormat()))
+        readRecord(view, context, iter, TFormat());
+    else
+        readRecord(view, context, iter, static_cast<typename TagSelector<TTagList>::Base const &>(format));
+}
+
+// SAM records are parsed and re-encoded in BAM format into the view's buffer
+template <typename TForwardIter, typename TNameStore, typename TNameStoreCache, typename TStorageSpec>
+inline void
+readRecord(BamAlignmentRecordView & view,
+           BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & context,
+           TForwardIter & iter,
+           Sam const & tag)
+{
+    BamAlignmentRecord record;
+    readRecord(record, context, iter, tag);
+    updateLengths(record);
+
+    clear(view._buffer);
+    _writeBamRecord(view._buffer, record, Bam());
+
+    static_cast<BamAlignmentRecordCore &>(view) = record;
+    view._data = begin(view._buffer, Standard()) + sizeof(BamAlignmentRecordCore);
+    view._dataLen = length(view._buffer) - sizeof(BamAlignmentRecordCore);
+}
+
+// convient BamFile variant
+template <typename TSpec>
+inline void
+readRecord(BamAlignmentRecordView & view, FormattedFile<Bam, Input, TSpec> & file)
+{
+    readRecord(view, context(file), file.iter, file.format);
+}
+
+}  // namespace seqan
+
+#endif  // INCLUDE_SEQAN_BAM_IO_BAM_ALIGNMENT_RECORD_VIEW_H_
@@ -241,6 +241,74 @@ readRecord(BamAlignmentRecord & record, FormattedFile<Bam, Input, TSpec> & file)
     readRecord(record, context(file), file.iter, file.format);
 }
 
+// ----------------------------------------------------------------------------
+// Function _parseBamRecord(); BamAlignmentRecord
+// ----------------------------------------------------------------------------
+
+// support for dynamically chosen file formats
+template <typename TNameStore, typename TNameStoreCache, typename TStorageSpec, typename TRawRecord>
+inline void
+_parseBamRecord(BamAlignmentRecord & /* record */,
+                BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & /* context */,
+                TRawRecord const & /* rawRecord */,
+                TagSelector<> const & /* format */)
+{
+    SEQAN_FAIL("BamFileIn: File format not specified.");
+}
+
+template <typename TNameStore, typename TNameStoreCache, typename TStorageSpec, typename TRawRecord, typename TTagList>
+inline void
+_parseBamRecord(BamAlignmentRecord & record,
+                BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & context,
+                TRawRecord const & rawRecord,
+                TagSelector<TTagList> const & format)
+{
+    typedef typename TTagList::Type TFormat;
+
+    if (isEqual(format, TFormat()))
+        _parseBamRecord(record, context, rawRecord, TFormat());
+    else
+        _parseBamRecord(record, context, rawRecord, static_cast<typename TagSelector<TTagList>::Base const &>(format));
+}
+
+// ----------------------------------------------------------------------------
+// Function _resolveBamRecordNames(); BamAlignmentRecord
+// ----------------------------------------------------------------------------
+
+// support for dynamically chosen file formats
+template <typename TNameStore, typename TNameStoreCache, typename TStorageSpec, typename TRawRecord>
+inline void
+_resolveBamRecordNames(BamAlignmentRecord & /* record */,
+                       BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & /* context */,
+                       TRawRecord const & /* rawRecord */,
+                       TagSelector<> const & /* format */)
+{
+    SEQAN_FAIL("BamFileIn: File format not specified.");
+}
+
+template <typename TNameStore, typename TNameStoreCache, typename TStorageSpec, typename TRawRecord, typename TTagList>
+inline void
+_resolveBamRecordNames(BamAlignmentRecord & record,
+                       BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & context,
+                       TRawRecord const & rawRecord,
+                       TagSelector<TTagList> const & format)
+{
+    typedef typename TTagList::Type TFormat;
+
+    if (isEqual(format, TFormat()))
+        _resolveBamRecordNames(record, context, rawRecord, TFormat());
+    else
+        _resolveBamRecordNames(record, context, rawRecord,
+                               static_cast<typename TagSelector<TTagList>::Base const &>(format));
+}
+
+// ----------------------------------------------------------------------------
+// Function readRecords(); BamAlignmentRecord
+// ----------------------------------------------------------------------------
+// The raw records are split off the (already decompressed) input by the calling
+// thread, then they are decoded by all threads.  The records keep file order.
+// SAM contig names are looked up by the calling thread afterwards.
+
 template <typename TRecords, typename TSpec, typename TSize>
 inline SEQAN_FUNC_ENABLE_IF(And<IsSameType<typename Value<TRecords>::Type, BamAlignmentRecord>,
                                 IsInteger<TSize> >, TSize)
@@ -252,17 +320,39 @@ readRecords(TRecords & records, FormattedFile<Bam, Input, TSpec> & file, TSize m
     if (static_cast<TSize>(length(records)) < maxRecords)
         resize(records, maxRecords, Exact());
 
-
     TSize numRecords = 0;
     for (; numRecords < maxRecords && !atEnd(file.iter); ++numRecords)
         _readBamRecord(buffers[numRecords], file.iter, file.format);
 
-//    SEQAN_OMP_PRAGMA(parallel for)
+    // Remember the error of the first broken record.
+    int errorPos = numRecords;
+    std::string error;
+
+    SEQAN_OMP_PRAGMA(parallel for schedule(dynamic, 256))
     for (int i = 0; i < (int)numRecords; ++i)
     {
-        CharIterator bufIter = begin(buffers[i]);
-        readRecord(records[i], context(file), bufIter, file.format);
+        try
+        {
+            _parseBamRecord(records[i], context(file), buffers[i], file.format);
+        }
+        catch (ParseError const & e)
+        {
+            SEQAN_OMP_PRAGMA(critical (readRecordsError))
+            if (i < errorPos)
+            {
+                errorPos = i;
+                error = e.what();
+            }
+        }
     }
+
+    // Look up the contig names in file order, as readRecord() would.
+    for (int i = 0; i < errorPos; ++i)
+        _resolveBamRecordNames(records[i], context(file), buffers[i], file.format);
+
+    if (errorPos != (int)numRecords)
+        throw ParseError(error);
+
     return numRecords;
 }
 
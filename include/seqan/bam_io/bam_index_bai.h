@@ -319,6 +319,54 @@ jumpToRegion(FormattedFile<Bam, Input, TSpec> & bamFile,
     return true;
 }
 
+// ----------------------------------------------------------------------------
+// Function _getRegionChunks()
+// ----------------------------------------------------------------------------
+
+// Appends the chunks [begin, end) of virtual offsets that may contain alignments overlapping [pos, posEnd).
+
+inline void
+_getRegionChunks(String<Pair<__uint64, __uint64> > & chunks,
+                 BamIndex<Bai> const & index,
+                 __int32 refId,
+                 __int32 pos,
+                 __int32 posEnd)
+{
+    typedef BamIndex<Bai>::TBinIndex_                                           TBinIndex;
+    typedef BamIndex<Bai>::TLinearIndex_                                        TLinearIndex;
+    typedef Iterator<String<__uint16>, Rooted>::Type                            TCandidateIter;
+    typedef Iterator<String<Pair<__uint64, __uint64> > const, Rooted>::Type     TBegEndIter;
+
+    if (refId < 0 || static_cast<unsigned>(refId) >= length(index._binIndices))
+        return;
+    if (pos < 0)
+        pos = 0;
+
+    // Retrieve the smallest required offset from the linear index.
+    TLinearIndex const & linearIndex = index._linearIndices[refId];
+    unsigned windowIdx = pos >> BamIndex<Bai>::BAM_LIDX_SHIFT;
+    __uint64 minOffset = 0;
+    if (windowIdx < length(linearIndex))
+        minOffset = linearIndex[windowIdx];
+    else if (!empty(linearIndex))
+        minOffset = back(linearIndex);
+
+    String<__uint16> candidateBins;
+    _baiReg2bins(candidateBins, pos, posEnd);
+
+    TBinIndex const & binIndex = index._binIndices[refId];
+    for (TCandidateIter it = begin(candidateBins, Rooted()); !atEnd(it); goNext(it))
+    {
+        TBinIndex::const_iterator mIt = binIndex.find(*it);
+        if (mIt == binIndex.end())
+            continue;  // Candidate is not in index!
+
+        for (TBegEndIter it2 = begin(mIt->second.chunkBegEnds, Rooted()); !atEnd(it2); goNext(it2))
+            if (it2->i2 > minOffset)
+                appendValue(chunks, Pair<__uint64, __uint64>(std::max(it2->i1, minOffset), it2->i2));
+    }
+}
+
 // ----------------------------------------------------------------------------
 // Function jumpToOrphans()
 // ----------------------------------------------------------------------------
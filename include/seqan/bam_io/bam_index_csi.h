@@ -0,0 +1,624 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2015, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: SeqAn Team <seqan-dev@lists.fu-berlin.de>
+// ==========================================================================
+// CSI (coordinate-sorted index) support for BAM files.
+//
+// In contrast to BAI, a CSI index has a configurable minimal bin size and
+// number of binning levels.  Thus, it can index contigs longer than 2^29 bp.
+// Instead of a linear index, each bin stores the smallest virtual file
+// offset of the records overlapping its first window (loffset).
+// ==========================================================================
+
+#ifndef INCLUDE_SEQAN_BAM_IO_BAM_INDEX_CSI_H_
+#define INCLUDE_SEQAN_BAM_IO_BAM_INDEX_CSI_H_
+
+namespace seqan {
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Tag Csi
+// ----------------------------------------------------------------------------
+
+struct Csi_;
+typedef Tag<Csi_> Csi;
+
+// ----------------------------------------------------------------------------
+// Helper Class CsiBamIndexBinData_
+// ----------------------------------------------------------------------------
+
+// Store the information of a bin.
+
+struct CsiBamIndexBinData_
+{
+    __uint64 loffset;
+    String<Pair<__uint64, __uint64> > chunkBegEnds;
+
+    CsiBamIndexBinData_() : loffset(0)
+    {}
+};
+
+// ----------------------------------------------------------------------------
+// Spec CSI BamIndex
+// ----------------------------------------------------------------------------
+
+/*!
+ * @class CsiBamIndex
+ * @headerfile <seqan/bam_io.h>
+ * @extends BamIndex
+ * @brief Access to CSI indices (coordinate-sorted index).
+ *
+ * @signature template <>
+ *            class BamIndex<Csi>;
+ *
+ * CSI indices generalize BAI indices to references longer than 2^29 bp.  @link CsiBamIndex#build @endlink chooses the
+ * number of binning levels from the reference lengths in the BAM header and the size of the smallest bin
+ * (<tt>minShift</tt>, default 14), which can be set before building.
+ */
+
+template <>
+class BamIndex<Csi>
+{
+public:
+    typedef std::map<__uint32, CsiBamIndexBinData_> TBinIndex_;
+
+    __int32 minShift;           // log2 of the size of the smallest bin
+    __int32 depth;              // number of binning levels
+    CharString aux;             // auxiliary data (unused for BAM)
+    __uint64 _unalignedCount;
+
+    String<TBinIndex_> _binIndices;
+
+    BamIndex() : minShift(14), depth(5), _unalignedCount(maxValue<__uint64>())
+    {}
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _csiBinFirst()
+// ----------------------------------------------------------------------------
+
+// Returns the id of the first bin on the given level.
+
+inline __uint32
+_csiBinFirst(__int32 level)
+{
+    return ((1u << (level * 3)) - 1) / 7;
+}
+
+// ----------------------------------------------------------------------------
+// Function _csiReg2bin()
+// ----------------------------------------------------------------------------
+
+// Returns the smallest bin that fully contains [beg, end).
+
+inline __uint32
+_csiReg2bin(__int64 beg, __int64 end, __int32 minShift, __int32 depth)
+{
+    --end;
+    for (__int32 level = depth, s = minShift; level > 0; --level, s += 3)
+        if (beg >> s == end >> s)
+            return _csiBinFirst(level) + static_cast<__uint32>(beg >> s);
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Function _csiReg2bins()
+// ----------------------------------------------------------------------------
+
+// Appends all bins that overlap [beg, end).
+
+inline void
+_csiReg2bins(String<__uint32> & list, __int64 beg, __int64 end, __int32 minShift, __int32 depth)
+{
+    if (beg >= end)
+        return;
+    __int64 maxEnd = (__int64)1 << (minShift + depth * 3);
+    if (end > maxEnd)
+        end = maxEnd;
+    --end;
+    for (__int32 level = 0, s = minShift + depth * 3; level <= depth; ++level, s -= 3)
+    {
+        __uint32 first = _csiBinFirst(level);
+        for (__uint32 k = first + (beg >> s); k <= first + (end >> s); ++k)
+            appendValue(list, k);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _csiMinOffset()
+// ----------------------------------------------------------------------------
+
+// Returns the smallest virtual offset of records overlapping position pos.  The bin of the window containing pos or
+// the closest preceding bin on the same or a higher level provides the lower bound.
+
+inline __uint64
+_csiMinOffset(BamIndex<Csi>::TBinIndex_ const & binIndex, __int64 pos, __int32 minShift, __int32 depth)
+{
+    __uint32 bin = _csiBinFirst(depth) + static_cast<__uint32>(pos >> minShift);
+    do
+    {
+        BamIndex<Csi>::TBinIndex_::const_iterator it = binIndex.find(bin);
+        if (it != binIndex.end())
+            return it->second.loffset;
+
+        __uint32 first = (((bin - 1) >> 3) << 3) + 1;   // first sibling
+        if (bin > first)
+            --bin;
+        else
+            bin = (bin - 1) >> 3;                       // parent
+    }
+    while (bin != 0);
+
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Function _getRegionChunks()
+// ----------------------------------------------------------------------------
+
+// Appends the chunks [begin, end) of virtual offsets that may contain alignments overlapping [pos, posEnd).
+
+inline void
+_getRegionChunks(String<Pair<__uint64, __uint64> > & chunks,
+                 BamIndex<Csi> const & index,
+                 __int32 refId,
+                 __int32 pos,
+                 __int32 posEnd)
+{
+    typedef BamIndex<Csi>::TBinIndex_                                           TBinIndex;
+    typedef Iterator<String<__uint32>, Rooted>::Type                            TCandidateIter;
+    typedef Iterator<String<Pair<__uint64, __uint64> > const, Rooted>::Type     TBegEndIter;
+
+    if (refId < 0 || static_cast<unsigned>(refId) >= length(index._binIndices))
+        return;
+    if (pos < 0)
+        pos = 0;
+
+    TBinIndex const & binIndex = index._binIndices[refId];
+    __uint64 minOffset = _csiMinOffset(binIndex, pos, index.minShift, index.depth);
+
+    // Retrieve the candidate bin identifiers for [pos, posEnd).
+    String<__uint32> candidateBins;
+    _csiReg2bins(candidateBins, pos, posEnd, index.minShift, index.depth);
+
+    for (TCandidateIter it = begin(candidateBins, Rooted()); !atEnd(it); goNext(it))
+    {
+        TBinIndex::const_iterator mIt = binIndex.find(*it);
+        if (mIt == binIndex.end())
+            continue;  // Candidate is not in index!
+
+        for (TBegEndIter it2 = begin(mIt->second.chunkBegEnds, Rooted()); !atEnd(it2); goNext(it2))
+            if (it2->i2 > minOffset)
+                appendValue(chunks, Pair<__uint64, __uint64>(std::max(it2->i1, minOffset), it2->i2));
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function jumpToRegion()
+// ----------------------------------------------------------------------------
+
+template <typename TSpec>
+inline bool
+jumpToRegion(FormattedFile<Bam, Input, TSpec> & bamFile,
+             bool & hasAlignments,
+             __int32 refId,
+             __int32 pos,
+             __int32 posEnd,
+             BamIndex<Csi> const & index)
+{
+    typedef Iterator<String<Pair<__uint64, __uint64> >, Standard>::Type TChunkIter;
+
+    if (!isEqual(format(bamFile), Bam()))
+        return false;
+
+    hasAlignments = false;
+    if (refId < 0)
+        return false;  // Cannot seek to invalid reference.
+    if (static_cast<unsigned>(refId) >= length(index._binIndices))
+        return false;  // Cannot seek to invalid reference.
+
+    if (pos < 0)
+        pos = 0;
+
+    // The leftmost chunk is the first to scan.
+    String<Pair<__uint64, __uint64> > chunks;
+    _getRegionChunks(chunks, index, refId, pos, posEnd);
+
+    __uint64 offset = MaxValue<__uint64>::VALUE;
+    for (TChunkIter it = begin(chunks, Standard()); it != end(chunks, Standard()); ++it)
+        offset = std::min(offset, it->i1);
+
+    if (offset == MaxValue<__uint64>::VALUE)
+        return true;  // No chunk overlaps the region.
+
+    // Scan forward to the first alignment overlapping [pos, posEnd).
+    BamAlignmentRecordView record;
+    setPosition(bamFile, offset);
+    while (!atEnd(bamFile))
+    {
+        offset = position(bamFile);
+        readRecord(record, bamFile);
+
+        if (record.rID != refId)
+        {
+            if (record.rID < 0 || record.rID > refId)
+                break;  // Passed the contig.
+            continue;
+        }
+        if (record.beginPos >= posEnd)
+            break;  // Cannot find overlapping any more.
+
+        __int32 endPos = record.beginPos + std::max(getAlignmentLengthInRef(record), 1u);
+        if (endPos > pos)
+        {
+            hasAlignments = true;
+            setPosition(bamFile, offset);
+            break;
+        }
+    }
+
+    // Finding no overlapping alignment is not an error, hasAlignments is false.
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Function getUnalignedCount()
+// ----------------------------------------------------------------------------
+
+inline __uint64
+getUnalignedCount(BamIndex<Csi> const & index)
+{
+    return index._unalignedCount;
+}
+
+// ----------------------------------------------------------------------------
+// Function open()
+// ----------------------------------------------------------------------------
+
+inline bool
+open(BamIndex<Csi> & index, char const * filename)
+{
+    typedef VirtualStream<char, Input>                  TInStream;
+    typedef DirectionIterator<TInStream, Input>::Type   TIter;
+
+    std::fstream file(filename, std::ios::binary | std::ios::in);
+    if (!file.good())
+        return false;  // Could not open file.
+
+    // CSI files are BGZF compressed.
+    TInStream csi;
+    if (!open(csi, file))
+        return false;
+
+    TIter iter = directionIterator(csi, Input());
+
+    // Read magic number.
+    String<char, Array<4> > magic;
+    read(magic, iter, 4);
+    if (magic != "CSI\1")
+        return false;  // Magic number is wrong.
+
+    // Read binning parameters and auxiliary data.
+    __int32 lAux = 0;
+    readRawPod(index.minShift, iter);
+    readRawPod(index.depth, iter);
+    readRawPod(lAux, iter);
+    clear(index.aux);
+    read(index.aux, iter, lAux);
+
+    __int32 nRef = 0;
+    readRawPod(nRef, iter);
+
+    clear(index._binIndices);
+    resize(index._binIndices, nRef);
+
+    CsiBamIndexBinData_ data;
+    for (int i = 0; i < nRef; ++i)  // For each reference.
+    {
+        __int32 nBin = 0;
+        readRawPod(nBin, iter);
+
+        for (int j = 0; j < nBin; ++j)  // For each bin.
+        {
+            __uint32 bin = 0;
+            __int32 nChunk = 0;
+            readRawPod(bin, iter);
+            readRawPod(data.loffset, iter);
+            readRawPod(nChunk, iter);
+
+            resize(data.chunkBegEnds, nChunk);
+            for (int k = 0; k < nChunk; ++k)  // For each chunk.
+            {
+                readRawPod(data.chunkBegEnds[k].i1, iter);
+                readRawPod(data.chunkBegEnds[k].i2, iter);
+            }
+
+            // Copy bin data into index.
+            index._binIndices[i][bin] = data;
+        }
+    }
+
+    // Read (optional) number of alignments without coordinate.
+    if (!atEnd(iter))
+        readRawPod(index._unalignedCount, iter);
+    else
+        index._unalignedCount = maxValue<__uint64>();
+
+    return true;
+}
+
+inline bool
+open(BamIndex<Csi> & index, char * filename)
+{
+    return open(index, static_cast<char const *>(filename));
+}
+
+// ---------------------------------------------------------------------------
+// Function save()
+// ---------------------------------------------------------------------------
+
+inline bool
+save(BamIndex<Csi> const & index, char const * csiFilename)
+{
+    typedef VirtualStream<char, Output>                 TOutStream;
+    typedef DirectionIterator<TOutStream, Output>::Type TIter;
+    typedef BamIndex<Csi>::TBinIndex_ const             TBinIndex;
+    typedef TBinIndex::const_iterator                   TBinIndexIter;
+    typedef Iterator<String<Pair<__uint64> > const, Rooted>::Type TChunkIter;
+
+    std::ofstream file(csiFilename, std::ios::binary | std::ios::out);
+    if (!file.good())
+        return false;  // Could not open file.
+
+    {
+        // CSI files are BGZF compressed.
+        TOutStream csi;
+        if (!open(csi, file, BgzfFile()))
+            return false;
+
+        TIter iter = directionIterator(csi, Output());
+
+        // Write header.
+        write(iter, "CSI\1");
+        appendRawPod(iter, index.minShift);
+        appendRawPod(iter, index.depth);
+        appendRawPod(iter, (__int32)length(index.aux));
+        write(iter, index.aux);
+
+        __int32 numRefSeqs = length(index._binIndices);
+        appendRawPod(iter, numRefSeqs);
+
+        // Write out binning indices.
+        for (int i = 0; i < numRefSeqs; ++i)
+        {
+            TBinIndex & binIndex = index._binIndices[i];
+            appendRawPod(iter, (__int32)binIndex.size());
+            for (TBinIndexIter itB = binIndex.begin(), itBEnd = binIndex.end(); itB != itBEnd; ++itB)
+            {
+                appendRawPod(iter, itB->first);
+                appendRawPod(iter, itB->second.loffset);
+                appendRawPod(iter, (__int32)length(itB->second.chunkBegEnds));
+                for (TChunkIter itC = begin(itB->second.chunkBegEnds, Rooted()); !atEnd(itC); goNext(itC))
+                {
+                    appendRawPod(iter, itC->i1);
+                    appendRawPod(iter, itC->i2);
+                }
+            }
+        }
+
+        // Write the number of unaligned reads if set.
+        if (index._unalignedCount != maxValue<__uint64>())
+            appendRawPod(iter, index._unalignedCount);
+
+        close(csi);
+    }
+
+    return file.good();  // false on error, true on success.
+}
+
+// ---------------------------------------------------------------------------
+// Function _csiAddChunkToBin()
+// ---------------------------------------------------------------------------
+
+inline void
+_csiAddChunkToBin(BamIndex<Csi>::TBinIndex_ & binIndex, __uint32 bin, __uint64 chunkBeg, __uint64 chunkEnd)
+{
+    appendValue(binIndex[bin].chunkBegEnds, Pair<__uint64>(chunkBeg, chunkEnd));
+}
+
+// ---------------------------------------------------------------------------
+// Function _csiFinalizeBins()
+// ---------------------------------------------------------------------------
+
+// Derive the loffset of each bin from a temporary linear index of minimal-bin-sized windows.
+
+inline void
+_csiFinalizeBins(BamIndex<Csi>::TBinIndex_ & binIndex, String<__uint64> & linearIndex,
+                 __int32 depth)
+{
+    typedef BamIndex<Csi>::TBinIndex_::iterator TBinIndexIter;
+
+    if (empty(linearIndex))
+        return;
+
+    // Windows not covered by any record inherit the offset of the next covered window.
+    for (int i = (int)length(linearIndex) - 2; i >= 0; --i)
+        if (linearIndex[i] == MaxValue<__uint64>::VALUE)
+            linearIndex[i] = linearIndex[i + 1];
+
+    for (TBinIndexIter it = binIndex.begin(); it != binIndex.end(); ++it)
+    {
+        __int32 level = 0;
+        while (level < depth && it->first >= _csiBinFirst(level + 1))
+            ++level;
+
+        __uint64 window = (__uint64)(it->first - _csiBinFirst(level)) << ((depth - level) * 3);
+        it->second.loffset = (window < length(linearIndex)) ? linearIndex[window] : 0;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Function build()
+// ---------------------------------------------------------------------------
+
+/*!
+ * @fn CsiBamIndex#build
+ * @brief Create a CSI index from a coordinate-sorted BAM file in a single pass.
+ *
+ * @signature bool build(csiIndex, bamFileName);
+ *
+ * @param[out] csiIndex    The BamIndex to build into.
+ * @param[in]  bamFileName Path to the BAM file to build an index for.  Type: <tt>char const *</tt>.
+ *
+ * @return bool <tt>true</tt> on success, <tt>false</tt> otherwise (e.g. if the file is not sorted).
+ */
+
+inline bool
+build(BamIndex<Csi> & index, char const * bamFilename)
+{
+    index._unalignedCount = 0;
+    clear(index.aux);
+    clear(index._binIndices);
+
+    // Open BAM file for reading.
+    BamFileIn bamFile;
+    if (!open(bamFile, bamFilename))
+        return false;  // Could not open BAM file.
+    if (!isEqual(format(bamFile), Bam()))
+        return false;  // Virtual offsets require BGZF.
+
+    // Read BAM header.
+    BamHeader header;
+    readHeader(header, bamFile);
+
+    // Choose the number of levels such that the longest contig fits into the root bin.
+    __uint32 numRefSeqs = length(contigNames(context(bamFile)));
+    __int64 maxLen = 0;
+    for (unsigned i = 0; i < length(contigLengths(context(bamFile))); ++i)
+        maxLen = std::max(maxLen, (__int64)contigLengths(context(bamFile))[i]);
+    maxLen += 256;
+    index.depth = 0;
+    for (__int64 s = (__int64)1 << index.minShift; maxLen > s; s <<= 3)
+        ++index.depth;
+
+    resize(index._binIndices, numRefSeqs);
+    String<__uint64> linearIndex;
+
+    // Scan over BAM file and create index.
+    BamAlignmentRecordView record;
+    __uint32 currBin    = maxValue<__uint32>();
+    __int32 currRefId   = BamAlignmentRecord::INVALID_REFID;
+    __int32 prevPos     = minValue<__int32>();
+    __uint64 chunkBeg   = position(bamFile);
+    __uint64 recordBeg  = chunkBeg;
+    __int64 maxEnd      = (__int64)1 << (index.minShift + index.depth * 3);
+
+    while (!atEnd(bamFile))
+    {
+        recordBeg = position(bamFile);
+        readRecord(record, bamFile);
+
+        // Close the chunk of the previous reference and check ordering.
+        if (record.rID != currRefId)
+        {
+            if (currBin != maxValue<__uint32>())
+            {
+                _csiAddChunkToBin(index._binIndices[currRefId], currBin, chunkBeg, recordBeg);
+                _csiFinalizeBins(index._binIndices[currRefId], linearIndex, index.depth);
+            }
+
+            if (record.rID >= 0 && (record.rID < currRefId || index._unalignedCount != 0u))
+                return false;  // Not sorted by reference.
+            if (record.rID >= 0 && static_cast<__uint32>(record.rID) >= numRefSeqs)
+                return false;  // Invalid reference id.
+
+            currRefId = record.rID;
+            currBin = maxValue<__uint32>();
+            prevPos = minValue<__int32>();
+            clear(linearIndex);
+        }
+
+        // Alignments without coordinate are only counted.
+        if (record.rID < 0 || record.beginPos < 0)
+        {
+            ++index._unalignedCount;
+            continue;
+        }
+
+        if (prevPos > record.beginPos)
+            return false;  // Not sorted by position.
+        prevPos = record.beginPos;
+
+        __int64 beg = record.beginPos;
+        __int64 end = beg + std::max(getAlignmentLengthInRef(record), 1u);
+        if (end > maxEnd)
+            return false;  // Alignment exceeds the reference length.
+
+        // Store the first record offset for every covered window.
+        __uint64 lastWindow = (end - 1) >> index.minShift;
+        if (length(linearIndex) <= lastWindow)
+            resize(linearIndex, lastWindow + 1, MaxValue<__uint64>::VALUE);
+        for (__uint64 w = beg >> index.minShift; w <= lastWindow; ++w)
+            if (linearIndex[w] == MaxValue<__uint64>::VALUE)
+                linearIndex[w] = recordBeg;
+
+        // Handle the case if we changed to a new bin.
+        __uint32 bin = _csiReg2bin(beg, end, index.minShift, index.depth);
+        if (bin != currBin)
+        {
+            if (currBin != maxValue<__uint32>())
+                _csiAddChunkToBin(index._binIndices[currRefId], currBin, chunkBeg, recordBeg);
+            chunkBeg = recordBeg;
+            currBin = bin;
+        }
+    }
+
+    // Store the last chunk.
+    if (currRefId >= 0 && currBin != maxValue<__uint32>())
+    {
+        _csiAddChunkToBin(index._binIndices[currRefId], currBin, chunkBeg, position(bamFile));
+        _csiFinalizeBins(index._binIndices[currRefId], linearIndex, index.depth);
+    }
+
+    return true;
+}
+
+}  // namespace seqan
+
+#endif  // #ifndef INCLUDE_SEQAN_BAM_IO_BAM_INDEX_CSI_H_
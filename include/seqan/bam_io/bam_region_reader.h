@@ -0,0 +1,285 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2015, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: SeqAn Team <seqan-dev@lists.fu-berlin.de>
+// ==========================================================================
+// Multi-region queries on indexed BAM files.
+//
+// The chunk lists of all query regions are merged into a sorted list of
+// disjoint virtual offset ranges that are scanned once in file order.  Each
+// alignment is reported once together with the ids of all regions it
+// overlaps.  Compressed blocks shared by neighbouring chunks are served from
+// the block cache of the BGZF stream.
+// ==========================================================================
+
+#ifndef INCLUDE_SEQAN_BAM_IO_BAM_REGION_READER_H_
+#define INCLUDE_SEQAN_BAM_IO_BAM_REGION_READER_H_
+
+namespace seqan {
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Class BamRegionReader
+// ----------------------------------------------------------------------------
+
+/*!
+ * @class BamRegionReader
+ * @headerfile <seqan/bam_io.h>
+ * @brief Read the alignments overlapping a list of genomic regions from an indexed BAM file.
+ *
+ * @signature template <typename TIndexSpec[, typename TFileSpec]>
+ *            class BamRegionReader;
+ *
+ * @tparam TIndexSpec The specialization of the @link BamIndex @endlink, e.g. <tt>Bai</tt> or <tt>Csi</tt>.
+ * @tparam TFileSpec  The specialization of the @link BamFileIn @endlink, defaults to <tt>void</tt>.
+ *
+ * The chunks of all regions are merged, so each part of the file is read at most once even if regions overlap or
+ * lie close to each other.  Every alignment is returned once, together with the ids (positions in the region list)
+ * of all regions it overlaps.  Alignments are returned in file order.
+ *
+ * A region is resolved by its @link GenomicRegion::rID @endlink or, if that is <tt>-1</tt>, by its
+ * @link GenomicRegion::seqName @endlink.  A <tt>beginPos</tt> of <tt>-1</tt> selects the contig from its begin, an
+ * <tt>endPos</tt> of <tt>-1</tt> selects it to its end.  Regions on unknown contigs are ignored.
+ *
+ * @section Examples
+ *
+ * @code{.cpp}
+ * BamFileIn bamFile("ex1.bam");
+ * BamHeader header;
+ * readHeader(header, bamFile);
+ *
+ * BamIndex<Bai> index;
+ * open(index, "ex1.bam.bai");
+ *
+ * String<GenomicRegion> regions;
+ * appendValue(regions, GenomicRegion("seq1:100-200"));
+ * appendValue(regions, GenomicRegion("seq2:1000-1500"));
+ *
+ * BamRegionReader<Bai> reader(bamFile, index, regions);
+ * BamAlignmentRecord record;
+ * String<unsigned> regionIds;
+ * while (!atEnd(reader))
+ *     readRecord(record, regionIds, reader);
+ * @endcode
+ */
+
+/*!
+ * @fn BamRegionReader::BamRegionReader
+ * @brief Constructor.
+ *
+ * @signature BamRegionReader::BamRegionReader(bamFileIn, index[, regions]);
+ *
+ * @param[in,out] bamFileIn The @link BamFileIn @endlink to read from.  Its header must have been read.
+ * @param[in]     index     The @link BamIndex @endlink of the file.
+ * @param[in]     regions   A @link String @endlink of @link GenomicRegion @endlink objects to query.
+ */
+
+template <typename TIndexSpec, typename TFileSpec = void>
+class BamRegionReader
+{
+public:
+    typedef FormattedFile<Bam, Input, TFileSpec>    TBamFileIn;
+    typedef BamIndex<TIndexSpec>                    TBamIndex;
+    typedef Pair<__uint64, __uint64>                TChunk;
+
+    TBamFileIn *            file;
+    TBamIndex const *       index;
+
+    String<GenomicRegion>   regions;        // resolved regions, sorted by (rID, beginPos)
+    String<unsigned>        regionIds;      // position of each region in the query list
+    String<TChunk>          chunks;         // merged virtual offset ranges to scan
+
+    unsigned                currentChunk;
+    unsigned                firstRegion;    // regions left of it end before the current alignment
+    bool                    _inChunk;
+    bool                    _pending;       // _record holds the next overlapping alignment
+    String<unsigned>        _pendingIds;
+    BamAlignmentRecordView  _record;
+
+    BamRegionReader(TBamFileIn & file, TBamIndex const & index) :
+        file(&file), index(&index), currentChunk(0), firstRegion(0), _inChunk(false), _pending(false)
+    {}
+
+    BamRegionReader(TBamFileIn & file, TBamIndex const & index, String<GenomicRegion> const & regions) :
+        file(&file), index(&index), currentChunk(0), firstRegion(0), _inChunk(false), _pending(false)
+    {
+        setRegions(*this, regions);
+    }
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function setRegions()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn BamRegionReader#setRegions
+ * @brief Set the regions to query and restart reading.
+ *
+ * @signature void setRegions(reader, regions);
+ *
+ * @param[in,out] reader  The @link BamRegionReader @endlink to configure.
+ * @param[in]     regions A @link String @endlink of @link GenomicRegion @endlink objects.  The ids reported by
+ *                        @link BamRegionReader#readRecord @endlink are positions in this string.
+ */
+
+template <typename TIndexSpec, typename TFileSpec>
+inline void
+setRegions(BamRegionReader<TIndexSpec, TFileSpec> & reader, String<GenomicRegion> const & regions)
+{
+    clear(reader.chunks);
+    reader.currentChunk = 0;
+    reader.firstRegion = 0;
+    reader._inChunk = false;
+    reader._pending = false;
+
+    _sortRegions(reader.regions, reader.regionIds, regions, contigNamesCache(context(*reader.file)));
+    for (unsigned i = 0; i < length(reader.regions); ++i)
+    {
+        GenomicRegion const & region = reader.regions[i];
+        _getRegionChunks(reader.chunks, *reader.index, region.rID, region.beginPos, region.endPos);
+    }
+    _mergeBgzfChunks(reader.chunks);
+}
+
+// ----------------------------------------------------------------------------
+// Function _advance()
+// ----------------------------------------------------------------------------
+
+// Scans the remaining chunks for the next alignment that overlaps a region.
+
+template <typename TIndexSpec, typename TFileSpec>
+inline bool
+_advance(BamRegionReader<TIndexSpec, TFileSpec> & reader)
+{
+    typedef typename BamRegionReader<TIndexSpec, TFileSpec>::TChunk TChunk;
+
+    if (reader._pending)
+        return true;
+
+    while (reader.currentChunk < length(reader.chunks) && reader.firstRegion < length(reader.regions))
+    {
+        TChunk const & chunk = reader.chunks[reader.currentChunk];
+        if (!reader._inChunk)
+        {
+            if ((__uint64)position(*reader.file) != chunk.i1)
+                setPosition(*reader.file, chunk.i1);
+            reader._inChunk = true;
+        }
+
+        if (atEnd(*reader.file) || (__uint64)position(*reader.file) >= chunk.i2)
+        {
+            ++reader.currentChunk;
+            reader._inChunk = false;
+            continue;
+        }
+
+        BamAlignmentRecordView & record = reader._record;
+        readRecord(record, *reader.file);
+        if (record.rID < 0 || record.beginPos < 0)
+            continue;  // Unaligned.
+
+        __int32 endPos = record.beginPos + std::max(getAlignmentLengthInRef(record), 1u);
+        _getOverlappingRegions(reader._pendingIds, reader.firstRegion, reader.regions, reader.regionIds,
+                               record.rID, record.beginPos, endPos);
+        if (!empty(reader._pendingIds))
+        {
+            reader._pending = true;
+            return true;
+        }
+    }
+    return false;
+}
+
+// ----------------------------------------------------------------------------
+// Function atEnd()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn BamRegionReader#atEnd
+ * @brief Query whether all alignments overlapping the regions have been read.
+ *
+ * @signature bool atEnd(reader);
+ *
+ * @param[in,out] reader The @link BamRegionReader @endlink to query.
+ *
+ * @return bool <tt>true</tt> if there are no more overlapping alignments.
+ */
+
+template <typename TIndexSpec, typename TFileSpec>
+inline bool
+atEnd(BamRegionReader<TIndexSpec, TFileSpec> & reader)
+{
+    return !_advance(reader);
+}
+
+// ----------------------------------------------------------------------------
+// Function readRecord()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn BamRegionReader#readRecord
+ * @brief Read the next alignment that overlaps one of the regions.
+ *
+ * @signature void readRecord(record, regionIds, reader);
+ *
+ * @param[out]    record    The @link BamAlignmentRecord @endlink to read into.
+ * @param[out]    regionIds A <tt>String&lt;unsigned&gt;</tt> with the ascending ids of the overlapped regions.
+ * @param[in,out] reader    The @link BamRegionReader @endlink to read from.
+ *
+ * @throw IOError On low-level I/O errors.
+ * @throw ParseError On high-level file format errors or if there are no more overlapping alignments.
+ */
+
+template <typename TIndexSpec, typename TFileSpec>
+inline void
+readRecord(BamAlignmentRecord & record,
+           String<unsigned> & regionIds,
+           BamRegionReader<TIndexSpec, TFileSpec> & reader)
+{
+    if (!_advance(reader))
+        SEQAN_THROW(ParseError("BamRegionReader: No more alignments in the regions."));
+
+    BamAlignmentRecordView const & view = reader._record;
+    assign(record, view);
+    regionIds = reader._pendingIds;
+    reader._pending = false;
+}
+
+}  // namespace seqan
+
+#endif  // INCLUDE_SEQAN_BAM_IO_BAM_REGION_READER_H_
@@ -153,6 +153,99 @@ readHeader(BamHeader & header,
     }
 }
 
+// ----------------------------------------------------------------------------
+// Function _translateBamRefIds()
+// ----------------------------------------------------------------------------
+
+// Translate file local rID and rNextId into global ids that are compatible with the context contigNames.
+template <typename TNameStore, typename TNameStoreCache, typename TStorageSpec>
+inline void
+_translateBamRefIds(BamAlignmentRecordCore & record,
+                    BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & context)
+{
+    if (record.rID >= 0 && !empty(context.translateFile2GlobalRefId))
+        record.rID = context.translateFile2GlobalRefId[record.rID];
+    if (record.rID >= 0)
+        SEQAN_ASSERT_LT(static_cast<__uint64>(record.rID), length(contigNames(context)));
+
+    // ... the same for rNextId
+    if (record.rNextId >= 0 && !empty(context.translateFile2GlobalRefId))
+        record.rNextId = context.translateFile2GlobalRefId[record.rNextId];
+    if (record.rNextId >= 0)
+        SEQAN_ASSERT_LT(static_cast<__uint64>(record.rNextId), length(contigNames(context)));
+}
+
+// ----------------------------------------------------------------------------
+// Function _decodeBamCigar()
+// ----------------------------------------------------------------------------
+
+template <typename TCigarString, typename TCharIter>
+inline void
+_decodeBamCigar(TCigarString & cigar, TCharIter & it, unsigned nCigar)
+{
+    typedef typename Iterator<TCigarString, Standard>::Type SEQAN_RESTRICT TCigarIter;
+
+    resize(cigar, nCigar, Exact());
+    static char const * CIGAR_MAPPING = "MIDNSHP=X*******";
+    TCigarIter cigEnd = end(cigar, Standard());
+    for (TCigarIter cig = begin(cigar, Standard()); cig != cigEnd; ++cig)
+    {
+        __uint32 opAndCnt;
+        arrayCopyForward(it, it + sizeof(opAndCnt), reinterpret_cast<char*>(&opAndCnt));
+        it += sizeof(opAndCnt);
+        SEQAN_ASSERT_LEQ(opAndCnt & 15, 8u);
+        cig->operation = CIGAR_MAPPING[opAndCnt & 15];
+        cig->count = opAndCnt >> 4;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _decodeBamSeq()
+// ----------------------------------------------------------------------------
+
+template <typename TSequence, typename TCharIter>
+inline void
+_decodeBamSeq(TSequence & seq, TCharIter & it, __int32 lSeq)
+{
+    typedef typename Iterator<TSequence, Standard>::Type SEQAN_RESTRICT TSeqIter;
+
+    resize(seq, lSeq, Exact());
+    TSeqIter sit = begin(seq, Standard());
+    TSeqIter sitEnd = sit + (lSeq & ~1);
+    while (sit != sitEnd)
+    {
+        unsigned char ui = getValue(it);
+        ++it;
+        assignValue(sit, Iupac(ui >> 4));
+        ++sit;
+        assignValue(sit, Iupac(ui & 0x0f));
+        ++sit;
+    }
+    if (lSeq & 1)
+        *sit++ = Iupac((__uint8)*it++ >> 4);
+}
+
+// ----------------------------------------------------------------------------
+// Function _decodeBamQual()
+// ----------------------------------------------------------------------------
+
+template <typename TQualString, typename TCharIter>
+inline void
+_decodeBamQual(TQualString & qual, TCharIter & it, __int32 lSeq)
+{
+    typedef typename Iterator<TQualString, Standard>::Type SEQAN_RESTRICT TQualIter;
+
+    // phred quality
+    resize(qual, lSeq, Exact());
+    // If qual is a sequence of 0xff (heuristic same as samtools: Only look at first byte) then we clear it, to get the
+    // representation of '*';
+    TQualIter qitEnd = end(qual, Standard());
+    for (TQualIter qit = begin(qual, Standard()); qit != qitEnd;)
+        *qit++ = '!' + *it++;
+    if (!empty(qual) && qual[0] == '\xff')
+        clear(qual);
+}
+
 // ----------------------------------------------------------------------------
 // Function readRecord()                                     BamAlignmentRecord
 // ----------------------------------------------------------------------------
@@ -189,22 +282,14 @@ _readBamRecord(TBuffer & rawRecord, TForwardIter & iter, Bam)
     write(rawRecord, iter, (size_t)recordLen);
 }
 
-template <typename TForwardIter, typename TNameStore, typename TNameStoreCache, typename TStorageSpec>
+// Decode a record of remainingBytes bytes (without the leading block size) starting at it.
+template <typename TCharIter, typename TNameStore, typename TNameStoreCache, typename TStorageSpec>
 inline void
-readRecord(BamAlignmentRecord & record,
-           BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & context,
-           TForwardIter & iter,
-           Bam const & /* tag */)
+_decodeBamRecord(BamAlignmentRecord & record,
+                 BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & context,
+                 TCharIter it,
+                 __int32 remainingBytes)
 {
-    typedef typename Iterator<CharString, Standard>::Type                             TCharIter;
-    typedef typename Iterator<String<CigarElement<> >, Standard>::Type SEQAN_RESTRICT TCigarIter;
-    typedef typename Iterator<IupacString, Standard>::Type SEQAN_RESTRICT             TSeqIter;
-    typedef typename Iterator<CharString, Standard>::Type SEQAN_RESTRICT              TQualIter;
-
-    // Read size and data of the remaining block in one chunk (fastest).
-    __int32 remainingBytes = _readBamRecordWithoutSize(context.buffer, iter);
-    TCharIter it = begin(context.buffer, Standard());
-
     // BamAlignmentRecordCore.
     arrayCopyForward(it, it + sizeof(BamAlignmentRecordCore), reinterpret_cast<char*>(&record));
     it += sizeof(BamAlignmentRecordCore);
@@ -213,67 +298,65 @@ readRecord(BamAlignmentRecord & record,
                       record._n_cigar * 4 + (record._l_qseq + 1) / 2 + record._l_qseq;
     SEQAN_ASSERT_GEQ(remainingBytes, 0);
 
-    // Translate file local rID into a global rID that is compatible with the context contigNames.
-    if (record.rID >= 0 && !empty(context.translateFile2GlobalRefId))
-        record.rID = context.translateFile2GlobalRefId[record.rID];
-    if (record.rID >= 0)
-        SEQAN_ASSERT_LT(static_cast<__uint64>(record.rID), length(contigNames(context)));
-
-    // ... the same for rNextId
-    if (record.rNextId >= 0 && !empty(context.translateFile2GlobalRefId))
-        record.rNextId = context.translateFile2GlobalRefId[record.rNextId];
-    if (record.rNextId >= 0)
-        SEQAN_ASSERT_LT(static_cast<__uint64>(record.rNextId), length(contigNames(context)));
+    _translateBamRefIds(record, context);
 
     // query name.
     resize(record.qName, record._l_qname - 1, Exact());
     arrayCopyForward(it, it + record._l_qname - 1, begin(record.qName, Standard()));
     it += record._l_qname;
 
-    // cigar string.
-    resize(record.cigar, record._n_cigar, Exact());
-    static char const * CIGAR_MAPPING = "MIDNSHP=X*******";
-    TCigarIter cigEnd = end(record.cigar, Standard());
-    for (TCigarIter cig = begin(record.cigar, Standard()); cig != cigEnd; ++cig)
-    {
-        unsigned opAndCnt;
-        readRawPod(opAndCnt, it);
-        SEQAN_ASSERT_LEQ(opAndCnt & 15, 8u);
-        cig->operation = CIGAR_MAPPING[opAndCnt & 15];
-        cig->count = opAndCnt >> 4;
-    }
-
-    // query sequence.
-    resize(record.seq, record._l_qseq, Exact());
-    TSeqIter sit = begin(record.seq, Standard());
-    TSeqIter sitEnd = sit + (record._l_qseq & ~1);
-    while (sit != sitEnd)
-    {
-        unsigned char ui = getValue(it);
-        ++it;
-        assignValue(sit, Iupac(ui >> 4));
-        ++sit;
-        assignValue(sit, Iupac(ui & 0x0f));
-        ++sit;
-    }
-    if (record._l_qseq & 1)
-        *sit++ = Iupac((__uint8)*it++ >> 4);
-
-    // phred quality
-    resize(record.qual, record._l_qseq, Exact());
-    // If qual is a sequence of 0xff (heuristic same as samtools: Only look at first byte) then we clear it, to get the
-    // representation of '*';
-    TQualIter qitEnd = end(record.qual, Standard());
-    for (TQualIter qit = begin(record.qual, Standard()); qit != qitEnd;)
-        *qit++ = '!' + *it++;
-    if (!empty(record.qual) && record.qual[0] == '\xff')
-        clear(record.qual);
+    _decodeBamCigar(record.cigar, it, record._n_cigar);
+    _decodeBamSeq(record.seq, it, record._l_qseq);
+    _decodeBamQual(record.qual, it, record._l_qseq);
 
     // tags
     resize(record.tags, remainingBytes, Exact());
     arrayCopyForward(it, it + remainingBytes, begin(record.tags, Standard()));
 }
 
+template <typename TForwardIter, typename TNameStore, typename TNameStoreCache, typename TStorageSpec>
+inline void
+readRecord(BamAlignmentRecord & record,
+           BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & context,
+           TForwardIter & iter,
+           Bam const & /* tag */)
+{
+    // Read size and data of the remaining block in one chunk (fastest).
+    __int32 remainingBytes = _readBamRecordWithoutSize(context.buffer, iter);
+    _decodeBamRecord(record, context, begin(context.buffer, Standard()), remainingBytes);
+}
+
+// ----------------------------------------------------------------------------
+// Function _parseBamRecord()
+// ----------------------------------------------------------------------------
+
+// Decode a raw record read by _readBamRecord().  Unlike readRecord(), this only reads from context and is safe to be
+// called concurrently.
+template <typename TNameStore, typename TNameStoreCache, typename TStorageSpec, typename TRawRecord>
+inline void
+_parseBamRecord(BamAlignmentRecord & record,
+                BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & context,
+                TRawRecord const & rawRecord,
+                Bam const & /* tag */)
+{
+    SEQAN_ASSERT_GEQ(length(rawRecord), sizeof(__int32) + sizeof(BamAlignmentRecordCore));
+    _decodeBamRecord(record, context, begin(rawRecord, Standard()) + sizeof(__int32),
+                     (__int32)(length(rawRecord) - sizeof(__int32)));
+}
+
+// ----------------------------------------------------------------------------
+// Function _resolveBamRecordNames()
+// ----------------------------------------------------------------------------
+
+// BAM records store numeric reference ids.
+template <typename TNameStore, typename TNameStoreCache, typename TStorageSpec, typename TRawRecord>
+inline void
+_resolveBamRecordNames(BamAlignmentRecord & /* record */,
+                       BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & /* context */,
+                       TRawRecord const & /* rawRecord */,
+                       Bam const & /* tag */)
+{}
+
 }  // namespace seqan
 
 #endif  // #ifndef INCLUDE_SEQAN_BAM_IO_READ_BAM_H_
@@ -247,15 +247,38 @@ _readBamRecord(TBuffer & rawRecord, TForwardIter & iter, Sam)
 }
 
 // ----------------------------------------------------------------------------
-// Function readRecord()                                     BamAlignmentRecord
+// Function _samNameToId()
 // ----------------------------------------------------------------------------
 
-template <typename TForwardIter, typename TNameStore, typename TNameStoreCache, typename TStorageSpec>
+// The name store cache is modified by lookups.  Records parsed concurrently (see readRecords()) skip the lookup
+// and get their ids from _resolveBamRecordNames().
+template <typename TNameStore, typename TNameStoreCache, typename TStorageSpec, typename TName>
+inline __int32
+_samNameToId(BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & context, TName const & name,
+             True /* resolveNames */)
+{
+    return nameToId(contigNamesCache(context), name);
+}
+
+template <typename TNameStore, typename TNameStoreCache, typename TStorageSpec, typename TName>
+inline __int32
+_samNameToId(BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & /* context */, TName const & /* name */,
+             False /* resolveNames */)
+{
+    return BamAlignmentRecord::INVALID_REFID;
+}
+
+// ----------------------------------------------------------------------------
+// Function _readSamRecord()
+// ----------------------------------------------------------------------------
+
+template <typename TForwardIter, typename TNameStore, typename TNameStoreCache, typename TStorageSpec,
+          typename TResolveNames>
 inline void
-readRecord(BamAlignmentRecord & record,
-           BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & context,
-           TForwardIter & iter,
-           Sam const & /*tag*/)
+_readSamRecord(BamAlignmentRecord & record,
+               BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & context,
+               TForwardIter & iter,
+               TResolveNames const & resolveNames)
 {
     // fail, if we read "@" (did you miss to call readRecord(header, bamFile) first?)
     if (nextIs(iter, SamHeader()))
@@ -264,7 +287,7 @@ readRecord(BamAlignmentRecord & record,
     OrFunctor<IsTab, AssertFunctor<NotFunctor<IsNewline>, ParseError, Sam> > nextEntry;
 
     clear(record);
-    CharString &buffer = context.buffer;
+    CharString &buffer = record._buffer;
 
     // QNAME
     readUntil(record.qName, iter, nextEntry);
@@ -283,7 +306,7 @@ readRecord(BamAlignmentRecord & record,
     if (buffer == "*")
         record.rID = BamAlignmentRecord::INVALID_REFID;
     else
-        record.rID = nameToId(contigNamesCache(context), buffer);
+        record.rID = _samNameToId(context, buffer, resolveNames);
     skipOne(iter, IsTab());
 
     // POS
@@ -333,7 +356,7 @@ readRecord(BamAlignmentRecord & record,
     else if (buffer == "=")
         record.rNextId = record.rID;
     else
-        record.rNextId = nameToId(contigNamesCache(context), buffer);
+        record.rNextId = _samNameToId(context, buffer, resolveNames);
     skipOne(iter, IsTab());
 
     // PNEXT
@@ -394,6 +417,74 @@ readRecord(BamAlignmentRecord & record,
     appendTagsSamToBam(record.tags, buffer);
 }
 
+// ----------------------------------------------------------------------------
+// Function readRecord()                                     BamAlignmentRecord
+// ----------------------------------------------------------------------------
+
+template <typename TForwardIter, typename TNameStore, typename TNameStoreCache, typename TStorageSpec>
+inline void
+readRecord(BamAlignmentRecord & record,
+           BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & context,
+           TForwardIter & iter,
+           Sam const & /*tag*/)
+{
+    _readSamRecord(record, context, iter, True());
+}
+
+// ----------------------------------------------------------------------------
+// Function _parseBamRecord()
+// ----------------------------------------------------------------------------
+
+// Parse a raw line read by _readBamRecord().  It can be called concurrently for different records, the reference
+// ids are set afterwards by _resolveBamRecordNames().
+template <typename TNameStore, typename TNameStoreCache, typename TStorageSpec, typename TRawRecord>
+inline void
+_parseBamRecord(BamAlignmentRecord & record,
+                BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & context,
+                TRawRecord const & rawRecord,
+                Sam const & /* tag */)
+{
+    typename Iterator<TRawRecord const, Rooted>::Type iter = begin(rawRecord, Rooted());
+    _readSamRecord(record, context, iter, False());
+}
+
+// ----------------------------------------------------------------------------
+// Function _resolveBamRecordNames()
+// ----------------------------------------------------------------------------
+
+// Look up RNAME (3rd field) and RNEXT (7th field) of a record parsed by _parseBamRecord().  Unknown names are
+// appended to the name store, so the records must be passed in file order and by one thread.
+template <typename TNameStore, typename TNameStoreCache, typename TStorageSpec, typename TRawRecord>
+inline void
+_resolveBamRecordNames(BamAlignmentRecord & record,
+                       BamIOContext<TNameStore, TNameStoreCache, TStorageSpec> & context,
+                       TRawRecord const & rawRecord,
+                       Sam const & /* tag */)
+{
+    typedef typename Iterator<TRawRecord const, Standard>::Type TIter;
+
+    TIter rawBegin = begin(rawRecord, Standard());
+    TIter rawEnd = end(rawRecord, Standard());
+    TIter fieldBegin = rawBegin;
+
+    for (unsigned field = 0; field < 7u && fieldBegin < rawEnd; ++field)
+    {
+        TIter fieldEnd = std::find(fieldBegin, rawEnd, '\t');
+        if (field == 2u || field == 6u)
+        {
+            typename Infix<TRawRecord const>::Type name = infix(rawRecord, fieldBegin - rawBegin, fieldEnd - rawBegin);
+            __int32 & id = (field == 2u) ? record.rID : record.rNextId;
+            if (name == "*")
+                id = BamAlignmentRecord::INVALID_REFID;
+            else if (field == 6u && name == "=")
+                id = record.rID;
+            else
+                id = _samNameToId(context, name, True());
+        }
+        fieldBegin = fieldEnd + 1;
+    }
+}
+
 }  // namespace seqan
 
 #endif  // #ifndef INCLUDE_SEQAN_BAM_IO_READ_SAM_H_
@@ -0,0 +1,329 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2015, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: SeqAn Team <seqan-dev@lists.fu-berlin.de>
+// ==========================================================================
+// Arena allocator that hands out memory by bumping a pointer and releases a
+// whole batch of allocations at once.
+// ==========================================================================
+
+#ifndef SEQAN_INCLUDE_SEQAN_BASIC_ALLOCATOR_ARENA_H_
+#define SEQAN_INCLUDE_SEQAN_BASIC_ALLOCATOR_ARENA_H_
+
+#include <seqan/basic/allocator_interface.h>
+
+namespace seqan {
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+/*!
+ * @class ArenaAllocator
+ * @extends Allocator
+ * @headerfile <seqan/basic.h>
+ * @brief Allocator that serves memory from large blocks and frees all of it at once.
+ *
+ * @signature template <typename TParentAllocator>
+ *            class Allocator<Arena<TParentAllocator> >;
+ *
+ * @tparam TParentAllocator The parent allocator to obtain the blocks from.  Default: @link SimpleAllocator @endlink.
+ *
+ * The arena requests blocks of <tt>BLOCK_SIZE</tt> bytes (or larger, for large requests) from its parent allocator
+ * and serves each allocation by advancing a pointer within the current block.  Individual deallocations are no-ops.
+ * Instead, @link ArenaAllocator#reset @endlink releases all allocations at once in constant time and keeps the
+ * blocks for the next batch, whereas @link Allocator#clear @endlink returns the blocks to the parent allocator.
+ *
+ * All allocations are aligned to <tt>ALIGNMENT</tt> bytes.  An arena is not thread-safe; use
+ * @link threadLocalArena @endlink to obtain a separate arena per thread.
+ *
+ * @section Example
+ *
+ * @code{.cpp}
+ * Allocator<Arena<> > arena;
+ * for (unsigned batch = 0; batch < 100; ++batch)
+ * {
+ *     int * buffer;
+ *     allocate(arena, buffer, 1000);
+ *     // ... use buffer ...
+ *     reset(arena);   // releases buffer and all other allocations of this batch
+ * }
+ * @endcode
+ */
+
+template <typename TParentAllocator = SimpleAllocator>
+struct Arena;
+
+// Header in front of each block of the arena.
+struct ArenaBlock_
+{
+    ArenaBlock_ * next;
+    size_t size;
+};
+
+template <typename TParentAllocator>
+struct Allocator<Arena<TParentAllocator> >
+{
+    enum
+    {
+        BLOCK_SIZE = 0x10000UL,
+        ALIGNMENT = 16,
+        HEADER_SIZE = (sizeof(ArenaBlock_) + ALIGNMENT - 1) & ~(size_t)(ALIGNMENT - 1)
+    };
+
+    ArenaBlock_ * data_first_block;
+    ArenaBlock_ * data_current_block;
+    char * data_current_free;
+    char * data_current_end;
+    Holder<TParentAllocator, Tristate> data_parent_allocator;
+
+    Allocator() :
+        data_first_block(), data_current_block(), data_current_free(), data_current_end()
+    {}
+
+    Allocator(TParentAllocator & parent_alloc) :
+        data_first_block(), data_current_block(), data_current_free(), data_current_end()
+    {
+        setValue(data_parent_allocator, parent_alloc);
+    }
+
+    // Dummy copy
+    Allocator(Allocator const &) :
+        data_first_block(), data_current_block(), data_current_free(), data_current_end()
+    {}
+
+    inline Allocator &
+    operator=(Allocator const &)
+    {
+        clear(*this);
+        return *this;
+    }
+
+    ~Allocator()
+    {
+        clear(*this);
+    }
+};
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function parentAllocator()
+// ----------------------------------------------------------------------------
+
+template <typename TParentAllocator>
+inline TParentAllocator &
+parentAllocator(Allocator<Arena<TParentAllocator> > & me)
+{
+    return value(me.data_parent_allocator);
+}
+
+// ----------------------------------------------------------------------------
+// Function clear()
+// ----------------------------------------------------------------------------
+
+template <typename TParentAllocator>
+void
+clear(Allocator<Arena<TParentAllocator> > & me)
+{
+    ArenaBlock_ * block = me.data_first_block;
+    while (block)
+    {
+        ArenaBlock_ * next = block->next;
+        deallocate(parentAllocator(me), reinterpret_cast<char *>(block), block->size, TagAllocateStorage());
+        block = next;
+    }
+
+    me.data_first_block = me.data_current_block = NULL;
+    me.data_current_free = me.data_current_end = NULL;
+}
+
+// ----------------------------------------------------------------------------
+// Function reset()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn ArenaAllocator#reset
+ * @brief Release all allocations of an arena at once.
+ *
+ * @signature void reset(arena);
+ *
+ * @param[in,out] arena The ArenaAllocator to reset.
+ *
+ * Runs in constant time.  The blocks are kept and reused by subsequent allocations.  Memory obtained from the arena
+ * before the reset must not be accessed afterwards.
+ */
+
+template <typename TParentAllocator>
+inline void
+reset(Allocator<Arena<TParentAllocator> > & me)
+{
+    typedef Allocator<Arena<TParentAllocator> > TAllocator;
+
+    me.data_current_block = me.data_first_block;
+    if (me.data_current_block)
+    {
+        me.data_current_free = reinterpret_cast<char *>(me.data_current_block) + TAllocator::HEADER_SIZE;
+        me.data_current_end = reinterpret_cast<char *>(me.data_current_block) + me.data_current_block->size;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _arenaNextBlock()
+// ----------------------------------------------------------------------------
+
+// Make the next block with at least bytes_needed free bytes the current one.
+// Blocks left over from before the last reset are reused if large enough,
+// otherwise a new block is inserted in front of them.
+
+template <typename TParentAllocator, typename TUsage>
+inline void
+_arenaNextBlock(Allocator<Arena<TParentAllocator> > & me, size_t bytes_needed, Tag<TUsage> const tag_)
+{
+    typedef Allocator<Arena<TParentAllocator> > TAllocator;
+
+    ArenaBlock_ * next = (me.data_current_block) ? me.data_current_block->next : me.data_first_block;
+
+    if (!next || next->size < TAllocator::HEADER_SIZE + bytes_needed)
+    {
+        size_t block_size = std::max((size_t)TAllocator::BLOCK_SIZE, TAllocator::HEADER_SIZE + bytes_needed);
+        char * ptr;
+        allocate(parentAllocator(me), ptr, block_size, tag_);
+
+        ArenaBlock_ * block = reinterpret_cast<ArenaBlock_ *>(ptr);
+        block->size = block_size;
+        block->next = next;
+        if (me.data_current_block)
+            me.data_current_block->next = block;
+        else
+            me.data_first_block = block;
+        next = block;
+    }
+
+    me.data_current_block = next;
+    me.data_current_free = reinterpret_cast<char *>(next) + TAllocator::HEADER_SIZE;
+    me.data_current_end = reinterpret_cast<char *>(next) + next->size;
+}
+
+// ----------------------------------------------------------------------------
+// Function allocate()
+// ----------------------------------------------------------------------------
+
+template <typename TParentAllocator, typename TValue, typename TSize, typename TUsage>
+inline void
+allocate(Allocator<Arena<TParentAllocator> > & me,
+         TValue * & data,
+         TSize count,
+         Tag<TUsage> const tag_)
+{
+    typedef Allocator<Arena<TParentAllocator> > TAllocator;
+
+    SEQAN_ASSERT_GT(count, static_cast<TSize>(0));
+
+    size_t bytes_needed = ((size_t)count * sizeof(TValue) + TAllocator::ALIGNMENT - 1) &
+                          ~(size_t)(TAllocator::ALIGNMENT - 1);
+
+    if (SEQAN_UNLIKELY((size_t)(me.data_current_end - me.data_current_free) < bytes_needed))
+        _arenaNextBlock(me, bytes_needed, tag_);
+
+    data = reinterpret_cast<TValue *>(me.data_current_free);
+    me.data_current_free += bytes_needed;
+}
+
+// ----------------------------------------------------------------------------
+// Function deallocate()
+// ----------------------------------------------------------------------------
+
+template <typename TParentAllocator, typename TValue, typename TSize, typename TUsage>
+inline void
+deallocate(Allocator<Arena<TParentAllocator> > & /*me*/,
+           TValue * /*data*/,
+           TSize /*count*/,
+           Tag<TUsage> const /*tag_*/)
+{
+    // Memory is released by reset() or clear().
+}
+
+// ----------------------------------------------------------------------------
+// Function threadLocalArena()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn threadLocalArena
+ * @headerfile <seqan/basic.h>
+ * @brief Returns the ArenaAllocator of the calling thread.
+ *
+ * @signature TArena & threadLocalArena();
+ * @signature TArena & threadLocalArena<TParentAllocator>();
+ *
+ * @tparam TParentAllocator The parent allocator of the arena.  Default: @link SimpleAllocator @endlink.
+ *
+ * @return TArena The thread's <tt>Allocator&lt;Arena&lt;TParentAllocator&gt; &gt;</tt>, created on first use.
+ *
+ * Each thread has its own arena, so no synchronization is needed.  The thread that allocated from the arena must
+ * also be the one that calls @link ArenaAllocator#reset @endlink.  The arena is released at thread exit if the
+ * compiler supports <tt>thread_local</tt>, otherwise it is kept until the program terminates.
+ */
+
+template <typename TParentAllocator>
+inline Allocator<Arena<TParentAllocator> > &
+threadLocalArena()
+{
+#if defined(SEQAN_CXX11_STANDARD) && (!defined(_MSC_VER) || _MSC_VER >= 1900)
+    static thread_local Allocator<Arena<TParentAllocator> > arena;
+    return arena;
+#else
+    static SEQAN_THREAD_LOCAL Allocator<Arena<TParentAllocator> > * arena = NULL;
+    if (SEQAN_UNLIKELY(!arena))
+        arena = new Allocator<Arena<TParentAllocator> >();
+    return *arena;
+#endif
+}
+
+inline Allocator<Arena<> > &
+threadLocalArena()
+{
+    return threadLocalArena<SimpleAllocator>();
+}
+
+}  // namespace seqan
+
+#endif  // SEQAN_INCLUDE_SEQAN_BASIC_ALLOCATOR_ARENA_H_
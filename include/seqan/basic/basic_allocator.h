@@ -57,6 +57,7 @@
 #include <seqan/basic/allocator_singlepool.h>
 #include <seqan/basic/allocator_multipool.h>
 #include <seqan/basic/allocator_chunkpool.h>
+#include <seqan/basic/allocator_arena.h>
 
 // Adaption from SeqAn allocator to STL allocator.
 #include <seqan/basic/allocator_to_std.h>
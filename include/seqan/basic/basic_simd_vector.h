@@ -39,6 +39,7 @@
 
 #ifdef __SSE4_1__
  #include <immintrin.h>
+ #define SEQAN_SIMD_ENABLED
 #else
 // SSE4.1 or greater required
  #warning "SSE4.1 instruction set not enabled"
@@ -340,12 +341,14 @@ SEQAN_FUNC_ENABLE_IF(
     int)
 inline _testAllZeros(TSimdVector const &vector, TSimdVector const &mask, SimdParams_<32>)
 {
+    __m256i const & vec = reinterpret_cast<const __m256i &>(vector);
+    __m256i const & msk = reinterpret_cast<const __m256i &>(mask);
 #ifdef __AVX2__
-    return _mm256_testz_si256(vector, mask);
+    return _mm256_testz_si256(vec, msk);
 #else   // #ifdef __AVX2__
     return
-        _mm_testz_si128(_mm256_castsi256_si128(vector), _mm256_castsi256_si128(mask)) &
-        _mm_testz_si128(_mm256_extractf128_si256(vector, 1), _mm256_extractf128_si256(mask, 1));
+        _mm_testz_si128(_mm256_castsi256_si128(vec), _mm256_castsi256_si128(msk)) &
+        _mm_testz_si128(_mm256_extractf128_si256(vec, 1), _mm256_extractf128_si256(msk, 1));
 #endif  // #ifdef __AVX2__
 }
 
@@ -540,7 +543,7 @@ SEQAN_FUNC_ENABLE_IF(
     int)
 inline _testAllZeros(TSimdVector const &vector, TSimdVector const &mask, SimdParams_<16>)
 {
-    return _mm_testz_si128(vector, mask);
+    return _mm_testz_si128(reinterpret_cast<const __m128i &>(vector), reinterpret_cast<const __m128i &>(mask));
 }
 
 template <typename TSimdVector>
@@ -612,6 +615,40 @@ inline fillVector(TSimdVector &vector, TValue x)
     _fillVector(vector, x, SimdParams_<sizeof(TSimdVector), LENGTH<TSimdVector>::VALUE>());
 }
 
+// Returns a new vector with all entries set to x.
+template <typename TSimdVector, typename TValue>
+SEQAN_FUNC_ENABLE_IF(
+    Is<SimdVectorConcept<TSimdVector> >,
+    TSimdVector)
+inline createVector(TValue x)
+{
+    TSimdVector vector;
+    fillVector(vector, x);
+    return vector;
+}
+
+// Loads a vector from a possibly unaligned memory address.
+template <typename TSimdVector, typename TValue>
+SEQAN_FUNC_ENABLE_IF(
+    Is<SimdVectorConcept<TSimdVector> >,
+    TSimdVector)
+inline loadu(TValue const * memAddr)
+{
+    TSimdVector vector;
+    std::memcpy(&vector, memAddr, sizeof(TSimdVector));
+    return vector;
+}
+
+// Stores a vector to a possibly unaligned memory address.
+template <typename TValue, typename TSimdVector>
+SEQAN_FUNC_ENABLE_IF(
+    Is<SimdVectorConcept<TSimdVector> >,
+    void)
+inline storeu(TValue * memAddr, TSimdVector const & vector)
+{
+    std::memcpy(memAddr, &vector, sizeof(TSimdVector));
+}
+
 template <typename TSimdVector>
 SEQAN_FUNC_ENABLE_IF(
     Is<SimdVectorConcept<TSimdVector> >,
@@ -98,6 +98,17 @@ struct Pair<T1, T2, Pack>
     // TODO(holtgrew): explicit?
     SEQAN_HOST_DEVICE Pair(Pair<T1_, T2_, TSpec__> const &_p)
             : i1(getValueI1(_p)), i2(getValueI2(_p)) {}
+
+    // ------------------------------------------------------------------------
+    // Assignment Operator
+    // ------------------------------------------------------------------------
+
+    SEQAN_HOST_DEVICE Pair & operator=(Pair const & _p)
+    {
+        i1 = _p.i1;
+        i2 = _p.i2;
+        return *this;
+    }
 }
 #ifndef PLATFORM_WINDOWS
     __attribute__((packed))
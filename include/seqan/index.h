@@ -89,6 +89,7 @@
 #include <seqan/index/shape_minimizer.h>
 #include <seqan/index/index_qgram.h>
 #include <seqan/index/index_qgram_openaddressing.h>
+#include <seqan/index/index_qgram_minimizer.h>
 
 // ----------------------------------------------------------------------------
 // Suffix array creators.
@@ -100,6 +101,8 @@
 #include <seqan/index/index_sa_mm.h>
 #include <seqan/index/index_sa_qsort.h>
 #include <seqan/index/index_sa_bwtwalk.h>
+#include <seqan/index/index_sa_sais.h>
+#include <seqan/index/index_sa_parallel.h>
 
 #include <seqan/index/pump_extender3.h>
 #include <seqan/index/pipe_merger3.h>
@@ -149,6 +152,7 @@
 #include <seqan/index/index_fm_rank_dictionary_base.h>
 #include <seqan/index/index_fm_rank_dictionary_naive.h>
 #include <seqan/index/index_fm_rank_dictionary_levels.h>
+#include <seqan/index/index_fm_rank_dictionary_epr.h>
 #include <seqan/index/index_fm_right_array_binary_tree.h>
 #include <seqan/index/index_fm_right_array_binary_tree_iterator.h>
 #include <seqan/index/index_fm_rank_dictionary_wt.h>
@@ -168,6 +172,8 @@
 #include <seqan/index/index_fm_compressed_sa_iterator.h>
 #include <seqan/index/index_fm.h>
 #include <seqan/index/index_fm_stree.h>
+#include <seqan/index/index_bifm.h>
+#include <seqan/index/index_bifm_stree.h>
 
 // ----------------------------------------------------------------------------
 // Suffix tree algorithms.
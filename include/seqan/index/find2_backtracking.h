@@ -215,6 +215,38 @@ struct Finder_<Index<TText, TTextIndexSpec>, Index<TPattern, TPatternIndexSpec>,
     {}
 };
 
+// ----------------------------------------------------------------------------
+// Class SearchSchemeStep_
+// ----------------------------------------------------------------------------
+// One step of a search scheme on a bidirectional index: the pattern position
+// matched by the step, the direction of the extension and the error bounds
+// holding after the step.
+
+struct SearchSchemeStep_
+{
+    unsigned    pos;
+    bool        right;
+    bool        pieceEnd;
+    unsigned    minPieceErrors;
+    unsigned    maxErrors;
+
+    SearchSchemeStep_() :
+        pos(0),
+        right(true),
+        pieceEnd(false),
+        minPieceErrors(0),
+        maxErrors(0)
+    {}
+
+    SearchSchemeStep_(unsigned pos, bool right, bool pieceEnd, unsigned minPieceErrors, unsigned maxErrors) :
+        pos(pos),
+        right(right),
+        pieceEnd(pieceEnd),
+        minPieceErrors(minPieceErrors),
+        maxErrors(maxErrors)
+    {}
+};
+
 // ============================================================================
 // Functions
 // ============================================================================
@@ -1354,6 +1386,191 @@ _find(Finder_<Index<TText, TTextIndexSpec>, Index<TPattern, TPatternIndexSpec>,
     _popState(finder, StageInitial_());
 }
 
+// ----------------------------------------------------------------------------
+// Function _initSearchSchemes()
+// ----------------------------------------------------------------------------
+// The pattern is split into k + 1 pieces.  By the pigeonhole principle, every
+// occurrence with at most k errors matches at least one piece exactly.  The
+// s-th search matches piece s exactly, extends to the right through the pieces
+// s + 1..k and then to the left through the pieces s - 1..0.  Each piece left
+// of s must contain at least one error, so that every occurrence is reported
+// by exactly one search: the one of its leftmost exact piece.
+
+template <typename TSchemes, typename TSize, typename TErrors>
+inline void
+_initSearchSchemes(TSchemes & schemes, TSize patternLength, TErrors maxErrors)
+{
+    typedef typename Value<TSchemes>::Type  TScheme;
+
+    clear(schemes);
+
+    unsigned pieces = static_cast<unsigned>(maxErrors) + 1;
+
+    // Patterns shorter than the number of pieces are searched by plain backtracking.
+    if (patternLength < pieces)
+    {
+        TScheme scheme;
+        for (unsigned pos = 0; pos < patternLength; ++pos)
+            appendValue(scheme, SearchSchemeStep_(pos, true, false, 0, maxErrors));
+        appendValue(schemes, scheme);
+        return;
+    }
+
+    for (unsigned s = 0; s < pieces; ++s)
+    {
+        TScheme scheme;
+
+        // Match piece s exactly, then extend to the right.
+        for (unsigned j = s; j < pieces; ++j)
+        {
+            unsigned pieceBegin = j * patternLength / pieces;
+            unsigned pieceEnd = (j + 1) * patternLength / pieces;
+
+            for (unsigned pos = pieceBegin; pos < pieceEnd; ++pos)
+                appendValue(scheme, SearchSchemeStep_(pos, true, pos + 1 == pieceEnd, 0, (j == s) ? 0 : maxErrors - s));
+        }
+
+        // Extend to the left, each piece containing at least one error.
+        for (unsigned j = s; j-- > 0;)
+        {
+            unsigned pieceBegin = j * patternLength / pieces;
+            unsigned pieceEnd = (j + 1) * patternLength / pieces;
+
+            for (unsigned pos = pieceEnd; pos-- > pieceBegin;)
+                appendValue(scheme, SearchSchemeStep_(pos, false, pos == pieceBegin, 1, maxErrors - j));
+        }
+
+        appendValue(schemes, scheme);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _findSearchScheme()
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TIndexSpec, typename TPattern, typename TSpec, typename TScheme, typename TDelegate>
+inline void
+_findSearchScheme(Finder_<Index<TText, BidirectionalIndex<TIndexSpec> >, TPattern, Backtracking<HammingDistance, TSpec> > & finder,
+                  TPattern const & pattern,
+                  TScheme const & scheme,
+                  unsigned step,
+                  unsigned pieceErrors,
+                  TDelegate & delegate)
+{
+    if (step == length(scheme))
+    {
+        // Inversion of control.
+        delegate(finder);
+    }
+    else if (scheme[step].right)
+    {
+        _findSearchScheme(finder, pattern, scheme, step, pieceErrors, delegate, Fwd());
+    }
+    else
+    {
+        _findSearchScheme(finder, pattern, scheme, step, pieceErrors, delegate, Rev());
+    }
+}
+
+template <typename TText, typename TIndexSpec, typename TPattern, typename TSpec, typename TScheme, typename TDelegate,
+          typename TDirection>
+inline void
+_findSearchScheme(Finder_<Index<TText, BidirectionalIndex<TIndexSpec> >, TPattern, Backtracking<HammingDistance, TSpec> > & finder,
+                  TPattern const & pattern,
+                  TScheme const & scheme,
+                  unsigned step,
+                  unsigned pieceErrors,
+                  TDelegate & delegate,
+                  TDirection const & dir)
+{
+    typedef Index<TText, BidirectionalIndex<TIndexSpec> >                   TIndex;
+    typedef Backtracking<HammingDistance, TSpec>                            TFinderSpec;
+    typedef typename TextIterator_<TIndex, TPattern, TFinderSpec>::Type     TTextIterator;
+    typedef typename Value<TIndex>::Type                                    TAlphabet;
+
+    TTextIterator & textIt = _textIterator(finder);
+    SearchSchemeStep_ const & current = scheme[step];
+    TAlphabet c = value(pattern, current.pos);
+
+    // Exact case.
+    if (finder._score >= current.maxErrors)
+    {
+        if (goDown(textIt, c, dir))
+        {
+            if (!current.pieceEnd || pieceErrors >= current.minPieceErrors)
+                _findSearchScheme(finder, pattern, scheme, step + 1, current.pieceEnd ? 0 : pieceErrors, delegate);
+
+            goUp(textIt);
+        }
+    }
+
+    // Approximate case.
+    else if (goDown(textIt, dir))
+    {
+        do
+        {
+            unsigned errors = pieceErrors + !ordEqual(parentEdgeLabel(textIt), c);
+
+            finder._score += errors - pieceErrors;
+
+            if (!current.pieceEnd || errors >= current.minPieceErrors)
+                _findSearchScheme(finder, pattern, scheme, step + 1, current.pieceEnd ? 0 : errors, delegate);
+
+            finder._score -= errors - pieceErrors;
+        }
+        while (goRight(textIt, dir));
+
+        goUp(textIt);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _find()
+// ----------------------------------------------------------------------------
+// Backtracking on a bidirectional index follows search schemes: the pattern
+// is extended in both directions, such that the errors are allowed only in
+// the deeper levels of the backtracking tree.
+
+template <typename TText, typename TIndexSpec, typename TPattern, typename TSpec, typename TDelegate>
+inline void
+_find(Finder_<Index<TText, BidirectionalIndex<TIndexSpec> >, TPattern, Backtracking<HammingDistance, TSpec> > & finder,
+      TPattern const & pattern,
+      TDelegate & delegate)
+{
+    typedef String<SearchSchemeStep_>                           TScheme;
+    typedef String<TScheme>                                     TSchemes;
+    typedef typename Iterator<TSchemes const, Standard>::Type   TSchemesIter;
+
+    if (empty(pattern)) return;
+
+    TSchemes schemes;
+    _initSearchSchemes(schemes, length(pattern), _getScoreThreshold(finder));
+
+    for (TSchemesIter schemeIt = begin(schemes, Standard()); schemeIt != end(schemes, Standard()); ++schemeIt)
+    {
+        goRoot(_textIterator(finder));
+        finder._score = 0;
+        _findSearchScheme(finder, pattern, value(schemeIt), 0u, 0u, delegate);
+    }
+}
+
+template <typename TText, typename TIndexSpec, typename TPattern, typename TSpec, typename TValue, typename TDelegate>
+inline void
+_find(Finder_<Index<TText, BidirectionalIndex<TIndexSpec> >, TPattern, Backtracking<HammingDistance, TSpec> > & finder,
+      Index<TText, BidirectionalIndex<TIndexSpec> > & text,
+      TPattern const & pattern,
+      TValue maxScore,
+      TDelegate & delegate)
+{
+    typedef Index<TText, BidirectionalIndex<TIndexSpec> >                       TTextIndex;
+    typedef Backtracking<HammingDistance, TSpec>                                TBacktracking;
+    typedef typename TextIterator_<TTextIndex, TPattern, TBacktracking>::Type   TTextIterator;
+
+    _textIterator(finder) = TTextIterator(text);
+    _setScoreThreshold(finder, maxScore);
+    _find(finder, pattern, delegate);
+}
+
 }
 
 #endif  // #ifndef SEQAN_FIND_BACKTRACKING_MULTIPLE_H_
@@ -51,6 +51,17 @@ struct DefaultFind<Index<THaystack, THaystackSpec>, TPattern>
     typedef Backtracking<Exact> Type;
 };
 
+// ----------------------------------------------------------------------------
+// Metafunction FindBatchSize_<Index>
+// ----------------------------------------------------------------------------
+// Number of needles whose backward search steps are interleaved.
+
+template <typename TIndex>
+struct FindBatchSize_
+{
+    static const unsigned VALUE = 32;
+};
+
 // ============================================================================
 // Functions
 // ============================================================================
@@ -79,6 +90,104 @@ _findImpl(TState & /* state */,
     }
 }
 
+// ----------------------------------------------------------------------------
+// Function _findBatch(fmIndex, needles, Backtracking<Exact>)
+// ----------------------------------------------------------------------------
+// Interleaves the backward search steps of a batch of needles. After each step
+// of one needle, the rank blocks of its next step are prefetched; they arrive
+// while the steps of the other needles in the batch are computed.
+
+template <typename TText, typename TOccSpec, typename TIndexSpec, typename TNeedles, typename TPos,
+          typename TThreshold, typename TDelegate>
+inline void
+_findBatch(Index<TText, FMIndex<TOccSpec, TIndexSpec> > & index,
+           TNeedles const & needles,
+           TPos batchBegin,
+           TPos batchEnd,
+           TThreshold /* threshold */,
+           TDelegate & delegate)
+{
+    typedef Index<TText, FMIndex<TOccSpec, TIndexSpec> >        TIndex;
+    typedef typename Fibre<TIndex, FibreLF>::Type               TLF;
+    typedef typename Size<TIndex>::Type                         TSize;
+    typedef Pair<TSize>                                         TRange;
+    typedef typename Iterator<TIndex, TopDown<> >::Type         TIndexIt;
+    typedef typename VertexDescriptor<TIndex>::Type             TVertexDesc;
+    typedef typename Iterator<TNeedles const, Rooted>::Type     TNeedlesIt;
+    typedef typename Reference<TNeedles const>::Type            TNeedle;
+    typedef typename Size<typename Value<TNeedles>::Type>::Type TNeedleSize;
+
+    static const unsigned BATCH_SIZE = FindBatchSize_<TIndex>::VALUE;
+
+    SEQAN_ASSERT_LEQ(batchEnd - batchBegin, static_cast<TPos>(BATCH_SIZE));
+
+    TLF const & lf = indexLF(index);
+    TIndexIt rootIt(index);
+
+    TVertexDesc vDescs[BATCH_SIZE];
+    TNeedleSize steps[BATCH_SIZE];
+    unsigned active[BATCH_SIZE];
+    unsigned activeCount = 0;
+    unsigned batchSize = batchEnd - batchBegin;
+
+    for (unsigned k = 0; k < batchSize; ++k)
+    {
+        vDescs[k] = value(rootIt);
+        steps[k] = 0;
+
+        if (!empty(needles[batchBegin + k]))
+            active[activeCount++] = k;
+    }
+
+    // Advance all active needles by one character per round.
+    while (activeCount > 0)
+    {
+        for (unsigned a = 0; a < activeCount;)
+        {
+            unsigned k = active[a];
+            TNeedle needle = needles[batchBegin + k];
+
+            TRange _range;
+
+            if (_getNodeByChar(rootIt, vDescs[k], _range, needle[steps[k]]))
+            {
+                vDescs[k].range = _range;
+
+                if (++steps[k] < length(needle))
+                {
+                    _prefetchBwtRank(lf, _range.i1);
+                    _prefetchBwtRank(lf, _range.i2);
+                    ++a;
+                    continue;
+                }
+            }
+
+            // The needle either mismatched or was fully matched.
+            active[a] = active[--activeCount];
+        }
+    }
+
+    // Report the occurrences in the order of the needles.
+    for (unsigned k = 0; k < batchSize; ++k)
+    {
+        TNeedle needle = needles[batchBegin + k];
+
+        if (steps[k] != length(needle)) continue;
+
+        TIndexIt indexIt(rootIt);
+        if (steps[k] > 0)
+        {
+            _historyPush(indexIt);
+            value(indexIt).range = vDescs[k].range;
+            value(indexIt).repLen = steps[k];
+            value(indexIt).lastChar = back(needle);
+        }
+
+        TNeedlesIt needlesIt = begin(needles, Rooted()) + (batchBegin + k);
+        delegate(indexIt, needlesIt, TThreshold());
+    }
+}
+
 // ----------------------------------------------------------------------------
 // Function _findImpl(trieText, sequenceNeedle, Backtracking<Edit/HammingDistance>)
 // ----------------------------------------------------------------------------
@@ -188,6 +297,62 @@ _findImpl(TState & /* indexIt */,
     approximateStringSearch(delegator, needle, indexIt, threshold);
 }
 
+// ----------------------------------------------------------------------------
+// Function find(fmIndex, needles, errors, [](...){}, Backtracking<Exact>(), Serial());
+// ----------------------------------------------------------------------------
+// Exact search of many needles in an FM index is batched to hide the latency
+// of the rank dictionary lookups.
+
+template <typename TText, typename TOccSpec, typename TIndexSpec, typename TNeedle, typename TSSetSpec,
+          typename TThreshold, typename TDelegate, typename TSpec, typename TParallelTag>
+inline void find(Index<TText, FMIndex<TOccSpec, TIndexSpec> > & index,
+                 StringSet<TNeedle, TSSetSpec> const & needles,
+                 TThreshold threshold,
+                 TDelegate && delegate,
+                 Backtracking<Exact, TSpec>,
+                 Tag<TParallelTag> const & /* tag */)
+{
+    typedef Index<TText, FMIndex<TOccSpec, TIndexSpec> >        TIndex;
+    typedef typename Size<StringSet<TNeedle, TSSetSpec> >::Type TNeedlesSize;
+
+    TNeedlesSize needlesCount = length(needles);
+
+    for (TNeedlesSize batchBegin = 0; batchBegin < needlesCount; batchBegin += FindBatchSize_<TIndex>::VALUE)
+    {
+        TNeedlesSize batchEnd = std::min(needlesCount, batchBegin + FindBatchSize_<TIndex>::VALUE);
+        _findBatch(index, needles, batchBegin, batchEnd, threshold, delegate);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function find(fmIndex, needles, errors, [](...){}, Backtracking<Exact>(), Parallel());
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TOccSpec, typename TIndexSpec, typename TNeedle, typename TSSetSpec,
+          typename TThreshold, typename TDelegate, typename TSpec>
+inline void find(Index<TText, FMIndex<TOccSpec, TIndexSpec> > & index,
+                 StringSet<TNeedle, TSSetSpec> const & needles,
+                 TThreshold threshold,
+                 TDelegate && delegate,
+                 Backtracking<Exact, TSpec>,
+                 Parallel)
+{
+    typedef Index<TText, FMIndex<TOccSpec, TIndexSpec> >        TIndex;
+    typedef typename Size<StringSet<TNeedle, TSSetSpec> >::Type TNeedlesSize;
+    typedef typename MakeSigned<TNeedlesSize>::Type             TSignedSize;
+
+    TNeedlesSize needlesCount = length(needles);
+    TSignedSize batchesCount = (needlesCount + FindBatchSize_<TIndex>::VALUE - 1) / FindBatchSize_<TIndex>::VALUE;
+
+    SEQAN_OMP_PRAGMA(parallel for schedule(dynamic))
+    for (TSignedSize batch = 0; batch < batchesCount; ++batch)
+    {
+        TNeedlesSize batchBegin = batch * FindBatchSize_<TIndex>::VALUE;
+        TNeedlesSize batchEnd = std::min(needlesCount, batchBegin + FindBatchSize_<TIndex>::VALUE);
+        _findBatch(index, needles, batchBegin, batchEnd, threshold, delegate);
+    }
+}
+
 // ----------------------------------------------------------------------------
 // Function find(treeText, trieNeedle, Backtracking<TDistance>());
 // ----------------------------------------------------------------------------
@@ -51,6 +51,7 @@ namespace SEQAN_NAMESPACE_MAIN
     struct LarssonSadakane;
     struct ManberMyers;
     struct SAQSort;
+    struct Sais;
     struct QGramAlg;
 
     // inverse suffix array construction specs
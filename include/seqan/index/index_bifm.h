@@ -0,0 +1,319 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2015, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: SeqAn Team <seqan-dev@lists.fu-berlin.de>
+// ==========================================================================
+// Bidirectional FM index: an FM index of the text paired with an FM index
+// of the reversed text, allowing to extend a pattern in both directions.
+// ==========================================================================
+
+//SEQAN_NO_DDDOC:do not generate documentation for this file
+
+#ifndef INDEX_BIFM_H_
+#define INDEX_BIFM_H_
+
+namespace seqan {
+
+// ============================================================================
+// Tags
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Tags Fwd, Rev
+// ----------------------------------------------------------------------------
+
+/*!
+ * @defgroup BidirectionalDirection Bidirectional Direction Tags
+ * @brief Tags to select the direction in which a @link BidirectionalIndex @endlink iterator extends its pattern.
+ *
+ * @tag BidirectionalDirection#Fwd
+ * @headerfile <seqan/index.h>
+ * @brief Extends the pattern to the right, using the index of the reversed text.
+ *
+ * @tag BidirectionalDirection#Rev
+ * @headerfile <seqan/index.h>
+ * @brief Extends the pattern to the left, using the index of the text.
+ */
+
+struct Fwd_;
+typedef Tag<Fwd_> const     Fwd;
+
+struct Rev_;
+typedef Tag<Rev_> const     Rev;
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+template <typename TIndexSpec = FMIndex<> >
+struct BidirectionalIndex {};
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Metafunction Fibre
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TIndexSpec>
+struct Fibre<Index<TText, BidirectionalIndex<TIndexSpec> >, FibreSA>
+{
+    typedef typename Fibre<Index<TText, TIndexSpec>, FibreSA>::Type     Type;
+};
+
+// ----------------------------------------------------------------------------
+// Metafunction DefaultFinder
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TIndexSpec>
+struct DefaultFinder<Index<TText, BidirectionalIndex<TIndexSpec> > >
+{
+    typedef FinderSTree Type;
+};
+
+// ============================================================================
+// Classes
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Class BidirectionalIndex
+// ----------------------------------------------------------------------------
+
+/*!
+ * @class BidirectionalIndex
+ * @extends Index
+ * @headerfile <seqan/index.h>
+ * @brief A pair of FM indices of a text and of its reverse, which allows to extend patterns in both directions.
+ *
+ * @signature template <typename TText[, typename TIndexSpec]>
+ *            class Index<TText, BidirectionalIndex<TIndexSpec> >;
+ *
+ * @tparam TText      The text type. Types: @link String @endlink, @link StringSet @endlink
+ * @tparam TIndexSpec The specialization of the two underlying indices, defaults to @link FMIndex @endlink.
+ *
+ * @section Structure
+ *
+ * The member <tt>rev</tt> is an index of the original text, its backward search extends a pattern to the left.
+ * The member <tt>fwd</tt> is an index of a reversed copy of the text, its backward search extends a pattern
+ * to the right.  A top-down iterator of the bidirectional index keeps the suffix array ranges of both indices
+ * in sync, see @link BidirectionalDirection @endlink.  Occurrences are reported as positions in the original text.
+ */
+
+template <typename TText, typename TIndexSpec>
+class Index<TText, BidirectionalIndex<TIndexSpec> >
+{
+public:
+    Index<TText, TIndexSpec>    fwd;
+    Index<TText, TIndexSpec>    rev;
+
+    Index() {}
+
+    Index(TText & text) :
+        rev(text)
+    {
+        _initFwdText(*this, text);
+    }
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _initFwdText()
+// ----------------------------------------------------------------------------
+
+// The forward index owns a reversed copy of the text.
+template <typename TText, typename TIndexSpec>
+inline void _initFwdText(Index<TText, BidirectionalIndex<TIndexSpec> > & index, TText const & text)
+{
+    TText & fwdText = getFibre(index.fwd, FibreText());
+    fwdText = text;
+    reverse(fwdText);
+}
+
+// ----------------------------------------------------------------------------
+// Function clear()
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TIndexSpec>
+inline void clear(Index<TText, BidirectionalIndex<TIndexSpec> > & index)
+{
+    clear(index.fwd);
+    clear(index.rev);
+}
+
+// ----------------------------------------------------------------------------
+// Function empty()
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TIndexSpec>
+inline bool empty(Index<TText, BidirectionalIndex<TIndexSpec> > const & index)
+{
+    return empty(index.fwd) && empty(index.rev);
+}
+
+// ----------------------------------------------------------------------------
+// Function getFibre()
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TIndexSpec>
+SEQAN_HOST_DEVICE inline typename Fibre<Index<TText, BidirectionalIndex<TIndexSpec> >, FibreText>::Type &
+getFibre(Index<TText, BidirectionalIndex<TIndexSpec> > & index, FibreText /*tag*/)
+{
+    return getFibre(index.rev, FibreText());
+}
+
+template <typename TText, typename TIndexSpec>
+SEQAN_HOST_DEVICE inline typename Fibre<Index<TText, BidirectionalIndex<TIndexSpec> >, FibreText>::Type const &
+getFibre(Index<TText, BidirectionalIndex<TIndexSpec> > const & index, FibreText /*tag*/)
+{
+    return getFibre(index.rev, FibreText());
+}
+
+template <typename TText, typename TIndexSpec>
+SEQAN_HOST_DEVICE inline typename Fibre<Index<TText, BidirectionalIndex<TIndexSpec> >, FibreSA>::Type &
+getFibre(Index<TText, BidirectionalIndex<TIndexSpec> > & index, FibreSA /*tag*/)
+{
+    return getFibre(index.rev, FibreSA());
+}
+
+template <typename TText, typename TIndexSpec>
+SEQAN_HOST_DEVICE inline typename Fibre<Index<TText, BidirectionalIndex<TIndexSpec> >, FibreSA>::Type const &
+getFibre(Index<TText, BidirectionalIndex<TIndexSpec> > const & index, FibreSA /*tag*/)
+{
+    return getFibre(index.rev, FibreSA());
+}
+
+// ----------------------------------------------------------------------------
+// Function indexCreate()
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TIndexSpec>
+inline bool indexCreate(Index<TText, BidirectionalIndex<TIndexSpec> > & index, FibreSALF)
+{
+    return indexCreate(index.fwd, FibreSALF()) && indexCreate(index.rev, FibreSALF());
+}
+
+template <typename TText, typename TIndexSpec, typename TAlgo>
+inline bool indexCreate(Index<TText, BidirectionalIndex<TIndexSpec> > & index, FibreSALF, TAlgo const)
+{
+    return indexCreate(index.fwd, FibreSALF(), TAlgo()) && indexCreate(index.rev, FibreSALF(), TAlgo());
+}
+
+template <typename TText, typename TIndexSpec, typename TAlgo>
+inline bool indexCreate(Index<TText, BidirectionalIndex<TIndexSpec> > & index, FibreSA, TAlgo const)
+{
+    return indexCreate(index, FibreSALF(), TAlgo());
+}
+
+template <typename TText, typename TIndexSpec>
+inline bool indexCreate(Index<TText, BidirectionalIndex<TIndexSpec> > & index, FibreSA)
+{
+    return indexCreate(index, FibreSALF());
+}
+
+template <typename TText, typename TIndexSpec>
+inline bool indexCreate(Index<TText, BidirectionalIndex<TIndexSpec> > & index)
+{
+    return indexCreate(index, FibreSALF());
+}
+
+// ----------------------------------------------------------------------------
+// Function indexSupplied()
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TIndexSpec>
+SEQAN_HOST_DEVICE inline bool indexSupplied(Index<TText, BidirectionalIndex<TIndexSpec> > & index, FibreSALF const)
+{
+    return indexSupplied(index.fwd, FibreSALF()) && indexSupplied(index.rev, FibreSALF());
+}
+
+template <typename TText, typename TIndexSpec>
+SEQAN_HOST_DEVICE inline bool indexSupplied(Index<TText, BidirectionalIndex<TIndexSpec> > const & index, FibreSALF const)
+{
+    return indexSupplied(index.fwd, FibreSALF()) && indexSupplied(index.rev, FibreSALF());
+}
+
+// ----------------------------------------------------------------------------
+// Function open()
+// ----------------------------------------------------------------------------
+
+// This function can be used to open a previously saved index.
+template <typename TText, typename TIndexSpec>
+inline bool open(Index<TText, BidirectionalIndex<TIndexSpec> > & index, const char * fileName, int openMode)
+{
+    String<char> name;
+
+    name = fileName;    append(name, ".fwd");
+    if (!open(index.fwd, toCString(name), openMode)) return false;
+
+    name = fileName;    append(name, ".rev");
+    if (!open(index.rev, toCString(name), openMode)) return false;
+
+    return true;
+}
+
+// This function can be used to open a previously saved index.
+template <typename TText, typename TIndexSpec>
+inline bool open(Index<TText, BidirectionalIndex<TIndexSpec> > & index, const char * fileName)
+{
+    return open(index, fileName, DefaultOpenMode<Index<TText, BidirectionalIndex<TIndexSpec> > >::VALUE);
+}
+
+// ----------------------------------------------------------------------------
+// Function save()
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TIndexSpec>
+inline bool save(Index<TText, BidirectionalIndex<TIndexSpec> > const & index, const char * fileName, int openMode)
+{
+    String<char> name;
+
+    name = fileName;    append(name, ".fwd");
+    if (!save(index.fwd, toCString(name), openMode)) return false;
+
+    name = fileName;    append(name, ".rev");
+    if (!save(index.rev, toCString(name), openMode)) return false;
+
+    return true;
+}
+
+// This function can be used to save an index on disk.
+template <typename TText, typename TIndexSpec>
+inline bool save(Index<TText, BidirectionalIndex<TIndexSpec> > const & index, const char * fileName)
+{
+    return save(index, fileName, DefaultOpenMode<Index<TText, BidirectionalIndex<TIndexSpec> > >::VALUE);
+}
+
+}
+#endif // INDEX_BIFM_H_
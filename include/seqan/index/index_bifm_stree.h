@@ -0,0 +1,672 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2015, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: SeqAn Team <seqan-dev@lists.fu-berlin.de>
+// ==========================================================================
+// Top-down iterators of the bidirectional FM index.
+//
+// Extending the pattern in one direction is a backward search step on one of
+// the two FM indices.  The range of the other index is updated by counting
+// the occurrences of all characters smaller than the new one (and of the
+// sentinels) within the current BWT range.
+// ==========================================================================
+
+//SEQAN_NO_DDDOC:do not generate documentation for this file
+
+#ifndef INDEX_BIFM_STREE_H_
+#define INDEX_BIFM_STREE_H_
+
+namespace seqan {
+
+// ============================================================================
+// Classes
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Class Iter<BidirectionalIndex, TopDown>
+// ----------------------------------------------------------------------------
+
+/*!
+ * @class BidirectionalIndexIterator
+ * @extends TopDownIterator
+ * @headerfile <seqan/index.h>
+ * @brief A top-down iterator of a @link BidirectionalIndex @endlink.
+ *
+ * @signature template <typename TText, typename TIndexSpec, typename TSpec>
+ *            class Iter<Index<TText, BidirectionalIndex<TIndexSpec> >, VSTree<TopDown<TSpec> > >;
+ *
+ * The iterator consists of one top-down iterator per underlying index, both point to the node of the same
+ * pattern.  The functions @link BidirectionalIndexIterator#goDown @endlink and
+ * @link BidirectionalIndexIterator#goRight @endlink take a direction tag (@link BidirectionalDirection @endlink),
+ * a subsequent <tt>goRight()</tt> must be called with the same direction as the preceding <tt>goDown()</tt>.
+ * The default direction is <tt>Fwd</tt>.
+ */
+
+template <typename TText, typename TIndexSpec, typename TSpec>
+class Iter<Index<TText, BidirectionalIndex<TIndexSpec> >, VSTree<TopDown<TSpec> > >
+{
+public:
+    typedef Index<TText, BidirectionalIndex<TIndexSpec> >               TIndex;
+    typedef Iter<Index<TText, TIndexSpec>, VSTree<TopDown<TSpec> > >    TUniIter;
+
+    TIndex const *  index;
+    TUniIter        fwdIter;
+    TUniIter        revIter;
+
+    Iter() :
+        index()
+    {}
+
+    Iter(TIndex & _index) :
+        index(&_index),
+        fwdIter(_index.fwd),
+        revIter(_index.rev)
+    {}
+};
+
+template <typename TText, typename TIndexSpec, typename TSpec>
+class Iter<Index<TText, BidirectionalIndex<TIndexSpec> >, VSTree<TopDown<ParentLinks<TSpec> > > >
+{
+public:
+    typedef Index<TText, BidirectionalIndex<TIndexSpec> >                               TIndex;
+    typedef Iter<Index<TText, TIndexSpec>, VSTree<TopDown<ParentLinks<TSpec> > > >      TUniIter;
+
+    TIndex const *  index;
+    TUniIter        fwdIter;
+    TUniIter        revIter;
+
+    Iter() :
+        index()
+    {}
+
+    Iter(TIndex & _index) :
+        index(&_index),
+        fwdIter(_index.fwd),
+        revIter(_index.rev)
+    {}
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _indexRequireTopDownIteration()                             [Index]
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TIndexSpec>
+inline void _indexRequireTopDownIteration(Index<TText, BidirectionalIndex<TIndexSpec> > & index)
+{
+    indexRequire(index, FibreSALF());
+}
+
+// ----------------------------------------------------------------------------
+// Function begin()                                                  [Iterator]
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TIndexSpec, typename TSpec>
+inline typename Iterator<Index<TText, BidirectionalIndex<TIndexSpec> >, TSpec>::Type
+begin(Index<TText, BidirectionalIndex<TIndexSpec> > & index, TSpec const /*Tag*/)
+{
+    typedef typename Iterator<Index<TText, BidirectionalIndex<TIndexSpec> >, TSpec>::Type TIter;
+
+    return TIter(index);
+}
+
+// ----------------------------------------------------------------------------
+// Function _iter()                                                  [Iterator]
+// ----------------------------------------------------------------------------
+
+// Returns the unidirectional iterator performing the backward search in direction dir.
+template <typename TText, typename TIndexSpec, typename TSpec>
+inline Iter<Index<TText, TIndexSpec>, VSTree<TopDown<TSpec> > > &
+_iter(Iter<Index<TText, BidirectionalIndex<TIndexSpec> >, VSTree<TopDown<TSpec> > > & it, Fwd)
+{
+    return it.fwdIter;
+}
+
+template <typename TText, typename TIndexSpec, typename TSpec>
+inline Iter<Index<TText, TIndexSpec>, VSTree<TopDown<TSpec> > > const &
+_iter(Iter<Index<TText, BidirectionalIndex<TIndexSpec> >, VSTree<TopDown<TSpec> > > const & it, Fwd)
+{
+    return it.fwdIter;
+}
+
+template <typename TText, typename TIndexSpec, typename TSpec>
+inline Iter<Index<TText, TIndexSpec>, VSTree<TopDown<TSpec> > > &
+_iter(Iter<Index<TText, BidirectionalIndex<TIndexSpec> >, VSTree<TopDown<TSpec> > > & it, Rev)
+{
+    return it.revIter;
+}
+
+template <typename TText, typename TIndexSpec, typename TSpec>
+inline Iter<Index<TText, TIndexSpec>, VSTree<TopDown<TSpec> > > const &
+_iter(Iter<Index<TText, BidirectionalIndex<TIndexSpec> >, VSTree<TopDown<TSpec> > > const & it, Rev)
+{
+    return it.revIter;
+}
+
+// ----------------------------------------------------------------------------
+// Function _oppositeIter()                                          [Iterator]
+// ----------------------------------------------------------------------------
+
+// Returns the unidirectional iterator that is only kept in sync in direction dir.
+template <typename TText, typename TIndexSpec, typename TSpec>
+inline Iter<Index<TText, TIndexSpec>, VSTree<TopDown<TSpec> > > &
+_oppositeIter(Iter<Index<TText, BidirectionalIndex<TIndexSpec> >, VSTree<TopDown<TSpec> > > & it, Fwd)
+{
+    return it.revIter;
+}
+
+template <typename TText, typename TIndexSpec, typename TSpec>
+inline Iter<Index<TText, TIndexSpec>, VSTree<TopDown<TSpec> > > &
+_oppositeIter(Iter<Index<TText, BidirectionalIndex<TIndexSpec> >, VSTree<TopDown<TSpec> > > & it, Rev)
+{
+    return it.fwdIter;
+}
+
+// ----------------------------------------------------------------------------
+// Function _countSentinels()
+// ----------------------------------------------------------------------------
+
+// Counts the sentinels within the BWT range [i1, i2).
+template <typename TText, typename TSpec, typename TConfig, typename TPos>
+inline typename Size<LF<TText, TSpec, TConfig> >::Type
+_countSentinels(LF<TText, TSpec, TConfig> const & lf, Pair<TPos> const & _range)
+{
+    if (_range.i1 >= _range.i2) return 0;
+
+    return _getSentinelsRank(lf, _range.i2 - 1) - ((_range.i1 > 0) ? _getSentinelsRank(lf, _range.i1 - 1) : 0);
+}
+
+// ----------------------------------------------------------------------------
+// Function _getNodeByChar()                                         [Iterator]
+// ----------------------------------------------------------------------------
+
+// Maps the ranges of a node onto the ranges of its child labeled c in direction dir.
+template <typename TText, typename TIndexSpec, typename TSpec, typename TSize, typename TChar, typename TDirection>
+inline bool
+_getNodeByChar(Iter<Index<TText, BidirectionalIndex<TIndexSpec> >, VSTree<TopDown<TSpec> > > const & it,
+               Pair<TSize> & extRange,
+               Pair<TSize> & syncRange,
+               TChar c,
+               TDirection const & dir)
+{
+    typedef Index<TText, TIndexSpec>                            TUniIndex;
+    typedef typename Fibre<TUniIndex, FibreLF>::Type            TLF;
+    typedef typename Value<TUniIndex>::Type                     TAlphabet;
+
+    TLF const & lf = indexLF(container(_iter(it, dir)));
+
+    Pair<TSize> _range(lf(extRange.i1, c), lf(extRange.i2, c));
+
+    if (_range.i1 >= _range.i2) return false;
+
+    // All children smaller than c precede the child labeled c in the other index.
+    TSize smaller = _countSentinels(lf, extRange);
+    for (unsigned ord = 0; ord < ordValue(c); ++ord)
+        smaller += lf(extRange.i2, TAlphabet(ord)) - lf(extRange.i1, TAlphabet(ord));
+
+    syncRange.i1 += smaller;
+    syncRange.i2 = syncRange.i1 + (_range.i2 - _range.i1);
+    extRange = _range;
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Function _setNode()                                               [Iterator]
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TIndexSpec, typename TSpec, typename TSize, typename TChar, typename TDirection>
+inline void
+_setNode(Iter<Index<TText, BidirectionalIndex<TIndexSpec> >, VSTree<TopDown<TSpec> > > & it,
+         Pair<TSize> const & extRange,
+         Pair<TSize> const & syncRange,
+         TChar c,
+         TDirection const & dir)
+{
+    value(_iter(it, dir)).range = extRange;
+    value(_iter(it, dir)).lastChar = c;
+    value(_oppositeIter(it, dir)).range = syncRange;
+    value(_oppositeIter(it, dir)).lastChar = c;
+}
+
+// ----------------------------------------------------------------------------
+// Function _historyPush()                                           [Iterator]
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TIndexSpec, typename TSpec>
+inline void
+_historyPush(Iter<Index<TText, BidirectionalIndex<TIndexSpec> >, VSTree<TopDown<TSpec> > > & it)
+{
+    _historyPush(it.fwdIter);
+    _historyPush(it.revIter);
+}
+
+// ----------------------------------------------------------------------------
+// Function _goDownChar()                                            [Iterator]
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TIndexSpec, typename TSpec, typename TChar, typename TDirection>
+inline bool
+_goDownChar(Iter<Index<TText, BidirectionalIndex<TIndexSpec> >, VSTree<TopDown<TSpec> > > & it,
+            TChar c,
+            TDirection const & dir)
+{
+    typedef Index<TText, TIndexSpec>                            TUniIndex;
+    typedef typename Value<TUniIndex>::Type                     TAlphabet;
+    typedef Pair<typename Size<TUniIndex>::Type>                TRange;
+
+    TAlphabet cc = c;
+    TRange extRange = range(_iter(it, dir));
+    TRange syncRange = range(_oppositeIter(it, dir));
+
+    if (!_getNodeByChar(it, extRange, syncRange, cc, dir)) return false;
+
+    _historyPush(it);
+    _setNode(it, extRange, syncRange, cc, dir);
+    value(it.fwdIter).repLen++;
+    value(it.revIter).repLen++;
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Function _goDownString()                                          [Iterator]
+// ----------------------------------------------------------------------------
+
+// Like on the unidirectional FM index, a string is a single edge: the history is pushed only once.
+template <typename TText, typename TIndexSpec, typename TSpec, typename TString, typename TSize>
+inline bool
+_goDownString(Iter<Index<TText, BidirectionalIndex<TIndexSpec> >, VSTree<TopDown<TSpec> > > & it,
+              TString const & string,
+              TSize & lcp,
+              Fwd)
+{
+    typedef Index<TText, TIndexSpec>                            TUniIndex;
+    typedef typename Value<TUniIndex>::Type                     TAlphabet;
+    typedef Pair<typename Size<TUniIndex>::Type>                TRange;
+    typedef typename Iterator<TString const, Standard>::Type    TStringIter;
+
+    _historyPush(it);
+
+    TRange extRange = range(it.fwdIter);
+    TRange syncRange = range(it.revIter);
+
+    TStringIter stringIt = begin(string, Standard());
+    TStringIter stringEnd = end(string, Standard());
+
+    for (lcp = 0; stringIt != stringEnd; ++stringIt, ++lcp)
+    {
+        if (!_getNodeByChar(it, extRange, syncRange, TAlphabet(value(stringIt)), Fwd())) break;
+
+        _setNode(it, extRange, syncRange, TAlphabet(value(stringIt)), Fwd());
+    }
+
+    value(it.fwdIter).repLen += lcp;
+    value(it.revIter).repLen += lcp;
+
+    return stringIt == stringEnd;
+}
+
+template <typename TText, typename TIndexSpec, typename TSpec, typename TString, typename TSize>
+inline bool
+_goDownString(Iter<Index<TText, BidirectionalIndex<TIndexSpec> >, VSTree<TopDown<TSpec> > > & it,
+              TString const & string,
+              TSize & lcp,
+              Rev)
+{
+    typedef Index<TText, TIndexSpec>                            TUniIndex;
+    typedef typename Value<TUniIndex>::Type                     TAlphabet;
+    typedef Pair<typename Size<TUniIndex>::Type>                TRange;
+    typedef typename Iterator<TString const, Standard>::Type    TStringIter;
+
+    _historyPush(it);
+
+    TRange extRange = range(it.revIter);
+    TRange syncRange = range(it.fwdIter);
+
+    TStringIter stringBegin = begin(string, Standard());
+    TStringIter stringIt = end(string, Standard());
+
+    // The string is prepended, i.e. searched from its last character on.
+    for (lcp = 0; stringIt != stringBegin; --stringIt, ++lcp)
+    {
+        if (!_getNodeByChar(it, extRange, syncRange, TAlphabet(value(stringIt - 1)), Rev())) break;
+
+        _setNode(it, extRange, syncRange, TAlphabet(value(stringIt - 1)), Rev());
+    }
+
+    value(it.fwdIter).repLen += lcp;
+    value(it.revIter).repLen += lcp;
+
+    return stringIt == stringBegin;
+}
+
+// ----------------------------------------------------------------------------
+// Function _goDownObject()                                          [Iterator]
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TIndexSpec, typename TSpec, typename TObject, typename TDirection>
+inline bool
+_goDownObject(Iter<Index<TText, BidirectionalIndex<TIndexSpec> >, VSTree<TopDown<TSpec> > > & it,
+              TObject const & obj,
+              TDirection const & dir,
+              False)
+{
+    return _goDownChar(it, obj, dir);
+}
+
+template <typename TText, typename TIndexSpec, typename TSpec, typename TObject, typename TDirection>
+inline bool
+_goDownObject(Iter<Index<TText, BidirectionalIndex<TIndexSpec> >, VSTree<TopDown<TSpec> > > & it,
+              TObject const & obj,
+              TDirection const & dir,
+              True)
+{
+    typename Size<Index<TText, TIndexSpec> >::Type lcp;
+    return _goDownString(it, obj, lcp, dir);
+}
+
+// ----------------------------------------------------------------------------
+// Function goDown()                                                 [Iterator]
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn BidirectionalIndexIterator#goDown
+ * @headerfile <seqan/index.h>
+ * @brief Extends the pattern of the iterator by a character or a string.
+ *
+ * @signature bool goDown(iterator[, obj][, dir]);
+ *
+ * @param[in,out] iterator The iterator to move.
+ * @param[in]     obj      A character or a string.  If omitted, the iterator moves to the first child.
+ * @param[in]     dir      The direction of the extension, <tt>Fwd</tt> appends, <tt>Rev</tt> prepends
+ *                         (see @link BidirectionalDirection @endlink).  Defaults to <tt>Fwd</tt>.
+ *
+ * @return bool <tt>true</tt> if the extended pattern occurs in the text.
+ */
+
+template <typename TText, typename TIndexSpec, typename TSpec, typename TDirection>
+inline bool
+goDown(Iter<Index<TText, BidirectionalIndex<TIndexSpec> >, VSTree<TopDown<TSpec> > > & it,
+       Tag<TDirection> const & dir)
+{
+    typedef typename Value<Index<TText, TIndexSpec> >::Type     TAlphabet;
+
+    for (unsigned ord = 0; ord < ValueSize<TAlphabet>::VALUE; ++ord)
+        if (_goDownChar(it, TAlphabet(ord), dir))
+            return true;
+
+    return false;
+}
+
+template <typename TText, typename TIndexSpec, typename TSpec>
+inline bool
+goDown(Iter<Index<TText, BidirectionalIndex<TIndexSpec> >, VSTree<TopDown<TSpec> > > & it)
+{
+    return goDown(it, Fwd());
+}
+
+template <typename TText, typename TIndexSpec, typename TSpec, typename TObject, typename TDirection>
+inline bool
+goDown(Iter<Index<TText, BidirectionalIndex<TIndexSpec> >, VSTree<TopDown<TSpec> > > & it,
+       TObject const & obj,
+       Tag<TDirection> const & dir)
+{
+    return _goDownObject(it, obj, dir, typename IsSequence<TObject>::Type());
+}
+
+template <typename TText, typename TIndexSpec, typename TSpec, typename TObject>
+inline bool
+goDown(Iter<Index<TText, BidirectionalIndex<TIndexSpec> >, VSTree<TopDown<TSpec> > > & it,
+       TObject const & obj)
+{
+    return goDown(it, obj, Fwd());
+}
+
+// ----------------------------------------------------------------------------
+// Functions extendLeft(), extendRight()                             [Iterator]
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn BidirectionalIndexIterator#extendLeft
+ * @headerfile <seqan/index.h>
+ * @brief Prepends a character or a string to the pattern of the iterator.
+ *
+ * @signature bool extendLeft(iterator, obj);
+ *
+ * @param[in,out] iterator The iterator to move.
+ * @param[in]     obj      A character or a string.
+ *
+ * @return bool <tt>true</tt> if the extended pattern occurs in the text.
+ *
+ * @see BidirectionalIndexIterator#extendRight
+ */
+
+template <typename TText, typename TIndexSpec, typename TSpec, typename TObject>
+inline bool
+extendLeft(Iter<Index<TText, BidirectionalIndex<TIndexSpec> >, VSTree<TopDown<TSpec> > > & it,
+           TObject const & obj)
+{
+    return goDown(it, obj, Rev());
+}
+
+/*!
+ * @fn BidirectionalIndexIterator#extendRight
+ * @headerfile <seqan/index.h>
+ * @brief Appends a character or a string to the pattern of the iterator.
+ *
+ * @signature bool extendRight(iterator, obj);
+ *
+ * @param[in,out] iterator The iterator to move.
+ * @param[in]     obj      A character or a string.
+ *
+ * @return bool <tt>true</tt> if the extended pattern occurs in the text.
+ *
+ * @see BidirectionalIndexIterator#extendLeft
+ */
+
+template <typename TText, typename TIndexSpec, typename TSpec, typename TObject>
+inline bool
+extendRight(Iter<Index<TText, BidirectionalIndex<TIndexSpec> >, VSTree<TopDown<TSpec> > > & it,
+            TObject const & obj)
+{
+    return goDown(it, obj, Fwd());
+}
+
+// ----------------------------------------------------------------------------
+// Function goRight()                                                [Iterator]
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn BidirectionalIndexIterator#goRight
+ * @headerfile <seqan/index.h>
+ * @brief Moves the iterator to the next sibling, i.e. replaces the character added by the last call of
+ *        @link BidirectionalIndexIterator#goDown @endlink by the next larger one occurring in the text.
+ *
+ * @signature bool goRight(iterator[, dir]);
+ *
+ * @param[in,out] iterator The iterator to move.
+ * @param[in]     dir      The direction of the preceding <tt>goDown()</tt>. Defaults to <tt>Fwd</tt>.
+ *
+ * @return bool <tt>true</tt> if the iterator could be moved.
+ */
+
+template <typename TText, typename TIndexSpec, typename TSpec, typename TDirection>
+inline bool
+goRight(Iter<Index<TText, BidirectionalIndex<TIndexSpec> >, VSTree<TopDown<TSpec> > > & it,
+        Tag<TDirection> const & dir)
+{
+    typedef Index<TText, TIndexSpec>                            TUniIndex;
+    typedef typename Value<TUniIndex>::Type                     TAlphabet;
+    typedef typename Fibre<TUniIndex, FibreLF>::Type            TLF;
+    typedef Pair<typename Size<TUniIndex>::Type>                TRange;
+
+    if (isRoot(it)) return false;
+
+    TUniIndex const & index = container(_iter(it, dir));
+    TLF const & lf = indexLF(index);
+
+    TRange parentRange = range(index, nodeUp(_iter(it, dir)));
+
+    // Siblings are adjacent in the other index.
+    TRange syncRange;
+    syncRange.i1 = value(_oppositeIter(it, dir)).range.i2;
+
+    for (unsigned ord = ordValue(value(_iter(it, dir)).lastChar) + 1; ord < ValueSize<TAlphabet>::VALUE; ++ord)
+    {
+        TRange extRange(lf(parentRange.i1, TAlphabet(ord)), lf(parentRange.i2, TAlphabet(ord)));
+
+        if (extRange.i1 < extRange.i2)
+        {
+            syncRange.i2 = syncRange.i1 + (extRange.i2 - extRange.i1);
+            _setNode(it, extRange, syncRange, TAlphabet(ord), dir);
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template <typename TText, typename TIndexSpec, typename TSpec>
+inline bool
+goRight(Iter<Index<TText, BidirectionalIndex<TIndexSpec> >, VSTree<TopDown<TSpec> > > & it)
+{
+    return goRight(it, Fwd());
+}
+
+// ----------------------------------------------------------------------------
+// Function goUp()                                                   [Iterator]
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TIndexSpec, typename TSpec>
+inline bool
+goUp(Iter<Index<TText, BidirectionalIndex<TIndexSpec> >, VSTree<TopDown<ParentLinks<TSpec> > > > & it)
+{
+    goUp(it.revIter);
+    return goUp(it.fwdIter);
+}
+
+// ----------------------------------------------------------------------------
+// Function goRoot()                                                 [Iterator]
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TIndexSpec, typename TSpec>
+inline void
+goRoot(Iter<Index<TText, BidirectionalIndex<TIndexSpec> >, VSTree<TopDown<TSpec> > > & it)
+{
+    goRoot(it.fwdIter);
+    goRoot(it.revIter);
+}
+
+// ----------------------------------------------------------------------------
+// Function isRoot()                                                 [Iterator]
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TIndexSpec, typename TSpec>
+inline bool
+isRoot(Iter<Index<TText, BidirectionalIndex<TIndexSpec> >, VSTree<TopDown<TSpec> > > const & it)
+{
+    return isRoot(it.revIter);
+}
+
+// ----------------------------------------------------------------------------
+// Function repLength()                                              [Iterator]
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TIndexSpec, typename TSpec>
+inline typename Size<Index<TText, TIndexSpec> >::Type
+repLength(Iter<Index<TText, BidirectionalIndex<TIndexSpec> >, VSTree<TopDown<TSpec> > > const & it)
+{
+    return repLength(it.revIter);
+}
+
+// ----------------------------------------------------------------------------
+// Function parentEdgeLabel()                                        [Iterator]
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TIndexSpec, typename TSpec>
+inline typename Value<Index<TText, TIndexSpec> >::Type
+parentEdgeLabel(Iter<Index<TText, BidirectionalIndex<TIndexSpec> >, VSTree<TopDown<TSpec> > > const & it)
+{
+    return parentEdgeLabel(it.revIter);
+}
+
+// ----------------------------------------------------------------------------
+// Function representative()                                         [Iterator]
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TIndexSpec, typename TSpec>
+inline typename Infix<typename Fibre<Index<TText, TIndexSpec>, FibreText>::Type const>::Type
+representative(Iter<Index<TText, BidirectionalIndex<TIndexSpec> >, VSTree<TopDown<TSpec> > > const & it)
+{
+    return representative(it.revIter);
+}
+
+// ----------------------------------------------------------------------------
+// Function range()                                                  [Iterator]
+// ----------------------------------------------------------------------------
+
+// Returns the suffix array range within the index of the original text.
+template <typename TText, typename TIndexSpec, typename TSpec>
+inline Pair<typename Size<Index<TText, TIndexSpec> >::Type>
+range(Iter<Index<TText, BidirectionalIndex<TIndexSpec> >, VSTree<TopDown<TSpec> > > const & it)
+{
+    return range(it.revIter);
+}
+
+// ----------------------------------------------------------------------------
+// Function countOccurrences()                                       [Iterator]
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TIndexSpec, typename TSpec>
+inline typename Size<Index<TText, TIndexSpec> >::Type
+countOccurrences(Iter<Index<TText, BidirectionalIndex<TIndexSpec> >, VSTree<TopDown<TSpec> > > const & it)
+{
+    return countOccurrences(it.revIter);
+}
+
+// ----------------------------------------------------------------------------
+// Function getOccurrences()                                         [Iterator]
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TIndexSpec, typename TSpec>
+inline typename Infix<typename Fibre<Index<TText, TIndexSpec>, FibreSA>::Type const>::Type
+getOccurrences(Iter<Index<TText, BidirectionalIndex<TIndexSpec> >, VSTree<TopDown<TSpec> > > const & it)
+{
+    return getOccurrences(it.revIter);
+}
+
+}
+#endif  // INDEX_BIFM_STREE_H_
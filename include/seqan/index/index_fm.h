@@ -54,10 +54,14 @@ namespace seqan {
  * @headerfile <seqan/index.h>
  * @brief A configuration object that determines the data types of certain fibres of the @link FMIndex @endlink.
  *
- * @signature template <[typename TSpec]>
+ * @signature template <[typename TSpec[, typename TLengthSum[, typename TFibre]]]>
  *            struct FMIndexConfig;
  *
- * @tparam TSpec The specializating type, defaults to <tt>void</tt>.
+ * @tparam TSpec      The specializating type, defaults to <tt>void</tt>.
+ * @tparam TLengthSum The type used to store counts and positions, defaults to <tt>size_t</tt>.
+ * @tparam TFibre     The string specialization of the rank dictionaries, defaults to <tt>Alloc&lt;&gt;</tt>.
+ *                    Use <tt>MMap&lt;&gt;</tt> together with a memory mapped text to memory map all fibres on
+ *                    @link Index#open @endlink.
  *
  * @var unsigned FMIndexConfig::SAMPLING;
  * @brief The sampling rate determines how many suffix array entries are represented with one entry in the
@@ -74,12 +78,13 @@ namespace seqan {
  *        default @link FMIndexConfig @endlink object the type of <tt>TSentinelsSpec</tt> is a two level
  *        @link RankDictionary @endlink.
  */
-template <typename TSpec = void, typename TLengthSum = size_t>
+template <typename TSpec = void, typename TLengthSum = size_t, typename TFibre = Alloc<> >
 struct FMIndexConfig
 {
-    typedef TLengthSum                                  LengthSum;
-    typedef WaveletTree<TSpec, WTRDConfig<LengthSum> >  Bwt;
-    typedef Levels<TSpec, LevelsRDConfig<LengthSum> >   Sentinels;
+    typedef TLengthSum                                          LengthSum;
+    typedef TFibre                                              Fibre;
+    typedef WaveletTree<TSpec, WTRDConfig<LengthSum, Fibre> >   Bwt;
+    typedef Levels<TSpec, LevelsRDConfig<LengthSum, Fibre> >    Sentinels;
 
     static const unsigned SAMPLING =                    10;
 };
@@ -168,6 +173,24 @@ struct DefaultFinder<Index<TText, FMIndex<TSpec, TConfig> > >
     typedef FinderSTree Type;
 };
 
+// ----------------------------------------------------------------------------
+// Metafunction DefaultIndexCreator
+// ----------------------------------------------------------------------------
+// The temporary SA is built by induced sorting.  A single string is sorted directly and thus must be in memory,
+// external strings keep the default creator.  StringSets are read once into a concatenation of small integers.
+
+template <typename TValue, typename TStringSpec, typename TSpec, typename TConfig>
+struct DefaultIndexCreator<Index<String<TValue, Alloc<TStringSpec> >, FMIndex<TSpec, TConfig> >, FibreSA>
+{
+    typedef Sais Type;
+};
+
+template <typename TString, typename TSSetSpec, typename TSpec, typename TConfig>
+struct DefaultIndexCreator<Index<StringSet<TString, TSSetSpec>, FMIndex<TSpec, TConfig> >, FibreSA>
+{
+    typedef Sais Type;
+};
+
 // ============================================================================
 // Classes
 // ============================================================================
@@ -370,13 +393,12 @@ _findFirstIndex(Finder<Index<TText, FMIndex<TSpec, TConfig> >, TSpecFinder> & fi
 // Function indexCreate()
 // ----------------------------------------------------------------------------
 
-template <typename TText, typename TSpec, typename TConfig>
-inline bool indexCreate(Index<TText, FMIndex<TSpec, TConfig> > & index, FibreSALF)
+template <typename TText, typename TSpec, typename TConfig, typename TAlgo>
+inline bool indexCreate(Index<TText, FMIndex<TSpec, TConfig> > & index, FibreSALF, TAlgo const)
 {
     typedef Index<TText, FMIndex<TSpec, TConfig> >               TIndex;
     typedef typename Fibre<TIndex, FibreTempSA>::Type            TTempSA;
     typedef typename Size<TIndex>::Type                          TSize;
-    typedef typename DefaultIndexCreator<TIndex, FibreSA>::Type  TAlgo;
 
     TText const & text = indexText(index);
 
@@ -402,6 +424,53 @@ inline bool indexCreate(Index<TText, FMIndex<TSpec, TConfig> > & index, FibreSAL
     return true;
 }
 
+// The parallel construction keeps the full SA and the BWT in memory.
+template <typename TText, typename TSpec, typename TConfig>
+inline bool indexCreate(Index<TText, FMIndex<TSpec, TConfig> > & index, FibreSALF, Parallel const)
+{
+    typedef Index<TText, FMIndex<TSpec, TConfig> >               TIndex;
+    typedef typename SAValue<TIndex>::Type                       TSAValue;
+    typedef typename Size<TIndex>::Type                          TSize;
+
+    TText const & text = indexText(index);
+
+    if (empty(text))
+        return false;
+
+    String<TSAValue> tempSA;
+
+    // Create the full SA.
+    resize(tempSA, lengthSum(text), Exact());
+    createSuffixArray(tempSA, text, Parallel());
+
+    // Create the LF table.
+    createLF(indexLF(index), text, tempSA, Parallel());
+
+    // Set the FMIndex LF as the CompressedSA LF.
+    setFibre(indexSA(index), indexLF(index), FibreLF());
+
+    // Create the compressed SA.
+    TSize numSentinel = countSequences(text);
+    createCompressedSa(indexSA(index), tempSA, numSentinel, Parallel());
+
+    return true;
+}
+
+template <typename TText, typename TSpec, typename TConfig>
+inline bool indexCreate(Index<TText, FMIndex<TSpec, TConfig> > & index, FibreSALF)
+{
+    typedef Index<TText, FMIndex<TSpec, TConfig> >               TIndex;
+    typedef typename DefaultIndexCreator<TIndex, FibreSA>::Type  TAlgo;
+
+    return indexCreate(index, FibreSALF(), TAlgo());
+}
+
+template <typename TText, typename TSpec, typename TConfig, typename TAlgo>
+inline bool indexCreate(Index<TText, FMIndex<TSpec, TConfig> > & index, FibreSA, TAlgo const)
+{
+    return indexCreate(index, FibreSALF(), TAlgo());
+}
+
 template <typename TText, typename TSpec, typename TConfig>
 inline bool indexCreate(Index<TText, FMIndex<TSpec, TConfig> > & index, FibreSA)
 {
@@ -269,7 +269,7 @@ SEQAN_HOST_DEVICE inline bool empty(CompressedSA<TText, TSpec, TConfig> & compre
  * @headerfile <seqan/index.h>
  * @brief This function creates a compressed suffix array with a specified compression factor.
  *
- * @signature void createCompressedSa(compressedSA, completeSA, compressionFactor[, offset]);
+ * @signature void createCompressedSa(compressedSA, completeSA, compressionFactor[, offset[, parallelTag]]);
  *
  * @param[out] compressedSA      The compressed suffix array.
  * @param[in]  completeSA        A complete suffix array containing all values. Types: @link String @endlink
@@ -278,6 +278,7 @@ SEQAN_HOST_DEVICE inline bool empty(CompressedSA<TText, TSpec, TConfig> & compre
  *                               UnsignedIntegerConcept @endlink
  * @param[in] offset             The offset determines how many empty values should be inserted into the compressed suffix array at the
  *                               beginning. This possibility accounts for the sentinel positions of the @link FMIndex @endlink.
+ * @param[in] parallelTag        Tag to sample the suffix array with multiple threads. Types: @link ParallelismTags @endlink.
  */
 
 template <typename TText, typename TSpec, typename TConfig, typename TSA, typename TSize>
@@ -331,6 +332,64 @@ void createCompressedSa(CompressedSA<TText, TSpec, TConfig> & compressedSA, TSA
     createCompressedSa(compressedSA, sa, 0);
 }
 
+// The indicators are collected in a plain string first, as concurrent writes to a packed RankDictionary would
+// interfere. Each thread then copies the samples of its chunk to the position given by the samples of the
+// previous chunks.
+template <typename TText, typename TSpec, typename TConfig, typename TSA, typename TSize, typename TParallelTag>
+void createCompressedSa(CompressedSA<TText, TSpec, TConfig> & compressedSA, TSA const & sa, TSize offset,
+                        Tag<TParallelTag> const & tag)
+{
+    typedef CompressedSA<TText, TSpec, TConfig>                     TCompressedSA;
+    typedef typename Size<TSA>::Type                                TSASize;
+    typedef typename MakeSigned<TSASize>::Type                      TSignedSize;
+    typedef typename Fibre<TCompressedSA, FibreSparseString>::Type  TSparseSA;
+    typedef typename Fibre<TSparseSA, FibreIndicators>::Type        TIndicators;
+    typedef typename Fibre<TSparseSA, FibreValues>::Type            TValues;
+
+    TSparseSA & sparseString = getFibre(compressedSA, FibreSparseString());
+    TIndicators & indicators = getFibre(sparseString, FibreIndicators());
+    TValues & values = getFibre(sparseString, FibreValues());
+
+    TSASize saLen = length(sa);
+    resize(compressedSA, saLen + offset, Exact());
+
+    String<bool> isSampled;
+    resize(isSampled, saLen + offset, false, Exact());
+
+    Splitter<TSASize> splitter(0u, saLen, tag);
+    String<TSASize> counts;
+    resize(counts, length(splitter) + 1, 0, Exact());
+
+    SEQAN_OMP_PRAGMA(parallel for)
+    for (TSignedSize job = 0; job < static_cast<TSignedSize>(length(splitter)); ++job)
+    {
+        for (TSASize i = splitter[job]; i < splitter[job + 1]; ++i)
+        {
+            if (getSeqOffset(sa[i]) % TConfig::SAMPLING == 0)
+            {
+                isSampled[offset + i] = true;
+                ++counts[job + 1];
+            }
+        }
+    }
+
+    createRankDictionary(indicators, isSampled, tag);
+
+    for (TSASize job = 0; job < length(splitter); ++job)
+        counts[job + 1] += counts[job];
+
+    resize(values, back(counts), Exact());
+
+    SEQAN_OMP_PRAGMA(parallel for)
+    for (TSignedSize job = 0; job < static_cast<TSignedSize>(length(splitter)); ++job)
+    {
+        TSASize counter = counts[job];
+        for (TSASize i = splitter[job]; i < splitter[job + 1]; ++i)
+            if (isSampled[offset + i])
+                assignValue(values, counter++, sa[i]);
+    }
+}
+
 // ----------------------------------------------------------------------------
 // Function getFibre()
 // ----------------------------------------------------------------------------
@@ -465,6 +465,18 @@ _getBwtRank(LF<TText, TSpec, TConfig> const & lf, TPos pos)
     return _getBwtRank(lf, pos, getValue(lf.bwt, pos));
 }
 
+// ----------------------------------------------------------------------------
+// Function _prefetchBwtRank()
+// ----------------------------------------------------------------------------
+// Prefetches the bwt rank block read by a subsequent lf(pos, c).
+
+template <typename TText, typename TSpec, typename TConfig, typename TPos>
+inline void _prefetchBwtRank(LF<TText, TSpec, TConfig> const & lf, TPos pos)
+{
+    if (pos > 0)
+        _prefetchRank(lf.bwt, pos - 1);
+}
+
 // ----------------------------------------------------------------------------
 // Function _setSentinelSubstitute()
 // ----------------------------------------------------------------------------
@@ -584,6 +596,92 @@ _createBwt(LF<StringSet<TText, TSSetSpec>, TSpec, TConfig> & lf, TBwt & bwt, TOt
     updateRanks(lf.sentinels);
 }
 
+// ----------------------------------------------------------------------------
+// Function _createBwt(Parallel)
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TSpec, typename TConfig, typename TBwt, typename TOtherText, typename TSA,
+          typename TParallelTag>
+inline void
+_createBwt(LF<TText, TSpec, TConfig> & lf, TBwt & bwt, TOtherText const & text, TSA const & sa,
+           Tag<TParallelTag> const & tag)
+{
+    typedef typename Size<TSA>::Type                        TSize;
+    typedef typename MakeSigned<TSize>::Type                TSignedSize;
+    typedef typename GetValue<TSA>::Type                    TSAValue;
+
+    bwt[0] = back(text);
+
+    Splitter<TSize> splitter(0u, length(sa), tag);
+
+    SEQAN_OMP_PRAGMA(parallel for)
+    for (TSignedSize job = 0; job < static_cast<TSignedSize>(length(splitter)); ++job)
+    {
+        for (TSize i = splitter[job]; i < splitter[job + 1]; ++i)
+        {
+            TSAValue pos = sa[i];
+
+            if (pos != 0)
+            {
+                bwt[i + 1] = getValue(text, pos - 1);
+            }
+            else
+            {
+                bwt[i + 1] = lf.sentinelSubstitute;
+                lf.sentinels = i + 1;
+            }
+        }
+    }
+}
+
+// The sentinel flags are collected in a plain string first, as concurrent writes to a
+// packed RankDictionary would interfere.
+template <typename TText, typename TSSetSpec, typename TSpec, typename TConfig, typename TBwt, typename TOtherText,
+          typename TSA, typename TParallelTag>
+inline void
+_createBwt(LF<StringSet<TText, TSSetSpec>, TSpec, TConfig> & lf, TBwt & bwt, TOtherText const & text, TSA const & sa,
+           Tag<TParallelTag> const & tag)
+{
+    typedef typename Value<TSA>::Type                       TSAValue;
+    typedef typename Size<TSA>::Type                        TSize;
+    typedef typename MakeSigned<TSize>::Type                TSignedSize;
+
+    TSize seqNum = countSequences(text);
+
+    String<bool> sentinels;
+    resize(sentinels, seqNum + length(sa), false, Exact());
+
+    // Fill the sentinel positions (they are all at the beginning of the bwt).
+    for (TSize i = 1; i <= seqNum; ++i)
+        bwt[i - 1] = back(text[seqNum - i]);
+
+    // Compute the rest of the bwt.
+    Splitter<TSize> splitter(0u, length(sa), tag);
+
+    SEQAN_OMP_PRAGMA(parallel for)
+    for (TSignedSize job = 0; job < static_cast<TSignedSize>(length(splitter)); ++job)
+    {
+        for (TSize i = splitter[job]; i < splitter[job + 1]; ++i)
+        {
+            TSAValue pos;    // = SA[i];
+            posLocalize(pos, sa[i], stringSetLimits(text));
+
+            if (getSeqOffset(pos) != 0)
+            {
+                bwt[seqNum + i] = getValue(getValue(text, getSeqNo(pos)), getSeqOffset(pos) - 1);
+            }
+            else
+            {
+                bwt[seqNum + i] = lf.sentinelSubstitute;
+                sentinels[seqNum + i] = true;
+            }
+        }
+    }
+
+    // Create the auxiliary RankDictionary of sentinel positions.
+    createRankDictionary(lf.sentinels, sentinels, tag);
+}
+
 // ----------------------------------------------------------------------------
 // Function createLF()
 // ----------------------------------------------------------------------------
@@ -594,12 +692,14 @@ _createBwt(LF<StringSet<TText, TSSetSpec>, TSpec, TConfig> & lf, TBwt & bwt, TOt
  *
  * @brief Creates the LF table
  *
- * @signature void createLF(lfTable, text, sa);
+ * @signature void createLF(lfTable, text, sa[, parallelTag]);
  *
- * @param[out] lfTable The LF table to be constructed.
- * @param[in]  text    The underlying text Types: @link String @endlink.
- * @param[in]  sa      The suffix array of the LF table underlying text. Types: @link String @endlink,
- *                     @link StringSet @endlink.
+ * @param[out] lfTable     The LF table to be constructed.
+ * @param[in]  text        The underlying text Types: @link String @endlink.
+ * @param[in]  sa          The suffix array of the LF table underlying text. Types: @link String @endlink,
+ *                         @link StringSet @endlink.
+ * @param[in]  parallelTag Tag to derive the BWT and its rank dictionaries with multiple threads.  The temporary BWT
+ *                         is then kept in memory instead of an external string.  Types: @link ParallelismTags @endlink.
  *
  * @return TReturn Returns a <tt>bool</tt> which is <tt>true</tt> on successes and <tt>false</tt> otherwise.
  */
@@ -635,6 +735,37 @@ inline void createLF(LF<TText, TSpec, TConfig> & lf, TOtherText const & text, TS
         lf.sums[i] += sentinelsCount;
 }
 
+template <typename TText, typename TSpec, typename TConfig, typename TOtherText, typename TSA, typename TParallelTag>
+inline void createLF(LF<TText, TSpec, TConfig> & lf, TOtherText const & text, TSA const & sa,
+                     Tag<TParallelTag> const & tag)
+{
+    typedef LF<TText, TSpec, TConfig>                          TLF;
+    typedef typename Value<TLF>::Type                          TValue;
+    typedef typename Size<TLF>::Type                           TSize;
+
+    // Clear assuming undefined state.
+    clear(lf);
+
+    // Compute prefix sum.
+    prefixSums<TValue>(lf.sums, text);
+
+    // Choose the sentinel substitute.
+    _setSentinelSubstitute(lf);
+
+    // Create BWT and mark sentinels.
+    String<TValue> bwt;
+    resize(bwt, bwtLength(text), Exact());
+    _createBwt(lf, bwt, text, sa, tag);
+
+    // Index BWT bwt for rank queries.
+    createRankDictionary(lf.bwt, bwt, tag);
+
+    // Add sentinels to prefix sum.
+    TSize sentinelsCount = countSequences(text);
+    for (TSize i = 0; i < length(lf.sums); ++i)
+        lf.sums[i] += sentinelsCount;
+}
+
 // ----------------------------------------------------------------------------
 // Function open()
 // ----------------------------------------------------------------------------
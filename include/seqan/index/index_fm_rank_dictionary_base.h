@@ -218,10 +218,12 @@ SEQAN_HOST_DEVICE inline bool empty(RankDictionary<TValue, TSpec> const & dict)
  * @headerfile <seqan/index.h>
  * @brief This functions creates the dictionary.
  *
- * @signature void createRankDictionary(dictionary, text);
+ * @signature void createRankDictionary(dictionary, text[, parallelTag]);
  *
- * @param[in]  text       A text to be transfered into a rank dictionary. Types: @link ContainerConcept @endlink
- * @param[out] dictionary The dictionary.
+ * @param[in]  text        A text to be transfered into a rank dictionary. Types: @link ContainerConcept @endlink
+ * @param[out] dictionary  The dictionary.
+ * @param[in]  parallelTag Tag to request parallel construction, if supported by the specialization.
+ *                         Types: @link ParallelismTags @endlink. Default: <tt>Serial</tt>.
  */
 
 template <typename TValue, typename TSpec, typename TText>
@@ -243,6 +245,13 @@ createRankDictionary(RankDictionary<TValue, TSpec> & dict, TText const & text)
     updateRanks(dict);
 }
 
+template <typename TValue, typename TSpec, typename TText, typename TParallelTag>
+inline void
+createRankDictionary(RankDictionary<TValue, TSpec> & dict, TText const & text, Tag<TParallelTag> const & /* tag */)
+{
+    createRankDictionary(dict, text);
+}
+
 // ----------------------------------------------------------------------------
 // Function getRank()
 // ----------------------------------------------------------------------------
@@ -262,6 +271,15 @@ createRankDictionary(RankDictionary<TValue, TSpec> & dict, TText const & text)
  */
 
 
+// ----------------------------------------------------------------------------
+// Function _prefetchRank()
+// ----------------------------------------------------------------------------
+// Hints that getRank() will soon be called at the given position.
+// Specs without a single cache-resident block per position ignore the hint.
+
+template <typename TValue, typename TSpec, typename TPos>
+inline void _prefetchRank(RankDictionary<TValue, TSpec> const & /* dict */, TPos /* pos */) {}
+
 // ----------------------------------------------------------------------------
 // Function getValue()
 // ----------------------------------------------------------------------------
@@ -304,11 +322,19 @@ createRankDictionary(RankDictionary<TValue, TSpec> & dict, TText const & text)
  *
  * @brief Updates the rank information.
  *
- * @signature void updateRanks(dict)
+ * @signature void updateRanks(dict[, parallelTag])
  *
- * @param dict The @link RankDictionary @endlink.
+ * @param dict        The @link RankDictionary @endlink.
+ * @param parallelTag Tag to request parallel computation of the ranks, if supported by the specialization.
+ *                    Types: @link ParallelismTags @endlink. Default: <tt>Serial</tt>.
  */
 
+template <typename TValue, typename TSpec, typename TParallelTag>
+inline void updateRanks(RankDictionary<TValue, TSpec> & dict, Tag<TParallelTag> const & /* tag */)
+{
+    updateRanks(dict);
+}
+
 // ----------------------------------------------------------------------------
 // Function length()
 // ----------------------------------------------------------------------------
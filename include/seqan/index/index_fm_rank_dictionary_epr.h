@@ -0,0 +1,508 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2015, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: SeqAn Team <seqan-dev@lists.fu-berlin.de>
+// ==========================================================================
+// Rank dictionary for alphabets of four symbols whose blocks fit into one
+// cache line. Each 64 byte block stores the symbol counts up to the block
+// followed by the symbols, split into one word of low bits and one word of
+// high bits per 64 symbols (EPR-dictionaries of Pockrandt, Ehrhardt and
+// Reinert, RECOMB 2017). A rank query thus touches a single cache line and
+// needs at most three popcounts.
+// ==========================================================================
+
+#ifndef INDEX_FM_RANK_DICTIONARY_EPR_H_
+#define INDEX_FM_RANK_DICTIONARY_EPR_H_
+
+namespace seqan {
+
+// ============================================================================
+// Tags
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Tag EprRDConfig
+// ----------------------------------------------------------------------------
+
+/*!
+ * @class EprRDConfig
+ * @headerfile <seqan/index.h>
+ * @brief Configuration of the @link EprRankDictionary @endlink.
+ *
+ * @signature template <typename TSize, typename TFibre, unsigned LEVELS>
+ *            struct EprRDConfig;
+ *
+ * @tparam TSize  The size type of the dictionary. Default: <tt>size_t</tt>
+ * @tparam TFibre The string specialization of the blocks. Default: <tt>Alloc&lt;OverAligned&gt;</tt>
+ * @tparam LEVELS The number of levels of counts.  One level stores <tt>TSize</tt> counts in each block, two levels
+ *                store 32 bit counts in each block relative to a small table of <tt>TSize</tt> superblock counts and
+ *                thus more symbols per block.  Default: 2 if <tt>TSize</tt> is wider than 32 bits, 1 otherwise.
+ */
+
+template <typename TSize = size_t, typename TFibre = Alloc<OverAligned>,
+          unsigned LEVELS_ = (BitsPerValue<TSize>::VALUE > 32) ? 2 : 1>
+struct EprRDConfig : RDConfig<TSize, TFibre>
+{
+    static const unsigned LEVELS = LEVELS_;
+};
+
+// ----------------------------------------------------------------------------
+// Tag Epr
+// ----------------------------------------------------------------------------
+
+template <typename TSpec = void, typename TConfig = EprRDConfig<> >
+struct Epr {};
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Metafunction RankDictionaryBlock_
+// ----------------------------------------------------------------------------
+// The counts stored within each block.
+
+template <typename TValue, typename TSpec, typename TConfig>
+struct RankDictionaryBlock_<TValue, Epr<TSpec, TConfig> >
+{
+    typedef RankDictionary<TValue, Epr<TSpec, TConfig> >                TRankDictionary_;
+    typedef typename Size<TRankDictionary_>::Type                       TSize_;
+    typedef typename IfC<TConfig::LEVELS == 1, TSize_, __uint32>::Type   TCount_;
+
+    typedef Tuple<TCount_, ValueSize<TValue>::VALUE>                    Type;
+};
+
+// ----------------------------------------------------------------------------
+// Metafunction RankDictionaryValues_
+// ----------------------------------------------------------------------------
+// The low and high bit words of the symbols within each block.
+
+template <typename TValue, typename TSpec, typename TConfig>
+struct RankDictionaryValues_<TValue, Epr<TSpec, TConfig> >
+{
+    typedef RankDictionary<TValue, Epr<TSpec, TConfig> >                TRankDictionary_;
+
+    typedef __uint64                                                    TWord;
+    typedef Tuple<TWord, 2 * TRankDictionary_::_WORD_PAIRS_PER_BLOCK>   Type;
+};
+
+// ----------------------------------------------------------------------------
+// Metafunction Fibre
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TSpec, typename TConfig>
+struct Fibre<RankDictionary<TValue, Epr<TSpec, TConfig> >, FibreRanks>
+{
+    typedef RankDictionary<TValue, Epr<TSpec, TConfig> >                TRankDictionary_;
+    typedef RankDictionaryEntry_<TValue, Epr<TSpec, TConfig> >          TEntry_;
+    typedef typename DefaultIndexStringSpec<TRankDictionary_>::Type     TFibreSpec_;
+
+    typedef String<TEntry_, TFibreSpec_>                                Type;
+};
+
+// ============================================================================
+// Classes
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Struct Epr RankDictionaryEntry_
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TSpec, typename TConfig>
+struct RankDictionaryEntry_<TValue, Epr<TSpec, TConfig> >
+{
+    // A summary of counts for each symbol before this block.
+    typename RankDictionaryBlock_<TValue, Epr<TSpec, TConfig> >::Type   block;
+
+    // The low and high bits of the symbols, one pair of words per 64 symbols.
+    typename RankDictionaryValues_<TValue, Epr<TSpec, TConfig> >::Type  values;
+}
+#if defined(PLATFORM_GCC)
+__attribute__((aligned(64)))
+#endif
+;
+
+// ----------------------------------------------------------------------------
+// Class Epr RankDictionary
+// ----------------------------------------------------------------------------
+
+/*!
+ * @class EprRankDictionary
+ * @extends RankDictionary
+ * @headerfile <seqan/index.h>
+ *
+ * @brief A rank dictionary for alphabets of size four, storing counts and symbols of each block in one cache line.
+ *
+ * @signature template <typename TValue, typename TSpec, typename TConfig>
+ *            class RankDictionary<TValue, Epr<TSpec, TConfig> >;
+ *
+ * @tparam TValue  The alphabet type, e.g. @link Dna @endlink.  Must have exactly four symbols.
+ * @tparam TSpec   A tag for specialization purposes. Default: <tt>void</tt>
+ * @tparam TConfig The configuration. Types: @link EprRDConfig @endlink
+ *
+ * Each block of 64 bytes holds the counts of all symbols before the block and the symbols themselves, split into
+ * a word of low bits and a word of high bits for every 64 symbols.  A rank query reads one block and counts the
+ * matching symbols with at most three popcounts.  Use it as <tt>Bwt</tt> in the configuration of an
+ * @link FMIndex @endlink over DNA to reduce memory stalls during backward search.
+ */
+
+template <typename TValue, typename TSpec, typename TConfig>
+struct RankDictionary<TValue, Epr<TSpec, TConfig> >
+{
+    // The blocks store two bits per symbol.
+    SEQAN_STATIC_ASSERT_MSG(ValueSize<TValue>::VALUE == 4, "The Epr rank dictionary supports alphabets of size four.");
+
+    // ------------------------------------------------------------------------
+    // Constants
+    // ------------------------------------------------------------------------
+
+    typedef typename RankDictionaryBlock_<TValue, Epr<TSpec, TConfig> >::Type   TBlock_;
+    typedef Tuple<typename Size<RankDictionary>::Type, ValueSize<TValue>::VALUE> TSuperBlock_;
+
+    static const unsigned _BITS_PER_VALUE        = 2;
+    static const unsigned _BITS_PER_WORD         = 64;
+    static const unsigned _BYTES_PER_BLOCK       = 64;
+    static const unsigned _WORD_PAIRS_PER_BLOCK  = (_BYTES_PER_BLOCK - sizeof(TBlock_)) / (2 * sizeof(__uint64));
+    static const unsigned _VALUES_PER_BLOCK      = _WORD_PAIRS_PER_BLOCK * _BITS_PER_WORD;
+    static const unsigned _BLOCKS_PER_SUPERBLOCK = 1u << 16;
+
+    // ------------------------------------------------------------------------
+    // Fibres
+    // ------------------------------------------------------------------------
+
+    typename Fibre<RankDictionary, FibreRanks>::Type    ranks;
+    String<TSuperBlock_>                                superBlocks;
+    typename Size<RankDictionary>::Type                 _length;
+
+    // ------------------------------------------------------------------------
+    // Constructors
+    // ------------------------------------------------------------------------
+
+    RankDictionary() :
+        _length(0)
+    {}
+
+    template <typename TText>
+    RankDictionary(TText const & text) :
+        _length(0)
+    {
+        createRankDictionary(*this, text);
+    }
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _getSuperBlockRank()
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TSpec, typename TConfig, typename TPos>
+SEQAN_HOST_DEVICE inline typename Size<RankDictionary<TValue, Epr<TSpec, TConfig> > const>::Type
+_getSuperBlockRank(RankDictionary<TValue, Epr<TSpec, TConfig> > const & /* dict */,
+                   TPos /* blockPos */, unsigned /* c */, True)
+{
+    return 0;
+}
+
+template <typename TValue, typename TSpec, typename TConfig, typename TPos>
+SEQAN_HOST_DEVICE inline typename Size<RankDictionary<TValue, Epr<TSpec, TConfig> > const>::Type
+_getSuperBlockRank(RankDictionary<TValue, Epr<TSpec, TConfig> > const & dict, TPos blockPos, unsigned c, False)
+{
+    return dict.superBlocks[blockPos / RankDictionary<TValue, Epr<TSpec, TConfig> >::_BLOCKS_PER_SUPERBLOCK][c];
+}
+
+template <typename TValue, typename TSpec, typename TConfig, typename TPos>
+SEQAN_HOST_DEVICE inline typename Size<RankDictionary<TValue, Epr<TSpec, TConfig> > const>::Type
+_getSuperBlockRank(RankDictionary<TValue, Epr<TSpec, TConfig> > const & dict, TPos blockPos, unsigned c)
+{
+    return _getSuperBlockRank(dict, blockPos, c, typename Eval<TConfig::LEVELS == 1>::Type());
+}
+
+// ----------------------------------------------------------------------------
+// Function _getWordPairRank()
+// ----------------------------------------------------------------------------
+// Counts the occurrences of c among the first posInWord + 1 symbols of a pair of words.
+
+SEQAN_HOST_DEVICE inline unsigned
+_getWordPairRank(__uint64 lo, __uint64 hi, unsigned posInWord, unsigned c)
+{
+    __uint64 mask = ((c & 1u) ? lo : ~lo) & ((c & 2u) ? hi : ~hi);
+
+    // NOTE: Shifting 2 by 63 gives 0, thus the last position yields the full mask.
+    return popCount(mask & ((static_cast<__uint64>(2) << posInWord) - 1));
+}
+
+// ----------------------------------------------------------------------------
+// Function _prefetchRank()
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TSpec, typename TConfig, typename TPos>
+inline void _prefetchRank(RankDictionary<TValue, Epr<TSpec, TConfig> > const & dict, TPos pos)
+{
+    typedef RankDictionary<TValue, Epr<TSpec, TConfig> >                TRankDictionary;
+
+    SEQAN_PREFETCH(&dict.ranks[pos / TRankDictionary::_VALUES_PER_BLOCK]);
+}
+
+// ----------------------------------------------------------------------------
+// Function getRank()
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TSpec, typename TConfig, typename TPos, typename TChar>
+SEQAN_HOST_DEVICE inline typename Size<RankDictionary<TValue, Epr<TSpec, TConfig> > const>::Type
+getRank(RankDictionary<TValue, Epr<TSpec, TConfig> > const & dict, TPos pos, TChar c)
+{
+    typedef RankDictionary<TValue, Epr<TSpec, TConfig> >                TRankDictionary;
+    typedef typename Fibre<TRankDictionary, FibreRanks>::Type           TFibreRanks;
+    typedef typename Value<TFibreRanks>::Type                           TRankEntry;
+    typedef typename Size<TRankDictionary>::Type                        TSize;
+
+    TSize blockPos   = pos / TRankDictionary::_VALUES_PER_BLOCK;
+    unsigned posInBlock = pos % TRankDictionary::_VALUES_PER_BLOCK;
+    unsigned wordPos = posInBlock / TRankDictionary::_BITS_PER_WORD;
+    unsigned ord = ordValue(static_cast<TValue>(c));
+
+    TRankEntry const & entry = dict.ranks[blockPos];
+
+    TSize rank = _getSuperBlockRank(dict, blockPos, ord) + entry.block[ord];
+
+    for (unsigned w = 0; w < TRankDictionary::_WORD_PAIRS_PER_BLOCK; ++w)
+        if (w < wordPos)
+            rank += _getWordPairRank(entry.values[2 * w], entry.values[2 * w + 1],
+                                     TRankDictionary::_BITS_PER_WORD - 1, ord);
+
+    return rank + _getWordPairRank(entry.values[2 * wordPos], entry.values[2 * wordPos + 1],
+                                   posInBlock % TRankDictionary::_BITS_PER_WORD, ord);
+}
+
+// ----------------------------------------------------------------------------
+// Function getValue()
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TSpec, typename TConfig, typename TPos>
+SEQAN_HOST_DEVICE inline typename Value<RankDictionary<TValue, Epr<TSpec, TConfig> > const>::Type
+getValue(RankDictionary<TValue, Epr<TSpec, TConfig> > const & dict, TPos pos)
+{
+    typedef RankDictionary<TValue, Epr<TSpec, TConfig> >                TRankDictionary;
+
+    unsigned posInBlock = pos % TRankDictionary::_VALUES_PER_BLOCK;
+    unsigned wordPos = posInBlock / TRankDictionary::_BITS_PER_WORD;
+    unsigned posInWord = posInBlock % TRankDictionary::_BITS_PER_WORD;
+
+    typename RankDictionaryValues_<TValue, Epr<TSpec, TConfig> >::Type const & values =
+        dict.ranks[pos / TRankDictionary::_VALUES_PER_BLOCK].values;
+
+    return TValue(((values[2 * wordPos] >> posInWord) & 1u) | (((values[2 * wordPos + 1] >> posInWord) & 1u) << 1));
+}
+
+template <typename TValue, typename TSpec, typename TConfig, typename TPos>
+SEQAN_HOST_DEVICE inline typename Value<RankDictionary<TValue, Epr<TSpec, TConfig> > >::Type
+getValue(RankDictionary<TValue, Epr<TSpec, TConfig> > & dict, TPos pos)
+{
+    return getValue(const_cast<RankDictionary<TValue, Epr<TSpec, TConfig> > const &>(dict), pos);
+}
+
+// ----------------------------------------------------------------------------
+// Function setValue()
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TSpec, typename TConfig, typename TPos, typename TChar>
+inline void setValue(RankDictionary<TValue, Epr<TSpec, TConfig> > & dict, TPos pos, TChar c)
+{
+    typedef RankDictionary<TValue, Epr<TSpec, TConfig> >                TRankDictionary;
+
+    unsigned posInBlock = pos % TRankDictionary::_VALUES_PER_BLOCK;
+    unsigned wordPos = posInBlock / TRankDictionary::_BITS_PER_WORD;
+    unsigned posInWord = posInBlock % TRankDictionary::_BITS_PER_WORD;
+    unsigned ord = ordValue(static_cast<TValue>(c));
+
+    typename RankDictionaryValues_<TValue, Epr<TSpec, TConfig> >::Type & values =
+        dict.ranks[pos / TRankDictionary::_VALUES_PER_BLOCK].values;
+
+    __uint64 bit = static_cast<__uint64>(1) << posInWord;
+    values[2 * wordPos]     = (ord & 1u) ? (values[2 * wordPos] | bit) : (values[2 * wordPos] & ~bit);
+    values[2 * wordPos + 1] = (ord & 2u) ? (values[2 * wordPos + 1] | bit) : (values[2 * wordPos + 1] & ~bit);
+}
+
+// ----------------------------------------------------------------------------
+// Function appendValue()
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TSpec, typename TConfig, typename TChar, typename TExpand>
+inline void appendValue(RankDictionary<TValue, Epr<TSpec, TConfig> > & dict, TChar c, Tag<TExpand> const tag)
+{
+    resize(dict, length(dict) + 1, tag);
+    setValue(dict, length(dict) - 1, c);
+}
+
+// ----------------------------------------------------------------------------
+// Function updateRanks()
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TSpec, typename TConfig>
+inline void updateRanks(RankDictionary<TValue, Epr<TSpec, TConfig> > & dict)
+{
+    typedef RankDictionary<TValue, Epr<TSpec, TConfig> >                TRankDictionary;
+    typedef typename Size<TRankDictionary>::Type                        TSize;
+    typedef Tuple<TSize, ValueSize<TValue>::VALUE>                      TCounts;
+
+    if (empty(dict)) return;
+
+    // Clear the uninitialized values.
+    for (TSize pos = length(dict); pos < length(dict.ranks) * TRankDictionary::_VALUES_PER_BLOCK; ++pos)
+        setValue(dict, pos, TValue());
+
+    TSize blocksCount = length(dict.ranks);
+    TSize superBlocksCount = (TConfig::LEVELS == 1) ? 0 :
+                             (blocksCount + TRankDictionary::_BLOCKS_PER_SUPERBLOCK - 1) /
+                             TRankDictionary::_BLOCKS_PER_SUPERBLOCK;
+    resize(dict.superBlocks, superBlocksCount, Exact());
+
+    TCounts counts;
+    TCounts superCounts;
+    clear(counts);
+    clear(superCounts);
+
+    for (TSize blockPos = 0; blockPos < blocksCount; ++blockPos)
+    {
+        if (TConfig::LEVELS > 1 && blockPos % TRankDictionary::_BLOCKS_PER_SUPERBLOCK == 0)
+        {
+            superCounts = counts;
+            for (unsigned c = 0; c < ValueSize<TValue>::VALUE; ++c)
+                dict.superBlocks[blockPos / TRankDictionary::_BLOCKS_PER_SUPERBLOCK][c] = superCounts[c];
+        }
+
+        for (unsigned c = 0; c < ValueSize<TValue>::VALUE; ++c)
+        {
+            dict.ranks[blockPos].block[c] = counts[c] - superCounts[c];
+
+            for (unsigned w = 0; w < TRankDictionary::_WORD_PAIRS_PER_BLOCK; ++w)
+                counts[c] += _getWordPairRank(dict.ranks[blockPos].values[2 * w], dict.ranks[blockPos].values[2 * w + 1],
+                                              TRankDictionary::_BITS_PER_WORD - 1, c);
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function clear()
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TSpec, typename TConfig>
+inline void clear(RankDictionary<TValue, Epr<TSpec, TConfig> > & dict)
+{
+    clear(dict.ranks);
+    clear(dict.superBlocks);
+    dict._length = 0;
+}
+
+// ----------------------------------------------------------------------------
+// Function length()
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TSpec, typename TConfig>
+inline typename Size<RankDictionary<TValue, Epr<TSpec, TConfig> > >::Type
+length(RankDictionary<TValue, Epr<TSpec, TConfig> > const & dict)
+{
+    return dict._length;
+}
+
+// ----------------------------------------------------------------------------
+// Function reserve()
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TSpec, typename TConfig, typename TSize, typename TExpand>
+inline typename Size<RankDictionary<TValue, Epr<TSpec, TConfig> > >::Type
+reserve(RankDictionary<TValue, Epr<TSpec, TConfig> > & dict, TSize newCapacity, Tag<TExpand> const tag)
+{
+    return reserve(dict.ranks, (newCapacity + RankDictionary<TValue, Epr<TSpec, TConfig> >::_VALUES_PER_BLOCK - 1) /
+                               RankDictionary<TValue, Epr<TSpec, TConfig> >::_VALUES_PER_BLOCK, tag);
+}
+
+// ----------------------------------------------------------------------------
+// Function resize()
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TSpec, typename TConfig, typename TSize, typename TExpand>
+inline typename Size<RankDictionary<TValue, Epr<TSpec, TConfig> > >::Type
+resize(RankDictionary<TValue, Epr<TSpec, TConfig> > & dict, TSize newLength, Tag<TExpand> const tag)
+{
+    dict._length = newLength;
+    return resize(dict.ranks, (newLength + RankDictionary<TValue, Epr<TSpec, TConfig> >::_VALUES_PER_BLOCK - 1) /
+                              RankDictionary<TValue, Epr<TSpec, TConfig> >::_VALUES_PER_BLOCK, tag);
+}
+
+// ----------------------------------------------------------------------------
+// Function open()
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TSpec, typename TConfig>
+inline bool open(RankDictionary<TValue, Epr<TSpec, TConfig> > & dict, const char * fileName, int openMode)
+{
+    String<char> name;
+
+    name = fileName;
+    if (!open(getFibre(dict, FibreRanks()), toCString(name), openMode)) return false;
+
+    if (TConfig::LEVELS > 1)
+    {
+        name = fileName;    append(name, ".sbl");
+        if (!open(dict.superBlocks, toCString(name), openMode)) return false;
+    }
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Function save()
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TSpec, typename TConfig>
+inline bool save(RankDictionary<TValue, Epr<TSpec, TConfig> > const & dict, const char * fileName, int openMode)
+{
+    String<char> name;
+
+    name = fileName;
+    if (!save(getFibre(dict, FibreRanks()), toCString(name), openMode)) return false;
+
+    if (TConfig::LEVELS > 1)
+    {
+        name = fileName;    append(name, ".sbl");
+        if (!save(dict.superBlocks, toCString(name), openMode)) return false;
+    }
+
+    return true;
+}
+
+}
+
+#endif  // INDEX_FM_RANK_DICTIONARY_EPR_H_
@@ -722,6 +722,17 @@ _getValuesRanks(RankDictionary<bool, Levels<TSpec, TConfig> > const & dict, TPos
     return _getValueRank(dict, _valuesAt(dict, pos), _toPosInBlock(dict, pos), true);
 }
 
+// ----------------------------------------------------------------------------
+// Function _prefetchRank()
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TSpec, typename TConfig, typename TPos>
+inline void _prefetchRank(RankDictionary<TValue, Levels<TSpec, TConfig> > const & dict, TPos pos)
+{
+    SEQAN_PREFETCH(&_blockAt(dict, pos));
+    SEQAN_PREFETCH(&_valuesAt(dict, pos));
+}
+
 // ----------------------------------------------------------------------------
 // Function getRank()
 // ----------------------------------------------------------------------------
@@ -857,6 +868,92 @@ inline void updateRanks(RankDictionary<TValue, Levels<TSpec, TConfig> > & dict)
     }
 }
 
+// ----------------------------------------------------------------------------
+// Function updateRanks(Parallel)
+// ----------------------------------------------------------------------------
+// The blocks are split into one chunk per thread. The block ranks are first
+// summed up within each chunk, then shifted by the ranks of all previous chunks.
+
+template <typename TValue, typename TSpec, typename TConfig, typename TParallelTag>
+inline void updateRanks(RankDictionary<TValue, Levels<TSpec, TConfig> > & dict, Tag<TParallelTag> const & tag)
+{
+    typedef RankDictionary<TValue, Levels<TSpec, TConfig> >                 TRankDictionary;
+    typedef typename Size<TRankDictionary>::Type                            TSize;
+    typedef typename MakeSigned<TSize>::Type                                TSignedSize;
+    typedef typename RankDictionaryBlock_<TValue, Levels<TSpec, TConfig> >::Type    TBlock;
+
+    if (empty(dict)) return;
+
+    // Insures the first block ranks start from zero.
+    _clearBlockAt(dict, 0u);
+
+    // Clear the uninitialized values.
+    _padValues(dict);
+
+    Splitter<TSize> splitter(1u, length(dict.ranks), tag);
+
+    SEQAN_OMP_PRAGMA(parallel for)
+    for (TSignedSize job = 0; job < static_cast<TSignedSize>(length(splitter)); ++job)
+    {
+        for (TSize blockPos = splitter[job]; blockPos < splitter[job + 1]; ++blockPos)
+        {
+            TSize curr = _toPos(dict, blockPos - 1);
+            TSize next = _toPos(dict, blockPos);
+
+            if (blockPos == splitter[job])
+                _blockAt(dict, next) = _getValuesRanks(dict, next - 1);
+            else
+                _blockAt(dict, next) = _blockAt(dict, curr) + _getValuesRanks(dict, next - 1);
+        }
+    }
+
+    if (length(splitter) < 2) return;
+
+    String<TBlock> carries;
+    resize(carries, length(splitter), Exact());
+    carries[0] = _blockAt(dict, 0u);
+    for (TSize job = 1; job < length(splitter); ++job)
+        carries[job] = carries[job - 1] + _blockAt(dict, _toPos(dict, splitter[job] - 1));
+
+    SEQAN_OMP_PRAGMA(parallel for)
+    for (TSignedSize job = 1; job < static_cast<TSignedSize>(length(splitter)); ++job)
+        for (TSize blockPos = splitter[job]; blockPos < splitter[job + 1]; ++blockPos)
+            _blockAt(dict, _toPos(dict, blockPos)) = _blockAt(dict, _toPos(dict, blockPos)) + carries[job];
+}
+
+// ----------------------------------------------------------------------------
+// Function createRankDictionary(Parallel)
+// ----------------------------------------------------------------------------
+// The values are filled in by block, such that no two threads write the same word.
+
+template <typename TValue, typename TSpec, typename TConfig, typename TText, typename TParallelTag>
+inline void
+createRankDictionary(RankDictionary<TValue, Levels<TSpec, TConfig> > & dict, TText const & text,
+                     Tag<TParallelTag> const & tag)
+{
+    typedef RankDictionary<TValue, Levels<TSpec, TConfig> >         TRankDictionary;
+    typedef typename Size<TRankDictionary>::Type                    TSize;
+    typedef typename MakeSigned<TSize>::Type                        TSignedSize;
+    typedef typename Iterator<TText const, Standard>::Type          TTextIterator;
+
+    resize(dict, length(text), Exact());
+
+    Splitter<TSize> splitter(0u, length(dict.ranks), tag);
+
+    SEQAN_OMP_PRAGMA(parallel for)
+    for (TSignedSize job = 0; job < static_cast<TSignedSize>(length(splitter)); ++job)
+    {
+        TSize pos = _toPos(dict, splitter[job]);
+        TSize posEnd = _min(static_cast<TSize>(_toPos(dict, splitter[job + 1])), static_cast<TSize>(length(text)));
+        TTextIterator textIt = begin(text, Standard()) + pos;
+
+        for (; pos < posEnd; ++pos, ++textIt)
+            setValue(dict, pos, value(textIt));
+    }
+
+    updateRanks(dict, tag);
+}
+
 // ----------------------------------------------------------------------------
 // Function length()
 // ----------------------------------------------------------------------------
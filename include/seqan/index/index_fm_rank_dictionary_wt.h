@@ -269,6 +269,18 @@ inline TValue getValue(RankDictionary<TValue, WaveletTree<TSpec, TConfig> > cons
     return getValue(const_cast<RankDictionary<TValue, WaveletTree<TSpec, TConfig> > &>(dict), pos);
 }
 
+// ----------------------------------------------------------------------------
+// Function _prefetchRank()
+// ----------------------------------------------------------------------------
+// Only the root level is prefetched, the lower levels depend on its rank.
+
+template <typename TValue, typename TSpec, typename TConfig, typename TPos>
+inline void _prefetchRank(RankDictionary<TValue, WaveletTree<TSpec, TConfig> > const & dict, TPos pos)
+{
+    if (!empty(dict.ranks))
+        _prefetchRank(dict.ranks[0], pos);
+}
+
 // ----------------------------------------------------------------------------
 // Function getRank()
 // ----------------------------------------------------------------------------
@@ -401,6 +413,14 @@ createRankDictionary(RankDictionary<TValue, WaveletTree<TSpec, TConfig> > & dict
     createRankDictionary(dict, text, sums);
 }
 
+template <typename TValue, typename TSpec, typename TConfig, typename TText, typename TParallelTag>
+inline void
+createRankDictionary(RankDictionary<TValue, WaveletTree<TSpec, TConfig> > & dict, TText const & text,
+                     Tag<TParallelTag> const & /* tag */)
+{
+    createRankDictionary(dict, text);
+}
+
 // ----------------------------------------------------------------------------
 // Function open()
 // ----------------------------------------------------------------------------
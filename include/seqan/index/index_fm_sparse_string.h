@@ -159,7 +159,9 @@ template <typename TFibreValues, typename TSpec>
 struct Fibre<SparseString<TFibreValues, TSpec>, FibreIndicators>
 {
     // NOTE(esiragusa): the CSA TConfig is not passed to the RD.
-    typedef RankDictionary<bool, Levels<TSpec> > Type;
+    // The indicators are stored like the values, e.g. both are memory mapped.
+    typedef typename DefaultIndexStringSpec<TFibreValues>::Type     TFibreSpec_;
+    typedef RankDictionary<bool, Levels<TSpec, LevelsRDConfig<size_t, TFibreSpec_> > > Type;
 };
 
 // ----------------------------------------------------------------------------
@@ -1324,10 +1324,12 @@ _qgramPostprocessBuckets(TDir &dir)
  * @headerfile <seqan/index.h>
  * @brief Builds a <i>q</i>-gram index on a sequence.
  *
- * @signature void createQGramIndex(index);
+ * @signature void createQGramIndex(index[, parallelTag]);
  * @signature void createQGramIndex(sa, dir, bucketMap, text, shape, stepSize); [DEPRECATED]
  *
  * @param[out] index     The IndexQGram to create.
+ * @param[in]  parallelTag Tag to count and distribute the <i>q</i>-grams with multiple threads.
+ *                       Types: @link ParallelismTags @endlink. Default: <tt>Serial</tt>.
  * @param[out] sa        The resulting list in which all <i>q</i>-grams are sorted alphabetically.
  * @param[out] dir       The resulting array that indicates at which position in index the corresponding <i>q</i>-grams
  * @param[in]  bucketMap Stores the <i>q</i>-gram hashes for the openaddressing hash maps, see
@@ -1403,6 +1405,430 @@ void createQGramIndex(TIndex &index)
     _qgramRefineSuffixArray(sa, text, shape, dir);
 }
 
+//////////////////////////////////////////////////////////////////////////////
+// Parallel counting sort
+//
+// The steps above are parallelized by splitting the text (or the sequences of
+// a string set) among the threads.  Counters are incremented atomically and
+// the cumulative sum is computed per subinterval of the directory.
+
+template < typename TIndex, typename TParallelTag >
+inline bool _qgramDisableBuckets(TIndex &index, Tag<TParallelTag>)
+{
+    // use the serial version (if no parallel overload is available)
+    return _qgramDisableBuckets(index);
+}
+
+template < typename TSequence >
+inline typename Value<TSequence>::Type
+_sumIgnoreDisabled(TSequence const &seq)
+{
+    typedef typename Value<TSequence>::Type TValue;
+    typename Iterator<TSequence const, Standard>::Type it = begin(seq, Standard());
+    typename Iterator<TSequence const, Standard>::Type itEnd = end(seq, Standard());
+    TValue sum = 0;
+    for (; it != itEnd; ++it)
+        if (*it != (TValue)-1)
+            sum += *it;
+    return sum;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Parallel counting sort - Step 2: Count q-grams
+template < typename TDir, typename TBucketMap, typename TText, typename TShape, typename TStepSize, typename TParallelTag >
+inline void
+_qgramCountQGrams(TDir &dir, TBucketMap &bucketMap, TText const &text, TShape shape, TStepSize stepSize, Tag<TParallelTag> parallelTag)
+{
+    typedef typename Iterator<TText const, Standard>::Type  TIterator;
+    typedef typename Iterator<TDir, Standard>::Type         TDirIterator;
+    typedef typename Value<TDir>::Type                      TSize;
+
+    if (empty(shape) || length(text) < length(shape))
+        return;
+
+    TSize num_qgrams = (length(text) - length(shape)) / stepSize + 1;
+    TDirIterator dirBegin = begin(dir, Standard());
+    Splitter<TSize> splitter(0, num_qgrams, parallelTag);
+
+    SEQAN_OMP_PRAGMA(parallel for firstprivate(shape))
+    for (int job = 0; job < (int)length(splitter); ++job)
+    {
+        if (splitter[job] == splitter[job + 1]) continue;
+
+        TIterator itText = begin(text, Standard()) + splitter[job] * stepSize;
+        TIterator itTextEnd = begin(text, Standard()) + splitter[job + 1] * stepSize;
+
+        if (stepSize == 1)
+        {
+            atomicInc(*(dirBegin + requestBucket(bucketMap, hash(shape, itText), parallelTag)), parallelTag);
+            for (++itText; itText != itTextEnd; ++itText)
+                atomicInc(*(dirBegin + requestBucket(bucketMap, hashNext(shape, itText), parallelTag)), parallelTag);
+        }
+        else
+        {
+            for (; itText != itTextEnd; itText += stepSize)
+                atomicInc(*(dirBegin + requestBucket(bucketMap, hash(shape, itText), parallelTag)), parallelTag);
+        }
+    }
+}
+
+template < typename TDir, typename TBucketMap, typename TString, typename TSpec, typename TShape, typename TStepSize, typename TParallelTag >
+inline void
+_qgramCountQGrams(TDir &dir, TBucketMap &bucketMap, StringSet<TString, TSpec> const &stringSet, TShape shape, TStepSize stepSize, Tag<TParallelTag> parallelTag)
+{
+    typedef typename Iterator<TString const, Standard>::Type    TIterator;
+    typedef typename Iterator<TDir, Standard>::Type             TDirIterator;
+    typedef typename Value<TDir>::Type                          TSize;
+
+    if (empty(shape) || empty(stringSet))
+        return;
+
+    TDirIterator dirBegin = begin(dir, Standard());
+    Splitter<TSize> seqSplitter(0, countSequences(stringSet), parallelTag);
+
+    SEQAN_OMP_PRAGMA(parallel for firstprivate(shape))
+    for (int job = 0; job < (int)length(seqSplitter); ++job)
+    {
+        for (TSize seqNo = seqSplitter[job]; seqNo < seqSplitter[job + 1]; ++seqNo)
+        {
+            TString const &sequence = value(stringSet, seqNo);
+            if (length(sequence) < length(shape)) continue;
+
+            TIterator itText = begin(sequence, Standard());
+            TIterator itTextEnd = itText + ((length(sequence) - length(shape)) / stepSize + 1) * stepSize;
+
+            if (stepSize == 1)
+            {
+                atomicInc(*(dirBegin + requestBucket(bucketMap, hash(shape, itText), parallelTag)), parallelTag);
+                for (++itText; itText != itTextEnd; ++itText)
+                    atomicInc(*(dirBegin + requestBucket(bucketMap, hashNext(shape, itText), parallelTag)), parallelTag);
+            }
+            else
+            {
+                for (; itText != itTextEnd; itText += stepSize)
+                    atomicInc(*(dirBegin + requestBucket(bucketMap, hash(shape, itText), parallelTag)), parallelTag);
+            }
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Parallel counting sort - Step 3: Cumulative sum
+//
+// The entries are shifted by SHIFT towards the end, e.g. for SHIFT=1
+//
+// 3 2 1 | 3  2  5 |
+// 0 0 3 | 5  6  9 | 11 16
+//
+// and disabled buckets are kept marked if TKeepDisabledBuckets is true.
+template < typename TDir, typename TWithConstraints, typename TKeepDisabledBuckets, unsigned SHIFT, typename TParallelTag >
+inline typename Value<TDir>::Type
+_qgramCummulativeSum(TDir &dir, TWithConstraints, TKeepDisabledBuckets, ConstUInt<SHIFT>, Tag<TParallelTag> parallelTag)
+{
+    typedef typename Value<TDir>::Type                      TValue;
+    typedef typename Size<TDir>::Type                       TSize;
+    typedef String<TValue>                                  TBuffer;
+    typedef typename Iterator<TDir const, Standard>::Type   TConstIterator;
+    typedef typename Iterator<TDir, Standard>::Type         TIterator;
+    typedef typename Iterator<TBuffer, Standard>::Type      TBufferIterator;
+
+    if (empty(dir))
+        return 0;
+
+    Splitter<TSize> splitter(0, length(dir), parallelTag);
+    String<TValue> localSums;
+    TBuffer prevCounts;
+    resize(localSums, length(splitter), Exact());
+    resize(prevCounts, length(splitter) * SHIFT, 0, Exact());
+
+    // STEP 1: compute sums of all subintervals (in parallel)
+    SEQAN_OMP_PRAGMA(parallel for)
+    for (int job = 0; job < (int)length(splitter); ++job)
+    {
+        TSize len = _min((TSize)SHIFT, (TSize)splitter[job]);
+        replace(prevCounts, (job + 1) * SHIFT - len, (job + 1) * SHIFT, infix(dir, splitter[job] - len, splitter[job]));
+
+        typename Infix<TDir>::Type dirInfix = infix(dir,
+                                                    _max((__int64)0, (__int64)splitter[job] - (__int64)SHIFT),
+                                                    _max((__int64)0, (__int64)splitter[job + 1] - (__int64)SHIFT));
+
+        if (TWithConstraints::VALUE)
+            localSums[job] = _sumIgnoreDisabled(dirInfix);
+        else
+            localSums[job] = sum(dirInfix, Serial());
+    }
+
+    // STEP 2: compute partial sums (of subinterval sums) from position 0 to the end of each subinterval
+    for (int job = 1; job < (int)length(splitter); ++job)
+        localSums[job] += localSums[job - 1];
+
+    // STEP 3: compute partial sums of each subinterval starting from offset (in parallel)
+    SEQAN_OMP_PRAGMA(parallel for)
+    for (int job = 0; job < (int)length(splitter); ++job)
+    {
+        TConstIterator itBegin = begin(dir, Standard()) + splitter[job];
+        TIterator dstIt = begin(dir, Standard()) + splitter[job + 1];
+        TValue sum = localSums[job];
+
+        // read over our subinterval
+        if (splitter[job + 1] - splitter[job] > SHIFT)
+        {
+            TConstIterator it = begin(dir, Standard()) + splitter[job + 1] - SHIFT;
+            while (it != itBegin)
+            {
+                TValue counter = *(--it);
+                if (!TWithConstraints::VALUE || counter != (TValue)-1)
+                    sum -= counter;
+                else if (TKeepDisabledBuckets::VALUE)
+                {
+                    *(--dstIt) = (TValue)-1;
+                    continue;
+                }
+                *(--dstIt) = sum;
+            }
+        }
+
+        // read suffix of the previous subinterval
+        TBufferIterator it = begin(prevCounts, Standard()) + (job + 1) * SHIFT;
+        while (dstIt != itBegin)
+        {
+            TValue counter = *(--it);
+            if (!TWithConstraints::VALUE || counter != (TValue)-1)
+                sum -= counter;
+            else if (TKeepDisabledBuckets::VALUE)
+            {
+                *(--dstIt) = (TValue)-1;
+                continue;
+            }
+            *(--dstIt) = sum;
+        }
+    }
+
+    return back(localSums);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Parallel counting sort - Step 4: Fill suffix array
+template < typename TSA, typename TText, typename TShape, typename TDir, typename TBucketMap, typename TStepSize,
+           typename TWithConstraints, typename TParallelTag >
+inline void
+_qgramFillSuffixArray(TSA &sa, TText const &text, TShape shape, TDir &dir, TBucketMap &bucketMap, TStepSize stepSize,
+                      TWithConstraints const, Tag<TParallelTag> parallelTag)
+{
+    typedef typename Iterator<TText const, Standard>::Type  TIterator;
+    typedef typename Iterator<TDir, Standard>::Type         TDirIterator;
+    typedef typename Value<TDir>::Type                      TSize;
+
+    if (empty(shape) || length(text) < length(shape))
+        return;
+
+    TSize num_qgrams = (length(text) - length(shape)) / stepSize + 1;
+    TDirIterator dirBegin1 = begin(dir, Standard()) + 1;
+    Splitter<TSize> splitter(0, num_qgrams, parallelTag);
+
+    SEQAN_OMP_PRAGMA(parallel for firstprivate(shape))
+    for (int job = 0; job < (int)length(splitter); ++job)
+    {
+        TSize pos = splitter[job] * stepSize;
+        TSize posEnd = splitter[job + 1] * stepSize;
+        if (pos == posEnd) continue;
+
+        TIterator itText = begin(text, Standard()) + pos;
+        TDirIterator bktPtr = dirBegin1 + getBucket(bucketMap, hash(shape, itText));
+        if (!TWithConstraints::VALUE || *bktPtr != (TSize)-1)           // ignore disabled buckets
+            sa[atomicPostInc(*bktPtr, parallelTag)] = pos;
+
+        for (pos += stepSize; pos != posEnd; pos += stepSize)
+        {
+            if (stepSize == 1)
+                bktPtr = dirBegin1 + getBucket(bucketMap, hashNext(shape, ++itText));
+            else
+                bktPtr = dirBegin1 + getBucket(bucketMap, hash(shape, itText += stepSize));
+            if (!TWithConstraints::VALUE || *bktPtr != (TSize)-1)       // ignore disabled buckets
+                sa[atomicPostInc(*bktPtr, parallelTag)] = pos;
+        }
+    }
+}
+
+template < typename TSA, typename TString, typename TSpec, typename TShape, typename TDir, typename TBucketMap,
+           typename TStepSize, typename TWithConstraints, typename TParallelTag >
+inline void
+_qgramFillSuffixArray(TSA &sa, StringSet<TString, TSpec> const &stringSet, TShape shape, TDir &dir,
+                      TBucketMap &bucketMap, TStepSize stepSize, TWithConstraints const, Tag<TParallelTag> parallelTag)
+{
+    typedef typename Iterator<TString const, Standard>::Type    TIterator;
+    typedef typename Iterator<TDir, Standard>::Type             TDirIterator;
+    typedef typename Value<TDir>::Type                          TSize;
+
+    if (empty(shape) || empty(stringSet))
+        return;
+
+    TDirIterator dirBegin1 = begin(dir, Standard()) + 1;
+    Splitter<TSize> seqSplitter(0, countSequences(stringSet), parallelTag);
+
+    SEQAN_OMP_PRAGMA(parallel for firstprivate(shape))
+    for (int job = 0; job < (int)length(seqSplitter); ++job)
+    {
+        for (TSize seqNo = seqSplitter[job]; seqNo < seqSplitter[job + 1]; ++seqNo)
+        {
+            TString const &sequence = value(stringSet, seqNo);
+            if (length(sequence) < length(shape)) continue;
+            TSize num_qgrams = length(sequence) - length(shape) + 1;
+
+            typename Value<TSA>::Type localPos;
+            assignValueI1(localPos, seqNo);
+            assignValueI2(localPos, 0);
+
+            TIterator itText = begin(sequence, Standard());
+            TDirIterator bktPtr = dirBegin1 + getBucket(bucketMap, hash(shape, itText));
+            if (!TWithConstraints::VALUE || *bktPtr != (TSize)-1)       // ignore disabled buckets
+                sa[atomicPostInc(*bktPtr, parallelTag)] = localPos;
+
+            for (TSize i = stepSize; i < num_qgrams; i += stepSize)
+            {
+                assignValueI2(localPos, i);
+                if (stepSize == 1)
+                    bktPtr = dirBegin1 + getBucket(bucketMap, hashNext(shape, ++itText));
+                else
+                    bktPtr = dirBegin1 + getBucket(bucketMap, hash(shape, itText += stepSize));
+                if (!TWithConstraints::VALUE || *bktPtr != (TSize)-1)   // ignore disabled buckets
+                    sa[atomicPostInc(*bktPtr, parallelTag)] = localPos;
+            }
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Parallel counting sort - Step 5: Correct disabled buckets
+template < typename TDir, typename TParallelTag >
+inline void
+_qgramPostprocessBuckets(TDir &dir, Tag<TParallelTag> parallelTag)
+{
+    typedef typename Iterator<TDir, Standard>::Type TDirIterator;
+    typedef typename Value<TDir>::Type              TSize;
+
+    Splitter<TDirIterator> splitter(begin(dir, Standard()), end(dir, Standard()), parallelTag);
+    String<TSize> last;
+    resize(last, length(splitter), Exact());
+
+    SEQAN_OMP_PRAGMA(parallel for)
+    for (int job = 0; job < (int)length(splitter); ++job)
+    {
+        TDirIterator it = splitter[job];
+        TDirIterator itEnd = splitter[job + 1];
+        TSize prev = (job == 0)? 0: (TSize)-1;
+        for (; it != itEnd; ++it)
+            if (*it == (TSize)-1)
+                *it = prev;
+            else
+                prev = *it;
+        last[job] = prev;
+    }
+
+    for (int job = 1; job < (int)length(splitter); ++job)
+        if (last[job] == (TSize)-1)
+            last[job] = last[job - 1];
+
+    SEQAN_OMP_PRAGMA(parallel for)
+    for (int job = 1; job < (int)length(splitter); ++job)
+    {
+        TDirIterator it = splitter[job];
+        TDirIterator itEnd = splitter[job + 1];
+        TSize prev = last[job - 1];
+        for (; it != itEnd && *it == (TSize)-1; ++it)
+            *it = prev;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Parallel counting sort - Step 6: Sort buckets
+// Threads fill the buckets in arbitrary order, sorting them yields the same suffix array as the serial construction.
+template < typename TSA, typename TDir, typename TParallelTag >
+inline void
+_qgramSortBuckets(TSA &sa, TDir const &dir, Tag<TParallelTag> parallelTag)
+{
+    typedef typename Iterator<TSA, Standard>::Type  TSAIterator;
+    typedef typename Size<TDir>::Type               TSize;
+
+    if (length(dir) < 2)
+        return;
+
+    TSAIterator saBegin = begin(sa, Standard());
+    Splitter<TSize> splitter(0, length(dir) - 1, parallelTag);
+
+    SEQAN_OMP_PRAGMA(parallel for schedule(dynamic))
+    for (int job = 0; job < (int)length(splitter); ++job)
+        for (TSize bucket = splitter[job]; bucket < splitter[job + 1]; ++bucket)
+            if (dir[bucket] + 1 < dir[bucket + 1])
+                std::sort(saBegin + dir[bucket], saBegin + dir[bucket + 1]);
+}
+
+template < typename TIndex, typename TParallelTag >
+void createQGramIndex(TIndex &index, Tag<TParallelTag> parallelTag)
+{
+    typename Fibre<TIndex, QGramText>::Type const &text      = indexText(index);
+    typename Fibre<TIndex, QGramSA>::Type         &sa        = indexSA(index);
+    typename Fibre<TIndex, QGramDir>::Type        &dir       = indexDir(index);
+    typename Fibre<TIndex, QGramShape>::Type      &shape     = indexShape(index);
+    typename Fibre<TIndex, QGramBucketMap>::Type  &bucketMap = index.bucketMap;
+
+    // 1. clear counters
+    _qgramClearDir(dir, bucketMap, parallelTag);
+
+    // 2. count q-grams
+    _qgramCountQGrams(dir, bucketMap, text, shape, getStepSize(index), parallelTag);
+
+    if (_qgramDisableBuckets(index, parallelTag))
+    {
+        // 3. cumulative sum, disabled buckets stay marked
+        _qgramCummulativeSum(dir, True(), True(), ConstUInt<1>(), parallelTag);
+
+        // 4. fill suffix array
+        _qgramFillSuffixArray(sa, text, shape, dir, bucketMap, getStepSize(index), True(), parallelTag);
+
+        // 5. correct disabled buckets
+        _qgramPostprocessBuckets(dir, parallelTag);
+    }
+    else
+    {
+        // 3. cumulative sum
+        _qgramCummulativeSum(dir, False(), False(), ConstUInt<1>(), parallelTag);
+
+        // 4. fill suffix array
+        _qgramFillSuffixArray(sa, text, shape, dir, bucketMap, getStepSize(index), False(), parallelTag);
+    }
+
+    // 6. sort buckets
+    _qgramSortBuckets(sa, dir, parallelTag);
+
+    // 7. refine suffix array
+    _qgramRefineSuffixArray(sa, text, shape, dir);
+}
+
+template < typename TIndex >
+void createQGramIndex(TIndex &index, Serial)
+{
+    createQGramIndex(index);
+}
+
+template < typename TIndex, typename TParallelTag >
+void createQGramIndexDirOnly(TIndex &index, Tag<TParallelTag> parallelTag)
+{
+    typename Fibre<TIndex, QGramText>::Type const &text      = indexText(index);
+    typename Fibre<TIndex, QGramDir>::Type        &dir       = indexDir(index);
+    typename Fibre<TIndex, QGramShape>::Type      &shape     = indexShape(index);
+    typename Fibre<TIndex, QGramBucketMap>::Type  &bucketMap = index.bucketMap;
+
+    // 1. clear counters
+    _qgramClearDir(dir, bucketMap, parallelTag);
+
+    // 2. count q-grams
+    _qgramCountQGrams(dir, bucketMap, text, shape, getStepSize(index), parallelTag);
+
+    // 3. cumulative sum (Step 4 is ommited)
+    _qgramCummulativeSum(dir, False(), False(), ConstUInt<0>(), parallelTag);
+}
+
 // DEPRECATED
 // better use createQGramIndex(index) (above)
 template <
@@ -2300,6 +2726,19 @@ inline bool indexCreate(
     return true;
 }
 
+template <typename TText, typename TShapeSpec, typename TSpec>
+inline bool indexCreate(
+                        Index<TText, IndexQGram<TShapeSpec, TSpec> > &index,
+                        FibreSADir,
+                        Parallel const)
+{
+    resize(indexSA(index), _qgramQGramCount(index), Exact());
+    resize(indexDir(index), _fullDirLength(index), Exact());
+    createQGramIndex(index, Parallel());
+    resize(indexSA(index), back(indexDir(index)), Exact());     // shrink if some buckets were disabled
+    return true;
+}
+
 template <typename TText, typename TSpec>
 inline bool indexSupplied(Index<TText, TSpec> &index, FibreSADir) {
     return !(empty(getFibre(index, FibreSA())) || empty(getFibre(index, FibreDir())));
@@ -2316,6 +2755,15 @@ inline bool indexCreate(
     return true;
 }
 
+template <typename TText, typename TShapeSpec, typename TSpec>
+inline bool indexCreate(
+                        Index<TText, IndexQGram<TShapeSpec, TSpec> > &index,
+                        FibreSA,
+                        Parallel const)
+{
+    return indexCreate(index, FibreSADir(), Parallel());
+}
+
 template <typename TText, typename TShapeSpec, typename TSpec>
 inline bool indexCreate(
                         Index<TText, IndexQGram<TShapeSpec, TSpec> > &index,
@@ -2338,6 +2786,17 @@ inline bool indexCreate(
     return true;
 }
 
+template <typename TText, typename TShapeSpec, typename TSpec>
+inline bool indexCreate(
+                        Index<TText, IndexQGram<TShapeSpec, TSpec> > &index,
+                        FibreDir,
+                        Parallel const)
+{
+    resize(indexDir(index), _fullDirLength(index), Exact());
+    createQGramIndexDirOnly(index, Parallel());
+    return true;
+}
+
 
 //////////////////////////////////////////////////////////////////////////////
 /*!
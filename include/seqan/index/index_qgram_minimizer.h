@@ -0,0 +1,730 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2015, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: SeqAn Team <seqan-dev@lists.fu-berlin.de>
+// ==========================================================================
+// Q-gram index storing only the (w,k)-minimizers of the text.  A window of
+// w consecutive k-mers is represented by its lexicographically smallest
+// k-mer (the leftmost one on ties), as computed by hash() on a
+// MinimizerShape<w+k-1, k>.  Consecutive windows sharing their minimizer
+// store it only once, thus roughly 2n/(w+1) positions are sampled.
+// MinimizerShape<w+k-1, k, ReverseComplement> samples canonical k-mers, the
+// smaller one of a k-mer and its reverse complement.
+// ==========================================================================
+
+#ifndef SEQAN_INDEX_QGRAM_MINIMIZER_H_
+#define SEQAN_INDEX_QGRAM_MINIMIZER_H_
+
+namespace seqan {
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Tag MinimizerSampling
+// ----------------------------------------------------------------------------
+
+struct MinimizerSampling_;
+typedef Tag<MinimizerSampling_> MinimizerSampling;
+
+// ----------------------------------------------------------------------------
+// Class MinimizerCounter_
+// ----------------------------------------------------------------------------
+
+template <typename TSize>
+struct MinimizerCounter_
+{
+    TSize count;
+
+    MinimizerCounter_() :
+        count(0)
+    {}
+
+    template <typename THashValue, typename TPos>
+    void operator()(THashValue /* hValue */, TPos /* pos */)
+    {
+        ++count;
+    }
+};
+
+// ----------------------------------------------------------------------------
+// Class MinimizerBucketCounter_
+// ----------------------------------------------------------------------------
+
+template <typename TDir, typename TBucketMap>
+struct MinimizerBucketCounter_
+{
+    TDir & dir;
+    TBucketMap & bucketMap;
+
+    MinimizerBucketCounter_(TDir & dir, TBucketMap & bucketMap) :
+        dir(dir),
+        bucketMap(bucketMap)
+    {}
+
+    template <typename THashValue, typename TPos>
+    void operator()(THashValue hValue, TPos /* pos */)
+    {
+        ++dir[requestBucket(bucketMap, hValue)];
+    }
+};
+
+// ----------------------------------------------------------------------------
+// Class MinimizerFiller_
+// ----------------------------------------------------------------------------
+
+template <typename TSA, typename TDir, typename TBucketMap>
+struct MinimizerFiller_
+{
+    TSA & sa;
+    TDir & dir;
+    TBucketMap const & bucketMap;
+
+    MinimizerFiller_(TSA & sa, TDir & dir, TBucketMap const & bucketMap) :
+        sa(sa),
+        dir(dir),
+        bucketMap(bucketMap)
+    {}
+
+    template <typename THashValue, typename TPos>
+    void operator()(THashValue hValue, TPos pos)
+    {
+        sa[dir[getBucket(bucketMap, hValue) + 1]++] = pos;
+    }
+};
+
+// ----------------------------------------------------------------------------
+// Class MinimizerKmerHasher_
+// ----------------------------------------------------------------------------
+// Rolling hash of the k-mers of a sequence.
+
+template <typename TValue, unsigned TWEIGHT, typename TShapeSpec>
+struct MinimizerKmerHasher_
+{
+    Shape<TValue, UngappedShape<TWEIGHT> >  shape;
+};
+
+// Canonical k-mers hash to the smaller value of the k-mer and its reverse complement.
+template <typename TValue, unsigned TWEIGHT>
+struct MinimizerKmerHasher_<TValue, TWEIGHT, ReverseComplement>
+{
+    typedef Shape<TValue, UngappedShape<TWEIGHT> >  TShape;
+    typedef typename Value<TShape>::Type            THashValue;
+
+    TShape      shape;
+    THashValue  rcValue;    // hash of the reverse complement of the current k-mer
+
+    MinimizerKmerHasher_() :
+        rcValue(0)
+    {}
+};
+
+// ----------------------------------------------------------------------------
+// Class MinimizerCandidates_
+// ----------------------------------------------------------------------------
+// Collects the text positions where the pattern would start given the minimizer hits.
+
+template <typename TCandidates, typename TIndex>
+struct MinimizerCandidates_
+{
+    typedef typename Fibre<TIndex, FibreSA>::Type               TSA;
+    typedef typename Infix<TSA const>::Type                     TOccurrences;
+    typedef typename Iterator<TOccurrences, Standard>::Type     TOccurrencesIter;
+    typedef typename Value<TCandidates>::Type                   TCandidate;
+
+    TCandidates & candidates;
+    TIndex const & index;
+
+    MinimizerCandidates_(TCandidates & candidates, TIndex const & index) :
+        candidates(candidates),
+        index(index)
+    {}
+
+    template <typename THashValue, typename TPos>
+    void operator()(THashValue hValue, TPos pos)
+    {
+        typename Size<TIndex>::Type bucket = getBucket(indexBucketMap(index), hValue);
+        TOccurrences occs = infix(indexSA(index), indexDir(index)[bucket], indexDir(index)[bucket + 1]);
+
+        TOccurrencesIter occsEnd = end(occs, Standard());
+        for (TOccurrencesIter occsIt = begin(occs, Standard()); occsIt != occsEnd; ++occsIt)
+        {
+            if (getSeqOffset(*occsIt) < pos) continue;
+
+            TCandidate candidate = *occsIt;
+            setSeqOffset(candidate, getSeqOffset(*occsIt) - pos);
+            appendValue(candidates, candidate);
+        }
+    }
+};
+
+// ----------------------------------------------------------------------------
+// Metafunction Fibre<FibreBucketMap>
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TShapeSpec>
+struct Fibre<Index<TText, IndexQGram<TShapeSpec, MinimizerSampling> >, FibreBucketMap>
+{
+    typedef typename Fibre<Index<TText, IndexQGram<TShapeSpec, MinimizerSampling> >, FibreShape>::Type TShape;
+    typedef BucketMap<typename Value<TShape>::Type>     Type;
+};
+
+// ----------------------------------------------------------------------------
+// Class MinimizerQGramIndex
+// ----------------------------------------------------------------------------
+
+/*!
+ * @class MinimizerQGramIndex
+ * @extends IndexQGram
+ * @headerfile <seqan/index.h>
+ * @brief A <i>q</i>-gram index storing only the (<i>w</i>,<i>k</i>)-minimizers of the text.
+ *
+ * @signature template <typename TText, unsigned TSPAN, unsigned TWEIGHT, typename TShapeSpec>
+ *            class Index<TText, IndexQGram<MinimizerShape<TSPAN, TWEIGHT, TShapeSpec>, MinimizerSampling> >;
+ *
+ * @tparam TText      The @link TextConcept text type @endlink.
+ * @tparam TSPAN      The window length, i.e. <i>w</i>+<i>k</i>-1 for windows of <i>w</i> consecutive <i>k</i>-mers.
+ * @tparam TWEIGHT    The <i>k</i>-mer length.
+ * @tparam TShapeSpec The specialization of the minimizer shape.  <tt>ReverseComplement</tt> samples canonical
+ *                    <i>k</i>-mers, i.e. the smaller one of each <i>k</i>-mer and its reverse complement.  Default:
+ *                    <tt>void</tt>.
+ *
+ * Each window of <tt>TSPAN</tt> characters is represented by its smallest <i>k</i>-mer, i.e. the one returned by
+ * @link Shape#hash @endlink on the corresponding minimizer shape.  The suffix array stores the positions of the
+ * sampled <i>k</i>-mers, about 2<i>n</i>/(<i>w</i>+1) entries for a random text of length <i>n</i>.  Buckets are
+ * addressed through an open addressing hash table sized for the sampled <i>k</i>-mers only, as in the @link
+ * OpenAddressingQGramIndex @endlink.
+ *
+ * Use @link MinimizerQGramIndex#getCandidates @endlink to obtain the text positions where a pattern may occur.
+ * Canonical minimizers are shared by both strands, but candidates are always reported for the forward strand of
+ * the pattern.
+ *
+ * @var double MinimizerQGramIndex::alpha
+ * @brief Load factor.  Controls space/time-tradeoff and must be greater 1.  Default value is 1.6.
+ */
+
+template <typename TText_, unsigned TSPAN, unsigned TWEIGHT, typename TShapeSpec>
+class Index<TText_, IndexQGram<MinimizerShape<TSPAN, TWEIGHT, TShapeSpec>, MinimizerSampling> >
+{
+public:
+    typedef typename Member<Index, QGramText>::Type         TTextMember;
+    typedef typename Fibre<Index, QGramText>::Type          TText;
+    typedef typename Fibre<Index, QGramSA>::Type            TSA;
+    typedef typename Fibre<Index, QGramDir>::Type           TDir;
+    typedef typename Fibre<Index, QGramCounts>::Type        TCounts;
+    typedef typename Fibre<Index, QGramCountsDir>::Type     TCountsDir;
+    typedef typename Fibre<Index, QGramShape>::Type         TShape;
+    typedef typename Fibre<Index, QGramBucketMap>::Type     TBucketMap;
+    typedef typename Cargo<Index>::Type                     TCargo;
+    typedef typename Size<Index>::Type                      TSize;
+
+    TTextMember     text;       // underlying text
+    TSA             sa;         // positions of the sampled minimizers grouped by k-mer
+    TDir            dir;        // bucket directory
+    TCounts         counts;     // unused
+    TCountsDir      countsDir;  // unused
+    TShape          shape;      // underlying shape
+    TCargo          cargo;      // user-defined cargo
+    TBucketMap      bucketMap;  // bucketMap table
+    TSize           stepSize;   // always 1, windows are sampled by their minimizer
+
+    double          alpha;      // for m sampled minimizers the hash map has at least size alpha*m
+
+    Index() :
+        stepSize(1),
+        alpha(1.6)
+    {}
+
+    Index(Index & other) :
+        text(other.text),
+        sa(other.sa),
+        dir(other.dir),
+        shape(other.shape),
+        cargo(other.cargo),
+        bucketMap(other.bucketMap),
+        stepSize(1),
+        alpha(other.alpha)
+    {}
+
+    Index(Index const & other) :
+        text(other.text),
+        sa(other.sa),
+        dir(other.dir),
+        shape(other.shape),
+        cargo(other.cargo),
+        bucketMap(other.bucketMap),
+        stepSize(1),
+        alpha(other.alpha)
+    {}
+
+    template <typename TText__>
+    Index(TText__ & _text) :
+        text(_text),
+        stepSize(1),
+        alpha(1.6)
+    {}
+
+    template <typename TText__>
+    Index(TText__ const & _text) :
+        text(_text),
+        stepSize(1),
+        alpha(1.6)
+    {}
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _minimizerKmerHash()
+// ----------------------------------------------------------------------------
+
+template <typename TValue, unsigned TWEIGHT, typename TShapeSpec, typename TIter>
+inline typename Value<Shape<TValue, UngappedShape<TWEIGHT> > >::Type
+_minimizerKmerHash(MinimizerKmerHasher_<TValue, TWEIGHT, TShapeSpec> & hasher, TIter const & it)
+{
+    return hash(hasher.shape, it);
+}
+
+template <typename TValue, unsigned TWEIGHT, typename TIter>
+inline typename Value<Shape<TValue, UngappedShape<TWEIGHT> > >::Type
+_minimizerKmerHash(MinimizerKmerHasher_<TValue, TWEIGHT, ReverseComplement> & hasher, TIter const & it)
+{
+    typedef typename Value<Shape<TValue, UngappedShape<TWEIGHT> > >::Type THashValue;
+
+    FunctorComplement<TValue> complement;
+
+    // The i-th character of the k-mer is the (k-i-1)-th character of its reverse complement.
+    hasher.rcValue = 0;
+    for (unsigned i = TWEIGHT; i > 0; --i)
+        hasher.rcValue = hasher.rcValue * ValueSize<TValue>::VALUE +
+                         (THashValue)ordValue(complement(TValue(*(it + (i - 1)))));
+
+    return _min(hash(hasher.shape, it), hasher.rcValue);
+}
+
+// ----------------------------------------------------------------------------
+// Function _minimizerKmerHashNext()
+// ----------------------------------------------------------------------------
+// Rolls the hash to the k-mer starting at it, one position right of the previous one.
+
+template <typename TValue, unsigned TWEIGHT, typename TShapeSpec, typename TIter>
+inline typename Value<Shape<TValue, UngappedShape<TWEIGHT> > >::Type
+_minimizerKmerHashNext(MinimizerKmerHasher_<TValue, TWEIGHT, TShapeSpec> & hasher, TIter const & it)
+{
+    return hashNext(hasher.shape, it);
+}
+
+template <typename TValue, unsigned TWEIGHT, typename TIter>
+inline typename Value<Shape<TValue, UngappedShape<TWEIGHT> > >::Type
+_minimizerKmerHashNext(MinimizerKmerHasher_<TValue, TWEIGHT, ReverseComplement> & hasher, TIter const & it)
+{
+    typedef Shape<TValue, UngappedShape<TWEIGHT> >  TShape;
+    typedef typename Value<TShape>::Type            THashValue;
+
+    FunctorComplement<TValue> complement;
+
+    hasher.rcValue = (hasher.rcValue - (THashValue)ordValue(complement(TValue(*(it - 1))))) /
+                     ValueSize<TValue>::VALUE +
+                     (THashValue)ordValue(complement(TValue(*(it + (TWEIGHT - 1))))) * TShape::leftFactor;
+
+    return _min(hashNext(hasher.shape, it), hasher.rcValue);
+}
+
+// ----------------------------------------------------------------------------
+// Function _forEachMinimizer()
+// ----------------------------------------------------------------------------
+// Calls delegate(hValue, pos) for each sampled minimizer of a sequence, from left to right.
+
+template <typename TSequence, typename TValue, unsigned TSPAN, unsigned TWEIGHT, typename TShapeSpec,
+          typename TPos, typename TDelegate>
+inline void
+_forEachMinimizer(TSequence const & seq, Shape<TValue, MinimizerShape<TSPAN, TWEIGHT, TShapeSpec> > const & shape,
+                  TPos pos, TDelegate & delegate)
+{
+    typedef typename Iterator<TSequence const, Standard>::Type  TIter;
+    typedef typename Size<TSequence const>::Type                TSize;
+    typedef MinimizerKmerHasher_<TValue, TWEIGHT, TShapeSpec>   THasher;
+    typedef typename Value<Shape<TValue, UngappedShape<TWEIGHT> > >::Type THashValue;
+    typedef Pair<THashValue, TSize>                             TWindowEntry;
+
+    TSize seqLength = length(seq);
+    if (seqLength < length(shape)) return;
+
+    TSize kmersCount = seqLength - weight(shape) + 1;
+    TSize windowSize = length(shape) - weight(shape) + 1;
+
+    // The window is a ring buffer of k-mers with increasing hash values, its front is the current minimizer.
+    String<TWindowEntry> window;
+    resize(window, windowSize, Exact());
+    TSize windowBegin = 0;
+    TSize windowLength = 0;
+    TSize lastPos = MaxValue<TSize>::VALUE;
+
+    THasher hasher;
+    TIter seqIt = begin(seq, Standard());
+    THashValue hValue = _minimizerKmerHash(hasher, seqIt);
+
+    for (TSize kmerPos = 0; kmerPos < kmersCount; ++kmerPos)
+    {
+        if (kmerPos > 0)
+            hValue = _minimizerKmerHashNext(hasher, ++seqIt);
+
+        // Remove the k-mer leaving the window.
+        if (windowLength > 0 && window[windowBegin].i2 + windowSize <= kmerPos)
+        {
+            if (++windowBegin == windowSize) windowBegin = 0;
+            --windowLength;
+        }
+
+        // Remove the k-mers that cannot become minimizers anymore.
+        while (windowLength > 0 && window[(windowBegin + windowLength - 1) % windowSize].i1 > hValue)
+            --windowLength;
+
+        window[(windowBegin + windowLength) % windowSize] = TWindowEntry(hValue, kmerPos);
+        ++windowLength;
+
+        if (kmerPos + 1 < windowSize || window[windowBegin].i2 == lastPos) continue;
+
+        lastPos = window[windowBegin].i2;
+        setSeqOffset(pos, lastPos);
+        delegate(window[windowBegin].i1, pos);
+    }
+}
+
+template <typename TText, typename TShape, typename TDelegate>
+inline void
+_forEachMinimizer(TText const & text, TShape const & shape, TDelegate & delegate)
+{
+    _forEachMinimizer(text, shape, typename SAValue<TText>::Type(), delegate);
+}
+
+template <typename TString, typename TSpec, typename TShape, typename TDelegate>
+inline void
+_forEachMinimizer(StringSet<TString, TSpec> const & text, TShape const & shape, TDelegate & delegate)
+{
+    typedef StringSet<TString, TSpec>           TText;
+    typedef typename Size<TText const>::Type    TSize;
+    typedef typename SAValue<TText>::Type       TPos;
+
+    for (TSize seqNo = 0; seqNo < length(text); ++seqNo)
+    {
+        TPos pos;
+        assignValueI1(pos, seqNo);
+        assignValueI2(pos, 0);
+        _forEachMinimizer(text[seqNo], shape, pos, delegate);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _qgramQGramCount()
+// ----------------------------------------------------------------------------
+// Returns the number of sampled minimizers.
+
+template <typename TText, unsigned TSPAN, unsigned TWEIGHT, typename TShapeSpec>
+inline typename Size<Index<TText, IndexQGram<MinimizerShape<TSPAN, TWEIGHT, TShapeSpec>, MinimizerSampling> > >::Type
+_qgramQGramCount(Index<TText, IndexQGram<MinimizerShape<TSPAN, TWEIGHT, TShapeSpec>, MinimizerSampling> > const & index)
+{
+    typedef Index<TText, IndexQGram<MinimizerShape<TSPAN, TWEIGHT, TShapeSpec>, MinimizerSampling> > TIndex;
+
+    MinimizerCounter_<typename Size<TIndex>::Type> counter;
+    _forEachMinimizer(indexText(index), indexShape(index), counter);
+    return counter.count;
+}
+
+// ----------------------------------------------------------------------------
+// Function _minimizerDirLength()
+// ----------------------------------------------------------------------------
+// Sizes the bucket map for the given number of minimizers and returns the directory length.
+
+template <typename TText, unsigned TSPAN, unsigned TWEIGHT, typename TShapeSpec, typename TSize>
+inline __int64
+_minimizerDirLength(Index<TText, IndexQGram<MinimizerShape<TSPAN, TWEIGHT, TShapeSpec>, MinimizerSampling> > & index,
+                    TSize minimizersCount)
+{
+    typedef Index<TText, IndexQGram<MinimizerShape<TSPAN, TWEIGHT, TShapeSpec>, MinimizerSampling> > TIndex;
+    typedef typename Fibre<TIndex, QGramDir>::Type          TDir;
+    typedef typename Fibre<TIndex, FibreShape>::Type        TShape;
+    typedef typename Value<TDir>::Type                      TDirValue;
+    typedef typename Value<TShape>::Type                    THashValue;
+
+    double numQGrams = minimizersCount * index.alpha;
+    double maxQGrams = pow((double)ValueSize<typename Value<TIndex>::Type>::VALUE, (double)TWEIGHT);
+    __int64 qgrams;
+
+    // Compare the size of open addressing with 1-1 mapping and use the smaller one.
+    if (numQGrams * (sizeof(TDirValue) + sizeof(THashValue)) < maxQGrams * sizeof(TDirValue))
+    {
+        qgrams = (__int64)ceil(numQGrams);
+#ifndef SEQAN_OPENADDRESSING_COMPACT
+        __int64 power2 = 1;
+        while (power2 < qgrams)
+            power2 <<= 1;
+        qgrams = power2;
+#endif
+        resize(index.bucketMap.qgramCode, qgrams + 1, Exact());
+    }
+    else
+    {
+        qgrams = (__int64)ceil(maxQGrams);
+        clear(index.bucketMap.qgramCode);
+    }
+
+    return qgrams + 1;
+}
+
+// ----------------------------------------------------------------------------
+// Function indexCreate()
+// ----------------------------------------------------------------------------
+
+template <typename TText, unsigned TSPAN, unsigned TWEIGHT, typename TShapeSpec>
+inline bool
+indexCreate(Index<TText, IndexQGram<MinimizerShape<TSPAN, TWEIGHT, TShapeSpec>, MinimizerSampling> > & index,
+            FibreSADir, Default const)
+{
+    typedef Index<TText, IndexQGram<MinimizerShape<TSPAN, TWEIGHT, TShapeSpec>, MinimizerSampling> > TIndex;
+    typedef typename Fibre<TIndex, QGramSA>::Type           TSA;
+    typedef typename Fibre<TIndex, QGramDir>::Type          TDir;
+    typedef typename Fibre<TIndex, QGramBucketMap>::Type    TBucketMap;
+
+    TSA & sa = indexSA(index);
+    TDir & dir = indexDir(index);
+    TBucketMap & bucketMap = indexBucketMap(index);
+
+    // 1. count minimizers and size the tables
+    typename Size<TIndex>::Type minimizersCount = _qgramQGramCount(index);
+    resize(sa, minimizersCount, Exact());
+    resize(dir, _minimizerDirLength(index, minimizersCount), Exact());
+    _qgramClearDir(dir, bucketMap);
+
+    // 2. count minimizers per bucket
+    MinimizerBucketCounter_<TDir, TBucketMap> counter(dir, bucketMap);
+    _forEachMinimizer(indexText(index), indexShape(index), counter);
+
+    // 3. cumulative sum
+    _qgramCummulativeSum(dir, False());
+
+    // 4. fill suffix array
+    MinimizerFiller_<TSA, TDir, TBucketMap> filler(sa, dir, bucketMap);
+    _forEachMinimizer(indexText(index), indexShape(index), filler);
+
+    return true;
+}
+
+template <typename TText, unsigned TSPAN, unsigned TWEIGHT, typename TShapeSpec>
+inline bool
+indexCreate(Index<TText, IndexQGram<MinimizerShape<TSPAN, TWEIGHT, TShapeSpec>, MinimizerSampling> > & index,
+            FibreSA, Default const)
+{
+    return indexCreate(index, FibreSADir(), Default());
+}
+
+template <typename TText, unsigned TSPAN, unsigned TWEIGHT, typename TShapeSpec>
+inline bool
+indexCreate(Index<TText, IndexQGram<MinimizerShape<TSPAN, TWEIGHT, TShapeSpec>, MinimizerSampling> > & index,
+            FibreDir, Default const)
+{
+    return indexCreate(index, FibreSADir(), Default());
+}
+
+// Minimizers are computed serially.
+template <typename TText, unsigned TSPAN, unsigned TWEIGHT, typename TShapeSpec>
+inline bool
+indexCreate(Index<TText, IndexQGram<MinimizerShape<TSPAN, TWEIGHT, TShapeSpec>, MinimizerSampling> > & index,
+            FibreSADir, Parallel const)
+{
+    return indexCreate(index, FibreSADir(), Default());
+}
+
+template <typename TText, unsigned TSPAN, unsigned TWEIGHT, typename TShapeSpec>
+inline bool
+indexCreate(Index<TText, IndexQGram<MinimizerShape<TSPAN, TWEIGHT, TShapeSpec>, MinimizerSampling> > & index,
+            FibreSA, Parallel const)
+{
+    return indexCreate(index, FibreSADir(), Default());
+}
+
+template <typename TText, unsigned TSPAN, unsigned TWEIGHT, typename TShapeSpec>
+inline bool
+indexCreate(Index<TText, IndexQGram<MinimizerShape<TSPAN, TWEIGHT, TShapeSpec>, MinimizerSampling> > & index,
+            FibreDir, Parallel const)
+{
+    return indexCreate(index, FibreSADir(), Default());
+}
+
+// ----------------------------------------------------------------------------
+// Function getCandidates()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn MinimizerQGramIndex#getCandidates
+ * @headerfile <seqan/index.h>
+ * @brief Returns the text positions where a pattern may start, given the minimizers shared with the text.
+ *
+ * @signature void getCandidates(candidates, index, pattern[, threshold]);
+ *
+ * @param[out] candidates A @link String @endlink of @link SAValue @endlink positions, sorted and without duplicates.
+ * @param[in]  index      The @link MinimizerQGramIndex @endlink to query.  The index tables are built on-demand via
+ *                        @link Index#indexRequire @endlink if index is not <tt>const</tt>.
+ * @param[in]  pattern    The pattern to search.
+ * @param[in]  threshold  The minimal number of minimizer hits supporting a candidate.  Default: 1.
+ *
+ * Each sampled minimizer of the pattern hitting the text votes for the text position aligning the pattern to the
+ * hit without gaps.  Every exact occurrence of a pattern at least as long as the minimizer window is reported.
+ */
+
+template <typename TCandidates, typename TText, unsigned TSPAN, unsigned TWEIGHT, typename TShapeSpec,
+          typename TPattern, typename TThreshold>
+inline void
+getCandidates(TCandidates & candidates,
+              Index<TText, IndexQGram<MinimizerShape<TSPAN, TWEIGHT, TShapeSpec>, MinimizerSampling> > const & index,
+              TPattern const & pattern, TThreshold threshold)
+{
+    typedef Index<TText, IndexQGram<MinimizerShape<TSPAN, TWEIGHT, TShapeSpec>, MinimizerSampling> > TIndex;
+    typedef typename Iterator<TCandidates, Standard>::Type  TCandidatesIter;
+    typedef typename Size<TCandidates>::Type                TSize;
+
+    clear(candidates);
+
+    MinimizerCandidates_<TCandidates, TIndex> collector(candidates, index);
+    _forEachMinimizer(pattern, indexShape(index), typename Size<TPattern>::Type(), collector);
+
+    std::sort(begin(candidates, Standard()), end(candidates, Standard()));
+
+    // Keep one copy of each candidate supported by enough hits.
+    TCandidatesIter candidatesIt = begin(candidates, Standard());
+    TCandidatesIter candidatesEnd = end(candidates, Standard());
+    TCandidatesIter outputIt = candidatesIt;
+    while (candidatesIt != candidatesEnd)
+    {
+        TCandidatesIter runIt = candidatesIt;
+        while (runIt != candidatesEnd && *runIt == *candidatesIt) ++runIt;
+        if (static_cast<TSize>(runIt - candidatesIt) >= static_cast<TSize>(threshold))
+            *outputIt++ = *candidatesIt;
+        candidatesIt = runIt;
+    }
+    resize(candidates, outputIt - begin(candidates, Standard()));
+}
+
+template <typename TCandidates, typename TText, unsigned TSPAN, unsigned TWEIGHT, typename TShapeSpec,
+          typename TPattern, typename TThreshold>
+inline void
+getCandidates(TCandidates & candidates,
+              Index<TText, IndexQGram<MinimizerShape<TSPAN, TWEIGHT, TShapeSpec>, MinimizerSampling> > & index,
+              TPattern const & pattern, TThreshold threshold)
+{
+    typedef Index<TText, IndexQGram<MinimizerShape<TSPAN, TWEIGHT, TShapeSpec>, MinimizerSampling> > TIndex;
+
+    indexRequire(index, QGramSADir());
+    getCandidates(candidates, static_cast<TIndex const &>(index), pattern, threshold);
+}
+
+template <typename TCandidates, typename TText, typename TShapeSpec, typename TPattern>
+inline void
+getCandidates(TCandidates & candidates, Index<TText, IndexQGram<TShapeSpec, MinimizerSampling> > & index,
+              TPattern const & pattern)
+{
+    getCandidates(candidates, index, pattern, 1u);
+}
+
+template <typename TCandidates, typename TText, typename TShapeSpec, typename TPattern>
+inline void
+getCandidates(TCandidates & candidates, Index<TText, IndexQGram<TShapeSpec, MinimizerSampling> > const & index,
+              TPattern const & pattern)
+{
+    getCandidates(candidates, index, pattern, 1u);
+}
+
+// ----------------------------------------------------------------------------
+// Function open()
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TShapeSpec>
+inline bool open(Index<TText, IndexQGram<TShapeSpec, MinimizerSampling> > & index, const char * fileName, int openMode)
+{
+    String<char> name;
+
+    name = fileName;    append(name, ".txt");
+    if (!open(getFibre(index, QGramText()), toCString(name), openMode)) return false;
+
+    name = fileName;    append(name, ".sa");
+    if (!open(getFibre(index, QGramSA()), toCString(name), openMode)) return false;
+
+    name = fileName;    append(name, ".dir");
+    if (!open(getFibre(index, QGramDir()), toCString(name), openMode)) return false;
+
+    name = fileName;    append(name, ".bkt");
+    if (!open(getFibre(index, QGramBucketMap()).qgramCode, toCString(name), openMode)) return false;
+
+    return true;
+}
+
+template <typename TText, typename TShapeSpec>
+inline bool open(Index<TText, IndexQGram<TShapeSpec, MinimizerSampling> > & index, const char * fileName)
+{
+    return open(index, fileName, OPEN_RDONLY);
+}
+
+// ----------------------------------------------------------------------------
+// Function save()
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TShapeSpec>
+inline bool save(Index<TText, IndexQGram<TShapeSpec, MinimizerSampling> > & index, const char * fileName, int openMode)
+{
+    String<char> name;
+
+    name = fileName;    append(name, ".txt");
+    if (!save(getFibre(index, QGramText()), toCString(name), openMode)) return false;
+
+    name = fileName;    append(name, ".sa");
+    if (!save(getFibre(index, QGramSA()), toCString(name), openMode)) return false;
+
+    name = fileName;    append(name, ".dir");
+    if (!save(getFibre(index, QGramDir()), toCString(name), openMode)) return false;
+
+    name = fileName;    append(name, ".bkt");
+    if (!save(getFibre(index, QGramBucketMap()).qgramCode, toCString(name), openMode)) return false;
+
+    return true;
+}
+
+template <typename TText, typename TShapeSpec>
+inline bool save(Index<TText, IndexQGram<TShapeSpec, MinimizerSampling> > & index, const char * fileName)
+{
+    return save(index, fileName, OPEN_WRONLY | OPEN_CREATE);
+}
+
+}
+
+#endif  // #ifndef SEQAN_INDEX_QGRAM_MINIMIZER_H_
@@ -0,0 +1,430 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2015, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: SeqAn Team <seqan-dev@lists.fu-berlin.de>
+// ==========================================================================
+// Multi-threaded in-memory suffix array construction by prefix doubling.
+//
+// The suffixes are first sorted by a packed prefix of as many characters as
+// fit into 64 bits. Then, in each round, the groups of suffixes sharing the
+// same h-prefix are refined by the rank of the suffix starting h characters
+// later, until all groups are singletons (Manber and Myers, Larsson and
+// Sadakane). Large groups are sorted with a parallel sort, small groups are
+// distributed among the threads. Each round reads the ranks while sorting and
+// writes them only afterwards, thus threads never have to synchronize.
+// ==========================================================================
+
+#ifndef SEQAN_HEADER_INDEX_SA_PARALLEL_H
+#define SEQAN_HEADER_INDEX_SA_PARALLEL_H
+
+namespace seqan {
+
+// ============================================================================
+// Classes
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Class SaParallelPrefixKey_
+// ----------------------------------------------------------------------------
+// Sort key of the first round: the packed prefix of each suffix.
+
+template <typename TKeys, typename TLimits>
+struct SaParallelPrefixKey_
+{
+    TKeys const &   keys;
+    TLimits const & limits;
+
+    SaParallelPrefixKey_(TKeys const & keys, TLimits const & limits) :
+        keys(keys),
+        limits(limits)
+    {}
+
+    template <typename TSAValue>
+    inline __uint64 operator()(TSAValue const & pos) const
+    {
+        return keys[posGlobalize(pos, limits)];
+    }
+};
+
+// ----------------------------------------------------------------------------
+// Class SaParallelRankKey_
+// ----------------------------------------------------------------------------
+// Sort key of the following rounds: the rank of the suffix h characters later.
+// Suffixes shorter than h sort before all others, the one of the last
+// sequence first.
+
+template <typename TText, typename TRanks, typename TLimits, typename TSize>
+struct SaParallelRankKey_
+{
+    TText const &   text;
+    TRanks const &  ranks;
+    TLimits const & limits;
+    TSize           h;
+    TSize           seqCount;
+
+    SaParallelRankKey_(TText const & text, TRanks const & ranks, TLimits const & limits, TSize h) :
+        text(text),
+        ranks(ranks),
+        limits(limits),
+        h(h),
+        seqCount(countSequences(text))
+    {}
+
+    template <typename TSAValue>
+    inline __uint64 operator()(TSAValue const & pos) const
+    {
+        if (getSeqOffset(pos) + h < sequenceLength(getSeqNo(pos), text))
+            return static_cast<__uint64>(ranks[posGlobalize(pos, limits) + h]) + seqCount;
+        else
+            return static_cast<__uint64>(seqCount - 1 - getSeqNo(pos));
+    }
+};
+
+// ----------------------------------------------------------------------------
+// Class SaParallelLess_
+// ----------------------------------------------------------------------------
+
+template <typename TKey>
+struct SaParallelLess_
+{
+    TKey const & key;
+
+    SaParallelLess_(TKey const & key) :
+        key(key)
+    {}
+
+    template <typename TSAValue>
+    inline bool operator()(TSAValue const & a, TSAValue const & b) const
+    {
+        return key(a) < key(b);
+    }
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _saParallelPackKeys()
+// ----------------------------------------------------------------------------
+// Packs the prefixes of the suffixes [from, to) of one sequence. Characters are
+// stored as ordValue + 1, the end of the sequence as 0.
+
+template <typename TKeys, typename TSequence, typename TSize>
+inline void _saParallelPackKeys(TKeys & keys, TSequence const & seq, TSize globalBegin, TSize from, TSize to,
+                                unsigned bitsPerChar, unsigned charsPerKey)
+{
+    TSize seqLength = length(seq);
+    __uint64 mask = (bitsPerChar * charsPerKey < 64) ? (1ull << (bitsPerChar * charsPerKey)) - 1 : ~0ull;
+    __uint64 key = 0;
+
+    for (unsigned i = 0; i < charsPerKey; ++i)
+    {
+        key <<= bitsPerChar;
+        if (from + i < seqLength)
+            key |= static_cast<__uint64>(ordValue(getValue(seq, from + i))) + 1;
+    }
+    keys[globalBegin + from] = key;
+
+    for (TSize pos = from + 1; pos < to; ++pos)
+    {
+        key = (key << bitsPerChar) & mask;
+        if (pos + charsPerKey - 1 < seqLength)
+            key |= static_cast<__uint64>(ordValue(getValue(seq, pos + charsPerKey - 1))) + 1;
+        keys[globalBegin + pos] = key;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _saParallelMarkGroups()
+// ----------------------------------------------------------------------------
+// Stores for each slot in [from, to) of the sorted group starting at groupBegin the
+// first slot with the same key. Slots whose first slot lies before from are marked
+// as unknown.
+
+template <typename TSlots, typename TSA, typename TKey, typename TSize>
+inline void _saParallelMarkGroups(TSlots & slots, TSA const & sa, TKey const & key,
+                                  TSize groupBegin, TSize from, TSize to)
+{
+    TSize start = (from == groupBegin) ? from : MaxValue<TSize>::VALUE;
+    __uint64 prevKey = key(sa[(from == groupBegin) ? from : from - 1]);
+
+    for (TSize pos = from; pos < to; ++pos)
+    {
+        __uint64 currKey = key(sa[pos]);
+        if (currKey != prevKey)
+            start = pos;
+        slots[pos] = start;
+        prevKey = currKey;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _saParallelUpdateRanks()
+// ----------------------------------------------------------------------------
+// Assigns the new ranks to the slots [from, to) of the group ending at groupEnd
+// and collects the groups that still need to be refined.
+
+template <typename TRanks, typename TGroups, typename TSlots, typename TSA, typename TLimits, typename TSize>
+inline void _saParallelUpdateRanks(TRanks & ranks, TGroups & groups, TSlots const & slots, TSA const & sa,
+                                   TLimits const & limits, TSize groupEnd, TSize from, TSize to)
+{
+    typedef typename Value<TGroups>::Type   TGroup;
+
+    for (TSize pos = from; pos < to; ++pos)
+    {
+        ranks[posGlobalize(sa[pos], limits)] = slots[pos];
+
+        if (slots[pos] == pos && pos + 1 < groupEnd && slots[pos + 1] == pos)
+        {
+            TSize end = pos + 2;
+            while (end < groupEnd && slots[end] == pos)
+                ++end;
+            appendValue(groups, TGroup(pos, end));
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _saParallelRefine()
+// ----------------------------------------------------------------------------
+// Sorts each group by key and splits it into groups of equal keys.
+
+template <typename TSA, typename TGroups, typename TKey, typename TRanks, typename TLimits, typename TSize>
+inline void _saParallelRefine(TSA & sa, TGroups & groups, TKey const & key, TRanks & ranks, TRanks & slots,
+                              TLimits const & limits, TSize chunkSize)
+{
+    typedef typename Value<TGroups>::Type                   TGroup;
+    typedef typename MakeSigned<TSize>::Type                TSignedSize;
+    typedef typename Iterator<TSA, Standard>::Type          TSAIter;
+    typedef SaParallelLess_<TKey>                           TLess;
+
+    TLess less(key);
+    TSAIter saBegin = begin(sa, Standard());
+    TSignedSize groupsCount = length(groups);
+
+    // Sort and mark the large groups one after the other using all threads.
+    for (TSignedSize i = 0; i < groupsCount; ++i)
+    {
+        TGroup group = groups[i];
+        if (group.i2 - group.i1 <= chunkSize)
+            continue;
+
+        typename Infix<TSA>::Type groupInfix = infix(sa, group.i1, group.i2);
+        sort(groupInfix, less, Parallel());
+
+        Splitter<TSize> splitter(group.i1, group.i2, Parallel());
+
+        SEQAN_OMP_PRAGMA(parallel for)
+        for (TSignedSize job = 0; job < static_cast<TSignedSize>(length(splitter)); ++job)
+            _saParallelMarkGroups(slots, sa, key, group.i1, splitter[job], splitter[job + 1]);
+
+        // Propagate the group starts across the chunk borders.
+        String<TSize> carries;
+        resize(carries, length(splitter), group.i1, Exact());
+        for (TSize job = 1; job < length(splitter); ++job)
+        {
+            TSize last = slots[splitter[job] - 1];
+            carries[job] = (last == MaxValue<TSize>::VALUE) ? carries[job - 1] : last;
+        }
+
+        SEQAN_OMP_PRAGMA(parallel for)
+        for (TSignedSize job = 1; job < static_cast<TSignedSize>(length(splitter)); ++job)
+            for (TSize pos = splitter[job]; pos < splitter[job + 1] && slots[pos] == MaxValue<TSize>::VALUE; ++pos)
+                slots[pos] = carries[job];
+    }
+
+    // Sort and mark the small groups in parallel.
+    SEQAN_OMP_PRAGMA(parallel for schedule(dynamic, 256))
+    for (TSignedSize i = 0; i < groupsCount; ++i)
+    {
+        TGroup group = groups[i];
+        if (group.i2 - group.i1 > chunkSize)
+            continue;
+
+        std::sort(saBegin + group.i1, saBegin + group.i2, less);
+        _saParallelMarkGroups(slots, sa, key, group.i1, group.i1, group.i2);
+    }
+
+    // Update the ranks and collect the groups of the next round in thread-local lists.
+    String<TGroups> threadGroups;
+    resize(threadGroups, omp_get_max_threads());
+
+    for (TSignedSize i = 0; i < groupsCount; ++i)
+    {
+        TGroup group = groups[i];
+        if (group.i2 - group.i1 <= chunkSize)
+            continue;
+
+        Splitter<TSize> splitter(group.i1, group.i2, Parallel());
+
+        SEQAN_OMP_PRAGMA(parallel for)
+        for (TSignedSize job = 0; job < static_cast<TSignedSize>(length(splitter)); ++job)
+            _saParallelUpdateRanks(ranks, threadGroups[omp_get_thread_num()], slots, sa, limits,
+                                   group.i2, splitter[job], splitter[job + 1]);
+    }
+
+    SEQAN_OMP_PRAGMA(parallel for schedule(dynamic, 256))
+    for (TSignedSize i = 0; i < groupsCount; ++i)
+    {
+        TGroup group = groups[i];
+        if (group.i2 - group.i1 > chunkSize)
+            continue;
+
+        _saParallelUpdateRanks(ranks, threadGroups[omp_get_thread_num()], slots, sa, limits,
+                               group.i2, group.i1, group.i2);
+    }
+
+    // Concatenate the thread-local lists.
+    String<TSize> offsets;
+    resize(offsets, length(threadGroups) + 1, 0, Exact());
+    for (TSize t = 0; t < length(threadGroups); ++t)
+        offsets[t + 1] = offsets[t] + length(threadGroups[t]);
+
+    resize(groups, back(offsets), Exact());
+
+    SEQAN_OMP_PRAGMA(parallel for)
+    for (TSignedSize t = 0; t < static_cast<TSignedSize>(length(threadGroups)); ++t)
+        std::copy(begin(threadGroups[t], Standard()), end(threadGroups[t], Standard()),
+                  begin(groups, Standard()) + offsets[t]);
+}
+
+// ----------------------------------------------------------------------------
+// Function _createSuffixArrayParallel()
+// ----------------------------------------------------------------------------
+
+template <typename TSA, typename TText>
+inline void _createSuffixArrayParallel(TSA & sa, TText const & text, True)
+{
+    typedef typename Size<TSA>::Type                                TSize;
+    typedef typename MakeSigned<TSize>::Type                        TSignedSize;
+    typedef typename Value<typename Concatenator<TText>::Type>::Type TAlphabet;
+    typedef typename StringSetLimits<TText const>::Type             TLimits;
+    typedef typename Value<TSA>::Type                               TSAValue;
+    typedef String<__uint64>                                        TKeys;
+    typedef String<TSize>                                           TRanks;
+    typedef String<Pair<TSize> >                                    TGroups;
+
+    TSize n = length(sa);
+    if (n == 0)
+        return;
+
+    TLimits const & limits = stringSetLimits(text);
+    Splitter<TSize> splitter(0, n, Parallel());
+
+    // Pack as many characters as possible into the keys of the first round.
+    unsigned bitsPerChar = BitsPerValue<TAlphabet>::VALUE + 1;
+    unsigned charsPerKey = _max(64u / bitsPerChar, 1u);
+    SEQAN_ASSERT_LEQ(bitsPerChar, 64u);
+
+    TKeys keys;
+    resize(keys, n, Exact());
+
+    SEQAN_OMP_PRAGMA(parallel for)
+    for (TSignedSize job = 0; job < static_cast<TSignedSize>(length(splitter)); ++job)
+    {
+        for (TSize pos = splitter[job]; pos < splitter[job + 1];)
+        {
+            TSAValue localPos;
+            posLocalize(localPos, pos, limits);
+
+            TSize seqNo = getSeqNo(localPos);
+            TSize seqOffset = getSeqOffset(localPos);
+            TSize seqEnd = _min(static_cast<TSize>(sequenceLength(seqNo, text)), seqOffset + splitter[job + 1] - pos);
+
+            _saParallelPackKeys(keys, getSequenceByNo(seqNo, text), pos - seqOffset, seqOffset, seqEnd,
+                                bitsPerChar, charsPerKey);
+
+            for (; seqOffset < seqEnd; ++seqOffset, ++pos)
+                posLocalize(sa[pos], pos, limits);
+        }
+    }
+
+    // Groups larger than this are sorted and scanned by all threads together.
+    TSize chunkSize = _max(static_cast<TSize>(1u << 14), n / omp_get_max_threads());
+
+    TRanks ranks;
+    TRanks slots;
+    resize(ranks, n, Exact());
+    resize(slots, n, Exact());
+
+    TGroups groups;
+    appendValue(groups, Pair<TSize>(0, n));
+
+    // Sort by the packed prefixes.
+    _saParallelRefine(sa, groups, SaParallelPrefixKey_<TKeys, TLimits>(keys, limits), ranks, slots, limits, chunkSize);
+    clear(keys);
+    shrinkToFit(keys);
+
+    // Double the sorted prefix length until all suffixes are distinguished.
+    for (TSize h = charsPerKey; !empty(groups); h *= 2)
+        _saParallelRefine(sa, groups, SaParallelRankKey_<TText, TRanks, TLimits, TSize>(text, ranks, limits, h),
+                          ranks, slots, limits, chunkSize);
+}
+
+// Suffix arrays without fast random access, e.g. external strings, are built in memory and copied.
+template <typename TSA, typename TText>
+inline void _createSuffixArrayParallel(TSA & sa, TText const & text, False)
+{
+    String<typename Value<TSA>::Type> tempSA;
+    resize(tempSA, length(sa), Exact());
+    _createSuffixArrayParallel(tempSA, text, True());
+    assign(sa, tempSA, Exact());
+}
+
+// ----------------------------------------------------------------------------
+// Function createSuffixArray()                                      [Parallel]
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn createSuffixArray#createSuffixArray(Parallel)
+ * @headerfile <seqan/index.h>
+ * @brief Creates a suffix array using all available threads.
+ *
+ * @signature void createSuffixArray(suffixArray, text, Parallel());
+ *
+ * @param[out] suffixArray The resulting suffix array.  Its size must be at least <tt>lengthSum(text)</tt>.
+ * @param[in]  text        A text or a @link StringSet @endlink.
+ *
+ * The suffixes are sorted by prefix doubling in <i>O(n log n)</i> work.  The number of threads is controlled by
+ * <tt>omp_set_num_threads()</tt>.  Passing <tt>Parallel()</tt> to @link Index#indexCreate @endlink builds the
+ * suffix array of an @link IndexEsa @endlink or an @link FMIndex @endlink this way.
+ */
+
+template <typename TSA, typename TText>
+inline void createSuffixArray(TSA & sa, TText const & text, Parallel const &)
+{
+    _createSuffixArrayParallel(sa, text, typename AllowsFastRandomAccess<TSA>::Type());
+}
+
+}
+
+#endif  // #ifndef SEQAN_HEADER_INDEX_SA_PARALLEL_H
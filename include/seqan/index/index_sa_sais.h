@@ -0,0 +1,519 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2015, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: SeqAn Team <seqan-dev@lists.fu-berlin.de>
+// ==========================================================================
+// In-memory suffix array construction by induced sorting (SA-IS) of
+// Nong, Zhang and Chan, "Two Efficient Algorithms for Linear Time Suffix
+// Array Construction", IEEE Trans. Comput. 60(10), 2011.
+//
+// The text is never copied for single strings: the algorithm runs on the
+// text itself and needs one bit per character for the suffix types, a
+// bucket array of alphabet size and the suffix array. The reduced problem
+// of each recursion level and, if there is room, its bucket array are
+// stored inside the suffix array.
+//
+// The strings of a StringSet are concatenated with the separator 0 into a
+// text of the smallest integer type that holds the alphabet, usually one
+// byte per character.  The first level treats the separators as unique
+// characters, see _saisIsSeparator().
+// ==========================================================================
+
+#ifndef SEQAN_HEADER_INDEX_SA_SAIS_H
+#define SEQAN_HEADER_INDEX_SA_SAIS_H
+
+namespace seqan {
+
+// ============================================================================
+// Tags
+// ============================================================================
+
+/*!
+ * @tag IndexEsaFibres#Sais
+ * @headerfile <seqan/index.h>
+ * @brief Suffix array construction algorithm tag for induced sorting (SA-IS).
+ *
+ * @signature struct Sais;
+ *
+ * Constructs the suffix array of a @link String @endlink or a @link StringSet @endlink in memory and in linear
+ * time.  Can be passed to @link Index#indexCreate @endlink or @link createSuffixArray @endlink.
+ *
+ * A single string is sorted directly and needs one bit per character besides the suffix array.  The strings of a
+ * StringSet are concatenated into a text of one byte per character for alphabets of up to 255 characters, which
+ * is sorted into a 32 or 64 bit integer suffix array.  For a DNA StringSet of less than 4G characters this needs
+ * about 5n bytes in addition to the suffix array.
+ */
+
+struct Sais {};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _saisOrdValue()
+// ----------------------------------------------------------------------------
+// Integral names of the reduced problems must not be narrowed by ordValue().
+
+template <typename TValue>
+inline unsigned _saisOrdValue(TValue const & c)
+{
+    return ordValue(c);
+}
+
+inline unsigned _saisOrdValue(unsigned c)
+{
+    return c;
+}
+
+inline unsigned long _saisOrdValue(unsigned long c)
+{
+    return c;
+}
+
+inline unsigned long long _saisOrdValue(unsigned long long c)
+{
+    return c;
+}
+
+// ----------------------------------------------------------------------------
+// Function _saisAlphabetSize()
+// ----------------------------------------------------------------------------
+
+template <typename TText>
+inline typename Size<TText>::Type
+_saisAlphabetSize(TText const & /*text*/, True)
+{
+    return ValueSize<typename Value<TText>::Type>::VALUE;
+}
+
+// Large alphabets are reduced to the ordinal values occurring in the text.
+template <typename TText>
+inline typename Size<TText>::Type
+_saisAlphabetSize(TText const & text, False)
+{
+    typedef typename Iterator<TText const, Standard>::Type  TIter;
+    typedef typename Size<TText>::Type                      TSize;
+
+    TSize sigma = 0;
+    for (TIter it = begin(text, Standard()); it != end(text, Standard()); ++it)
+        sigma = std::max(sigma, static_cast<TSize>(_saisOrdValue(*it)) + 1);
+
+    return sigma;
+}
+
+template <typename TText>
+inline typename Size<TText>::Type
+_saisAlphabetSize(TText const & text)
+{
+    typedef typename Value<TText>::Type TValue;
+
+    return _saisAlphabetSize(text, typename Eval<(BitsPerValue<TValue>::VALUE <= 16)>::Type());
+}
+
+template <typename TString, typename TSSetSpec>
+inline typename Size<TString>::Type
+_saisAlphabetSize(StringSet<TString, TSSetSpec> const & stringSet)
+{
+    typedef typename Size<TString>::Type    TSize;
+
+    TSize sigma = 0;
+    for (TSize i = 0; i < length(stringSet); ++i)
+        sigma = std::max(sigma, static_cast<TSize>(_saisAlphabetSize(stringSet[i])));
+
+    return sigma;
+}
+
+// ----------------------------------------------------------------------------
+// Function _saisIsSeparator()
+// ----------------------------------------------------------------------------
+// The concatenation of a StringSet ends each string but the last with the character 0.  The separators are
+// unique, i.e. two separators are never equal, and a later separator is smaller than an earlier one.  Therefore
+// the separator suffixes are the smallest suffixes and ordered by decreasing position.  Instead of sorting them,
+// they are placed at the begin of the suffix array and never induced.
+
+template <typename TValue>
+inline bool _saisIsSeparator(TValue const & c, True)
+{
+    return _saisOrdValue(c) == 0u;
+}
+
+template <typename TValue>
+inline bool _saisIsSeparator(TValue const & /*c*/, False)
+{
+    return false;
+}
+
+// ----------------------------------------------------------------------------
+// Function _saisPlaceSeparators()
+// ----------------------------------------------------------------------------
+
+template <typename TSAIter, typename TTextIter, typename TSize>
+inline void _saisPlaceSeparators(TSAIter sa, TTextIter text, TSize n, True)
+{
+    for (TSize i = n; i > 0; --i)
+        if (_saisIsSeparator(*(text + (i - 1)), True()))
+            *sa++ = i - 1;
+}
+
+template <typename TSAIter, typename TTextIter, typename TSize>
+inline void _saisPlaceSeparators(TSAIter /*sa*/, TTextIter /*text*/, TSize /*n*/, False)
+{}
+
+// ----------------------------------------------------------------------------
+// Function _saisIsLms()
+// ----------------------------------------------------------------------------
+// Returns true if i is a leftmost S-type position.
+
+template <typename TTypes, typename TSize>
+inline bool _saisIsLms(TTypes const & types, TSize i)
+{
+    return i > 0 && getValue(types, i) && !getValue(types, i - 1);
+}
+
+// ----------------------------------------------------------------------------
+// Function _saisGetBuckets()
+// ----------------------------------------------------------------------------
+// Computes the begin or the end positions of all character buckets.  The buckets are given by an iterator, as
+// the reduced problems store them inside the suffix array.
+
+template <typename TBuckets, typename TTextIter, typename TSize>
+inline void _saisGetBuckets(TBuckets buckets, TTextIter text, TSize n, TSize sigma, bool bucketEnd)
+{
+    arrayFill(buckets, buckets + sigma, 0u);
+
+    for (TSize i = 0; i < n; ++i)
+        ++buckets[_saisOrdValue(*(text + i))];
+
+    TSize sum = 0;
+    for (TSize c = 0; c < sigma; ++c)
+    {
+        sum += buckets[c];
+        buckets[c] = bucketEnd ? sum : sum - buckets[c];
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _saisInduceL()
+// ----------------------------------------------------------------------------
+// Induces the order of L-type suffixes from the sorted LMS suffixes.
+
+template <typename TSAIter, typename TTextIter, typename TTypes, typename TBuckets, typename TSize,
+          typename TSeparators>
+inline void _saisInduceL(TSAIter sa, TTextIter text, TTypes const & types, TBuckets buckets, TSize n, TSize sigma,
+                         TSeparators)
+{
+    const TSize EMPTY = MaxValue<TSize>::VALUE;
+
+    _saisGetBuckets(buckets, text, n, sigma, false);
+
+    // The virtual sentinel at position n induces the last suffix, which is always L-type.
+    if (!_saisIsSeparator(*(text + (n - 1)), TSeparators()))
+        sa[buckets[_saisOrdValue(*(text + (n - 1)))]++] = n - 1;
+
+    for (TSize i = 0; i < n; ++i)
+    {
+        TSize j = sa[i];
+        if (j != EMPTY && j > 0 && !getValue(types, j - 1) && !_saisIsSeparator(*(text + (j - 1)), TSeparators()))
+            sa[buckets[_saisOrdValue(*(text + (j - 1)))]++] = j - 1;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _saisInduceS()
+// ----------------------------------------------------------------------------
+// Induces the order of S-type suffixes from the sorted L-type suffixes.
+
+template <typename TSAIter, typename TTextIter, typename TTypes, typename TBuckets, typename TSize,
+          typename TSeparators>
+inline void _saisInduceS(TSAIter sa, TTextIter text, TTypes const & types, TBuckets buckets, TSize n, TSize sigma,
+                         TSeparators)
+{
+    const TSize EMPTY = MaxValue<TSize>::VALUE;
+
+    _saisGetBuckets(buckets, text, n, sigma, true);
+
+    for (TSize i = n; i > 0; --i)
+    {
+        TSize j = sa[i - 1];
+        if (j != EMPTY && j > 0 && getValue(types, j - 1) && !_saisIsSeparator(*(text + (j - 1)), TSeparators()))
+            sa[--buckets[_saisOrdValue(*(text + (j - 1)))]] = j - 1;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _createSuffixArraySais()
+// ----------------------------------------------------------------------------
+// Sorts the suffixes of text[0..n) over the alphabet [0..sigma) into sa[0..n), using sigma bucket entries.
+// The text is implicitly terminated by a unique sentinel smaller than all characters.  If TSeparators is True,
+// 0 is the separator of a concatenated StringSet.
+
+template <typename TSAIter, typename TTextIter, typename TBucketIter, typename TSize, typename TSeparators>
+void _createSuffixArraySais(TSAIter sa, TTextIter text, TBucketIter buckets, TSize n, TSize sigma, TSeparators)
+{
+    typedef String<bool, Packed<> >     TTypes;
+
+    const TSize EMPTY = MaxValue<TSize>::VALUE;
+
+    if (n == 0)
+        return;
+
+    if (n == 1)
+    {
+        sa[0] = 0;
+        return;
+    }
+
+    // Classify suffixes into S-type (true) and L-type (false).
+    TTypes types;
+    resize(types, n, Exact());
+    assignValue(types, n - 1, false);
+    for (TSize i = n - 1; i > 0; --i)
+    {
+        TSize c = _saisOrdValue(*(text + (i - 1)));
+        TSize d = _saisOrdValue(*(text + i));
+        assignValue(types, i - 1, c < d || (c == d && !_saisIsSeparator(c, TSeparators()) && getValue(types, i)));
+    }
+
+    // Stage 1: sort all LMS substrings by inducing from the unsorted LMS suffixes.
+    _saisGetBuckets(buckets, text, n, sigma, true);
+    arrayFill(sa, sa + n, EMPTY);
+    for (TSize i = 1; i < n; ++i)
+        if (_saisIsLms(types, i) && !_saisIsSeparator(*(text + i), TSeparators()))
+            sa[--buckets[_saisOrdValue(*(text + i))]] = i;
+    _saisPlaceSeparators(sa, text, n, TSeparators());
+
+    _saisInduceL(sa, text, types, buckets, n, sigma, TSeparators());
+    _saisInduceS(sa, text, types, buckets, n, sigma, TSeparators());
+
+    // Compact the sorted LMS substrings into the first n1 entries.
+    TSize n1 = 0;
+    for (TSize i = 0; i < n; ++i)
+        if (_saisIsLms(types, sa[i]))
+            sa[n1++] = sa[i];
+
+    // Name the LMS substrings, storing the name of position p at n1 + p / 2.
+    arrayFill(sa + n1, sa + n, EMPTY);
+    TSize name = 0;
+    TSize prev = EMPTY;
+    for (TSize i = 0; i < n1; ++i)
+    {
+        TSize pos = sa[i];
+        bool diff = false;
+        for (TSize d = 0; ; ++d)
+        {
+            if (prev == EMPTY || pos + d == n || prev + d == n ||
+                _saisOrdValue(*(text + (pos + d))) != _saisOrdValue(*(text + (prev + d))) ||
+                _saisIsSeparator(*(text + (pos + d)), TSeparators()) ||
+                getValue(types, pos + d) != getValue(types, prev + d))
+            {
+                diff = true;
+                break;
+            }
+            if (d > 0 && (_saisIsLms(types, pos + d) || _saisIsLms(types, prev + d)))
+                break;
+        }
+        if (diff)
+        {
+            ++name;
+            prev = pos;
+        }
+        sa[n1 + pos / 2] = name - 1;
+    }
+
+    // Move the reduced string to the last n1 entries.
+    for (TSize i = n, j = n; i > n1; --i)
+        if (sa[i - 1] != EMPTY)
+            sa[--j] = sa[i - 1];
+
+    TSAIter reduced = sa + (n - n1);
+
+    // Stage 2: sort the LMS suffixes by solving the reduced problem.
+    // The reduced problem uses the first and the last n1 entries.  Its buckets fit in between for most texts.
+    if (name < n1 && name <= n - 2 * n1)
+    {
+        _createSuffixArraySais(sa, reduced, sa + n1, n1, name, False());
+    }
+    else if (name < n1)
+    {
+        String<TSize> reducedBuckets;
+        resize(reducedBuckets, name, Exact());
+        _createSuffixArraySais(sa, reduced, begin(reducedBuckets, Standard()), n1, name, False());
+    }
+    else
+    {
+        for (TSize i = 0; i < n1; ++i)
+            sa[reduced[i]] = i;
+    }
+
+    // Stage 3: induce the whole suffix array from the sorted LMS suffixes.
+    for (TSize i = 1, j = 0; i < n; ++i)
+        if (_saisIsLms(types, i))
+            reduced[j++] = i;
+
+    for (TSize i = 0; i < n1; ++i)
+        sa[i] = reduced[sa[i]];
+    arrayFill(sa + n1, sa + n, EMPTY);
+
+    _saisGetBuckets(buckets, text, n, sigma, true);
+    for (TSize i = n1; i > 0; --i)
+    {
+        TSize j = sa[i - 1];
+        sa[i - 1] = EMPTY;
+        if (!_saisIsSeparator(*(text + j), TSeparators()))
+            sa[--buckets[_saisOrdValue(*(text + j))]] = j;
+    }
+    _saisPlaceSeparators(sa, text, n, TSeparators());
+
+    _saisInduceL(sa, text, types, buckets, n, sigma, TSeparators());
+    _saisInduceS(sa, text, types, buckets, n, sigma, TSeparators());
+}
+
+template <typename TSAIter, typename TTextIter, typename TSize, typename TSeparators>
+inline void _createSuffixArraySais(TSAIter sa, TTextIter text, TSize n, TSize sigma, TSeparators)
+{
+    String<TSize> buckets;
+    resize(buckets, sigma, Exact());
+    _createSuffixArraySais(sa, text, begin(buckets, Standard()), n, sigma, TSeparators());
+}
+
+// ----------------------------------------------------------------------------
+// Function _createSuffixArraySaisMulti()
+// ----------------------------------------------------------------------------
+// The strings are concatenated into a text over [0..sigma), where each string but the last is followed by the
+// separator 0.  Separators are smaller than all characters and ordered decreasingly, thus equal suffixes of
+// different strings are sorted by decreasing sequence number, as with all other suffix array algorithms.
+
+template <typename TChar, typename TSA, typename TString, typename TSSetSpec, typename TInt>
+void _createSuffixArraySaisMulti(TSA & sa, StringSet<TString, TSSetSpec> const & stringSet, TInt sigma, TChar)
+{
+    typedef typename Iterator<TString const, Standard>::Type    TStringIter;
+    typedef typename Iterator<String<TInt>, Standard>::Type     TIntIter;
+    typedef typename Value<TSA>::Type                           TSAValue;
+
+    TInt m = length(stringSet);
+    TInt n = lengthSum(stringSet) + m - 1;
+
+    String<TChar> text;
+    String<TInt> starts;
+    resize(text, n, Exact());
+    resize(starts, m, Exact());
+
+    for (TInt i = 0, p = 0; i < m; ++i)
+    {
+        starts[i] = p;
+        TStringIter itEnd = end(stringSet[i], Standard());
+        for (TStringIter it = begin(stringSet[i], Standard()); it != itEnd; ++it, ++p)
+            text[p] = static_cast<TChar>(_saisOrdValue(*it) + 1);
+        if (i + 1 < m)
+            text[p++] = 0;
+    }
+
+    String<TInt> intSA;
+    resize(intSA, n, Exact());
+    _createSuffixArraySais(begin(intSA, Standard()), begin(text, Standard()), n, sigma, True());
+
+    clear(text);
+    shrinkToFit(text);
+
+    // The m - 1 separator suffixes come first and are dropped.
+    TIntIter startsBegin = begin(starts, Standard());
+    TIntIter startsEnd = end(starts, Standard());
+    typename Iterator<TSA, Standard>::Type saIt = begin(sa, Standard());
+    for (TInt i = m - 1; i < n; ++i, ++saIt)
+    {
+        TInt seqNo = (std::upper_bound(startsBegin, startsEnd, intSA[i]) - startsBegin) - 1;
+        *saIt = TSAValue(seqNo, intSA[i] - starts[seqNo]);
+    }
+}
+
+// Uses the narrowest character type for the concatenation.
+template <typename TSA, typename TString, typename TSSetSpec, typename TInt>
+void _createSuffixArraySaisMulti(TSA & sa, StringSet<TString, TSSetSpec> const & stringSet, TInt)
+{
+    TInt sigma = _saisAlphabetSize(stringSet) + 1;
+
+    if (sigma <= 256u)
+        _createSuffixArraySaisMulti(sa, stringSet, sigma, static_cast<unsigned char>(0));
+    else if (sigma <= 65536u)
+        _createSuffixArraySaisMulti(sa, stringSet, sigma, static_cast<unsigned short>(0));
+    else
+        _createSuffixArraySaisMulti(sa, stringSet, sigma, sigma);
+}
+
+// ----------------------------------------------------------------------------
+// Function createSuffixArray()                                          [Sais]
+// ----------------------------------------------------------------------------
+
+template <typename TSA, typename TText>
+inline void _createSuffixArraySais(TSA & sa, TText const & text, True)
+{
+    typedef typename Value<TSA>::Type   TSize;
+
+    _createSuffixArraySais(begin(sa, Standard()), begin(text, Standard()),
+                           static_cast<TSize>(length(text)), static_cast<TSize>(_saisAlphabetSize(text)), False());
+}
+
+// Suffix arrays without fast random access, e.g. external strings, are built in memory and copied.
+template <typename TSA, typename TText>
+inline void _createSuffixArraySais(TSA & sa, TText const & text, False)
+{
+    String<typename Value<TSA>::Type> tempSA;
+    resize(tempSA, length(text), Exact());
+    _createSuffixArraySais(tempSA, text, True());
+    assign(sa, tempSA, Exact());
+}
+
+template <typename TSA, typename TText>
+inline void createSuffixArray(TSA & sa, TText const & text, Sais const &)
+{
+    _createSuffixArraySais(sa, text, typename AllowsFastRandomAccess<TSA>::Type());
+}
+
+template <typename TSA, typename TString, typename TSSetSpec>
+inline void createSuffixArray(TSA & sa, StringSet<TString, TSSetSpec> const & stringSet, Sais const &)
+{
+    typedef typename Size<StringSet<TString, TSSetSpec> >::Type TSize;
+
+    if (empty(stringSet))
+        return;
+
+    // Use 32 bit integers whenever the concatenation and the alphabet are small enough.
+    TSize m = length(stringSet);
+    if (lengthSum(stringSet) + m + _saisAlphabetSize(stringSet) < static_cast<TSize>(MaxValue<__uint32>::VALUE))
+        _createSuffixArraySaisMulti(sa, stringSet, __uint32());
+    else
+        _createSuffixArraySaisMulti(sa, stringSet, static_cast<__uint64>(0));
+}
+
+}
+
+#endif  // #ifndef SEQAN_HEADER_INDEX_SA_SAIS_H
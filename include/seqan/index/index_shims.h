@@ -628,6 +628,10 @@ namespace SEQAN_NAMESPACE_MAIN
  *
  * <tt>indexCreate</tt> calls the fibre corresponding <tt>createXXX(..)</tt> function (e.g. @link createSuffixArray
  * @endlink).
+ *
+ * Passing <tt>Parallel()</tt> as <tt>algoTag</tt> for the suffix array of an @link IndexEsa @endlink, the
+ * suffix array and LF table of an @link FMIndex @endlink, or the suffix array and directory of an @link IndexQGram
+ * @endlink constructs them with all available threads.
  */
     template <typename TText, typename TSpec, typename TSpecAlg>
     inline bool indexCreate(Index<TText, TSpec> &index, FibreSA, TSpecAlg const alg) {
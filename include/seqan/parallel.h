@@ -54,13 +54,14 @@
 
 #include <seqan/system/system_critical_section.h>   // Suspendable Queue
 #include <seqan/system/system_condition.h>          // Suspendable Queue
+#include <seqan/system/system_thread.h>             // Thread Pool
 
 // ----------------------------------------------------------------------------
 // STL
 // ----------------------------------------------------------------------------
 // Use MCSTL which is part of the GCC since version 4.3
 
-#if defined(_OPENMP) && defined(PLATFORM_GCC) && __GNUC__ >= 4 && __GNUC_MINOR__ >= 3
+#if defined(_OPENMP) && defined(PLATFORM_GCC) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 3))
 #include <parallel/algorithm>
 #include <parallel/numeric>
 #else
@@ -96,7 +97,9 @@
 #include <seqan/parallel/parallel_sequence.h>
 #include <seqan/parallel/parallel_queue.h>
 #include <seqan/parallel/parallel_queue_suspendable.h>
+#include <seqan/parallel/parallel_queue_lockfree.h>
 #include <seqan/parallel/parallel_resource_pool.h>
 #include <seqan/parallel/parallel_serializer.h>
+#include <seqan/parallel/parallel_thread_pool.h>
 
 #endif  // SEQAN_PARALLEL_H_
@@ -39,6 +39,45 @@
 
 namespace seqan {
 
+// ============================================================================
+// Classes
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Class RadixSortTraits_
+// ----------------------------------------------------------------------------
+// Splits a key into bytes, the least significant one first.  Signed integers get their sign bit flipped, pairs are
+// ordered lexicographically.
+
+template <typename TValue>
+struct RadixSortTraits_
+{
+    typedef typename MakeUnsigned<TValue>::Type TUnsigned;
+
+    static const unsigned DIGITS = sizeof(TValue);
+
+    static unsigned digit(TValue const & val, unsigned d)
+    {
+        TUnsigned key = static_cast<TUnsigned>(val);
+        if ((TValue)-1 < (TValue)0)
+            key ^= (TUnsigned)1 << (BitsPerValue<TUnsigned>::VALUE - 1);
+        return static_cast<unsigned>(key >> (8 * d)) & 0xff;
+    }
+};
+
+template <typename T1, typename T2, typename TSpec>
+struct RadixSortTraits_<Pair<T1, T2, TSpec> >
+{
+    static const unsigned DIGITS = RadixSortTraits_<T1>::DIGITS + RadixSortTraits_<T2>::DIGITS;
+
+    static unsigned digit(Pair<T1, T2, TSpec> const & val, unsigned d)
+    {
+        if (d < RadixSortTraits_<T2>::DIGITS)
+            return RadixSortTraits_<T2>::digit(getValueI2(val), d);
+        return RadixSortTraits_<T1>::digit(getValueI1(val), d - RadixSortTraits_<T2>::DIGITS);
+    }
+};
+
 // ============================================================================
 // Functions
 // ============================================================================
@@ -427,6 +466,169 @@ minElement(TContainer const & c, Tag<TParallelTag> const & /* tag */)
     return value(std::min_element(begin(c, Standard()), end(c, Standard())));
 }
 
+// ----------------------------------------------------------------------------
+// Function _sortSerial()
+// ----------------------------------------------------------------------------
+
+template <typename TIterator, typename TBinaryPredicate>
+inline void _sortSerial(TIterator first, TIterator last, TBinaryPredicate p, False)
+{
+    std::sort(first, last, p);
+}
+
+template <typename TIterator, typename TBinaryPredicate>
+inline void _sortSerial(TIterator first, TIterator last, TBinaryPredicate p, True)
+{
+    std::stable_sort(first, last, p);
+}
+
+// ----------------------------------------------------------------------------
+// Function _mergePathSplit()
+// ----------------------------------------------------------------------------
+// Returns the number of elements taken from the first sequence among the first diag elements of the stable merge.
+
+template <typename TIterator, typename TSize, typename TBinaryPredicate>
+inline TSize
+_mergePathSplit(TIterator itA, TSize lenA, TIterator itB, TSize lenB, TSize diag, TBinaryPredicate p)
+{
+    TSize lo = (diag > lenB) ? diag - lenB : 0;
+    TSize hi = _min(diag, lenA);
+    while (lo < hi)
+    {
+        TSize mid = lo + (hi - lo) / 2;
+        // on ties, elements of the first sequence come first
+        if (!p(*(itB + (diag - mid - 1)), *(itA + mid)))
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+// ----------------------------------------------------------------------------
+// Function _mergeParallel()
+// ----------------------------------------------------------------------------
+// Stably merges two sorted sequences into target.  Every thread writes an equally sized part of the output and
+// finds the corresponding input positions by a binary search.
+
+template <typename TTargetIter, typename TSourceIter, typename TBinaryPredicate>
+inline void
+_mergeParallel(TTargetIter target,
+               TSourceIter itA, TSourceIter itAEnd,
+               TSourceIter itB, TSourceIter itBEnd,
+               TBinaryPredicate p)
+{
+    typedef typename Difference<TSourceIter>::Type TSize;
+
+    TSize lenA = itAEnd - itA;
+    TSize lenB = itBEnd - itB;
+    Splitter<TSize> splitter(0, lenA + lenB, Parallel());
+
+    SEQAN_OMP_PRAGMA(parallel for)
+    for (int job = 0; job < (int)length(splitter); ++job)
+    {
+        TSize diagBegin = splitter[job];
+        TSize diagEnd = splitter[job + 1];
+        TSize aBegin = _mergePathSplit(itA, lenA, itB, lenB, diagBegin, p);
+        TSize aEnd = _mergePathSplit(itA, lenA, itB, lenB, diagEnd, p);
+        std::merge(itA + aBegin, itA + aEnd,
+                   itB + (diagBegin - aBegin), itB + (diagEnd - aEnd),
+                   target + diagBegin, p);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _sortParallel()
+// ----------------------------------------------------------------------------
+// Sorts one subinterval per thread and merges pairs of sorted runs until one is left.  The runs are merged
+// alternately from the sequence into a buffer and back.
+
+template <typename TIterator, typename TBinaryPredicate, typename TStable>
+inline void
+_sortParallel(TIterator first, TIterator last, TBinaryPredicate p, TStable)
+{
+    typedef typename Value<TIterator>::Type                 TValue;
+    typedef typename Difference<TIterator>::Type            TSize;
+    typedef String<TValue>                                  TBuffer;
+    typedef typename Iterator<TBuffer, Standard>::Type      TBufferIter;
+
+    Splitter<TSize> splitter(0, last - first, Parallel());
+
+    // STEP 1: sort subintervals (in parallel)
+    //
+    SEQAN_OMP_PRAGMA(parallel for)
+    for (int job = 0; job < (int)length(splitter); ++job)
+        _sortSerial(first + splitter[job], first + splitter[job + 1], p, TStable());
+
+    if (length(splitter) < 2u)
+        return;
+
+    // STEP 2: merge pairs of adjacent runs (each merge in parallel)
+    //
+    String<TSize> runs, mergedRuns;
+    for (unsigned job = 0; job <= length(splitter); ++job)
+        appendValue(runs, splitter[job]);
+
+    TBuffer buffer;
+    resize(buffer, last - first, Exact());
+    TBufferIter bufferBegin = begin(buffer, Standard());
+    bool inBuffer = false;
+
+    while (length(runs) > 2u)
+    {
+        clear(mergedRuns);
+        for (unsigned i = 0; i + 1 < length(runs); i += 2)
+        {
+            TSize runBegin = runs[i];
+            TSize runMid = runs[i + 1];
+            TSize runEnd = (i + 2 < length(runs)) ? runs[i + 2] : runMid;
+            if (inBuffer)
+                _mergeParallel(first + runBegin,
+                               bufferBegin + runBegin, bufferBegin + runMid,
+                               bufferBegin + runMid, bufferBegin + runEnd, p);
+            else
+                _mergeParallel(bufferBegin + runBegin,
+                               first + runBegin, first + runMid,
+                               first + runMid, first + runEnd, p);
+            appendValue(mergedRuns, runBegin);
+        }
+        appendValue(mergedRuns, back(runs));
+        swap(runs, mergedRuns);
+        inBuffer = !inBuffer;
+    }
+
+    // STEP 3: move the result back (in parallel)
+    //
+    if (inBuffer)
+    {
+        SEQAN_OMP_PRAGMA(parallel for)
+        for (int job = 0; job < (int)length(splitter); ++job)
+            std::copy(bufferBegin + splitter[job], bufferBegin + splitter[job + 1], first + splitter[job]);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _sortParallelSequence()
+// ----------------------------------------------------------------------------
+// Threads write disjoint ranges of values, but neighbouring values of a non-contiguous sequence, e.g. a packed
+// string, may share a host word.  Such sequences are sorted in a contiguous copy.
+
+template <typename TSequence, typename TBinaryPredicate, typename TStable>
+inline void _sortParallelSequence(TSequence & seq, TBinaryPredicate p, TStable, True /* contiguous */)
+{
+    _sortParallel(begin(seq, Standard()), end(seq, Standard()), p, TStable());
+}
+
+template <typename TSequence, typename TBinaryPredicate, typename TStable>
+inline void _sortParallelSequence(TSequence & seq, TBinaryPredicate p, TStable, False /* contiguous */)
+{
+    String<typename Value<TSequence>::Type> buffer;
+    resize(buffer, length(seq), Exact());
+    std::copy(begin(seq, Standard()), end(seq, Standard()), begin(buffer, Standard()));
+    _sortParallel(begin(buffer, Standard()), end(buffer, Standard()), p, TStable());
+    std::copy(begin(buffer, Standard()), end(buffer, Standard()), begin(seq, Standard()));
+}
+
 // ----------------------------------------------------------------------------
 // Function sort()
 // ----------------------------------------------------------------------------
@@ -443,6 +645,25 @@ inline void sort(TContainer SEQAN_FORWARD_ARG c, Tag<TParallelTag> const & /* ta
     return std::sort(begin(c, Standard()), end(c, Standard()));
 }
 
+// ----------------------------------------------------------------------------
+// Function sort(Parallel)
+// ----------------------------------------------------------------------------
+
+template <typename TContainer, typename TBinaryPredicate>
+inline void sort(TContainer SEQAN_FORWARD_ARG c, TBinaryPredicate p, Parallel)
+{
+    typedef typename RemoveReference<TContainer>::Type TSequence;
+    _sortParallelSequence(c, p, False(), typename IsContiguous<TSequence>::Type());
+}
+
+template <typename TContainer>
+inline void sort(TContainer SEQAN_FORWARD_ARG c, Parallel)
+{
+    typedef typename RemoveReference<TContainer>::Type TSequence;
+    typedef typename Value<TSequence>::Type TValue;
+    _sortParallelSequence(c, std::less<TValue>(), False(), typename IsContiguous<TSequence>::Type());
+}
+
 // ----------------------------------------------------------------------------
 // Function stableSort()
 // ----------------------------------------------------------------------------
@@ -459,12 +680,242 @@ inline void stableSort(TContainer SEQAN_FORWARD_ARG c, Tag<TParallelTag> const &
     return std::stable_sort(begin(c, Standard()), end(c, Standard()));
 }
 
+// ----------------------------------------------------------------------------
+// Function stableSort(Parallel)
+// ----------------------------------------------------------------------------
+
+template <typename TContainer, typename TBinaryPredicate>
+inline void stableSort(TContainer SEQAN_FORWARD_ARG c, TBinaryPredicate p, Parallel)
+{
+    typedef typename RemoveReference<TContainer>::Type TSequence;
+    _sortParallelSequence(c, p, True(), typename IsContiguous<TSequence>::Type());
+}
+
+template <typename TContainer>
+inline void stableSort(TContainer SEQAN_FORWARD_ARG c, Parallel)
+{
+    typedef typename RemoveReference<TContainer>::Type TSequence;
+    typedef typename Value<TSequence>::Type TValue;
+    _sortParallelSequence(c, std::less<TValue>(), True(), typename IsContiguous<TSequence>::Type());
+}
+
+// ----------------------------------------------------------------------------
+// Function _radixSortPass()
+// ----------------------------------------------------------------------------
+// Scatters the elements of source stably into target by their d-th byte.  Each subinterval of the splitter is
+// counted and scattered by one thread.  Returns false, and leaves target untouched, if all elements have the same
+// byte.
+
+template <typename TTargetIter, typename TSourceIter, typename TSize, typename TCounts>
+inline bool
+_radixSortPass(TTargetIter target, TSourceIter source, Splitter<TSize> const & splitter, TCounts & counts, unsigned d)
+{
+    typedef typename Value<TSourceIter>::Type   TValue;
+    typedef RadixSortTraits_<TValue>            TTraits;
+    typedef typename Value<TCounts>::Type       TCount;
+
+    int numJobs = length(splitter);
+
+    // STEP 1: count bytes of each subinterval (in parallel)
+    //
+    arrayFill(begin(counts, Standard()), end(counts, Standard()), 0);
+    SEQAN_OMP_PRAGMA(parallel for)
+    for (int job = 0; job < numJobs; ++job)
+    {
+        TCount * jobCounts = begin(counts, Standard()) + 256 * job;
+        TSourceIter it = source + splitter[job];
+        TSourceIter itEnd = source + splitter[job + 1];
+        for (; it != itEnd; ++it)
+            ++jobCounts[TTraits::digit(*it, d)];
+    }
+
+    // STEP 2: compute target offsets for each byte and subinterval (sequentially)
+    //
+    TCount sum = 0;
+    for (unsigned c = 0; c < 256; ++c)
+    {
+        TCount total = 0;
+        for (int job = 0; job < numJobs; ++job)
+        {
+            TCount cnt = counts[256 * job + c];
+            counts[256 * job + c] = sum + total;
+            total += cnt;
+        }
+        if (total == (TCount)(splitter[numJobs] - splitter[0]))
+            return false;
+        sum += total;
+    }
+
+    // STEP 3: scatter (in parallel)
+    //
+    SEQAN_OMP_PRAGMA(parallel for)
+    for (int job = 0; job < numJobs; ++job)
+    {
+        TCount * jobCounts = begin(counts, Standard()) + 256 * job;
+        TSourceIter it = source + splitter[job];
+        TSourceIter itEnd = source + splitter[job + 1];
+        for (; it != itEnd; ++it)
+        {
+            TValue val = *it;
+            *(target + jobCounts[TTraits::digit(val, d)]++) = val;
+        }
+    }
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Function _radixSort()
+// ----------------------------------------------------------------------------
+// Non-contiguous sequences are sorted in a contiguous copy, see _sortParallelSequence().
+
+template <typename TSequence, typename TParallelTag>
+inline void _radixSort(TSequence & c, Tag<TParallelTag> parallelTag, True /* contiguous */)
+{
+    typedef typename Value<TSequence>::Type                     TValue;
+    typedef typename Size<TSequence>::Type                      TSize;
+    typedef String<TValue>                                      TBuffer;
+    typedef typename Iterator<TSequence, Standard>::Type        TIter;
+    typedef typename Iterator<TBuffer, Standard>::Type          TBufferIter;
+
+    if (length(c) < 2u)
+        return;
+
+    Splitter<TSize> splitter(0, length(c), parallelTag);
+    String<TSize> counts;
+    resize(counts, 256 * length(splitter), Exact());
+
+    TBuffer buffer;
+    resize(buffer, length(c), Exact());
+
+    TIter first = begin(c, Standard());
+    TBufferIter bufferBegin = begin(buffer, Standard());
+    bool inBuffer = false;
+
+    for (unsigned d = 0; d < RadixSortTraits_<TValue>::DIGITS; ++d)
+    {
+        bool moved;
+        if (inBuffer)
+            moved = _radixSortPass(first, bufferBegin, splitter, counts, d);
+        else
+            moved = _radixSortPass(bufferBegin, first, splitter, counts, d);
+        if (moved)
+            inBuffer = !inBuffer;
+    }
+
+    if (inBuffer)
+    {
+        SEQAN_OMP_PRAGMA(parallel for)
+        for (int job = 0; job < (int)length(splitter); ++job)
+            std::copy(bufferBegin + splitter[job], bufferBegin + splitter[job + 1], first + splitter[job]);
+    }
+}
+
+template <typename TSequence, typename TParallelTag>
+inline void _radixSort(TSequence & c, Tag<TParallelTag> parallelTag, False /* contiguous */)
+{
+    String<typename Value<TSequence>::Type> buffer;
+    resize(buffer, length(c), Exact());
+    std::copy(begin(c, Standard()), end(c, Standard()), begin(buffer, Standard()));
+    _radixSort(buffer, parallelTag, True());
+    std::copy(begin(buffer, Standard()), end(buffer, Standard()), begin(c, Standard()));
+}
+
+// A single thread may scatter into any sequence.
+template <typename TSequence>
+inline void _radixSort(TSequence & c, Serial parallelTag, False /* contiguous */)
+{
+    _radixSort(c, parallelTag, True());
+}
+
+// ----------------------------------------------------------------------------
+// Function radixSort()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn radixSort
+ * @headerfile <seqan/parallel.h>
+ * @brief Sorts a sequence of integers or pairs of integers with an LSD radix sort.
+ *
+ * @signature void radixSort(seq[, parallelTag]);
+ *
+ * @param[in,out] seq         The sequence to sort, e.g. a @link String @endlink, @link Segment @endlink or packed
+ *                            string.  Its values must be integers or @link Pair @endlink objects of integers, which
+ *                            are sorted lexicographically.  If <tt>seq</tt> is a @link StringSet @endlink, each of its
+ *                            strings is sorted on its own.
+ * @param[in]     parallelTag Tag to enable/disable parallelism, one of <tt>Serial</tt>, <tt>Parallel</tt>, default is
+ *                            <tt>Serial</tt>.
+ *
+ * The sort is stable and needs a buffer of the size of <tt>seq</tt>.  Bytes that are equal in all values are skipped.
+ * Non-contiguous sequences, e.g. packed strings, need a second buffer.
+ *
+ * @see sort
+ */
+
+template <typename TContainer, typename TParallelTag>
+inline void radixSort(TContainer SEQAN_FORWARD_ARG c, Tag<TParallelTag> parallelTag)
+{
+    typedef typename RemoveReference<TContainer>::Type TSequence;
+    _radixSort(c, parallelTag, typename IsContiguous<TSequence>::Type());
+}
+
+template <typename TContainer>
+inline void radixSort(TContainer SEQAN_FORWARD_ARG c)
+{
+    radixSort(c, Serial());
+}
+
+// ----------------------------------------------------------------------------
+// Function radixSort(StringSet)
+// ----------------------------------------------------------------------------
+// With at least as many strings as threads, each thread sorts whole strings.  Otherwise all threads sort one string
+// after another.  Strings that are not contiguous may share host words with their neighbours, e.g. the infixes of a
+// packed concatenation, so they are never written by different threads.
+
+template <typename TString, typename TSpec, typename TParallelTag>
+inline void radixSort(StringSet<TString, TSpec> & set, Tag<TParallelTag> parallelTag)
+{
+    typedef StringSet<TString, TSpec>                   TStringSet;
+    typedef typename Reference<TStringSet>::Type        TStringRef;
+    typedef typename Size<TStringSet>::Type             TSetSize;
+
+    for (TSetSize i = 0; i < length(set); ++i)
+    {
+        TStringRef str = value(set, i);
+        radixSort(str, parallelTag);
+    }
+}
+
+template <typename TString, typename TSpec>
+inline void radixSort(StringSet<TString, TSpec> & set, Parallel parallelTag)
+{
+    typedef StringSet<TString, TSpec>                   TStringSet;
+    typedef typename Reference<TStringSet>::Type        TStringRef;
+    typedef typename Size<TStringSet>::Type             TSetSize;
+
+    if (!IsContiguous<TString>::VALUE || length(set) < (TSetSize)omp_get_max_threads())
+    {
+        for (TSetSize i = 0; i < length(set); ++i)
+        {
+            TStringRef str = value(set, i);
+            radixSort(str, parallelTag);
+        }
+        return;
+    }
+
+    SEQAN_OMP_PRAGMA(parallel for schedule(dynamic))
+    for (int i = 0; i < (int)length(set); ++i)
+    {
+        TStringRef str = value(set, i);
+        radixSort(str, Serial());
+    }
+}
+
 // ============================================================================
 // MCSTL Wrappers
 // ============================================================================
 
 // use MCSTL which is part of the GCC since version 4.3
-#if defined(_OPENMP) && defined(PLATFORM_GCC) && __GNUC__ >= 4 && __GNUC_MINOR__ >= 3
+#if defined(_OPENMP) && defined(PLATFORM_GCC) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 3))
 
 // ----------------------------------------------------------------------------
 // Function forEach(Parallel)
@@ -611,38 +1062,6 @@ minElement(TContainer const & c, Parallel)
     return value(__gnu_parallel::min_element(begin(c, Standard()), end(c, Standard())));
 }
 
-// ----------------------------------------------------------------------------
-// Function sort(Parallel)
-// ----------------------------------------------------------------------------
-
-template <typename TContainer, typename TBinaryPredicate>
-inline void sort(TContainer SEQAN_FORWARD_ARG c, TBinaryPredicate p, Parallel)
-{
-    return __gnu_parallel::sort(begin(c, Standard()), end(c, Standard()), p);
-}
-
-template <typename TContainer>
-inline void sort(TContainer SEQAN_FORWARD_ARG c, Parallel)
-{
-    return __gnu_parallel::sort(begin(c, Standard()), end(c, Standard()));
-}
-
-// ----------------------------------------------------------------------------
-// Function stableSort(Parallel)
-// ----------------------------------------------------------------------------
-
-template <typename TContainer, typename TBinaryPredicate>
-inline void stableSort(TContainer SEQAN_FORWARD_ARG c, TBinaryPredicate p, Parallel)
-{
-    return __gnu_parallel::stable_sort(begin(c, Standard()), end(c, Standard()), p);
-}
-
-template <typename TContainer>
-inline void stableSort(TContainer SEQAN_FORWARD_ARG c, Parallel)
-{
-    return __gnu_parallel::stable_sort(begin(c, Standard()), end(c, Standard()));
-}
-
 #endif  // #ifdef PLATFORM_GCC
 
 // ============================================================================
@@ -455,6 +455,10 @@ template <typename T>   inline T atomicCas(std::atomic<T>        & x, T cmp, T y
 template <typename T>   inline T atomicCas(std::atomic<T>        & x, T cmp, T y, Parallel) { x.compare_exchange_weak(cmp, y); return cmp; }
 template <typename T>   inline bool atomicCasBool(std::atomic<T> & x, T    , T y, Serial)   { x = y; return true;                          }
 template <typename T>   inline bool atomicCasBool(std::atomic<T> & x, T cmp, T y, Parallel) { return x.compare_exchange_weak(cmp, y);      }
+
+template <typename T1, typename T2>   inline T1 atomicAdd(std::atomic<T1> & x, T2 y)            { return x += y; }
+template <typename T1, typename T2>   inline T1 atomicAdd(std::atomic<T1> & x, T2 y, Serial)    { return x += y; }
+template <typename T1, typename T2>   inline T1 atomicAdd(std::atomic<T1> & x, T2 y, Parallel)  { return x += y; }
 #endif  // #ifdef SEQAN_CXX11_STL
 
 } // namespace seqan
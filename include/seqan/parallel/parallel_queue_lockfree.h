@@ -0,0 +1,470 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2015, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: SeqAn Team <seqan-dev@lists.fu-berlin.de>
+// ==========================================================================
+// ==========================================================================
+// Bounded lock-free queue for multiple producers and consumers.  Every slot
+// of the ring buffer carries a sequence number that tells producers and
+// consumers whether it is free or occupied in the current round, so both
+// ends only synchronize on a single compare-and-swap.  Like the suspendable
+// queue, callers are suspended if the queue is empty or full.
+// ==========================================================================
+
+#ifndef SEQAN_PARALLEL_PARALLEL_QUEUE_LOCKFREE_H_
+#define SEQAN_PARALLEL_PARALLEL_QUEUE_LOCKFREE_H_
+
+namespace seqan {
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Tag LockFree
+// ----------------------------------------------------------------------------
+
+struct LockFree_;
+typedef Tag<LockFree_> LockFree;
+
+// ----------------------------------------------------------------------------
+// Class ConcurrentQueueCell_
+// ----------------------------------------------------------------------------
+// A ring buffer slot padded to a multiple of the cache line size to avoid false sharing.
+
+template <typename TValue>
+struct ConcurrentQueueCell_
+{
+    typedef typename Atomic<size_t>::Type TAtomicSize;
+
+    TAtomicSize seq;
+    TValue      value;
+    char        pad[SEQAN_CACHE_LINE_SIZE - (sizeof(TAtomicSize) + sizeof(TValue)) % SEQAN_CACHE_LINE_SIZE];
+};
+
+// ----------------------------------------------------------------------------
+// Class ConcurrentQueue
+// ----------------------------------------------------------------------------
+
+/*!
+ * @class ConcurrentLockFreeQueue Concurrent Lock-Free Queue
+ * @extends ConcurrentQueue
+ * @headerfile <seqan/parallel.h>
+ * @brief Bounded lock-free queue for multiple producers and multiple consumers.
+ *
+ * @signature template <typename TValue>
+ *            class ConcurrentQueue<TValue, Suspendable<LockFree> >;
+ *
+ * @tparam TValue Element type of the queue.
+ *
+ * The queue has the same interface as the @link ConcurrentSuspendableQueue @endlink with a fixed size, i.e.
+ * <tt>ConcurrentQueue&lt;TValue, Suspendable&lt;Limit&gt; &gt;</tt>.  Instead of a mutex, producers and consumers
+ * claim slots of a ring buffer with a compare-and-swap on a single counter.  A thread is suspended only if it pops
+ * from an empty queue or appends to a full queue.
+ *
+ * The capacity is given to the constructor and never changes.
+ */
+
+template <typename TValue>
+class ConcurrentQueue<TValue, Suspendable<LockFree> >
+{
+public:
+    typedef ConcurrentQueueCell_<TValue>            TCell;
+    typedef typename Host<ConcurrentQueue>::Type    TString;
+    typedef typename Size<TString>::Type            TSize;
+    typedef typename Atomic<TSize>::Type            TAtomicSize;
+    typedef typename Atomic<unsigned>::Type         TAtomicCount;
+
+    TCell           *cells;
+    TSize           cap;
+
+    TAtomicSize     headPos;                char pad1[SEQAN_CACHE_LINE_SIZE - sizeof(TAtomicSize)];
+    TAtomicSize     tailPos;                char pad2[SEQAN_CACHE_LINE_SIZE - sizeof(TAtomicSize)];
+
+    size_t          readerCount;
+    size_t          writerCount;
+    TAtomicCount    waitingReaders;
+    TAtomicCount    waitingWriters;
+
+    CriticalSection cs;
+    Condition       more;
+    Condition       less;
+
+    explicit
+    ConcurrentQueue(TSize maxSize) :
+        cells(new TCell[maxSize]),
+        cap(maxSize),
+        headPos(0),
+        tailPos(0),
+        readerCount(0),
+        writerCount(0),
+        waitingReaders(0),
+        waitingWriters(0),
+        more(cs),
+        less(cs)
+    {
+        SEQAN_ASSERT_GT(maxSize, 0u);
+        for (TSize i = 0; i < cap; ++i)
+            cells[i].seq = i;
+    }
+
+    ~ConcurrentQueue()
+    {
+        SEQAN_ASSERT_EQ(writerCount, 0u);
+
+        // wait for all pending readers to finish
+        while (readerCount != 0u)
+        {}
+
+        delete[] cells;
+    }
+
+private:
+    ConcurrentQueue(ConcurrentQueue const &);
+    void operator=(ConcurrentQueue const &);
+};
+
+template <typename TValue>
+struct DefaultOverflowImplicit<ConcurrentQueue<TValue, Suspendable<LockFree> > >
+{
+    typedef Limit Type;
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _wakeUp()
+// ----------------------------------------------------------------------------
+// Waiting threads increment their counter before they check the queue for the last time, and producers/consumers
+// check the counter after they modified the queue.  As both are full barriers, no wake-up is lost.
+
+template <typename TValue>
+inline void
+_wakeUp(ConcurrentQueue<TValue, Suspendable<LockFree> > & me, Condition & cond,
+        typename Atomic<unsigned>::Type & waiting)
+{
+    if (waiting != 0u)
+    {
+        ScopedLock<CriticalSection> lock(me.cs);
+        signal(cond);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function lockReading() / unlockReading()
+// ----------------------------------------------------------------------------
+
+template <typename TValue>
+inline void
+lockReading(ConcurrentQueue<TValue, Suspendable<LockFree> > &)
+{}
+
+template <typename TValue>
+inline void
+unlockReading(ConcurrentQueue<TValue, Suspendable<LockFree> > & me)
+{
+    if (atomicDec(me.readerCount) == 0u)
+    {
+        ScopedLock<CriticalSection> lock(me.cs);
+        signal(me.less);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function lockWriting() / unlockWriting()
+// ----------------------------------------------------------------------------
+
+template <typename TValue>
+inline void
+lockWriting(ConcurrentQueue<TValue, Suspendable<LockFree> > &)
+{}
+
+template <typename TValue>
+inline void
+unlockWriting(ConcurrentQueue<TValue, Suspendable<LockFree> > & me)
+{
+    if (atomicDec(me.writerCount) == 0u)
+    {
+        ScopedLock<CriticalSection> lock(me.cs);
+        signal(me.more);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function setReaderCount() / setWriterCount() / setReaderWriterCount()
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TSize>
+inline void
+setReaderCount(ConcurrentQueue<TValue, Suspendable<LockFree> > & me, TSize readerCount)
+{
+    ScopedLock<CriticalSection> lock(me.cs);
+    me.readerCount = readerCount;
+}
+
+template <typename TValue, typename TSize>
+inline void
+setWriterCount(ConcurrentQueue<TValue, Suspendable<LockFree> > & me, TSize writerCount)
+{
+    ScopedLock<CriticalSection> lock(me.cs);
+    me.writerCount = writerCount;
+}
+
+template <typename TValue, typename TSize1, typename TSize2>
+inline void
+setReaderWriterCount(ConcurrentQueue<TValue, Suspendable<LockFree> > & me, TSize1 readerCount, TSize2 writerCount)
+{
+    ScopedLock<CriticalSection> lock(me.cs);
+    me.readerCount = readerCount;
+    me.writerCount = writerCount;
+}
+
+// ----------------------------------------------------------------------------
+// Function empty() / length() / capacity()
+// ----------------------------------------------------------------------------
+
+template <typename TValue>
+inline bool
+empty(ConcurrentQueue<TValue, Suspendable<LockFree> > const & me)
+{
+    return me.headPos == me.tailPos;
+}
+
+template <typename TValue>
+inline typename Size<ConcurrentQueue<TValue, Suspendable<LockFree> > >::Type
+length(ConcurrentQueue<TValue, Suspendable<LockFree> > const & me)
+{
+    typedef typename Size<ConcurrentQueue<TValue, Suspendable<LockFree> > >::Type TSize;
+
+    // read the head first, so the difference cannot underflow
+    TSize headPos = me.headPos;
+    TSize tailPos = me.tailPos;
+    return tailPos - headPos;
+}
+
+template <typename TValue>
+inline typename Size<ConcurrentQueue<TValue, Suspendable<LockFree> > >::Type
+capacity(ConcurrentQueue<TValue, Suspendable<LockFree> > const & me)
+{
+    return me.cap;
+}
+
+// ----------------------------------------------------------------------------
+// Function waitForMinSize()
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TSize>
+inline bool
+waitForMinSize(ConcurrentQueue<TValue, Suspendable<LockFree> > & me, TSize minSize)
+{
+    if (length(me) >= minSize)
+        return true;
+
+    ScopedLock<CriticalSection> lock(me.cs);
+    atomicInc(me.waitingReaders);
+    while (length(me) < minSize && me.writerCount > 0u)
+        waitFor(me.more);
+    atomicDec(me.waitingReaders);
+    return length(me) >= minSize;
+}
+
+// ----------------------------------------------------------------------------
+// Function _tryPopFront()
+// ----------------------------------------------------------------------------
+
+template <typename TValue>
+inline bool
+_tryPopFront(TValue & result, ConcurrentQueue<TValue, Suspendable<LockFree> > & me)
+{
+    typedef ConcurrentQueue<TValue, Suspendable<LockFree> > TQueue;
+    typedef typename TQueue::TCell                          TCell;
+    typedef typename TQueue::TSize                          TSize;
+    typedef typename MakeSigned<TSize>::Type                TSignedSize;
+
+    TSize pos = me.headPos;
+    TCell * cell;
+    while (true)
+    {
+        cell = &me.cells[pos % me.cap];
+        TSignedSize diff = (TSignedSize)(cell->seq - (pos + 1));
+
+        if (diff == 0)
+        {
+            // the slot was filled in this round, try to claim it
+            if (atomicCasBool(me.headPos, pos, (TSize)(pos + 1), Parallel()))
+                break;
+        }
+        else if (diff < 0)
+        {
+            // the slot is not filled yet, i.e. the queue is empty
+            return false;
+        }
+        pos = me.headPos;
+    }
+
+    std::swap(result, cell->value);
+
+    // release the slot for the next round of producers
+    atomicAdd(cell->seq, me.cap - 1);
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Function tryPopFront()
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TParallel>
+inline bool
+tryPopFront(TValue & result, ConcurrentQueue<TValue, Suspendable<LockFree> > & me, Tag<TParallel>)
+{
+    if (!_tryPopFront(result, me))
+        return false;
+    _wakeUp(me, me.less, me.waitingWriters);
+    return true;
+}
+
+template <typename TValue>
+inline bool
+tryPopFront(TValue & result, ConcurrentQueue<TValue, Suspendable<LockFree> > & me)
+{
+    return tryPopFront(result, me, Parallel());
+}
+
+// ----------------------------------------------------------------------------
+// Function popFront()
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TParallel>
+inline bool
+popFront(TValue & result, ConcurrentQueue<TValue, Suspendable<LockFree> > & me, Tag<TParallel> parallelTag)
+{
+    if (tryPopFront(result, me, parallelTag))
+        return true;
+
+    ScopedLock<CriticalSection> lock(me.cs);
+    atomicInc(me.waitingReaders);
+    bool success;
+    while (!(success = _tryPopFront(result, me)) && me.writerCount > 0u)
+        waitFor(me.more);
+    atomicDec(me.waitingReaders);
+    if (success && me.waitingWriters != 0u)
+        signal(me.less);
+    return success;
+}
+
+template <typename TValue>
+inline bool
+popFront(TValue & result, ConcurrentQueue<TValue, Suspendable<LockFree> > & me)
+{
+    return popFront(result, me, Parallel());
+}
+
+// ----------------------------------------------------------------------------
+// Function _tryAppendValue()
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TValue2>
+inline bool
+_tryAppendValue(ConcurrentQueue<TValue, Suspendable<LockFree> > & me, TValue2 SEQAN_FORWARD_CARG val)
+{
+    typedef ConcurrentQueue<TValue, Suspendable<LockFree> > TQueue;
+    typedef typename TQueue::TCell                          TCell;
+    typedef typename TQueue::TSize                          TSize;
+    typedef typename MakeSigned<TSize>::Type                TSignedSize;
+
+    TSize pos = me.tailPos;
+    TCell * cell;
+    while (true)
+    {
+        cell = &me.cells[pos % me.cap];
+        TSignedSize diff = (TSignedSize)(cell->seq - pos);
+
+        if (diff == 0)
+        {
+            // the slot was emptied in the previous round, try to claim it
+            if (atomicCasBool(me.tailPos, pos, (TSize)(pos + 1), Parallel()))
+                break;
+        }
+        else if (diff < 0)
+        {
+            // the slot is still occupied, i.e. the queue is full
+            return false;
+        }
+        pos = me.tailPos;
+    }
+
+    cell->value = SEQAN_FORWARD(TValue2, val);
+
+    // publish the value to the consumers
+    atomicInc(cell->seq);
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Function appendValue()
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TValue2, typename TExpand>
+inline bool
+appendValue(ConcurrentQueue<TValue, Suspendable<LockFree> > & me,
+            TValue2 SEQAN_FORWARD_CARG val,
+            Tag<TExpand>)
+{
+    if (_tryAppendValue(me, SEQAN_FORWARD(TValue2, val)))
+    {
+        _wakeUp(me, me.more, me.waitingReaders);
+        return true;
+    }
+
+    ScopedLock<CriticalSection> lock(me.cs);
+    atomicInc(me.waitingWriters);
+    bool success;
+    while (!(success = _tryAppendValue(me, SEQAN_FORWARD(TValue2, val))) && me.readerCount > 0u)
+        waitFor(me.less);
+    atomicDec(me.waitingWriters);
+    if (success && me.waitingReaders != 0u)
+        signal(me.more);
+    return success;
+}
+
+template <typename TValue, typename TValue2>
+inline bool
+appendValue(ConcurrentQueue<TValue, Suspendable<LockFree> > & me,
+            TValue2 SEQAN_FORWARD_CARG val)
+{
+    return appendValue(me, SEQAN_FORWARD(TValue2, val), Limit());
+}
+
+}  // namespace seqan
+
+#endif  // #ifndef SEQAN_PARALLEL_PARALLEL_QUEUE_LOCKFREE_H_
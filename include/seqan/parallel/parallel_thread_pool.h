@@ -0,0 +1,690 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2015, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: SeqAn Team <seqan-dev@lists.fu-berlin.de>
+// ==========================================================================
+// Work-stealing thread pool.  Every worker owns a task deque, it pushes and
+// pops tasks at the back and idle workers steal from the front of the
+// others.  Threads waiting for a task group execute pending tasks instead
+// of blocking, which makes nested parallelism safe.
+// ==========================================================================
+
+#ifndef SEQAN_PARALLEL_PARALLEL_THREAD_POOL_H_
+#define SEQAN_PARALLEL_PARALLEL_THREAD_POOL_H_
+
+namespace seqan {
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+class ThreadPool;
+class TaskGroup;
+
+// ============================================================================
+// Classes
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Class ThreadPoolTask_
+// ----------------------------------------------------------------------------
+
+struct ThreadPoolTask_
+{
+    void        (*run)(void *);
+    void        *data;
+    TaskGroup   *group;
+};
+
+// ----------------------------------------------------------------------------
+// Class ThreadPoolQueue_
+// ----------------------------------------------------------------------------
+// A task deque.  The owner uses the back, thieves take from the front.
+
+struct ThreadPoolQueue_
+{
+    ReadWriteLock               lock;
+    String<ThreadPoolTask_>     tasks;
+    size_t                      head;
+    Atomic<unsigned>::Type      count;
+
+    ThreadPoolQueue_() :
+        head(0),
+        count(0)
+    {}
+};
+
+// ----------------------------------------------------------------------------
+// Class ThreadPool
+// ----------------------------------------------------------------------------
+
+/*!
+ * @class ThreadPool
+ * @headerfile <seqan/parallel.h>
+ * @brief Work-stealing pool of worker threads.
+ *
+ * @signature class ThreadPool;
+ *
+ * Tasks are spawned into a @link TaskGroup @endlink and executed by the workers.  A worker that runs out of tasks
+ * steals the oldest task of another worker.  Threads that wait for a task group execute pending tasks in the
+ * meantime, so tasks may spawn and wait for further tasks.
+ *
+ * There is no implicit process-wide pool.  The application creates the pool and passes it to the algorithms.  The
+ * workers are started in addition to any OpenMP threads, so a program that uses both should split its cores between
+ * them, e.g. by starting <tt>omp_get_max_threads() - 1</tt> workers only while no OpenMP region is active.
+ *
+ * @see TaskGroup
+ * @see parallelFor
+ * @see parallelReduce
+ */
+
+/*!
+ * @fn ThreadPool::ThreadPool
+ * @brief Constructor.
+ *
+ * @signature ThreadPool::ThreadPool(numWorkers);
+ *
+ * @param[in] numWorkers Number of worker threads to start, <tt>unsigned</tt>.  As waiting threads help executing
+ *                       tasks, <tt>numWorkers</tt> is usually one less than the number of cores.  A pool without
+ *                       workers executes all tasks in the waiting thread.
+ */
+
+class ThreadPool
+{
+public:
+    struct Worker_
+    {
+        ThreadPool  *pool;
+        unsigned    id;
+
+        Worker_() : pool(NULL), id(0)
+        {}
+
+        inline void operator()();
+    };
+
+    typedef Thread<Worker_> TThread;
+
+    unsigned                numWorkers;
+    TThread                 *threads;
+    // one deque per worker, followed by a shared deque for tasks spawned by other threads
+    ThreadPoolQueue_        *queues;
+
+    Atomic<unsigned>::Type  queued;
+    Atomic<unsigned>::Type  sleeping;
+    bool                    stop;
+    CriticalSection         cs;
+    Condition               wakeUp;
+
+    explicit
+    ThreadPool(unsigned numWorkers_) :
+        numWorkers(numWorkers_),
+        threads(NULL),
+        queues(new ThreadPoolQueue_[numWorkers_ + 1]),
+        queued(0),
+        sleeping(0),
+        stop(false),
+        wakeUp(cs)
+    {
+        if (numWorkers == 0u)
+            return;
+
+        threads = new TThread[numWorkers];
+        for (unsigned i = 0; i < numWorkers; ++i)
+        {
+            threads[i].worker.pool = this;
+            threads[i].worker.id = i;
+            run(threads[i]);
+        }
+    }
+
+    ~ThreadPool()
+    {
+        {
+            ScopedLock<CriticalSection> lock(cs);
+            stop = true;
+            signal(wakeUp);
+        }
+        for (unsigned i = 0; i < numWorkers; ++i)
+            waitFor(threads[i]);
+
+        delete[] threads;
+        delete[] queues;
+    }
+
+private:
+    ThreadPool(ThreadPool const &);
+    ThreadPool & operator=(ThreadPool const &);
+};
+
+// ----------------------------------------------------------------------------
+// Class TaskGroup
+// ----------------------------------------------------------------------------
+
+/*!
+ * @class TaskGroup
+ * @headerfile <seqan/parallel.h>
+ * @brief A set of tasks of a @link ThreadPool @endlink that can be waited for.
+ *
+ * @signature class TaskGroup;
+ *
+ * @section Example
+ *
+ * @code{.cpp}
+ * ThreadPool pool(3);
+ * TaskGroup group(pool);
+ * spawn(group, TaskA());
+ * spawn(group, TaskB());
+ * waitFor(group);
+ * @endcode
+ *
+ * @see ThreadPool
+ */
+
+/*!
+ * @fn TaskGroup::TaskGroup
+ * @brief Constructor.
+ *
+ * @signature TaskGroup::TaskGroup(pool);
+ *
+ * @param[in] pool The @link ThreadPool @endlink to execute the tasks.
+ */
+
+class TaskGroup
+{
+public:
+    ThreadPool              *pool;
+    Atomic<unsigned>::Type  pending;
+
+    explicit
+    TaskGroup(ThreadPool & pool_) :
+        pool(&pool_),
+        pending(0)
+    {}
+
+    ~TaskGroup()
+    {
+        SEQAN_ASSERT_EQ_MSG((unsigned)pending, 0u, "Call waitFor() before a TaskGroup is destroyed.");
+    }
+
+private:
+    TaskGroup(TaskGroup const &);
+    TaskGroup & operator=(TaskGroup const &);
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function numThreads()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn ThreadPool#numThreads
+ * @brief Returns the number of threads executing tasks, i.e. the workers plus the waiting thread.
+ *
+ * @signature unsigned numThreads(pool);
+ *
+ * @param[in] pool The ThreadPool to query.
+ */
+
+inline unsigned
+numThreads(ThreadPool const & pool)
+{
+    return pool.numWorkers + 1;
+}
+
+// ----------------------------------------------------------------------------
+// Function _currentThreadPoolWorker()
+// ----------------------------------------------------------------------------
+
+inline ThreadPool::Worker_ *&
+_currentThreadPoolWorker()
+{
+    static SEQAN_THREAD_LOCAL ThreadPool::Worker_ * worker = NULL;
+    return worker;
+}
+
+// ----------------------------------------------------------------------------
+// Function _pushBack(), _popBack(), _popFront()                [ThreadPoolQueue_]
+// ----------------------------------------------------------------------------
+
+inline void
+_pushBack(ThreadPoolQueue_ & queue, ThreadPoolTask_ const & task)
+{
+    ScopedWriteLock<> lock(queue.lock);
+    appendValue(queue.tasks, task);
+    atomicInc(queue.count);
+}
+
+inline bool
+_popBack(ThreadPoolTask_ & task, ThreadPoolQueue_ & queue)
+{
+    if (queue.count == 0u)
+        return false;
+
+    ScopedWriteLock<> lock(queue.lock);
+    if (length(queue.tasks) == queue.head)
+        return false;
+
+    task = back(queue.tasks);
+    _setLength(queue.tasks, length(queue.tasks) - 1);
+    if (length(queue.tasks) == queue.head)
+    {
+        clear(queue.tasks);
+        queue.head = 0;
+    }
+    atomicDec(queue.count);
+    return true;
+}
+
+inline bool
+_popFront(ThreadPoolTask_ & task, ThreadPoolQueue_ & queue)
+{
+    if (queue.count == 0u)
+        return false;
+
+    ScopedWriteLock<> lock(queue.lock);
+    if (length(queue.tasks) == queue.head)
+        return false;
+
+    task = queue.tasks[queue.head++];
+    if (length(queue.tasks) == queue.head)
+    {
+        clear(queue.tasks);
+        queue.head = 0;
+    }
+    atomicDec(queue.count);
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Function _popTask()
+// ----------------------------------------------------------------------------
+// Takes the newest task of the own deque, otherwise the oldest of the shared deque or of another worker.
+
+inline bool
+_popTask(ThreadPoolTask_ & task, ThreadPool & pool, unsigned workerId)
+{
+    if (pool.queued == 0u)
+        return false;
+
+    bool found = (workerId < pool.numWorkers) && _popBack(task, pool.queues[workerId]);
+    if (!found)
+        found = _popFront(task, pool.queues[pool.numWorkers]);
+    for (unsigned i = 1; !found && i <= pool.numWorkers; ++i)
+        found = _popFront(task, pool.queues[(workerId + i) % pool.numWorkers]);
+
+    if (found)
+        atomicDec(pool.queued);
+    return found;
+}
+
+// ----------------------------------------------------------------------------
+// Function _runTask()
+// ----------------------------------------------------------------------------
+
+inline void
+_runTask(ThreadPoolTask_ const & task)
+{
+    task.run(task.data);
+    atomicDec(task.group->pending);
+}
+
+// ----------------------------------------------------------------------------
+// Function ThreadPool::Worker_::operator()
+// ----------------------------------------------------------------------------
+
+inline void
+ThreadPool::Worker_::operator()()
+{
+    _currentThreadPoolWorker() = this;
+
+    ThreadPoolTask_ task;
+    while (true)
+    {
+        if (_popTask(task, *pool, id))
+        {
+            _runTask(task);
+            continue;
+        }
+
+        // announce to sleep before checking for tasks, a spawning thread checks in the reverse order
+        ScopedLock<CriticalSection> lock(pool->cs);
+        if (pool->stop)
+            return;
+        atomicInc(pool->sleeping);
+        if (pool->queued == 0u)
+            waitFor(pool->wakeUp);
+        atomicDec(pool->sleeping);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _spawnTask()
+// ----------------------------------------------------------------------------
+
+inline void
+_spawnTask(TaskGroup & group, void (*run)(void *), void * data)
+{
+    ThreadPool & pool = *group.pool;
+    ThreadPoolTask_ task;
+    task.run = run;
+    task.data = data;
+    task.group = &group;
+
+    atomicInc(group.pending);
+
+    // workers push to their own deque, all other threads to the shared one
+    ThreadPool::Worker_ * worker = _currentThreadPoolWorker();
+    unsigned queueId = (worker != NULL && worker->pool == &pool) ? worker->id : pool.numWorkers;
+    _pushBack(pool.queues[queueId], task);
+
+    atomicInc(pool.queued);
+    if (pool.sleeping != 0u)
+    {
+        ScopedLock<CriticalSection> lock(pool.cs);
+        signal(pool.wakeUp);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _runOwnedTask(), _runReferencedTask()
+// ----------------------------------------------------------------------------
+
+template <typename TFunctor>
+inline void
+_runOwnedTask(void * data)
+{
+    TFunctor * f = static_cast<TFunctor *>(data);
+    (*f)();
+    delete f;
+}
+
+template <typename TFunctor>
+inline void
+_runReferencedTask(void * data)
+{
+    (*static_cast<TFunctor *>(data))();
+}
+
+// ----------------------------------------------------------------------------
+// Function spawn()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn TaskGroup#spawn
+ * @brief Adds a task to a TaskGroup.
+ *
+ * @signature void spawn(group, task);
+ *
+ * @param[in,out] group The TaskGroup to add the task to.
+ * @param[in]     task  A functor with <tt>void operator()()</tt>.  It is copied and executed by some thread of the
+ *                      group's @link ThreadPool @endlink.  Tasks must not throw exceptions.
+ */
+
+template <typename TFunctor>
+inline void
+spawn(TaskGroup & group, TFunctor const & task)
+{
+    _spawnTask(group, &_runOwnedTask<TFunctor>, new TFunctor(task));
+}
+
+// ----------------------------------------------------------------------------
+// Function waitFor()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn TaskGroup#waitFor
+ * @brief Waits until all tasks of a TaskGroup are finished.
+ *
+ * @signature void waitFor(group);
+ *
+ * @param[in,out] group The TaskGroup to wait for.
+ *
+ * The calling thread executes pending tasks of the pool while waiting.
+ */
+
+inline void
+waitFor(TaskGroup & group)
+{
+    ThreadPool & pool = *group.pool;
+    ThreadPool::Worker_ * worker = _currentThreadPoolWorker();
+    unsigned workerId = (worker != NULL && worker->pool == &pool) ? worker->id : pool.numWorkers;
+
+    ThreadPoolTask_ task;
+    SpinDelay spinDelay;
+    while (group.pending != 0u)
+    {
+        if (_popTask(task, pool, workerId))
+        {
+            _runTask(task);
+            clear(spinDelay);
+        }
+        else
+        {
+            waitFor(spinDelay);
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _defaultGrainSize()
+// ----------------------------------------------------------------------------
+
+template <typename TPos>
+inline TPos
+_defaultGrainSize(ThreadPool const & pool, TPos beginPos, TPos endPos)
+{
+    // about 8 ranges per thread leave room for balancing
+    TPos grainSize = (endPos - beginPos) / (8 * numThreads(pool));
+    return (grainSize > (TPos)0) ? grainSize : (TPos)1;
+}
+
+// ----------------------------------------------------------------------------
+// Class ParallelForTask_
+// ----------------------------------------------------------------------------
+// Splits off and spawns the right half of its range until the range is not larger than the grain size.  Spawned
+// halves are split further by the thread that executes them, so stolen work is divided again.
+
+template <typename TPos, typename TFunctor>
+struct ParallelForTask_
+{
+    TaskGroup   *group;
+    TFunctor    *f;
+    TPos        beginPos;
+    TPos        endPos;
+    TPos        grainSize;
+
+    void operator()()
+    {
+        while (endPos - beginPos > grainSize)
+        {
+            ParallelForTask_ right = *this;
+            right.beginPos = beginPos + (endPos - beginPos) / 2;
+            endPos = right.beginPos;
+            spawn(*group, right);
+        }
+        for (TPos i = beginPos; i < endPos; ++i)
+            (*f)(i);
+    }
+};
+
+// ----------------------------------------------------------------------------
+// Function parallelFor()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn parallelFor
+ * @headerfile <seqan/parallel.h>
+ * @brief Calls a functor for every position of an interval in parallel.
+ *
+ * @signature void parallelFor(pool, beginPos, endPos, f[, grainSize]);
+ *
+ * @param[in] pool      The @link ThreadPool @endlink to use.
+ * @param[in] beginPos  Begin of the interval, an integer.
+ * @param[in] endPos    End of the interval, an integer of the same type.
+ * @param[in] f         A functor with <tt>operator()(pos)</tt>.  It is shared by all threads.
+ * @param[in] grainSize Intervals of at most this size are not split further.  Default: The interval size divided
+ *                      by 8 times @link ThreadPool#numThreads @endlink.
+ *
+ * Unlike a static OpenMP loop, the interval is split recursively and idle threads steal the largest
+ * remaining parts, which balances irregular work.
+ *
+ * @see parallelReduce
+ */
+
+template <typename TPos, typename TFunctor>
+inline void
+parallelFor(ThreadPool & pool, TPos beginPos, TPos endPos, TFunctor & f, TPos grainSize)
+{
+    if (!(beginPos < endPos))
+        return;
+
+    TaskGroup group(pool);
+    ParallelForTask_<TPos, TFunctor> root;
+    root.group = &group;
+    root.f = &f;
+    root.beginPos = beginPos;
+    root.endPos = endPos;
+    root.grainSize = (grainSize > (TPos)0) ? grainSize : (TPos)1;
+    root();
+    waitFor(group);
+}
+
+template <typename TPos, typename TFunctor>
+inline void
+parallelFor(ThreadPool & pool, TPos beginPos, TPos endPos, TFunctor & f)
+{
+    parallelFor(pool, beginPos, endPos, f, _defaultGrainSize(pool, beginPos, endPos));
+}
+
+// ----------------------------------------------------------------------------
+// Class ParallelReduceTask_
+// ----------------------------------------------------------------------------
+// Like ParallelForTask_ but the split-off halves are kept on the stack to combine their results in order.
+
+template <typename TPos, typename TValue, typename TMap, typename TReduce>
+struct ParallelReduceTask_
+{
+    ThreadPool  *pool;
+    TMap        *map;
+    TReduce     *op;
+    TPos        beginPos;
+    TPos        endPos;
+    TPos        grainSize;
+    TValue      result;
+
+    void operator()()
+    {
+        unsigned numChildren = 0;
+        for (TPos pos = endPos; pos - beginPos > grainSize; pos = beginPos + (pos - beginPos) / 2)
+            ++numChildren;
+
+        // the children must not be moved once they are spawned
+        String<ParallelReduceTask_> children;
+        reserve(children, numChildren, Exact());
+
+        TaskGroup group(*pool);
+        while (endPos - beginPos > grainSize)
+        {
+            appendValue(children, *this);
+            ParallelReduceTask_ & right = back(children);
+            right.beginPos = beginPos + (endPos - beginPos) / 2;
+            endPos = right.beginPos;
+            _spawnTask(group, &_runReferencedTask<ParallelReduceTask_>, &right);
+        }
+
+        for (TPos i = beginPos; i < endPos; ++i)
+            result = (*op)(result, (*map)(i));
+        waitFor(group);
+
+        // the last child covers the leftmost remaining interval
+        for (unsigned i = length(children); i > 0; --i)
+            result = (*op)(result, children[i - 1].result);
+    }
+};
+
+// ----------------------------------------------------------------------------
+// Function parallelReduce()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn parallelReduce
+ * @headerfile <seqan/parallel.h>
+ * @brief Maps every position of an interval to a value and reduces the values in parallel.
+ *
+ * @signature TValue parallelReduce(pool, beginPos, endPos, identity, map, op[, grainSize]);
+ *
+ * @param[in] pool      The @link ThreadPool @endlink to use.
+ * @param[in] beginPos  Begin of the interval, an integer.
+ * @param[in] endPos    End of the interval, an integer of the same type.
+ * @param[in] identity  The neutral element of <tt>op</tt>, of type <tt>TValue</tt>.
+ * @param[in] map       A functor with <tt>TValue operator()(pos)</tt>.  It is shared by all threads.
+ * @param[in] op        An associative functor with <tt>TValue operator()(TValue, TValue)</tt>.  It need not be
+ *                      commutative, the values are combined in the order of their positions.
+ * @param[in] grainSize Intervals of at most this size are not split further.  Default: The interval size divided
+ *                      by 8 times @link ThreadPool#numThreads @endlink.
+ *
+ * @return TValue <tt>op(...op(op(identity, map(beginPos)), map(beginPos + 1))..., map(endPos - 1))</tt>, up to
+ *                associativity.
+ *
+ * @see parallelFor
+ */
+
+template <typename TPos, typename TValue, typename TMap, typename TReduce>
+inline TValue
+parallelReduce(ThreadPool & pool, TPos beginPos, TPos endPos, TValue const & identity, TMap & map, TReduce & op,
+               TPos grainSize)
+{
+    ParallelReduceTask_<TPos, TValue, TMap, TReduce> root;
+    root.pool = &pool;
+    root.map = &map;
+    root.op = &op;
+    root.beginPos = beginPos;
+    root.endPos = (beginPos < endPos) ? endPos : beginPos;
+    root.grainSize = (grainSize > (TPos)0) ? grainSize : (TPos)1;
+    root.result = identity;
+    root();
+    return root.result;
+}
+
+template <typename TPos, typename TValue, typename TMap, typename TReduce>
+inline TValue
+parallelReduce(ThreadPool & pool, TPos beginPos, TPos endPos, TValue const & identity, TMap & map, TReduce & op)
+{
+    return parallelReduce(pool, beginPos, endPos, identity, map, op, _defaultGrainSize(pool, beginPos, endPos));
+}
+
+}  // namespace seqan
+
+#endif  // #ifndef SEQAN_PARALLEL_PARALLEL_THREAD_POOL_H_
@@ -97,6 +97,38 @@
 #define SEQAN_UNLIKELY(x) (x)
 #endif
 
+// Software prefetch hint for reading, see e.g. platform_gcc.h
+#ifndef SEQAN_PREFETCH
+#define SEQAN_PREFETCH(addr)
+#endif
+
+/*!
+ * @macro SEQAN_THREAD_LOCAL
+ * @headerfile <seqan/platform.h>
+ * @brief Portable storage class specifier for thread-local variables.
+ *
+ * @signature SEQAN_THREAD_LOCAL
+ *
+ * @section Remarks
+ *
+ * Expands to <tt>__declspec(thread)</tt> with MSVC and to <tt>__thread</tt> otherwise.  Both only support variables
+ * of POD type with static initialization, e.g. pointers.
+ *
+ * @section Example
+ *
+ * @code{.cpp}
+ * static SEQAN_THREAD_LOCAL Worker * currentWorker = NULL;
+ * @endcode
+ */
+
+#ifndef SEQAN_THREAD_LOCAL
+#if defined(PLATFORM_WINDOWS) && !defined(PLATFORM_WINDOWS_MINGW)
+#define SEQAN_THREAD_LOCAL __declspec(thread)
+#else
+#define SEQAN_THREAD_LOCAL __thread
+#endif
+#endif
+
 // A macro to eliminate warnings on GCC and Clang
 #if (defined(__GNUC__) && ((__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 7)))) || defined(__clang__)
 #  define SEQAN_UNUSED __attribute__((unused))
@@ -202,4 +202,6 @@ typedef uint8_t __uint8;   // nolint
 
 #define SEQAN_RESTRICT  __restrict__
 
+#define SEQAN_PREFETCH(addr)  __builtin_prefetch(addr, 0, 3)
+
 #endif  // #ifndef PLATFORM_GCC
@@ -43,6 +43,7 @@
 
 #include <seqan/basic.h>
 #include <seqan/stream.h>
+#include <seqan/parallel.h>
 #include <seqan/misc/name_store_cache.h>
 
 // ===========================================================================
@@ -90,6 +90,20 @@ clear(FaiIndexEntry_ &entry)
     entry.overallLineLength = 0;
 }
 
+// ----------------------------------------------------------------------------
+// Class FaiGziLess_
+// ----------------------------------------------------------------------------
+
+// Orders GZI entries (compressed offset, uncompressed offset) by their uncompressed offset.
+
+struct FaiGziLess_
+{
+    bool operator()(Pair<__uint64, __uint64> const & a, Pair<__uint64, __uint64> const & b) const
+    {
+        return a.i2 < b.i2;
+    }
+};
+
 // ----------------------------------------------------------------------------
 // Class FaiIndex
 // ----------------------------------------------------------------------------
@@ -104,6 +118,11 @@ clear(FaiIndexEntry_ &entry)
  * FAI indices allow the rast random access to sequences or parts of sequences in a FASTA file.  Originally, they were
  * introduced in the <a href="http://samtools.sourceforge.net/samtools.shtml">samtools</a> program.
  *
+ * The FASTA file is memory mapped and @link FaiIndex#readRegion @endlink does not modify the index, so any number of
+ * threads can read from the same FaiIndex concurrently.  FASTA files compressed with bgzip are supported as well.
+ * Their BGZF blocks are located via a GZI index (<tt>"${fastaFileName}.gzi"</tt>), which is written by
+ * @link FaiIndex#save @endlink and derived from the block headers if missing.
+ *
  * Also see the <a href="http://seqan.readthedocs.org/en/develop/Tutorial/IndexedFastaIO.html">Indexed FASTA I/O
  * Tutorial</a>.
  *
@@ -140,6 +159,11 @@ public:
 
     mutable std::ifstream file;
 
+    // Memory mapping of the FASTA file, shared by concurrent readRegion() calls.
+    String<char, MMap<> > mmapString;
+    // Offsets (compressed, uncompressed) of the BGZF blocks if the FASTA file is compressed with bgzip (GZI).
+    String<Pair<__uint64, __uint64> > gziIndex;
+
     FaiIndex() :
         seqNameStoreCache(seqNameStore)
     {}
@@ -173,6 +197,8 @@ inline void clear(FaiIndex & index)
     clear(index.indexEntryStore);
     clear(index.seqNameStore);
     clear(index.seqNameStoreCache);
+    close(index.mmapString);
+    clear(index.gziIndex);
 }
 
 // ----------------------------------------------------------------------------
@@ -289,6 +315,90 @@ inline __uint64 numSeqs(FaiIndex const & index)
     return length(index.indexEntryStore);
 }
 
+// ----------------------------------------------------------------------------
+// Function _faiCopyLines()
+// ----------------------------------------------------------------------------
+
+// Copies toRead sequence characters that start at column of a line.  As all lines of an entry have the same length,
+// the characters are copied in runs between the line breaks.
+
+template <typename TTargetIter, typename TSize>
+inline void
+_faiCopyLines(TTargetIter target,
+              char const * source,
+              TSize column,
+              TSize toRead,
+              FaiIndexEntry_ const & entry)
+{
+    unsigned lineBreakLength = entry.overallLineLength - entry.lineLength;
+    while (toRead != 0)
+    {
+        TSize runLength = std::min((TSize)(entry.lineLength - column), toRead);
+        target = std::copy(source, source + runLength, target);
+        source += runLength + lineBreakLength;
+        toRead -= runLength;
+        column = 0;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _faiReadBgzfRange()
+// ----------------------------------------------------------------------------
+
+#if SEQAN_HAS_ZLIB
+
+// Inflates the uncompressed file range [beginOfs, endOfs) of a bgzip-compressed FASTA file into buffer.
+
+inline void
+_faiReadBgzfRange(CharString & buffer, FaiIndex const & index, __uint64 beginOfs, __uint64 endOfs)
+{
+    typedef Pair<__uint64, __uint64>                                    TGziEntry;
+    typedef Iterator<String<TGziEntry> const, Standard>::Type           TGziIter;
+
+    const unsigned BLOCK_HEADER_LENGTH = DefaultPageSize<BgzfFile>::BLOCK_HEADER_LENGTH;
+    const unsigned BLOCK_FOOTER_LENGTH = DefaultPageSize<BgzfFile>::BLOCK_FOOTER_LENGTH;
+
+    // Find the last block that starts at or before beginOfs.
+    TGziIter it = std::upper_bound(begin(index.gziIndex, Standard()), end(index.gziIndex, Standard()),
+                                   TGziEntry(MaxValue<__uint64>::VALUE, beginOfs), FaiGziLess_());
+    SEQAN_ASSERT(it != begin(index.gziIndex, Standard()));
+    --it;
+
+    char const * fileBegin = begin(index.mmapString, Standard());
+    __uint64 fileLength = length(index.mmapString);
+    __uint64 blockOfs = it->i2;
+    __uint64 compressedOfs = it->i1;
+
+    CompressionContext<BgzfFile> ctx;
+    CharString block;
+    resize(block, BGZF_MAX_BLOCK_SIZE, Exact());
+    clear(buffer);
+    while (blockOfs < endOfs)
+    {
+        if (compressedOfs + BLOCK_HEADER_LENGTH + BLOCK_FOOTER_LENGTH > fileLength)
+            SEQAN_THROW(UnexpectedEnd());
+
+        char const * src = fileBegin + compressedOfs;
+        unsigned compressedLength = _bgzfUnpack16(src + 16) + 1u;
+        if (compressedOfs + compressedLength > fileLength)
+            SEQAN_THROW(UnexpectedEnd());
+
+        unsigned size = _decompressBlock(begin(block, Standard()), (unsigned)length(block), src, compressedLength, ctx);
+        if (size == 0)
+            SEQAN_THROW(UnexpectedEnd());   // EOF marker
+
+        // Append the part of the block that lies in [beginOfs, endOfs).
+        __uint64 copyBegin = std::max(beginOfs, blockOfs) - blockOfs;
+        __uint64 copyEnd = std::min(endOfs, blockOfs + size) - blockOfs;
+        append(buffer, infix(block, copyBegin, copyEnd));
+
+        blockOfs += size;
+        compressedOfs += compressedLength;
+    }
+}
+
+#endif  // #if SEQAN_HAS_ZLIB
+
 // ----------------------------------------------------------------------------
 // Function readRegion()
 // ----------------------------------------------------------------------------
@@ -322,60 +432,34 @@ inline void readRegion(String<TValue, TSpec> & str,
     beginPos = std::min((TEndPos)beginPos, seqLen);
     endPos = std::min(std::max((TEndPos)beginPos, endPos), seqLen);
     TEndPos toRead = endPos - beginPos;
-    
+
     clear(str);
     if (toRead == 0)
         return;
 
-    // seek to start position
-    DirectionIterator<std::ifstream, Input>::Type reader = directionIterator(index.file, Input());
-    setPosition(
-        reader,
-        index.indexEntryStore[rID].offset +
-        (beginPos / entry.lineLength) * entry.overallLineLength);
-
-    // set up countdowns
-    CountDownFunctor<NotFunctor<IsWhitespace> > countDownIgnore(beginPos % entry.lineLength);
-    CountDownFunctor<NotFunctor<IsWhitespace> > countDownData(toRead);
-    IsWhitespace ignWhiteSpace;
-
-    // read characters
-    skipUntil(reader, countDownIgnore);
-    readUntil(str, reader, countDownData, ignWhiteSpace);
-    if (!countDownData)
-        SEQAN_THROW(UnexpectedEnd());
-//
-//
-//    typedef typename Iterator<String<char, MMap<> > const, Standard>::Type TSourceIter;
-//    typedef typename Iterator<String<TValue, TSpec>, Standard>::Type TTargetIter;
-//    TSourceIter itSource = begin(index.mmapString, Standard());
-//    __uint64 offset = index.indexEntryStore[rID].offset;
-//    // First, compute offset of the completely filled lines.
-//    unsigned numLines = beginPos / index.indexEntryStore[rID].lineLength;
-//    unsigned numBytes = numLines * index.indexEntryStore[rID].overallLineLength;
-//    // Then, compute overall offset by adding remaining bytes, too.
-//    numBytes += beginPos % index.indexEntryStore[rID].lineLength;
-//    offset += numBytes;
-//    // Advance iterator in MMap file.
-//    itSource += offset;
-//
-//    // Copy out the characters from FASTA file and convert via iterator assignment to target string's type.
-//    resize(str, toRead, TValue());
-//    TTargetIter itTarget = begin(str, Standard());
-//    for (TEndPos i = 0; i < toRead; )
-//    {
-//        if (isspace(*itSource))
-//        {
-//            ++itSource;
-//            continue;  // Skip spaces.
-//        }
-//        *itTarget = *itSource;
-//        ++itTarget;
-//        ++itSource;
-//        ++i;
-//    }
-//
-//    return true;
+    // File range from the first to behind the last character to read.
+    __uint64 beginOfs = entry.offset + (__uint64)(beginPos / entry.lineLength) * entry.overallLineLength +
+                        beginPos % entry.lineLength;
+    __uint64 endOfs = entry.offset + (__uint64)((endPos - 1) / entry.lineLength) * entry.overallLineLength +
+                      (endPos - 1) % entry.lineLength + 1;
+
+    resize(str, toRead, Exact());
+    if (empty(index.gziIndex))
+    {
+        if (endOfs > length(index.mmapString))
+            SEQAN_THROW(UnexpectedEnd());
+        _faiCopyLines(begin(str, Standard()), begin(index.mmapString, Standard()) + beginOfs,
+                      (TEndPos)(beginPos % entry.lineLength), toRead, entry);
+    }
+    else
+    {
+#if SEQAN_HAS_ZLIB
+        CharString buffer;
+        _faiReadBgzfRange(buffer, index, beginOfs, endOfs);
+        _faiCopyLines(begin(str, Standard()), begin(buffer, Standard()),
+                      (TEndPos)(beginPos % entry.lineLength), toRead, entry);
+#endif  // #if SEQAN_HAS_ZLIB
+    }
 }
 
 template <typename TValue, typename TSpec>
@@ -471,6 +555,151 @@ readRecord(FaiIndexEntry_ & entry, TFwdIterator & reader, CharString & buffer)
     skipLine(reader);           // Skip over line ending.
 }
 
+// ---------------------------------------------------------------------------
+// Function _faiIsBgzf()
+// ---------------------------------------------------------------------------
+
+#if SEQAN_HAS_ZLIB
+
+inline bool
+_faiIsBgzf(FaiIndex const & index)
+{
+    return length(index.mmapString) >= DefaultPageSize<BgzfFile>::BLOCK_HEADER_LENGTH &&
+           _bgzfCheckHeader(begin(index.mmapString, Standard()));
+}
+
+// ---------------------------------------------------------------------------
+// Function _faiBuildGzi()
+// ---------------------------------------------------------------------------
+
+// Derives the GZI index from the headers and footers of all BGZF blocks, no data is inflated.
+
+inline bool
+_faiBuildGzi(FaiIndex & index)
+{
+    const unsigned BLOCK_HEADER_LENGTH = DefaultPageSize<BgzfFile>::BLOCK_HEADER_LENGTH;
+    const unsigned BLOCK_FOOTER_LENGTH = DefaultPageSize<BgzfFile>::BLOCK_FOOTER_LENGTH;
+
+    char const * fileBegin = begin(index.mmapString, Standard());
+    __uint64 fileLength = length(index.mmapString);
+    __uint64 compressedOfs = 0;
+    __uint64 uncompressedOfs = 0;
+
+    clear(index.gziIndex);
+    while (compressedOfs < fileLength)
+    {
+        char const * src = fileBegin + compressedOfs;
+        if (compressedOfs + BLOCK_HEADER_LENGTH + BLOCK_FOOTER_LENGTH > fileLength || !_bgzfCheckHeader(src))
+            return false;
+
+        unsigned compressedLength = _bgzfUnpack16(src + 16) + 1u;
+        if (compressedOfs + compressedLength > fileLength)
+            return false;
+
+        appendValue(index.gziIndex, Pair<__uint64, __uint64>(compressedOfs, uncompressedOfs));
+        compressedOfs += compressedLength;
+        uncompressedOfs += _bgzfUnpack32(src + compressedLength - 4);
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Function _faiOpenGzi()
+// ---------------------------------------------------------------------------
+
+// Reads a GZI file as written by bgzip and samtools.  It stores all blocks but the first.
+
+inline bool
+_faiOpenGzi(FaiIndex & index, char const * gziFilename)
+{
+    typedef DirectionIterator<std::ifstream, Input>::Type TIter;
+
+    std::ifstream file(gziFilename, std::ios::binary | std::ios::in);
+    if (!file.good())
+        return false;
+
+    TIter iter = directionIterator(file, Input());
+    __uint64 numEntries = 0;
+    readRawPod(numEntries, iter);
+
+    clear(index.gziIndex);
+    reserve(index.gziIndex, numEntries + 1, Exact());
+    appendValue(index.gziIndex, Pair<__uint64, __uint64>(0, 0));
+    for (__uint64 i = 0; i < numEntries; ++i)
+    {
+        Pair<__uint64, __uint64> entry;
+        readRawPod(entry.i1, iter);
+        readRawPod(entry.i2, iter);
+        appendValue(index.gziIndex, entry);
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Function _faiSaveGzi()
+// ---------------------------------------------------------------------------
+
+inline bool
+_faiSaveGzi(FaiIndex const & index, char const * gziFilename)
+{
+    std::ofstream file(gziFilename, std::ios::binary | std::ios::out);
+    if (!file.good())
+        return false;
+
+    __uint64 numEntries = length(index.gziIndex) - 1;
+    file.write(reinterpret_cast<char const *>(&numEntries), sizeof(numEntries));
+    for (unsigned i = 1; i < length(index.gziIndex); ++i)
+    {
+        file.write(reinterpret_cast<char const *>(&index.gziIndex[i].i1), sizeof(__uint64));
+        file.write(reinterpret_cast<char const *>(&index.gziIndex[i].i2), sizeof(__uint64));
+    }
+    return file.good();
+}
+
+// ---------------------------------------------------------------------------
+// Function _faiUncompressedOffset()
+// ---------------------------------------------------------------------------
+
+// Converts a BGZF virtual offset into an offset in the uncompressed file.
+
+inline __uint64
+_faiUncompressedOffset(FaiIndex const & index, __uint64 virtualOffset)
+{
+    typedef Iterator<String<Pair<__uint64, __uint64> > const, Standard>::Type TGziIter;
+
+    TGziIter it = std::lower_bound(begin(index.gziIndex, Standard()), end(index.gziIndex, Standard()),
+                                   Pair<__uint64, __uint64>(virtualOffset >> 16, 0));
+    SEQAN_ASSERT(it != end(index.gziIndex, Standard()));
+    return it->i2 + (virtualOffset & 0xffff);
+}
+
+#endif  // #if SEQAN_HAS_ZLIB
+
+// ---------------------------------------------------------------------------
+// Function _faiOpenFasta()
+// ---------------------------------------------------------------------------
+
+// Maps the FASTA file and locates its BGZF blocks if it is compressed.
+
+inline bool
+_faiOpenFasta(FaiIndex & index, char const * fastaFilename)
+{
+    if (!open(index.mmapString, fastaFilename, OPEN_RDONLY))
+        return false;
+
+    clear(index.gziIndex);
+#if SEQAN_HAS_ZLIB
+    if (_faiIsBgzf(index))
+    {
+        std::string gziFilename = fastaFilename;
+        gziFilename += ".gzi";
+        if (!_faiOpenGzi(index, gziFilename.c_str()) && !_faiBuildGzi(index))
+            return false;
+    }
+#endif  // #if SEQAN_HAS_ZLIB
+    return true;
+}
+
 // ---------------------------------------------------------------------------
 // Function open()
 // ---------------------------------------------------------------------------
@@ -495,7 +724,7 @@ inline bool open(FaiIndex & index, char const * fastaFilename, char const * faiF
     index.fastaFilename = fastaFilename;
     index.faiFilename = faiFilename;
 
-    if (!open(index.file, toCString(fastaFilename), OPEN_RDONLY))
+    if (!_faiOpenFasta(index, fastaFilename))
         return false;  // Could not open file.
 
     // Open file.
@@ -536,6 +765,8 @@ inline bool open(FaiIndex & index, char const * fastaFilename)
  *
  * @signature bool save(faiIndex[, faiFileName]);
  *
+ * For FASTA files compressed with bgzip, the GZI index is written to <tt>"${fastaFileName}.gzi"</tt> as well.
+ *
  * @param[in] faiIndex    The FaiIndex to write out.
  * @param[in] faiFileName The name of the FAI file to write to.  This parameter is optional only if the FAI index knows
  *                        the FAI file name from a previous @link FaiIndex#build @endlink call.  By default, the FAI
@@ -559,6 +790,15 @@ inline bool save(FaiIndex const & index, char const * faiFilename)
         file << entry.name << '\t' << entry.sequenceLength << '\t' << entry.offset << '\t'
              << entry.lineLength << '\t' << entry.overallLineLength << '\n';
     }
+
+#if SEQAN_HAS_ZLIB
+    if (!empty(index.gziIndex) && !empty(index.fastaFilename))
+    {
+        CharString gziFilename = index.fastaFilename;
+        append(gziFilename, ".gzi");
+        return _faiSaveGzi(index, toCString(gziFilename));
+    }
+#endif  // #if SEQAN_HAS_ZLIB
     return true;
 }
 
@@ -651,16 +891,10 @@ inline void getRecordInfo(FaiIndexEntry_ & entry, TFwdIterator & iter, Fasta)
  * @return bool <tt>true</tt> on success, <tt>false</tt> otherwise.
  */
 
-inline bool build(FaiIndex & index, char const * fastaFilename, char const * faiFilename)
+template <typename TFwdIterator>
+inline void
+_buildFaiEntries(FaiIndex & index, TFwdIterator & iter)
 {
-    index.fastaFilename = fastaFilename;
-    index.faiFilename = faiFilename;
-
-    if (!open(index.file, toCString(fastaFilename), OPEN_RDONLY))
-        return false;  // Could not open file.
-
-    DirectionIterator<std::ifstream, Input>::Type iter = directionIterator(index.file, Input());
-
     // Clear everything.
     clear(index.seqNameStore);
     clear(index.seqNameStoreCache);
@@ -677,7 +911,37 @@ inline bool build(FaiIndex & index, char const * fastaFilename, char const * fai
 
     // Recreate name store cache.
     refresh(index.seqNameStoreCache);
+}
+
+inline bool build(FaiIndex & index, char const * fastaFilename, char const * faiFilename)
+{
+    index.fastaFilename = fastaFilename;
+    index.faiFilename = faiFilename;
+
+    if (!_faiOpenFasta(index, fastaFilename))
+        return false;  // Could not open file.
 
+    if (!open(index.file, toCString(fastaFilename), OPEN_RDONLY))
+        return false;  // Could not open file.
+
+    if (empty(index.gziIndex))
+    {
+        DirectionIterator<std::ifstream, Input>::Type iter = directionIterator(index.file, Input());
+        _buildFaiEntries(index, iter);
+        return true;
+    }
+
+#if SEQAN_HAS_ZLIB
+    // Record offsets are BGZF virtual offsets while parsing and must be converted.
+    VirtualStream<char, Input> stream;
+    if (!open(stream, index.file, BgzfFile()))
+        return false;
+
+    DirectionIterator<VirtualStream<char, Input>, Input>::Type iter = directionIterator(stream, Input());
+    _buildFaiEntries(index, iter);
+    for (unsigned i = 0; i < length(index.indexEntryStore); ++i)
+        index.indexEntryStore[i].offset = _faiUncompressedOffset(index, index.indexEntryStore[i].offset);
+#endif  // #if SEQAN_HAS_ZLIB
     return true;
 }
 
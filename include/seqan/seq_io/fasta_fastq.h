@@ -416,6 +416,248 @@ inline void readRecord(TIdString & meta, TSeqString & seq, TQualString & qual, T
     skipUntil(iter, TFastqBegin());     // forward to the next '@'
 }
 
+// ----------------------------------------------------------------------------
+// Function _readRawRecord(Fasta)
+// ----------------------------------------------------------------------------
+// Copy the next record verbatim into a char buffer, consuming exactly what
+// readRecord(Fasta) would consume. Used to cut a file into chunks of whole
+// records that can be parsed independently.
+
+template <typename TTarget, typename TFwdIterator, typename TSeqIgnore, typename TQualIgnore>
+inline void _readRawRecord(TTarget & target, TFwdIterator & iter, Fasta, TSeqIgnore const &, TQualIgnore const &)
+{
+    typedef EqualsChar<'>'>                                         TFastaBegin;
+
+    skipUntil(iter, TFastaBegin());     // forward to the next '>'
+    skipOne(iter);                      // assert and skip '>'
+
+    appendValue(target, '>');
+    readLine(target, iter);             // copy Fasta id
+    appendValue(target, '\n');
+    readUntil(target, iter, TFastaBegin()); // copy Fasta sequence
+}
+
+// ----------------------------------------------------------------------------
+// Function _readRawRecord(Fastq)
+// ----------------------------------------------------------------------------
+// The sequence and quality ignore functors must be those readRecord(Fastq)
+// uses for the target alphabets, as they determine how many quality values
+// belong to the record.
+
+template <typename TTarget, typename TFwdIterator, typename TSeqIgnore, typename TQualIgnore>
+inline void _readRawRecord(TTarget & target, TFwdIterator & iter, Fastq, TSeqIgnore const &, TQualIgnore const &)
+{
+    typedef typename Size<TTarget>::Type                                    TSize;
+    typedef EqualsChar<'@'>                                                 TFastqBegin;
+    typedef EqualsChar<'+'>                                                 TQualsBegin;
+
+    skipUntil(iter, TFastqBegin());     // forward to the next '@'
+    skipOne(iter);                      // skip '@'
+
+    appendValue(target, '@');
+    readLine(target, iter);             // copy Fastq id
+    appendValue(target, '\n');
+
+    TSize seqBegin = length(target);
+    readUntil(target, iter, TQualsBegin());     // copy Fastq sequence
+
+    TSeqIgnore seqIgnore;
+    __uint64 seqLength = 0;
+    for (TSize i = seqBegin; i < length(target); ++i)
+        if (!seqIgnore(target[i]))
+            ++seqLength;
+
+    skipOne(iter, TQualsBegin());       // assert and skip '+'
+    skipLine(iter);                     // skip optional 2nd Fastq id
+    appendValue(target, '+');
+    appendValue(target, '\n');
+
+    CountDownFunctor<NotFunctor<TQualIgnore> > qualCountDown(seqLength);
+    readUntil(target, iter, qualCountDown);     // copy Fastq qualities
+    appendValue(target, '\n');
+    skipUntil(iter, TFastqBegin());     // forward to the next '@'
+}
+
+// ----------------------------------------------------------------------------
+// Function _scanRawLine()
+// ----------------------------------------------------------------------------
+// Return the position behind the line starting at ptr as readLine() leaves
+// it, or NULL if the line end is not inside [ptr, end).
+
+template <typename TValue>
+inline TValue * _scanRawLine(TValue * ptr, TValue * end)
+{
+    IsNewline isNewline;
+
+    ptr = _scanUntil(ptr, end, isNewline);
+    if (ptr == end)
+        return NULL;
+
+    // a trailing '\r' could be followed by '\n' in the next buffer
+    if (*ptr == '\r' && ++ptr == end)
+        return NULL;
+
+    if (*ptr == '\n')
+        ++ptr;
+
+    return ptr;
+}
+
+// ----------------------------------------------------------------------------
+// Function _scanRawRecord(Fasta)
+// ----------------------------------------------------------------------------
+// Locate the record starting at ptr inside an input buffer and return the
+// beginning of the next record, i.e. the position readRecord(Fasta) stops at.
+// Return NULL if ptr is not a record start or the next record does not begin
+// inside [ptr, end).
+
+template <typename TValue, typename TSeqIgnore, typename TQualIgnore>
+inline TValue * _scanRawRecord(TValue * ptr, TValue * end, Fasta, TSeqIgnore const &, TQualIgnore const &)
+{
+    EqualsChar<'>'> fastaBegin;
+
+    if (ptr == end || !fastaBegin(*ptr))
+        return NULL;
+
+    if ((ptr = _scanRawLine(ptr + 1, end)) == NULL)     // Fasta id
+        return NULL;
+
+    ptr = _scanUntil(ptr, end, fastaBegin);             // Fasta sequence
+    return (ptr != end) ? ptr : NULL;
+}
+
+// ----------------------------------------------------------------------------
+// Function _scanRawRecord(Fastq)
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TSeqIgnore, typename TQualIgnore>
+inline TValue * _scanRawRecord(TValue * ptr, TValue * end, Fastq, TSeqIgnore const &, TQualIgnore const &)
+{
+    EqualsChar<'@'> fastqBegin;
+    EqualsChar<'+'> qualsBegin;
+    TSeqIgnore seqIgnore;
+    TQualIgnore qualIgnore;
+
+    if (ptr == end || !fastqBegin(*ptr))
+        return NULL;
+
+    if ((ptr = _scanRawLine(ptr + 1, end)) == NULL)     // Fastq id
+        return NULL;
+
+    TValue * seqEnd = _scanUntil(ptr, end, qualsBegin); // Fastq sequence
+    if (seqEnd == end)
+        return NULL;
+
+    __uint64 seqLength = seqEnd - ptr;
+    for (; (ptr = _scanUntil(ptr, seqEnd, seqIgnore)) != seqEnd; ++ptr)
+        --seqLength;
+
+    if ((ptr = _scanRawLine(seqEnd + 1, end)) == NULL)  // optional 2nd Fastq id
+        return NULL;
+
+    while (seqLength != 0)                              // Fastq qualities
+    {
+        if (ptr == end)
+            return NULL;
+
+        TValue * runEnd = ptr + std::min(seqLength, static_cast<__uint64>(end - ptr));
+        TValue * ignored = _scanUntil(ptr, runEnd, qualIgnore);
+        seqLength -= ignored - ptr;
+        ptr = (ignored != runEnd) ? ignored + 1 : runEnd;
+    }
+
+    ptr = _scanUntil(ptr, end, fastqBegin);             // forward to the next '@'
+    return (ptr != end) ? ptr : NULL;
+}
+
+// ----------------------------------------------------------------------------
+// Function _readRawRecords(); Element-wise
+// ----------------------------------------------------------------------------
+// Append whole records to a char buffer until it holds maxRecords records or
+// at least minLength characters. Return the number of records appended.
+
+template <typename TTarget, typename TFwdIterator, typename TFormat, typename TSeqIgnore, typename TQualIgnore,
+          typename TSize, typename TIChunk>
+inline TSize _readRawRecords(TTarget & target, TFwdIterator & iter, TFormat const & format,
+                             TSeqIgnore const & seqIgnore, TQualIgnore const & qualIgnore,
+                             TSize maxRecords, typename Size<TTarget>::Type minLength, TIChunk)
+{
+    TSize count = 0;
+
+    for (; count < maxRecords && length(target) < minLength && !atEnd(iter); ++count)
+        _readRawRecord(target, iter, format, seqIgnore, qualIgnore);
+
+    return count;
+}
+
+// ----------------------------------------------------------------------------
+// Function _readRawRecords(); Chunked
+// ----------------------------------------------------------------------------
+// Records lying completely inside the input buffer are located by scanning
+// the buffer and copied as one block. Only a record crossing the buffer end
+// is copied through _readRawRecord().
+
+template <typename TTarget, typename TFwdIterator, typename TFormat, typename TSeqIgnore, typename TQualIgnore,
+          typename TSize, typename TValue>
+inline TSize _readRawRecords(TTarget & target, TFwdIterator & iter, TFormat const & format,
+                             TSeqIgnore const & seqIgnore, TQualIgnore const & qualIgnore,
+                             TSize maxRecords, typename Size<TTarget>::Type minLength, Range<TValue*> *)
+{
+    typedef typename Value<TFwdIterator>::Type  TIValue;
+    typedef typename Size<TTarget>::Type        TTargetSize;
+
+    TSize count = 0;
+
+    while (count < maxRecords && length(target) < minLength && !atEnd(iter))
+    {
+        Range<TIValue const *> ichunk;
+        getChunk(ichunk, iter, Input());
+        SEQAN_ASSERT(!empty(ichunk));
+
+        TIValue const * recordsEnd = ichunk.begin;
+        TTargetSize targetLength = length(target);
+
+        for (; count < maxRecords && targetLength < minLength; ++count)
+        {
+            TIValue const * nextRecord = _scanRawRecord(recordsEnd, ichunk.end, format, seqIgnore, qualIgnore);
+            if (nextRecord == NULL)
+                break;
+
+            targetLength += nextRecord - recordsEnd;
+            recordsEnd = nextRecord;
+        }
+
+        if (recordsEnd != ichunk.begin)
+        {
+            resize(target, targetLength);
+            std::copy(ichunk.begin, recordsEnd, end(target, Standard()) - (recordsEnd - ichunk.begin));
+            iter += recordsEnd - ichunk.begin;  // advance input iterator
+        }
+        else
+        {
+            _readRawRecord(target, iter, format, seqIgnore, qualIgnore);
+            ++count;
+        }
+    }
+
+    return count;
+}
+
+// ----------------------------------------------------------------------------
+// Function _readRawRecords()
+// ----------------------------------------------------------------------------
+
+template <typename TTarget, typename TFwdIterator, typename TFormat, typename TSeqIgnore, typename TQualIgnore,
+          typename TSize>
+inline TSize _readRawRecords(TTarget & target, TFwdIterator & iter, TFormat const & format,
+                             TSeqIgnore const & seqIgnore, TQualIgnore const & qualIgnore,
+                             TSize maxRecords, typename Size<TTarget>::Type minLength)
+{
+    typedef typename Chunk<TFwdIterator>::Type* TIChunk;
+
+    return _readRawRecords(target, iter, format, seqIgnore, qualIgnore, maxRecords, minLength, TIChunk());
+}
+
 // ----------------------------------------------------------------------------
 // Function writeRecord(Raw); Qualities inside seq
 // ----------------------------------------------------------------------------
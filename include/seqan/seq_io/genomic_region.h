@@ -278,6 +278,91 @@ parse(GenomicRegion & region, CharString const & regionString)
         SEQAN_THROW(ParseError("GenomicRegion: End postition less than 1"));
 }
 
+// ---------------------------------------------------------------------------
+// Function _sortRegions()
+// ---------------------------------------------------------------------------
+
+// Resolves the contig ids of a region list with the given name store cache and stores the non-empty regions sorted
+// by (rID, beginPos) in sorted.  Open ends are replaced by 0 and MaxValue<__int32>::VALUE, sortedIds receives the
+// positions of the sorted regions in the original list.  Regions on unknown contigs are dropped.
+
+template <typename TNameStoreCache>
+inline void
+_sortRegions(String<GenomicRegion> & sorted,
+             String<unsigned> & sortedIds,
+             String<GenomicRegion> const & regions,
+             TNameStoreCache const & nameStoreCache)
+{
+    typedef Triple<__int32, __int32, unsigned>                  TKey;
+    typedef typename Iterator<String<TKey>, Standard>::Type     TKeyIter;
+
+    clear(sorted);
+    clear(sortedIds);
+
+    String<TKey> keys;
+    for (unsigned i = 0; i < length(regions); ++i)
+    {
+        __int32 rID = regions[i].rID;
+        if (rID == GenomicRegion::INVALID_ID)
+        {
+            unsigned id = 0;
+            if (!getIdByName(id, nameStoreCache, regions[i].seqName))
+                continue;
+            rID = id;
+        }
+        appendValue(keys, TKey(rID, std::max(regions[i].beginPos, (__int32)0), i));
+    }
+    std::sort(begin(keys, Standard()), end(keys, Standard()));
+
+    for (TKeyIter it = begin(keys, Standard()); it != end(keys, Standard()); ++it)
+    {
+        GenomicRegion region;
+        region.seqName = regions[it->i3].seqName;
+        region.rID = it->i1;
+        region.beginPos = it->i2;
+        region.endPos = (regions[it->i3].endPos < 0) ? MaxValue<__int32>::VALUE : regions[it->i3].endPos;
+        if (region.beginPos >= region.endPos)
+            continue;
+
+        appendValue(sorted, region);
+        appendValue(sortedIds, it->i3);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Function _getOverlappingRegions()
+// ---------------------------------------------------------------------------
+
+// Stores the ascending ids of the sorted regions that overlap [beginPos, endPos) on rID in regionIds.  Intervals must
+// be queried in ascending order of (rID, beginPos).  firstRegion skips the regions that ended before and is advanced
+// accordingly.
+
+inline void
+_getOverlappingRegions(String<unsigned> & regionIds,
+                       unsigned & firstRegion,
+                       String<GenomicRegion> const & sorted,
+                       String<unsigned> const & sortedIds,
+                       __int32 rID,
+                       __int32 beginPos,
+                       __int32 endPos)
+{
+    clear(regionIds);
+
+    for (; firstRegion < length(sorted); ++firstRegion)
+        if (sorted[firstRegion].rID > rID || (sorted[firstRegion].rID == rID && sorted[firstRegion].endPos > beginPos))
+            break;
+
+    for (unsigned i = firstRegion; i < length(sorted); ++i)
+    {
+        if (sorted[i].rID != rID || sorted[i].beginPos >= endPos)
+            break;
+        if (sorted[i].endPos > beginPos)
+            appendValue(regionIds, sortedIds[i]);
+    }
+
+    std::sort(begin(regionIds, Standard()), end(regionIds, Standard()));
+}
+
 }  // namespace seqan
 
 #endif  // #ifndef INCLUDE_SEQAN_SEQ_IO_GENOMIC_REGION_H_
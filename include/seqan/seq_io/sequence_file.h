@@ -230,7 +230,14 @@ readRecord(TIdString & meta, TSeqString & seq, TQualString & qual, FormattedFile
 /*!
  * @fn SeqFileIn#readRecords
  * @brief Read many @link FormattedFileRecordConcept @endlink from a @link SeqFileIn @endlink object.
- * @signature void readRecords(metas, seqs, quals, fileIn, numRecord);
+ * @signature void readRecords(metas, seqs, quals, fileIn, numRecord[, parallelTag]);
+ *
+ * @param[in] parallelTag   Tag to enable/disable parallel parsing, defaults to @link ParallelismTags#Serial @endlink.
+ *                          Types: @link ParallelismTags @endlink.
+ *
+ * With <tt>Parallel</tt>, FASTA and FASTQ files are cut into large chunks of whole records which are parsed by all
+ * OpenMP threads. The records are returned in file order. Other formats are always read sequentially.
+ *
  * @see SeqFileIn#readRecord
  */
 
@@ -334,6 +341,212 @@ inline void readRecords(TIdStringSet & meta,
     readRecords(meta, seq, qual, file, MaxValue<__uint64>::VALUE);
 }
 
+// ----------------------------------------------------------------------------
+// Function _readRecordsChunk(); With separate qualities
+// ----------------------------------------------------------------------------
+// Parse all the records of one chunk produced by _readRawRecords().
+
+template <typename TIdStringSet, typename TSeqStringSet, typename TQualStringSet, typename TSpec, typename TFormat>
+inline void _readRecordsChunk(TIdStringSet & meta,
+                              TSeqStringSet & seq,
+                              TQualStringSet & qual,
+                              CharString & chunk,
+                              FormattedFile<Fastq, Input, TSpec> const &,
+                              TFormat const & format,
+                              True)
+{
+    typedef typename SeqFileBuffer_<TSeqStringSet, TSpec>::Type     TSeqBuffer;
+    typedef typename Iterator<CharString, Rooted>::Type             TIter;
+
+    CharString metaBuffer;
+    TSeqBuffer seqBuffer;
+    CharString qualBuffer;
+
+    for (TIter iter = begin(chunk, Rooted()); !atEnd(iter);)
+    {
+        readRecord(metaBuffer, seqBuffer, qualBuffer, iter, format);
+        appendValue(meta, metaBuffer);
+        appendValue(seq, seqBuffer);
+        appendValue(qual, qualBuffer);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _readRecordsChunk(); Without separate qualities
+// ----------------------------------------------------------------------------
+
+template <typename TIdStringSet, typename TSeqStringSet, typename TQualStringSet, typename TSpec, typename TFormat>
+inline void _readRecordsChunk(TIdStringSet & meta,
+                              TSeqStringSet & seq,
+                              TQualStringSet & /* qual */,
+                              CharString & chunk,
+                              FormattedFile<Fastq, Input, TSpec> const &,
+                              TFormat const & format,
+                              False)
+{
+    typedef typename SeqFileBuffer_<TSeqStringSet, TSpec>::Type     TSeqBuffer;
+    typedef typename Iterator<CharString, Rooted>::Type             TIter;
+
+    CharString metaBuffer;
+    TSeqBuffer seqBuffer;
+
+    // qualities inside the seq alphabet are assigned by readRecord()
+    for (TIter iter = begin(chunk, Rooted()); !atEnd(iter);)
+    {
+        readRecord(metaBuffer, seqBuffer, iter, format);
+        appendValue(meta, metaBuffer);
+        appendValue(seq, seqBuffer);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _readRecordsParallel()
+// ----------------------------------------------------------------------------
+// The file is cut into chunks of whole records by a single thread, the chunks
+// are parsed by all threads and the records are appended in file order. The
+// cutting thread only locates record boundaries in the input buffer and
+// copies whole blocks of records, the parsing is left to the workers.
+
+template <typename TIdStringSet, typename TSeqStringSet, typename TQualStringSet, typename TSpec, typename TSize,
+          typename TFormat, typename TQualAlphabet, typename TWithQuals>
+inline void _readRecordsParallel(TIdStringSet & meta,
+                                 TSeqStringSet & seq,
+                                 TQualStringSet & qual,
+                                 FormattedFile<Fastq, Input, TSpec> & file,
+                                 TSize maxRecords,
+                                 TFormat const & format,
+                                 TQualAlphabet const &,
+                                 TWithQuals const & withQuals)
+{
+    typedef typename Value<typename Value<TSeqStringSet>::Type>::Type   TSeqAlphabet;
+    typedef typename FastaIgnoreFunctor_<TSeqAlphabet>::Type            TSeqIgnore;
+    typedef typename FastaIgnoreFunctor_<TQualAlphabet>::Type           TQualIgnore;
+    typedef typename Size<CharString>::Type                             TChunkSize;
+
+    TChunkSize const CHUNK_SIZE = 1024 * 1024;
+    unsigned const chunksCount = 2 * omp_get_max_threads();
+
+    String<CharString> chunks;
+    String<TIdStringSet> chunkMeta;
+    String<TSeqStringSet> chunkSeq;
+    String<TQualStringSet> chunkQual;
+    String<std::string> errors;
+
+    resize(chunks, chunksCount);
+    resize(chunkMeta, chunksCount);
+    resize(chunkSeq, chunksCount);
+    resize(chunkQual, chunksCount);
+    resize(errors, chunksCount);
+
+    while (!atEnd(file) && maxRecords > 0)
+    {
+        // Cut the next chunks at record boundaries.
+        unsigned chunksRead = 0;
+        for (; chunksRead < chunksCount && !atEnd(file) && maxRecords > 0; ++chunksRead)
+        {
+            clear(chunks[chunksRead]);
+            maxRecords -= _readRawRecords(chunks[chunksRead], file.iter, format, TSeqIgnore(), TQualIgnore(),
+                                          maxRecords, CHUNK_SIZE);
+        }
+
+        // Parse the chunks.
+        SEQAN_OMP_PRAGMA(parallel for schedule(dynamic))
+        for (int i = 0; i < (int)chunksRead; ++i)
+        {
+            clear(chunkMeta[i]);
+            clear(chunkSeq[i]);
+            clear(chunkQual[i]);
+            clear(errors[i]);
+
+            try
+            {
+                _readRecordsChunk(chunkMeta[i], chunkSeq[i], chunkQual[i], chunks[i], file, format, withQuals);
+            }
+            catch (ParseError const & e)
+            {
+                errors[i] = e.what();
+            }
+        }
+
+        // Append the records in file order.
+        for (unsigned i = 0; i < chunksRead; ++i)
+        {
+            if (!errors[i].empty())
+                throw ParseError(errors[i]);
+
+            append(meta, chunkMeta[i]);
+            append(seq, chunkSeq[i]);
+            if (TWithQuals::VALUE)
+                append(qual, chunkQual[i]);
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function readRecords(); Parallel
+// ----------------------------------------------------------------------------
+
+template <typename TIdStringSet, typename TSeqStringSet, typename TSpec, typename TSize>
+inline void readRecords(TIdStringSet & meta,
+                        TSeqStringSet & seq,
+                        FormattedFile<Fastq, Input, TSpec> & file,
+                        TSize maxRecords,
+                        Parallel)
+{
+    typedef typename Value<typename Value<TSeqStringSet>::Type>::Type   TSeqAlphabet;
+
+    StringSet<CharString> qual;
+
+    if (isEqual(file.format, Fastq()))
+        _readRecordsParallel(meta, seq, qual, file, maxRecords, Fastq(), TSeqAlphabet(), False());
+    else if (isEqual(file.format, Fasta()))
+        _readRecordsParallel(meta, seq, qual, file, maxRecords, Fasta(), TSeqAlphabet(), False());
+    else
+        readRecords(meta, seq, file, maxRecords);
+}
+
+template <typename TIdStringSet, typename TSeqStringSet, typename TQualStringSet, typename TSpec, typename TSize>
+inline void readRecords(TIdStringSet & meta,
+                        TSeqStringSet & seq,
+                        TQualStringSet & qual,
+                        FormattedFile<Fastq, Input, TSpec> & file,
+                        TSize maxRecords,
+                        Parallel)
+{
+    // qualities are parsed into a CharString buffer
+    if (isEqual(file.format, Fastq()))
+        _readRecordsParallel(meta, seq, qual, file, maxRecords, Fastq(), char(), True());
+    else if (isEqual(file.format, Fasta()))
+        _readRecordsParallel(meta, seq, qual, file, maxRecords, Fasta(), char(), True());
+    else
+        readRecords(meta, seq, qual, file, maxRecords);
+}
+
+// ----------------------------------------------------------------------------
+// Function readRecords(); Serial
+// ----------------------------------------------------------------------------
+
+template <typename TIdStringSet, typename TSeqStringSet, typename TSpec, typename TSize>
+inline void readRecords(TIdStringSet & meta,
+                        TSeqStringSet & seq,
+                        FormattedFile<Fastq, Input, TSpec> & file,
+                        TSize maxRecords,
+                        Serial)
+{
+    readRecords(meta, seq, file, maxRecords);
+}
+
+template <typename TIdStringSet, typename TSeqStringSet, typename TQualStringSet, typename TSpec, typename TSize>
+inline void readRecords(TIdStringSet & meta,
+                        TSeqStringSet & seq,
+                        TQualStringSet & qual,
+                        FormattedFile<Fastq, Input, TSpec> & file,
+                        TSize maxRecords,
+                        Serial)
+{
+    readRecords(meta, seq, qual, file, maxRecords);
+}
+
 // ----------------------------------------------------------------------------
 // Function writeRecord()
 // ----------------------------------------------------------------------------
@@ -60,6 +60,39 @@ namespace seqan {
  * @tparam TSpec  Tag for further specializing Alloc String.  Default is <tt>void</tt>.
  */
 
+/*!
+ * @tag AllocString#OverAligned
+ * @headerfile <seqan/sequence.h>
+ * @brief Alloc String that allocates its storage with the alignment of the value type.
+ *
+ * @signature typedef Tag<OverAligned_> OverAligned;
+ *
+ * The default allocator only guarantees the alignment of <tt>operator new</tt>.  Use
+ * <tt>String&lt;TValue, Alloc&lt;OverAligned&gt; &gt;</tt> for value types with a stricter alignment, e.g. for
+ * @link SimdVector @endlink types.
+ */
+
+struct OverAligned_;
+typedef Tag<OverAligned_> OverAligned;
+
+/*!
+ * @tag AllocString#Arena
+ * @headerfile <seqan/sequence.h>
+ * @brief Alloc String that allocates its storage from the @link threadLocalArena @endlink of the calling thread.
+ *
+ * @signature template <typename TParentAllocator>
+ *            class String<TValue, Alloc<Arena<TParentAllocator> > >;
+ *
+ * Growing and destroying such a string never returns memory to the heap.  The storage of all arena strings built by
+ * a thread is released at once by <tt>reset(threadLocalArena())</tt>, which makes them well suited for short-lived
+ * per-batch data.  A @link StringSet @endlink of arena strings keeps its limits in the arena as well, and a
+ * <tt>StringSet&lt;String&lt;TValue, Alloc&lt;Arena&lt;&gt; &gt; &gt;, Owner&lt;ConcatDirect&lt;&gt; &gt; &gt;</tt>
+ * is entirely arena-backed.
+ *
+ * Arena strings must not be accessed after the arena has been reset, but destroying them afterwards is safe.  They
+ * must be grown by the thread that created them.
+ */
+
 // TODO(holtgrew): Where is Alloc<> defined? In module base?
 
 template <typename TValue, typename TSpec>
@@ -376,6 +409,127 @@ _deallocateStorage(String<TValue, Alloc<TSpec> > & me,
     deallocate(me, ptr, size, TagAllocateStorage());
 }
 
+// ----------------------------------------------------------------------------
+// Function allocate()                                            [OverAligned]
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TValue2, typename TSize, typename TUsage>
+inline void
+allocate(String<TValue, Alloc<OverAligned> > const & /*me*/,
+         TValue2 * & data,
+         TSize count,
+         Tag<TUsage> const &)
+{
+#ifdef PLATFORM_WINDOWS_VS
+    data = (TValue2 *) _aligned_malloc(count * sizeof(TValue2), __alignof(TValue2));
+#else
+    const size_t align = (__alignof__(TValue2) < sizeof(void*)) ? sizeof(void*) : __alignof__(TValue2);
+    void * ptr = NULL;
+    if (posix_memalign(&ptr, align, count * sizeof(TValue2)))
+        ptr = NULL;
+    data = static_cast<TValue2 *>(ptr);
+#endif
+
+#ifdef SEQAN_PROFILE
+    if (data)
+        SEQAN_PROADD(SEQAN_PROMEMORY, count * sizeof(TValue2));
+#endif
+}
+
+template <typename TValue, typename TValue2, typename TSize, typename TUsage>
+inline void
+allocate(String<TValue, Alloc<OverAligned> > & me,
+         TValue2 * & data,
+         TSize count,
+         Tag<TUsage> const & tag)
+{
+    allocate(static_cast<String<TValue, Alloc<OverAligned> > const &>(me), data, count, tag);
+}
+
+// ----------------------------------------------------------------------------
+// Function deallocate()                                          [OverAligned]
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TValue2, typename TSize, typename TUsage>
+inline void
+deallocate(String<TValue, Alloc<OverAligned> > const & /*me*/,
+           TValue2 * data,
+#ifdef SEQAN_PROFILE
+           TSize count,
+#else
+           TSize,
+#endif
+           Tag<TUsage> const)
+{
+#ifdef SEQAN_PROFILE
+    if (data && count)
+        SEQAN_PROSUB(SEQAN_PROMEMORY, count * sizeof(TValue2));
+#endif
+#ifdef PLATFORM_WINDOWS_VS
+    _aligned_free((void *) data);
+#else
+    free((void *) data);
+#endif
+}
+
+template <typename TValue, typename TValue2, typename TSize, typename TUsage>
+inline void
+deallocate(String<TValue, Alloc<OverAligned> > & me,
+           TValue2 * data,
+           TSize count,
+           Tag<TUsage> const tag)
+{
+    deallocate(static_cast<String<TValue, Alloc<OverAligned> > const &>(me), data, count, tag);
+}
+
+// ----------------------------------------------------------------------------
+// Function allocate()                                                  [Arena]
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TParentAllocator, typename TValue2, typename TSize, typename TUsage>
+inline void
+allocate(String<TValue, Alloc<Arena<TParentAllocator> > > const & /*me*/,
+         TValue2 * & data,
+         TSize count,
+         Tag<TUsage> const & tag)
+{
+    allocate(threadLocalArena<TParentAllocator>(), data, count, tag);
+}
+
+template <typename TValue, typename TParentAllocator, typename TValue2, typename TSize, typename TUsage>
+inline void
+allocate(String<TValue, Alloc<Arena<TParentAllocator> > > & me,
+         TValue2 * & data,
+         TSize count,
+         Tag<TUsage> const & tag)
+{
+    allocate(static_cast<String<TValue, Alloc<Arena<TParentAllocator> > > const &>(me), data, count, tag);
+}
+
+// ----------------------------------------------------------------------------
+// Function deallocate()                                                [Arena]
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TParentAllocator, typename TValue2, typename TSize, typename TUsage>
+inline void
+deallocate(String<TValue, Alloc<Arena<TParentAllocator> > > const & /*me*/,
+           TValue2 * /*data*/,
+           TSize /*count*/,
+           Tag<TUsage> const)
+{
+    // The storage is released by reset(threadLocalArena()).
+}
+
+template <typename TValue, typename TParentAllocator, typename TValue2, typename TSize, typename TUsage>
+inline void
+deallocate(String<TValue, Alloc<Arena<TParentAllocator> > > & me,
+           TValue2 * data,
+           TSize count,
+           Tag<TUsage> const tag)
+{
+    deallocate(static_cast<String<TValue, Alloc<Arena<TParentAllocator> > > const &>(me), data, count, tag);
+}
+
 // ----------------------------------------------------------------------------
 // Function move()
 // ----------------------------------------------------------------------------
@@ -58,6 +58,13 @@
 #include <unistd.h>
 #endif
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 #include <seqan/basic.h>
 #include <seqan/file.h>
 #include <seqan/sequence.h>
@@ -94,11 +101,13 @@
 #include <seqan/stream/iostream_zutil.h>
 #include <seqan/stream/iostream_zip.h>
 #include <seqan/stream/iostream_zip_impl.h>
+#include <seqan/stream/iostream_prefetch.h>
 #include <seqan/stream/iostream_bgzf.h>
 #endif
 
 #if SEQAN_HAS_BZIP2
 #include <seqan/stream/iostream_bzip2.h>
+#include <seqan/stream/iostream_bzip2_parallel.h>
 #endif
 
 #include <seqan/stream/virtual_stream.h>
@@ -31,6 +31,12 @@ const unsigned ZLIB_BLOCK_OVERHEAD = 5; // 5 bytes block overhead (see 3.2.4. at
 // always fits in one block even for level Z_NO_COMPRESSION.
 const unsigned BGZF_BLOCK_SIZE = BGZF_MAX_BLOCK_SIZE - BGZF_BLOCK_HEADER_LENGTH - BGZF_BLOCK_FOOTER_LENGTH - ZLIB_BLOCK_OVERHEAD;
 
+// Number of (de)compression threads used if 0 is given.
+const unsigned BGZF_DEFAULT_THREADS = 16;
+
+// Number of recently inflated blocks kept for backward seeks.
+const unsigned BGZF_DEFAULT_CACHE_BLOCKS = 4;
+
 // ===========================================================================
 // Classes
 // ===========================================================================
@@ -57,7 +63,7 @@ public:
     typedef typename Tr::char_type char_type;
     typedef typename Tr::int_type int_type;
 
-    typedef ConcurrentQueue<size_t, Suspendable<Limit> > TJobQueue;
+    typedef ConcurrentQueue<size_t, Suspendable<LockFree> > TJobQueue;
 
     struct OutputBuffer
     {
@@ -145,21 +151,21 @@ public:
     Thread<CompressionThread>   *threads;
 
     basic_bgzf_streambuf(ostream_reference ostream_,
-                         size_t numThreads = 16,
+                         size_t numThreads = BGZF_DEFAULT_THREADS,
                          size_t jobsPerThread = 8) :
-        numThreads(numThreads),
-        numJobs(numThreads * jobsPerThread),
+        numThreads((numThreads != 0)? numThreads : BGZF_DEFAULT_THREADS),
+        numJobs(this->numThreads * jobsPerThread),
         jobQueue(numJobs),
         idleQueue(numJobs),
-        serializer(ostream_, numThreads * jobsPerThread)
+        serializer(ostream_, numJobs)
     {
         resize(jobs, numJobs, Exact());
         currentJobId = 0;
 
         lockWriting(jobQueue);
         lockReading(idleQueue);
-        setReaderWriterCount(jobQueue, numThreads, 1);
-        setReaderWriterCount(idleQueue, 1, numThreads);
+        setReaderWriterCount(jobQueue, this->numThreads, 1);
+        setReaderWriterCount(idleQueue, 1, this->numThreads);
 
         for (unsigned i = 0; i < numJobs; ++i)
         {
@@ -168,8 +174,8 @@ public:
             SEQAN_ASSERT(success);
         }
 
-        threads = new Thread<CompressionThread>[numThreads];
-        for (unsigned i = 0; i < numThreads; ++i)
+        threads = new Thread<CompressionThread>[this->numThreads];
+        for (unsigned i = 0; i < this->numThreads; ++i)
         {
             threads[i].worker.streamBuf = this;
             threads[i].worker.threadNum = i;
@@ -227,7 +233,8 @@ public:
         {
             CompressionJob &job = jobs[currentJobId];
             this->setp(&job.buffer[0], &job.buffer[0] + (job.buffer.size() - 1));
-            return c;
+            // sync() calls overflow(EOF) and must not mistake success for an error
+            return Tr::not_eof(c);
         }
         else
         {
@@ -303,7 +310,7 @@ public:
     typedef typename Tr::pos_type pos_type;
 
     typedef std::vector<char_type, char_allocator_type>     TBuffer;
-    typedef ConcurrentQueue<int, Suspendable<Limit> >       TJobQueue;
+    typedef ConcurrentQueue<int, Suspendable<LockFree> >    TJobQueue;
 
     static const size_t MAX_PUTBACK = 4;
 
@@ -370,6 +377,27 @@ public:
     TJobQueue                   todoQueue;
     int                         currentJobId;
 
+    // LRU cache of released blocks, filled by swapping buffers with the released jobs
+    struct CachedBlock
+    {
+        TBuffer         buffer;
+        off_type        fileOfs;
+        unsigned        compressedSize;
+        int             size;
+        __uint64        lastUse;
+
+        CachedBlock() :
+            fileOfs(-1),
+            compressedSize(0),
+            size(0),
+            lastUse(0)
+        {}
+    };
+
+    String<CachedBlock>         cache;
+    __uint64                    cacheTick;
+    int                         currentCacheId;     // >= 0 if the current block is served from the cache
+
     struct DecompressionThread
     {
         basic_unbgzf_streambuf          *streamBuf;
@@ -389,6 +417,7 @@ public:
 
                 DecompressionJob &job = streamBuf->jobs[jobId];
                 size_t tailLen = 0;
+                bool inflate = false;
 
                 // typically the idle queue contains only ready jobs
                 // however, if seek() fast forwards running jobs into the todoQueue
@@ -459,6 +488,7 @@ public:
                         job.compressedSize = BGZF_BLOCK_HEADER_LENGTH + tailLen;
                         streamBuf->serializer.fileOfs += job.compressedSize;
                         job.ready = false;
+                        inflate = true;
 
                     eofSkip:
                         streamBuf->serializer.istream.clear(
@@ -477,7 +507,8 @@ public:
                     }
                 }
 
-                if (!job.ready)
+                // job.ready must not be read here, as the job can already be recycled by seek()
+                if (inflate)
                 {
                     // decompress block
                     job.size = _decompressBlock(
@@ -500,22 +531,26 @@ public:
     TBuffer                     putbackBuffer;
 
     basic_unbgzf_streambuf(istream_reference istream_,
-                           size_t numThreads = 16,
-                           size_t jobsPerThread = 8) :
+                           size_t numThreads = BGZF_DEFAULT_THREADS,
+                           size_t jobsPerThread = 8,
+                           size_t cacheBlocks = BGZF_DEFAULT_CACHE_BLOCKS) :
         serializer(istream_),
-        numThreads(numThreads),
-        numJobs(numThreads * jobsPerThread),
+        numThreads((numThreads != 0)? numThreads : BGZF_DEFAULT_THREADS),
+        numJobs(this->numThreads * jobsPerThread),
         runningQueue(numJobs),
         todoQueue(numJobs),
+        cacheTick(0),
+        currentCacheId(-1),
         putbackBuffer(MAX_PUTBACK)
     {
         resize(jobs, numJobs, Exact());
+        resize(cache, cacheBlocks, Exact());
         currentJobId = -1;
 
         lockReading(runningQueue);
         lockWriting(todoQueue);
-        setReaderWriterCount(runningQueue, 1, numThreads);
-        setReaderWriterCount(todoQueue, numThreads, 1);
+        setReaderWriterCount(runningQueue, 1, this->numThreads);
+        setReaderWriterCount(todoQueue, this->numThreads, 1);
 
         for (unsigned i = 0; i < numJobs; ++i)
         {
@@ -524,8 +559,8 @@ public:
             SEQAN_ASSERT(success);
         }
 
-        threads = new Thread<DecompressionThread>[numThreads];
-        for (unsigned i = 0; i < numThreads; ++i)
+        threads = new Thread<DecompressionThread>[this->numThreads];
+        for (unsigned i = 0; i < this->numThreads; ++i)
         {
             threads[i].worker.streamBuf = this;
             run(threads[i]);
@@ -542,12 +577,85 @@ public:
         delete[] threads;
     }
 
+    // Keep the block of a released job by swapping its buffer with the least recently used cache entry.
+    void cacheJob(DecompressionJob &job, int protectedId = -1)
+    {
+        if (empty(cache) || job.size <= 0)
+            return;
+
+        int victim = -1;
+        for (unsigned i = 0; i < length(cache); ++i)
+        {
+            if ((int)i == protectedId)
+                continue;
+            if (cache[i].fileOfs == job.fileOfs)
+            {
+                cache[i].lastUse = ++cacheTick;
+                return;
+            }
+            if (victim < 0 || cache[i].lastUse < cache[victim].lastUse)
+                victim = i;
+        }
+        if (victim < 0)
+            return;
+
+        CachedBlock &block = cache[victim];
+        if (block.buffer.size() != job.buffer.size())
+            block.buffer.resize(job.buffer.size());
+        block.buffer.swap(job.buffer);
+        block.fileOfs = job.fileOfs;
+        block.compressedSize = job.compressedSize;
+        block.size = job.size;
+        block.lastUse = ++cacheTick;
+    }
+
+    int findCachedBlock(off_type fileOfs)
+    {
+        for (unsigned i = 0; i < length(cache); ++i)
+            if (cache[i].fileOfs == fileOfs && cache[i].size > 0)
+                return i;
+        return -1;
+    }
+
+    // file offset, compressed size, and buffer of the current block
+    bool currentBlock(off_type &fileOfs, unsigned &compressedSize, char_type *&buffer)
+    {
+        if (currentCacheId >= 0)
+        {
+            CachedBlock &block = cache[currentCacheId];
+            fileOfs = block.fileOfs;
+            compressedSize = block.compressedSize;
+            buffer = &block.buffer[0];
+            return true;
+        }
+        if (currentJobId >= 0)
+        {
+            DecompressionJob &job = jobs[currentJobId];
+            fileOfs = job.fileOfs;
+            compressedSize = job.compressedSize;
+            buffer = &job.buffer[0];
+            return true;
+        }
+        return false;
+    }
+
     int_type underflow()
     {
         // no need to use the next buffer?
         if (this->gptr() && this->gptr() < this->egptr())
             return Tr::to_int_type(*this->gptr());
 
+        // continue behind a cached block by seeking to its successor
+        if (currentCacheId >= 0)
+        {
+            CachedBlock &block = cache[currentCacheId];
+            off_type nextFileOfs = block.fileOfs + block.compressedSize;
+            currentCacheId = -1;
+            if (seekoff(nextFileOfs << 16, std::ios_base::beg, std::ios_base::in) == pos_type(off_type(-1)))
+                return EOF;
+            return this->underflow();
+        }
+
         size_t putback = this->gptr() - this->eback();
         if (putback > MAX_PUTBACK)
             putback = MAX_PUTBACK;
@@ -560,7 +668,10 @@ public:
                 &putbackBuffer[0]);
 
         if (currentJobId >= 0)
+        {
+            cacheJob(jobs[currentJobId]);
             appendValue(todoQueue, currentJobId);
+        }
 
         while (true)
         {
@@ -609,20 +720,23 @@ public:
     {
         if ((openMode & (std::ios_base::in | std::ios_base::out)) == std::ios_base::in)
         {
+            off_type fileOfs;
+            unsigned compressedSize;
+            char_type *buffer;
+
             if (dir == std::ios_base::cur && ofs >= 0)
             {
                 // forward delta seek
-                while (currentJobId < 0 || this->egptr() - this->gptr() < ofs)
+                while ((currentJobId < 0 && currentCacheId < 0) || this->egptr() - this->gptr() < ofs)
                 {
                     ofs -= this->egptr() - this->gptr();
+                    this->setg(this->eback(), this->egptr(), this->egptr());
                     if (this->underflow() == EOF)
                         break;
                 }
 
-                if (currentJobId >= 0 && ofs <= this->egptr() - this->gptr())
+                if (currentBlock(fileOfs, compressedSize, buffer) && ofs <= this->egptr() - this->gptr())
                 {
-                    DecompressionJob &job = jobs[currentJobId];
-
                     // reset buffer pointers
                     this->setg(
                           this->eback(),            // beginning of putback area
@@ -630,9 +744,9 @@ public:
                           this->egptr());           // end of buffer
 
                     if (this->gptr() != this->egptr())
-                        return pos_type((job.fileOfs << 16) + ((this->gptr() - &job.buffer[MAX_PUTBACK])));
+                        return pos_type((fileOfs << 16) + ((this->gptr() - &buffer[MAX_PUTBACK])));
                     else
-                        return pos_type((job.fileOfs + job.compressedSize) << 16);
+                        return pos_type((fileOfs + compressedSize) << 16);
                 }
 
             }
@@ -642,19 +756,42 @@ public:
                 std::streampos destFileOfs = ofs >> 16;
 
                 // are we in the same block?
-                if (currentJobId >= 0 && jobs[currentJobId].fileOfs == (off_type)destFileOfs)
+                if (currentBlock(fileOfs, compressedSize, buffer) && fileOfs == (off_type)destFileOfs)
                 {
-                    DecompressionJob &job = jobs[currentJobId];
-
                     // reset buffer pointers
                     this->setg(
                           this->eback(),                                        // beginning of putback area
-                          &job.buffer[0] + (MAX_PUTBACK + (ofs & 0xffff)),      // read position
+                          buffer + (MAX_PUTBACK + (ofs & 0xffff)),              // read position
                           this->egptr());                                       // end of buffer
                     return ofs;
                 }
 
+                // was the block inflated recently?
+                int cacheId = findCachedBlock((off_type)destFileOfs);
+                if (cacheId >= 0)
+                {
+                    CachedBlock &block = cache[cacheId];
+                    block.lastUse = ++cacheTick;
+
+                    // the running queue still prefetches the successors of the released block
+                    if (currentJobId >= 0)
+                    {
+                        cacheJob(jobs[currentJobId], cacheId);
+                        appendValue(todoQueue, currentJobId);
+                        currentJobId = -1;
+                    }
+                    currentCacheId = cacheId;
+
+                    // reset buffer pointers
+                    this->setg(
+                          &block.buffer[0] + MAX_PUTBACK,                       // no putback area
+                          &block.buffer[0] + (MAX_PUTBACK + (ofs & 0xffff)),    // read position
+                          &block.buffer[0] + (MAX_PUTBACK + block.size));       // end of buffer
+                    return ofs;
+                }
+
                 // ok, different block
+                currentCacheId = -1;
                 {
                     ScopedLock<Mutex> scopedLock(serializer.lock);
 
@@ -662,7 +799,10 @@ public:
                     // find our seek target
 
                     if (currentJobId >= 0)
+                    {
+                        cacheJob(jobs[currentJobId]);
                         appendValue(todoQueue, currentJobId);
+                    }
 
                     // Note that if we are here the current job does not represent the sought block.
                     // Hence if the running queue is empty we need to explicitly unset the jobId,
@@ -751,8 +891,8 @@ public:
     typedef std::basic_ostream<Elem, Tr>&                        ostream_reference;
     typedef basic_bgzf_streambuf<Elem, Tr, ElemA, ByteT, ByteAT> bgzf_streambuf_type;
 
-    basic_bgzf_ostreambase(ostream_reference ostream_)
-        : m_buf(ostream_)
+    basic_bgzf_ostreambase(ostream_reference ostream_, size_t numThreads = BGZF_DEFAULT_THREADS)
+        : m_buf(ostream_, numThreads)
     {
         this->init(&m_buf );
     };
@@ -789,8 +929,8 @@ public:
     typedef std::basic_istream<Elem, Tr>&                           istream_reference;
     typedef basic_unbgzf_streambuf<Elem, Tr, ElemA, ByteT, ByteAT>  unbgzf_streambuf_type;
 
-    basic_bgzf_istreambase(istream_reference ostream_)
-        : m_buf(ostream_)
+    basic_bgzf_istreambase(istream_reference ostream_, size_t numThreads = BGZF_DEFAULT_THREADS)
+        : m_buf(ostream_, numThreads)
     {
         this->init(&m_buf );
     };
@@ -831,8 +971,8 @@ public:
     typedef std::basic_ostream<Elem,Tr>                        ostream_type;
     typedef ostream_type&                                      ostream_reference;
 
-    basic_bgzf_ostream(ostream_reference ostream_) :
-        bgzf_ostreambase_type(ostream_),
+    basic_bgzf_ostream(ostream_reference ostream_, size_t numThreads = BGZF_DEFAULT_THREADS) :
+        bgzf_ostreambase_type(ostream_, numThreads),
         ostream_type(bgzf_ostreambase_type::rdbuf())
     {}
 
@@ -876,8 +1016,8 @@ public:
     typedef istream_type &                                     istream_reference;
     typedef char                                               byte_type;
 
-    basic_bgzf_istream(istream_reference istream_) :
-        bgzf_istreambase_type(istream_),
+    basic_bgzf_istream(istream_reference istream_, size_t numThreads = BGZF_DEFAULT_THREADS) :
+        bgzf_istreambase_type(istream_, numThreads),
         istream_type(bgzf_istreambase_type::rdbuf()),
         m_is_gzip(false),
         m_gbgzf_data_size(0)
@@ -918,6 +1058,38 @@ typedef basic_bgzf_istream<char> bgzf_istream;
 // A typedef for basic_bgzf_istream<wchart>
 typedef basic_bgzf_istream<wchar_t> bgzf_wistream;
 
+// ===========================================================================
+// Functions
+// ===========================================================================
+
+// ---------------------------------------------------------------------------
+// Function _mergeBgzfChunks()
+// ---------------------------------------------------------------------------
+
+// Sorts a list of [begin, end) virtual offset ranges and merges overlapping or adjacent ones, such that every
+// compressed block is visited at most once when the chunks are read in order.
+
+inline void
+_mergeBgzfChunks(String<Pair<__uint64, __uint64> > & chunks)
+{
+    typedef Iterator<String<Pair<__uint64, __uint64> >, Standard>::Type TIter;
+
+    if (empty(chunks))
+        return;
+
+    std::sort(begin(chunks, Standard()), end(chunks, Standard()));
+
+    TIter dst = begin(chunks, Standard());
+    for (TIter it = dst + 1; it != end(chunks, Standard()); ++it)
+    {
+        if (it->i1 <= dst->i2)
+            dst->i2 = std::max(dst->i2, it->i2);
+        else
+            *++dst = *it;
+    }
+    resize(chunks, (dst - begin(chunks, Standard())) + 1);
+}
+
 }  // namespace seqan
 
 #endif // INCLUDE_SEQAN_STREAM_IOSTREAM_BGZF_H_
@@ -0,0 +1,744 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2015, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: SeqAn Team <seqan-dev@lists.fu-berlin.de>
+// ==========================================================================
+// Parallel bzip2 decompression.  The blocks of a bzip2 stream are coded
+// independently but are not byte-aligned.  A serial reader locates the
+// 48-bit block magics at any bit offset and hands each block to a worker
+// thread, which wraps it into a single-block stream of its own and
+// decompresses it with libbz2.  The block magic may also occur inside
+// compressed data; such a false split fails to decode and the consumer
+// then merges the affected blocks and decodes them in one piece.
+// ==========================================================================
+
+#ifndef INCLUDE_SEQAN_STREAM_IOSTREAM_BZIP2_PARALLEL_H_
+#define INCLUDE_SEQAN_STREAM_IOSTREAM_BZIP2_PARALLEL_H_
+
+namespace seqan {
+
+// ============================================================================
+// Classes
+// ============================================================================
+
+// --------------------------------------------------------------------------
+// Class Bzip2BitBuffer_
+// --------------------------------------------------------------------------
+// Bit string in bzip2 order, i.e. most significant bit first.
+
+struct Bzip2BitBuffer_
+{
+    std::vector<unsigned char>  data;
+    __uint64                    bits;
+
+    Bzip2BitBuffer_() :
+        bits(0)
+    {}
+
+    void clear()
+    {
+        data.clear();
+        bits = 0;
+    }
+
+    // append the n <= 57 lowest bits of value
+    void appendBits(__uint64 value, unsigned n)
+    {
+        while (n != 0)
+        {
+            unsigned freeBits = 8 - (bits & 7);
+            if (freeBits == 8)
+                data.push_back(0);
+
+            unsigned take = std::min(freeBits, n);
+            unsigned char chunk = (value >> (n - take)) & ((1u << take) - 1);
+            data.back() |= chunk << (freeBits - take);
+            bits += take;
+            n -= take;
+        }
+    }
+
+    // append n bits of src starting at bit position pos
+    void append(unsigned char const *src, __uint64 pos, __uint64 n)
+    {
+        data.reserve(data.size() + (n >> 3) + 2);
+        unsigned shift = pos & 7;
+        src += pos >> 3;
+        if (shift == 0)
+        {
+            for (; n >= 8; n -= 8, ++src)
+                appendBits(*src, 8);
+        }
+        else
+        {
+            for (; n >= 8; n -= 8, ++src)
+                appendBits(((src[0] << 8) | src[1]) >> (8 - shift), 8);
+        }
+        if (n != 0)
+        {
+            unsigned window = src[0] << 8;
+            if (shift + n > 8)
+                window |= src[1];
+            appendBits(window >> (16 - shift - n), n);
+        }
+    }
+
+    void truncate(__uint64 n)
+    {
+        bits = n;
+        data.resize((n + 7) >> 3);
+        if (n & 7)
+            data.back() &= 0xff << (8 - (n & 7));
+    }
+};
+
+// --------------------------------------------------------------------------
+// Class Bzip2BlockReader_
+// --------------------------------------------------------------------------
+// Splits the compressed input into blocks.  Not thread-safe, the caller
+// must hold the reader lock.
+
+template <typename TIStream>
+struct Bzip2BlockReader_
+{
+    static const __uint64 BLOCK_MAGIC = 0x314159265359ull;
+    static const __uint64 EOS_MAGIC = 0x177245385090ull;
+    static const size_t READ_SIZE = 1024 * 1024;
+
+    enum State
+    {
+        STREAM_HEADER,
+        BLOCK_MAGIC_OR_EOS,
+        DONE
+    };
+
+    TIStream                    &istream;
+    Mutex                       lock;
+    IOError                     *error;
+
+    std::vector<unsigned char>  in;         // read bytes followed by 8 zero bytes at EOF
+    size_t                      inSize;     // number of read bytes
+    bool                        eof;
+    __uint64                    bitPos;
+    State                       state;
+    unsigned char               level;
+
+    // candidate (shift, magic) pairs keyed by the second window byte
+    unsigned short              candidates[256];
+
+    Bzip2BlockReader_(TIStream &istream) :
+        istream(istream),
+        lock(false),
+        error(NULL),
+        inSize(0),
+        eof(false),
+        bitPos(0),
+        state(STREAM_HEADER),
+        level('9')
+    {
+        std::fill(candidates, candidates + 256, 0);
+        for (unsigned k = 0; k < 8; ++k)
+        {
+            candidates[(BLOCK_MAGIC >> (32 + k)) & 0xff] |= 1 << (2 * k);
+            candidates[(EOS_MAGIC >> (32 + k)) & 0xff] |= 1 << (2 * k + 1);
+        }
+    }
+
+    ~Bzip2BlockReader_()
+    {
+        delete error;
+    }
+
+    bool _fill()
+    {
+        if (eof)
+            return false;
+
+        in.resize(inSize + READ_SIZE);
+        istream.read((char*)&in[inSize], READ_SIZE);
+        size_t n = istream.gcount();
+        inSize += n;
+        in.resize(inSize);
+
+        if (!istream.good())
+        {
+            eof = true;
+            if (!istream.eof())
+                error = new IOError("Stream read error.");
+            istream.clear(istream.rdstate() & ~std::ios_base::failbit);
+            in.resize(inSize + 8, 0);
+        }
+        return n != 0;
+    }
+
+    // make sure that n bytes are available, pads the buffer at EOF
+    bool _avail(size_t n)
+    {
+        while (inSize < n && _fill()) ;
+        return inSize >= n;
+    }
+
+    __uint64 _getBits(__uint64 pos, unsigned n) const
+    {
+        unsigned char const *p = &in[pos >> 3];
+        __uint64 w = 0;
+        for (unsigned i = 0; i < 8; ++i)
+            w = (w << 8) | p[i];
+        return (w >> (64 - (pos & 7) - n)) & ((1ull << n) - 1);
+    }
+
+    // returns the bit position of the next magic at or after pos, or -1 at the end of input
+    __int64 _findMagic(__uint64 pos, bool &isEos)
+    {
+        for (size_t i = pos >> 3; ; ++i)
+        {
+            if (!_avail(i + 8) && i >= inSize)
+                return -1;
+
+            unsigned short cand = candidates[in[i + 1]];
+            for (unsigned k = 0; cand != 0; ++k, cand >>= 2)
+            {
+                if ((cand & 3) == 0)
+                    continue;
+
+                __uint64 p = i * 8 + k;
+                if (p < pos || p + 48 > inSize * 8)
+                    continue;
+
+                __uint64 magic = _getBits(p, 48);
+                if (magic == BLOCK_MAGIC || magic == EOS_MAGIC)
+                {
+                    isEos = (magic == EOS_MAGIC);
+                    return p;
+                }
+            }
+        }
+    }
+
+    // an end-of-stream magic must be followed by the end of input or a new stream header
+    bool _isValidEos(__uint64 pos)
+    {
+        size_t next = (pos + 48 + 32 + 7) >> 3;
+        if (!_avail(next + 1))
+            return true;
+        return _avail(next + 4) && _isStreamHeader(next);
+    }
+
+    bool _isStreamHeader(size_t i) const
+    {
+        return in[i] == 'B' && in[i + 1] == 'Z' && in[i + 2] == 'h' && in[i + 3] >= '1' && in[i + 3] <= '9';
+    }
+
+    void _discardConsumed()
+    {
+        size_t consumed = bitPos >> 3;
+        if (consumed == 0)
+            return;
+        in.erase(in.begin(), in.begin() + consumed);
+        inSize -= consumed;
+        bitPos &= 7;
+    }
+
+    bool _fail(char const *msg)
+    {
+        if (error == NULL)
+            error = new IOError(msg);
+        state = DONE;
+        return false;
+    }
+
+    // extracts the next block as a single-block stream (without trailer)
+    // returns false at the end of input or on error
+    bool nextBlock(Bzip2BitBuffer_ &raw, __uint32 &crc, bool &endsStream)
+    {
+        while (state != DONE)
+        {
+            if (error != NULL)
+                return _fail("Stream read error.");
+
+            _discardConsumed();
+
+            if (state == STREAM_HEADER)
+            {
+                SEQAN_ASSERT_EQ(bitPos & 7, 0u);
+                if (!_avail((bitPos >> 3) + 1))
+                {
+                    state = DONE;
+                    break;
+                }
+                if (!_avail((bitPos >> 3) + 4) || !_isStreamHeader(bitPos >> 3))
+                    return _fail("Invalid bzip2 stream header.");
+
+                level = in[(bitPos >> 3) + 3];
+                bitPos += 32;
+                state = BLOCK_MAGIC_OR_EOS;
+                continue;
+            }
+
+            if (!_avail((bitPos + 48 + 32 + 7) >> 3))
+                return _fail("Unexpected end of bzip2 stream.");
+
+            __uint64 magic = _getBits(bitPos, 48);
+            if (magic == EOS_MAGIC)
+            {
+                bitPos = (bitPos + 48 + 32 + 7) & ~(__uint64)7;
+                state = STREAM_HEADER;
+                continue;
+            }
+            if (magic != BLOCK_MAGIC)
+                return _fail("Invalid bzip2 block header.");
+
+            // search the end of this block
+            __int64 trailingEos = -1;
+            __int64 next;
+            bool isEos = false;
+            for (__uint64 from = bitPos + 48; ; from = next + 1)
+            {
+                next = _findMagic(from, isEos);
+                if (next < 0 || !isEos)
+                    break;
+                if (_isValidEos(next))
+                    break;
+                if (trailingEos < 0)
+                    trailingEos = next;
+            }
+
+            if (next < 0)
+            {
+                // accept an end-of-stream magic followed by garbage
+                if (trailingEos < 0)
+                    return _fail("Unexpected end of bzip2 stream.");
+                next = trailingEos;
+                isEos = true;
+            }
+
+            raw.clear();
+            raw.appendBits(((__uint64)'B' << 24) | ((__uint64)'Z' << 16) | ((__uint64)'h' << 8) | level, 32);
+            raw.append(&in[0], bitPos, next - bitPos);
+            crc = _getBits(bitPos + 48, 32);
+            endsStream = isEos;
+
+            bitPos = next;
+            if (isEos && next == trailingEos)
+            {
+                // the stream is followed by garbage, ignore it
+                state = DONE;
+            }
+            return true;
+        }
+        return false;
+    }
+};
+
+// --------------------------------------------------------------------------
+// Class basic_unbzip2_parallel_streambuf
+// --------------------------------------------------------------------------
+
+template<
+    typename Elem,
+    typename Tr = std::char_traits<Elem>,
+    typename ElemA = std::allocator<Elem>
+>
+class basic_unbzip2_parallel_streambuf :
+    public std::basic_streambuf<Elem, Tr>
+{
+public:
+    typedef std::basic_istream<Elem, Tr>& istream_reference;
+    typedef ElemA char_allocator_type;
+    typedef typename Tr::char_type char_type;
+    typedef typename Tr::int_type int_type;
+
+    typedef std::vector<char_type, char_allocator_type>     TBuffer;
+    typedef ConcurrentQueue<int, Suspendable<Limit> >       TJobQueue;
+    typedef Bzip2BlockReader_<std::basic_istream<Elem, Tr> > TSerializer;
+
+    static const size_t MAX_PUTBACK = 4;
+    static const size_t INITIAL_BUFFER_SIZE = 1024 * 1024;
+
+    TSerializer serializer;
+
+    struct DecompressionJob
+    {
+        Bzip2BitBuffer_ raw;
+        __uint32        crc;
+        bool            endsStream;
+        TBuffer         buffer;
+        int             size;
+
+        CriticalSection cs;
+        Condition       readyEvent;
+        bool            ready;
+
+        DecompressionJob() :
+            crc(0),
+            endsStream(false),
+            buffer(MAX_PUTBACK + INITIAL_BUFFER_SIZE, 0),
+            size(0),
+            readyEvent(cs),
+            ready(true)
+        {}
+
+        DecompressionJob(DecompressionJob const &other) :
+            raw(other.raw),
+            crc(other.crc),
+            endsStream(other.endsStream),
+            buffer(other.buffer),
+            size(other.size),
+            readyEvent(cs),
+            ready(other.ready)
+        {}
+    };
+
+    // string of recycable jobs
+    size_t                      numThreads;
+    size_t                      numJobs;
+    String<DecompressionJob>    jobs;
+    TJobQueue                   runningQueue;
+    TJobQueue                   todoQueue;
+    int                         currentJobId;
+
+    // decompresses a single-block stream into buffer (behind the putback area),
+    // returns the number of decompressed characters or -2 on failure
+    static int decompressBlock(TBuffer &buffer, Bzip2BitBuffer_ &raw, __uint32 crc)
+    {
+        __uint64 rawBits = raw.bits;
+        raw.appendBits(TSerializer::EOS_MAGIC, 48);
+        raw.appendBits(crc, 32);
+
+        bz_stream strm;
+        std::memset(&strm, 0, sizeof(strm));
+        if (BZ2_bzDecompressInit(&strm, 0, 0) != BZ_OK)
+        {
+            raw.truncate(rawBits);
+            return -2;
+        }
+
+        strm.next_in = (char*)&raw.data[0];
+        strm.avail_in = raw.data.size();
+
+        size_t total = 0;
+        int ret;
+        while (true)
+        {
+            strm.next_out = (char*)&buffer[MAX_PUTBACK + total];
+            strm.avail_out = buffer.size() - (MAX_PUTBACK + total);
+            size_t avail = strm.avail_out;
+
+            ret = BZ2_bzDecompress(&strm);
+            total += avail - strm.avail_out;
+
+            if (ret != BZ_OK)
+                break;
+            if (strm.avail_out == 0)
+                buffer.resize(2 * buffer.size());
+            else if (strm.avail_in == 0)
+                break;
+        }
+        BZ2_bzDecompressEnd(&strm);
+        raw.truncate(rawBits);
+
+        return (ret == BZ_STREAM_END)? static_cast<int>(total) : -2;
+    }
+
+    struct DecompressionThread
+    {
+        basic_unbzip2_parallel_streambuf *streamBuf;
+
+        void operator()()
+        {
+            ScopedReadLock<TJobQueue> readLock(streamBuf->todoQueue);
+            ScopedWriteLock<TJobQueue> writeLock(streamBuf->runningQueue);
+
+            // wait for a new job to become available
+            while (true)
+            {
+                int jobId = -1;
+                if (!popFront(jobId, streamBuf->todoQueue))
+                    return;
+
+                DecompressionJob &job = streamBuf->jobs[jobId];
+
+                {
+                    ScopedLock<Mutex> scopedLock(streamBuf->serializer.lock);
+
+                    if (streamBuf->serializer.error != NULL)
+                        return;
+
+                    job.size = -1;
+                    if (streamBuf->serializer.nextBlock(job.raw, job.crc, job.endsStream))
+                        job.ready = false;
+                    else if (streamBuf->serializer.error != NULL)
+                        return;
+
+                    if (!appendValue(streamBuf->runningQueue, jobId))
+                    {
+                        // signal that job is ready
+                        {
+                            ScopedLock<CriticalSection> lock(job.cs);
+                            job.ready = true;
+                            signal(job.readyEvent);
+                        }
+                        return;
+                    }
+                }
+
+                if (!job.ready)
+                {
+                    job.size = decompressBlock(job.buffer, job.raw, job.crc);
+
+                    // signal that job is ready
+                    {
+                        ScopedLock<CriticalSection> lock(job.cs);
+                        job.ready = true;
+                        signal(job.readyEvent);
+                    }
+                }
+            }
+        }
+    };
+
+    // array of worker threads
+    Thread<DecompressionThread> *threads;
+    TBuffer                     putbackBuffer;
+
+    // every block needs a few MB of decoder state, oversubscribing the cores thrashes the caches,
+    // hence 0 selects one thread per OpenMP thread
+    basic_unbzip2_parallel_streambuf(istream_reference istream_,
+                                     size_t numThreads = 0,
+                                     size_t jobsPerThread = 2) :
+        serializer(istream_),
+        numThreads((numThreads != 0)? numThreads : omp_get_max_threads()),
+        numJobs(this->numThreads * jobsPerThread),
+        runningQueue(numJobs),
+        todoQueue(numJobs),
+        putbackBuffer(MAX_PUTBACK)
+    {
+        resize(jobs, numJobs, Exact());
+        currentJobId = -1;
+
+        lockReading(runningQueue);
+        lockWriting(todoQueue);
+        setReaderWriterCount(runningQueue, 1, this->numThreads);
+        setReaderWriterCount(todoQueue, this->numThreads, 1);
+
+        for (unsigned i = 0; i < numJobs; ++i)
+        {
+            bool success = appendValue(todoQueue, i);
+            ignoreUnusedVariableWarning(success);
+            SEQAN_ASSERT(success);
+        }
+
+        threads = new Thread<DecompressionThread>[this->numThreads];
+        for (unsigned i = 0; i < this->numThreads; ++i)
+        {
+            threads[i].worker.streamBuf = this;
+            run(threads[i]);
+        }
+    }
+
+    ~basic_unbzip2_parallel_streambuf()
+    {
+        unlockWriting(todoQueue);
+        unlockReading(runningQueue);
+
+        for (unsigned i = 0; i < numThreads; ++i)
+            waitFor(threads[i]);
+        delete[] threads;
+    }
+
+    void _waitForJob(DecompressionJob &job)
+    {
+        ScopedLock<CriticalSection> lock(job.cs);
+        if (!job.ready)
+            waitFor(job.readyEvent);
+    }
+
+    // a block failed to decode, the block magic may have occurred inside compressed data
+    // merge it with its successors until it decodes or the stream ends
+    void _recoverBlock(DecompressionJob &job)
+    {
+        Bzip2BitBuffer_ merged(job.raw);
+        bool endsStream = job.endsStream;
+
+        while (job.size == -2)
+        {
+            int nextJobId = -1;
+            if (endsStream || !popFront(nextJobId, runningQueue))
+                break;
+
+            DecompressionJob &nextJob = jobs[nextJobId];
+            _waitForJob(nextJob);
+
+            bool nextIsBlock = (nextJob.size != -1);
+            if (nextIsBlock)
+            {
+                // skip the stream header of the successor
+                merged.append(&nextJob.raw.data[0], 32, nextJob.raw.bits - 32);
+                endsStream = nextJob.endsStream;
+            }
+            appendValue(todoQueue, nextJobId);
+
+            if (!nextIsBlock)
+                break;
+
+            job.size = decompressBlock(job.buffer, merged, job.crc);
+        }
+
+        if (job.size == -2)
+            throw IOError("Invalid bzip2 block.");
+    }
+
+    int_type underflow()
+    {
+        // no need to use the next buffer?
+        if (this->gptr() && this->gptr() < this->egptr())
+            return Tr::to_int_type(*this->gptr());
+
+        size_t putback = this->gptr() - this->eback();
+        if (putback > MAX_PUTBACK)
+            putback = MAX_PUTBACK;
+
+        // save at most MAX_PUTBACK characters from previous page to putback buffer
+        if (putback != 0)
+            std::copy(
+                this->gptr() - putback,
+                this->gptr(),
+                &putbackBuffer[0]);
+
+        if (currentJobId >= 0)
+            appendValue(todoQueue, currentJobId);
+
+        while (true)
+        {
+            if (!popFront(currentJobId, runningQueue))
+            {
+                currentJobId = -1;
+                SEQAN_ASSERT(serializer.error != NULL);
+                if (serializer.error != NULL)
+                    throw *serializer.error;
+                return EOF;
+            }
+
+            DecompressionJob &job = jobs[currentJobId];
+
+            // wait for the end of decompression
+            _waitForJob(job);
+
+            if (job.size == -2)
+                _recoverBlock(job);
+
+            // restore putback buffer
+            if (putback != 0)
+                std::copy(
+                    &putbackBuffer[0],
+                    &putbackBuffer[0] + putback,
+                    &job.buffer[0] + (MAX_PUTBACK - putback));
+
+            size_t size = (job.size != -1)? job.size : 0;
+
+            // reset buffer pointers
+            this->setg(
+                  &job.buffer[0] + (MAX_PUTBACK - putback),     // beginning of putback area
+                  &job.buffer[0] + MAX_PUTBACK,                 // read position
+                  &job.buffer[0] + (MAX_PUTBACK + size));       // end of buffer
+
+            if (job.size == -1)
+                return EOF;
+            else if (job.size > 0)
+                return Tr::to_int_type(*this->gptr());      // return next character
+        }
+    }
+
+    // returns the compressed input istream
+    istream_reference get_istream()    { return serializer.istream; };
+};
+
+// --------------------------------------------------------------------------
+// Class basic_bzip2_parallel_istreambase
+// --------------------------------------------------------------------------
+
+template<
+    typename Elem,
+    typename Tr = std::char_traits<Elem>,
+    typename ElemA = std::allocator<Elem>
+>
+class basic_bzip2_parallel_istreambase : virtual public std::basic_ios<Elem,Tr>
+{
+public:
+    typedef std::basic_istream<Elem, Tr>&                               istream_reference;
+    typedef basic_unbzip2_parallel_streambuf<Elem, Tr, ElemA>           unbzip2_streambuf_type;
+
+    basic_bzip2_parallel_istreambase(istream_reference istream_, size_t numThreads = 0)
+        : m_buf(istream_, numThreads)
+    {
+        this->init(&m_buf);
+    };
+
+    // returns the underlying unzip istream object
+    unbzip2_streambuf_type* rdbuf() { return &m_buf; };
+
+private:
+    unbzip2_streambuf_type m_buf;
+};
+
+// --------------------------------------------------------------------------
+// Class basic_bzip2_parallel_istream
+// --------------------------------------------------------------------------
+
+template<
+    typename Elem,
+    typename Tr = std::char_traits<Elem>,
+    typename ElemA = std::allocator<Elem>
+>
+class basic_bzip2_parallel_istream :
+    public basic_bzip2_parallel_istreambase<Elem,Tr,ElemA>,
+    public std::basic_istream<Elem,Tr>
+{
+public:
+    typedef basic_bzip2_parallel_istreambase<Elem,Tr,ElemA>    bzip2_istreambase_type;
+    typedef std::basic_istream<Elem,Tr>                         istream_type;
+    typedef istream_type &                                      istream_reference;
+
+    basic_bzip2_parallel_istream(istream_reference istream_, size_t numThreads = 0) :
+        bzip2_istreambase_type(istream_, numThreads),
+        istream_type(bzip2_istreambase_type::rdbuf())
+    {};
+
+#ifdef _WIN32
+private:
+    void _Add_vtordisp1() { } // Required to avoid VC++ warning C4250
+    void _Add_vtordisp2() { } // Required to avoid VC++ warning C4250
+#endif
+};
+
+}  // namespace seqan
+
+#endif // INCLUDE_SEQAN_STREAM_IOSTREAM_BZIP2_PARALLEL_H_
@@ -0,0 +1,301 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2015, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: SeqAn Team <seqan-dev@lists.fu-berlin.de>
+// ==========================================================================
+// Read-ahead wrapper for sequential input streams.  A worker thread drains
+// an inner stream (e.g. a gzip decompressor) into a small ring of buffers
+// while the caller consumes the previously filled one.  This overlaps the
+// inherently sequential decompression with parsing.
+// ==========================================================================
+
+#ifndef INCLUDE_SEQAN_STREAM_IOSTREAM_PREFETCH_H_
+#define INCLUDE_SEQAN_STREAM_IOSTREAM_PREFETCH_H_
+
+namespace seqan {
+
+// ============================================================================
+// Classes
+// ============================================================================
+
+// --------------------------------------------------------------------------
+// Class basic_prefetch_streambuf
+// --------------------------------------------------------------------------
+
+template<
+    typename Elem,
+    typename Tr = std::char_traits<Elem>,
+    typename ElemA = std::allocator<Elem>
+>
+class basic_prefetch_streambuf :
+    public std::basic_streambuf<Elem, Tr>
+{
+public:
+    typedef std::basic_istream<Elem, Tr>& istream_reference;
+    typedef ElemA char_allocator_type;
+    typedef typename Tr::char_type char_type;
+    typedef typename Tr::int_type int_type;
+
+    typedef std::vector<char_type, char_allocator_type>     TBuffer;
+    typedef ConcurrentQueue<int, Suspendable<Limit> >       TJobQueue;
+
+    static const size_t MAX_PUTBACK = 4;
+
+    struct PrefetchJob
+    {
+        TBuffer         buffer;
+        int             size;
+    };
+
+    istream_reference           istream;
+    IOError                     *error;
+    size_t                      bufferSize;
+
+    // string of recycable buffers
+    size_t                      numJobs;
+    String<PrefetchJob>         jobs;
+    TJobQueue                   runningQueue;
+    TJobQueue                   todoQueue;
+    int                         currentJobId;
+
+    struct PrefetchThread
+    {
+        basic_prefetch_streambuf    *streamBuf;
+
+        void operator()()
+        {
+            ScopedReadLock<TJobQueue> readLock(streamBuf->todoQueue);
+            ScopedWriteLock<TJobQueue> writeLock(streamBuf->runningQueue);
+
+            istream_reference istream = streamBuf->istream;
+            bool atEnd = false;
+
+            // wait for an empty buffer to become available
+            while (true)
+            {
+                int jobId = -1;
+                if (!popFront(jobId, streamBuf->todoQueue))
+                    return;
+
+                PrefetchJob &job = streamBuf->jobs[jobId];
+                job.size = -1;
+
+                // only read if not at EOF
+                if (!atEnd)
+                {
+                    istream.read(&job.buffer[0] + MAX_PUTBACK, streamBuf->bufferSize);
+                    job.size = static_cast<int>(istream.gcount());
+
+                    if (!istream.good())
+                    {
+                        atEnd = true;
+                        if (!istream.eof())
+                            streamBuf->error = new IOError("Stream read error.");
+                    }
+                }
+
+                // the queue lock publishes job.size and error to the reader
+                if (!appendValue(streamBuf->runningQueue, jobId))
+                    return;
+            }
+        }
+    };
+
+    Thread<PrefetchThread>      thread;
+    TBuffer                     putbackBuffer;
+
+    basic_prefetch_streambuf(istream_reference istream_,
+                             size_t numBuffers = 2,
+                             size_t bufferSize = 256 * 1024) :
+        istream(istream_),
+        error(NULL),
+        bufferSize(bufferSize),
+        numJobs(std::max(numBuffers, (size_t)1)),
+        runningQueue(numJobs),
+        todoQueue(numJobs),
+        putbackBuffer(MAX_PUTBACK)
+    {
+        resize(jobs, numJobs, Exact());
+        for (unsigned i = 0; i < numJobs; ++i)
+        {
+            jobs[i].buffer.resize(MAX_PUTBACK + bufferSize);
+            jobs[i].size = 0;
+        }
+        currentJobId = -1;
+
+        lockReading(runningQueue);
+        lockWriting(todoQueue);
+        setReaderWriterCount(runningQueue, 1, 1);
+        setReaderWriterCount(todoQueue, 1, 1);
+
+        for (unsigned i = 0; i < numJobs; ++i)
+        {
+            bool success = appendValue(todoQueue, i);
+            ignoreUnusedVariableWarning(success);
+            SEQAN_ASSERT(success);
+        }
+
+        thread.worker.streamBuf = this;
+        run(thread);
+    }
+
+    ~basic_prefetch_streambuf()
+    {
+        unlockWriting(todoQueue);
+        unlockReading(runningQueue);
+
+        waitFor(thread);
+        delete error;
+    }
+
+    int_type underflow()
+    {
+        // no need to use the next buffer?
+        if (this->gptr() && this->gptr() < this->egptr())
+            return Tr::to_int_type(*this->gptr());
+
+        size_t putback = this->gptr() - this->eback();
+        if (putback > MAX_PUTBACK)
+            putback = MAX_PUTBACK;
+
+        // save at most MAX_PUTBACK characters from previous page to putback buffer
+        if (putback != 0)
+            std::copy(
+                this->gptr() - putback,
+                this->gptr(),
+                &putbackBuffer[0]);
+
+        if (currentJobId >= 0)
+            appendValue(todoQueue, currentJobId);
+
+        while (true)
+        {
+            if (!popFront(currentJobId, runningQueue))
+            {
+                currentJobId = -1;
+                return EOF;
+            }
+
+            PrefetchJob &job = jobs[currentJobId];
+
+            // restore putback buffer
+            if (putback != 0)
+                std::copy(
+                    &putbackBuffer[0],
+                    &putbackBuffer[0] + putback,
+                    &job.buffer[0] + (MAX_PUTBACK - putback));
+
+            size_t size = (job.size != -1)? job.size : 0;
+
+            // reset buffer pointers
+            this->setg(
+                  &job.buffer[0] + (MAX_PUTBACK - putback),     // beginning of putback area
+                  &job.buffer[0] + MAX_PUTBACK,                 // read position
+                  &job.buffer[0] + (MAX_PUTBACK + size));       // end of buffer
+
+            if (job.size == -1)
+            {
+                if (error != NULL)
+                    throw *error;
+                return EOF;
+            }
+            else if (job.size > 0)
+                return Tr::to_int_type(*this->gptr());      // return next character
+        }
+    }
+
+    // returns the inner input istream
+    istream_reference get_istream()    { return istream; };
+};
+
+// --------------------------------------------------------------------------
+// Class basic_prefetch_istreambase
+// --------------------------------------------------------------------------
+
+template <typename TInnerStream>
+class basic_prefetch_istreambase :
+    virtual public std::basic_ios<typename TInnerStream::char_type, typename TInnerStream::traits_type>
+{
+public:
+    typedef typename TInnerStream::char_type                        char_type;
+    typedef typename TInnerStream::traits_type                      traits_type;
+    typedef std::basic_istream<char_type, traits_type>&             istream_reference;
+    typedef basic_prefetch_streambuf<char_type, traits_type>        prefetch_streambuf_type;
+
+    basic_prefetch_istreambase(istream_reference istream_) :
+        m_inner(istream_),
+        m_buf(m_inner)
+    {
+        this->init(&m_buf);
+    };
+
+    // returns the read-ahead stream buffer
+    prefetch_streambuf_type* rdbuf()        { return &m_buf; };
+    // returns the wrapped (decompressing) stream
+    TInnerStream & inner()                  { return m_inner; };
+
+private:
+    // m_buf must be destroyed (and its thread joined) before m_inner
+    TInnerStream            m_inner;
+    prefetch_streambuf_type m_buf;
+};
+
+// --------------------------------------------------------------------------
+// Class basic_prefetch_istream
+// --------------------------------------------------------------------------
+
+template <typename TInnerStream>
+class basic_prefetch_istream :
+    public basic_prefetch_istreambase<TInnerStream>,
+    public std::basic_istream<typename TInnerStream::char_type, typename TInnerStream::traits_type>
+{
+public:
+    typedef basic_prefetch_istreambase<TInnerStream>                prefetch_istreambase_type;
+    typedef typename prefetch_istreambase_type::char_type           char_type;
+    typedef typename prefetch_istreambase_type::traits_type         traits_type;
+    typedef std::basic_istream<char_type, traits_type>              istream_type;
+    typedef istream_type &                                          istream_reference;
+
+    basic_prefetch_istream(istream_reference istream_) :
+        prefetch_istreambase_type(istream_),
+        istream_type(prefetch_istreambase_type::rdbuf())
+    {};
+
+#ifdef _WIN32
+private:
+    void _Add_vtordisp1() { } // Required to avoid VC++ warning C4250
+    void _Add_vtordisp2() { } // Required to avoid VC++ warning C4250
+#endif
+};
+
+}  // namespace seqan
+
+#endif // INCLUDE_SEQAN_STREAM_IOSTREAM_PREFETCH_H_
@@ -152,10 +152,181 @@ typedef OrFunctor<IsInRange<'a', 'z'>, IsInRange<'A', 'Z'> >    IsAlpha;
 typedef IsInRange<'0', '9'>                                     IsDigit;
 typedef OrFunctor<IsAlpha, IsDigit>                             IsAlphaNum;
 
+// ----------------------------------------------------------------------------
+// Class VectorizedTokenizer_
+// ----------------------------------------------------------------------------
+// Compile-time translation of stateless character functors (EqualsChar,
+// IsInRange and their Or/And/Not compositions) into byte-wise vector compares.
+// VALUE is false for all other functors, which are evaluated char by char.
+
+template <typename TFunctor>
+struct VectorizedTokenizer_
+{
+    enum { VALUE = false };
+};
+
+#if defined(__SSE2__)
+
+template <char VALUE_>
+struct VectorizedTokenizer_<EqualsChar<VALUE_> >
+{
+    enum { VALUE = true };
+
+    static inline __m128i match(__m128i const & v)
+    {
+        return _mm_cmpeq_epi8(v, _mm_set1_epi8(VALUE_));
+    }
+
+#if defined(__AVX2__)
+    static inline __m256i match(__m256i const & v)
+    {
+        return _mm256_cmpeq_epi8(v, _mm256_set1_epi8(VALUE_));
+    }
+#endif
+};
+
+template <char FIRST_CHAR, char LAST_CHAR>
+struct VectorizedTokenizer_<IsInRange<FIRST_CHAR, LAST_CHAR> >
+{
+    enum { VALUE = true };
+
+    // (v - FIRST) <= (LAST - FIRST) as unsigned bytes
+    static inline __m128i match(__m128i const & v)
+    {
+        __m128i shifted = _mm_sub_epi8(v, _mm_set1_epi8(FIRST_CHAR));
+        return _mm_cmpeq_epi8(_mm_min_epu8(shifted, _mm_set1_epi8(LAST_CHAR - FIRST_CHAR)), shifted);
+    }
+
+#if defined(__AVX2__)
+    static inline __m256i match(__m256i const & v)
+    {
+        __m256i shifted = _mm256_sub_epi8(v, _mm256_set1_epi8(FIRST_CHAR));
+        return _mm256_cmpeq_epi8(_mm256_min_epu8(shifted, _mm256_set1_epi8(LAST_CHAR - FIRST_CHAR)), shifted);
+    }
+#endif
+};
+
+template <typename TFunctor1, typename TFunctor2>
+struct VectorizedTokenizer_<OrFunctor<TFunctor1, TFunctor2> >
+{
+    typedef VectorizedTokenizer_<TFunctor1> TMatcher1;
+    typedef VectorizedTokenizer_<TFunctor2> TMatcher2;
+
+    enum { VALUE = TMatcher1::VALUE && TMatcher2::VALUE };
+
+    static inline __m128i match(__m128i const & v)
+    {
+        return _mm_or_si128(TMatcher1::match(v), TMatcher2::match(v));
+    }
+
+#if defined(__AVX2__)
+    static inline __m256i match(__m256i const & v)
+    {
+        return _mm256_or_si256(TMatcher1::match(v), TMatcher2::match(v));
+    }
+#endif
+};
+
+template <typename TFunctor1, typename TFunctor2>
+struct VectorizedTokenizer_<AndFunctor<TFunctor1, TFunctor2> >
+{
+    typedef VectorizedTokenizer_<TFunctor1> TMatcher1;
+    typedef VectorizedTokenizer_<TFunctor2> TMatcher2;
+
+    enum { VALUE = TMatcher1::VALUE && TMatcher2::VALUE };
+
+    static inline __m128i match(__m128i const & v)
+    {
+        return _mm_and_si128(TMatcher1::match(v), TMatcher2::match(v));
+    }
+
+#if defined(__AVX2__)
+    static inline __m256i match(__m256i const & v)
+    {
+        return _mm256_and_si256(TMatcher1::match(v), TMatcher2::match(v));
+    }
+#endif
+};
+
+template <typename TFunctor>
+struct VectorizedTokenizer_<NotFunctor<TFunctor> >
+{
+    typedef VectorizedTokenizer_<TFunctor> TMatcher;
+
+    enum { VALUE = TMatcher::VALUE };
+
+    static inline __m128i match(__m128i const & v)
+    {
+        return _mm_andnot_si128(TMatcher::match(v), _mm_set1_epi8(-1));
+    }
+
+#if defined(__AVX2__)
+    static inline __m256i match(__m256i const & v)
+    {
+        return _mm256_andnot_si256(TMatcher::match(v), _mm256_set1_epi8(-1));
+    }
+#endif
+};
+
+#endif  // #if defined(__SSE2__)
+
 // ============================================================================
 // Functions
 // ============================================================================
 
+// ----------------------------------------------------------------------------
+// Function _scanUntil()
+// ----------------------------------------------------------------------------
+// Returns a pointer to the first character in [ptr, end) the stop functor
+// matches, or end. Chars are tested in vectors of 16 (SSE2) or 32 (AVX2) bytes
+// if the functor can be vectorized, otherwise one by one.
+
+template <typename TValue, typename TStopFunctor>
+inline TValue * _scanUntil(TValue * ptr, TValue * end, TStopFunctor & stopFunctor, False)
+{
+    for (; ptr != end; ++ptr)
+        if (SEQAN_UNLIKELY(stopFunctor(*ptr)))
+            break;
+    return ptr;
+}
+
+#if defined(__SSE2__)
+
+template <typename TValue, typename TStopFunctor>
+inline TValue * _scanUntil(TValue * ptr, TValue * end, TStopFunctor & stopFunctor, True)
+{
+    typedef VectorizedTokenizer_<TStopFunctor> TMatcher;
+
+#if defined(__AVX2__)
+    for (; end - ptr >= 32; ptr += 32)
+    {
+        unsigned mask = _mm256_movemask_epi8(TMatcher::match(_mm256_loadu_si256(reinterpret_cast<__m256i const *>(ptr))));
+        if (SEQAN_UNLIKELY(mask != 0))
+            return ptr + __builtin_ctz(mask);
+    }
+#endif
+
+    for (; end - ptr >= 16; ptr += 16)
+    {
+        unsigned mask = _mm_movemask_epi8(TMatcher::match(_mm_loadu_si128(reinterpret_cast<__m128i const *>(ptr))));
+        if (SEQAN_UNLIKELY(mask != 0))
+            return ptr + __builtin_ctz(mask);
+    }
+
+    return _scanUntil(ptr, end, stopFunctor, False());
+}
+
+#endif  // #if defined(__SSE2__)
+
+template <typename TValue, typename TStopFunctor>
+inline TValue * _scanUntil(TValue * ptr, TValue * end, TStopFunctor & stopFunctor)
+{
+    typedef typename IfC<IsSameType<typename RemoveConst<TValue>::Type, char>::VALUE &&
+                         VectorizedTokenizer_<TStopFunctor>::VALUE, True, False>::Type    TVectorize;
+
+    return _scanUntil(ptr, end, stopFunctor, TVectorize());
+}
+
 // ----------------------------------------------------------------------------
 // Function _skipUntil(); Element-wise
 // ----------------------------------------------------------------------------
@@ -181,18 +352,11 @@ inline void _skipUntil(TFwdIterator &iter, TStopFunctor &stopFunctor, Range<TVal
         getChunk(ichunk, iter, Input());
         SEQAN_ASSERT(!empty(ichunk));
 
-        const TIValue* SEQAN_RESTRICT ptr = ichunk.begin;
-
-        for (; ptr != ichunk.end; ++ptr)
-        {
-            if (SEQAN_UNLIKELY(stopFunctor(*ptr)))
-            {
-                iter += ptr - ichunk.begin;    // advance input iterator
-                return;
-            }
-        }
+        const TIValue* ptr = _scanUntil(ichunk.begin, ichunk.end, stopFunctor);
 
         iter += ptr - ichunk.begin;            // advance input iterator
+        if (ptr != ichunk.end)
+            return;
     }
 }
 
@@ -317,6 +481,53 @@ inline void _readUntil(TTarget &target,
     advanceChunk(target, optr - ochunk.begin);
 }
 
+// ----------------------------------------------------------------------------
+// Function _readUntil(); Chunked, not ignoring
+// ----------------------------------------------------------------------------
+// Scan for the stop char first, then copy the whole span.
+
+template <typename TTarget, typename TFwdIterator, typename TStopFunctor, typename TIValue, typename TOValue>
+inline void _readUntil(TTarget &target,
+                       TFwdIterator &iter,
+                       TStopFunctor &stopFunctor,
+                       False &,
+                       Range<TIValue*> *,
+                       Range<TOValue*> *)
+{
+    Range<TOValue*> ochunk(NULL, NULL);
+    TOValue* optr = NULL;
+
+    Range<TIValue*> ichunk;
+    for (; !atEnd(iter); )
+    {
+        getChunk(ichunk, iter, Input());
+        SEQAN_ASSERT(ichunk.begin < ichunk.end);
+
+        const TIValue* iend = _scanUntil(ichunk.begin, ichunk.end, stopFunctor);
+
+        for (const TIValue* iptr = ichunk.begin; iptr != iend;)
+        {
+            // construct values in reserved memory
+            if (optr == ochunk.end)
+            {
+                advanceChunk(target, optr - ochunk.begin);
+                reserveChunk(target, iend - iptr, Output());
+                getChunk(ochunk, target, Output());
+                optr = ochunk.begin;
+                SEQAN_ASSERT(optr < ochunk.end);
+            }
+            size_t n = std::min<size_t>(iend - iptr, ochunk.end - optr);
+            optr = std::copy(iptr, iptr + n, optr);
+            iptr += n;
+        }
+
+        iter += iend - ichunk.begin;                       // advance input iterator
+        if (iend != ichunk.end)
+            break;
+    }
+    advanceChunk(target, optr - ochunk.begin);             // extend target string size
+}
+
 // ----------------------------------------------------------------------------
 // Function readUntil()
 // ----------------------------------------------------------------------------
@@ -140,16 +140,18 @@ struct VirtualStreamSwitch_
 };
 
 #if SEQAN_HAS_ZLIB
+// gzip members can only be inflated sequentially, a worker thread inflates ahead of the reader
 template <typename TValue>
 struct VirtualStreamSwitch_<TValue, Input, GZFile>
 {
-    typedef zlib_stream::basic_zip_istream<TValue> Type;
+    typedef basic_prefetch_istream<zlib_stream::basic_zip_istream<TValue> > Type;
 };
 
+// BGZF is a series of gzip members, hence readable by gunzip, and compressed by a pool of worker threads
 template <typename TValue>
 struct VirtualStreamSwitch_<TValue, Output, GZFile>
 {
-    typedef zlib_stream::basic_zip_ostream<TValue> Type;
+    typedef basic_bgzf_ostream<TValue> Type;
 };
 
 template <typename TValue>
@@ -168,10 +170,11 @@ struct VirtualStreamSwitch_<TValue, Output, BgzfFile>
 
 #if SEQAN_HAS_BZIP2
 
+// bzip2 blocks are independent and decompressed by a pool of worker threads
 template <typename TValue>
 struct VirtualStreamSwitch_<TValue, Input, BZ2File>
 {
-    typedef bzip2_stream::basic_bzip2_istream<TValue> Type;
+    typedef basic_bzip2_parallel_istream<TValue> Type;
 };
 
 template <typename TValue>
@@ -181,6 +184,27 @@ struct VirtualStreamSwitch_<TValue, Output, BZ2File>
 };
 #endif
 
+// --------------------------------------------------------------------------
+// Metafunction VirtualStreamIsThreaded_
+// --------------------------------------------------------------------------
+// Whether the (de)compressing stream takes the number of threads as second constructor argument.
+
+template <typename TStream>
+struct VirtualStreamIsThreaded_ : False {};
+
+#if SEQAN_HAS_ZLIB
+template <typename Elem, typename Tr, typename ElemA, typename ByteT, typename ByteAT>
+struct VirtualStreamIsThreaded_<basic_bgzf_istream<Elem, Tr, ElemA, ByteT, ByteAT> > : True {};
+
+template <typename Elem, typename Tr, typename ElemA, typename ByteT, typename ByteAT>
+struct VirtualStreamIsThreaded_<basic_bgzf_ostream<Elem, Tr, ElemA, ByteT, ByteAT> > : True {};
+#endif
+
+#if SEQAN_HAS_BZIP2
+template <typename Elem, typename Tr, typename ElemA>
+struct VirtualStreamIsThreaded_<basic_bzip2_parallel_istream<Elem, Tr, ElemA> > : True {};
+#endif
+
 // ==========================================================================
 // Classes
 // ==========================================================================
@@ -208,27 +232,44 @@ struct VirtualStreamContextBase_
 };
 
 // generic subclass with virtual destructor
-template <typename TValue, typename TDirection, typename TTraits, typename TFormatTag = void>
+template <typename TValue, typename TDirection, typename TTraits, typename TFormatTag = void,
+          typename TThreaded = typename VirtualStreamIsThreaded_<
+              typename VirtualStreamSwitch_<TValue, TDirection, TFormatTag>::Type>::Type>
 struct VirtualStreamContext_:
     VirtualStreamContextBase_<TValue, TTraits>
 {
     typename VirtualStreamSwitch_<TValue, TDirection, TFormatTag>::Type stream;
 
     template <typename TObject>
-    VirtualStreamContext_(TObject &object):
+    VirtualStreamContext_(TObject &object, size_t /* numThreads */):
         stream(object)
     {
         this->streamBuf = stream.rdbuf();
     }
 };
 
+// multi-threaded (de)compression
+template <typename TValue, typename TDirection, typename TTraits, typename TFormatTag>
+struct VirtualStreamContext_<TValue, TDirection, TTraits, TFormatTag, True>:
+    VirtualStreamContextBase_<TValue, TTraits>
+{
+    typename VirtualStreamSwitch_<TValue, TDirection, TFormatTag>::Type stream;
+
+    template <typename TObject>
+    VirtualStreamContext_(TObject &object, size_t numThreads):
+        stream(object, numThreads)
+    {
+        this->streamBuf = stream.rdbuf();
+    }
+};
+
 // special case: no compression, we simply forward the file stream
-template <typename TValue, typename TDirection, typename TTraits>
-struct VirtualStreamContext_<TValue, TDirection, TTraits, Nothing>:
+template <typename TValue, typename TDirection, typename TTraits, typename TThreaded>
+struct VirtualStreamContext_<TValue, TDirection, TTraits, Nothing, TThreaded>:
     VirtualStreamContextBase_<TValue, TTraits>
 {
     template <typename TObject>
-    VirtualStreamContext_(TObject &object)
+    VirtualStreamContext_(TObject &object, size_t /* numThreads */)
     {
         this->streamBuf = object.rdbuf();
     }
@@ -273,6 +314,14 @@ public:
     TVirtualStreamContext   *context;
     TFormat                 format;
 
+    /*!
+     * @var size_t VirtualStream::numThreads;
+     * @brief Number of threads used for (de)compression of BGZF, gzip output, and bzip2 input.
+     *
+     * Must be set before the stream is opened.  The default <tt>0</tt> selects the default of the compressor.
+     */
+    size_t                  numThreads;
+
     /*!
      * @fn VirtualStream::VirtualStream
      * @brief Default constructor and construction from stream, stream buffer, or filename.
@@ -290,19 +339,22 @@ public:
     VirtualStream():
         TStream(NULL),
         streamBuf(),
-        context()
+        context(),
+        numThreads(0)
     {}
 
     VirtualStream(TStreamBuffer &streamBuf):
         TStream(NULL),
         streamBuf(streamBuf),
-        context()
+        context(),
+        numThreads(0)
     {}
 
     VirtualStream(TStream &stream):
         TStream(NULL),
         streamBuf(),
-        context()
+        context(),
+        numThreads(0)
     {
         open(*this, stream);
     }
@@ -311,7 +363,8 @@ public:
                   int openMode = DefaultOpenMode<VirtualStream>::VALUE):
         TStream(NULL),
         streamBuf(),
-        context()
+        context(),
+        numThreads(0)
     {
         open(*this, fileName, openMode);
     }
@@ -456,8 +509,11 @@ struct VirtualStreamFactoryContext_<VirtualStream<TValue, TDirection, TTraits> >
     typedef typename TVirtualStream::TStream            TStream;
 
     TStream &stream;
-    VirtualStreamFactoryContext_(TStream &stream):
-        stream(stream) {}
+    size_t  numThreads;
+
+    VirtualStreamFactoryContext_(TStream &stream, size_t numThreads):
+        stream(stream),
+        numThreads(numThreads) {}
 };
 
 template <typename TVirtualStream>
@@ -479,7 +535,7 @@ template <typename TValue, typename TDirection, typename TTraits, typename TForm
 inline VirtualStreamContextBase_<TValue, TTraits> *
 tagApply(VirtualStreamFactoryContext_<VirtualStream<TValue, TDirection, TTraits> > &ctx, Tag<TFormat>)
 {
-    return new VirtualStreamContext_<TValue, TDirection, TTraits, Tag<TFormat> >(ctx.stream);
+    return new VirtualStreamContext_<TValue, TDirection, TTraits, Tag<TFormat> >(ctx.stream, ctx.numThreads);
 }
 
 // ----------------------------------------------------------------------------
@@ -590,7 +646,7 @@ open(VirtualStream<TValue, TDirection, TTraits> &stream, TStream &fileStream, TC
         return open(stream, stream.bufferedStream, compressionType);
     }
 
-    VirtualStreamFactoryContext_<TVirtualStream> ctx(fileStream);
+    VirtualStreamFactoryContext_<TVirtualStream> ctx(fileStream, stream.numThreads);
 
     // try to detect/verify format
     if (!_guessFormat(stream, fileStream, compressionType))
@@ -647,7 +703,7 @@ open(VirtualStream<TValue, TDirection, TTraits> &stream,
     else
         guessFormatFromFilename(fileName, stream.format);       // read/write from/to a file (with extension)
 
-    VirtualStreamFactoryContext_<TVirtualStream> ctx(stream.file);
+    VirtualStreamFactoryContext_<TVirtualStream> ctx(stream.file, stream.numThreads);
 
     // create a new (un)zipper buffer
     stream.context = tagApply(ctx, stream.format);
@@ -46,6 +46,7 @@
 #include <seqan/sequence.h>
 #include <seqan/stream.h>
 #include <seqan/misc/name_store_cache.h>
+#include <seqan/seq_io/genomic_region.h>
 
 // ===========================================================================
 // Tabix index
@@ -54,6 +55,7 @@
 // Tabix indices are only available when ZLIB is available.
 #if SEQAN_HAS_ZLIB
 #include <seqan/tabix_io/tabix_index_tbi.h>
+#include <seqan/tabix_io/tabix_region_reader.h>
 #endif  // #if SEQAN_HAS_ZLIB
 
 #endif  // INCLUDE_SEQAN_TABIX_IO_H_
@@ -31,16 +31,17 @@
 // ==========================================================================
 // Author: David Weese <david.weese@fu-berlin.de>
 // ==========================================================================
-// (Read-only) Tabix index support.
+// Tabix index support.
 //
 // A Tabix index (Heng Li) allows to randomly seek in a tab-seperated genome
 // related file, e.g. VCF, GFF, SAM, BED, etc. The corresponding file only
-// needs to be sorted by chromosomal position in advance and optionally
-// compressed with 'bgzip'. The resulting file must be indexed with 'tabix'.
+// needs to be sorted by chromosomal position in advance and compressed with
+// 'bgzip'.  The index can be loaded from and saved to TBI or CSI files and
+// built from the compressed file itself.  CSI indices support more binning
+// levels and thus contigs longer than 2^29 bp.
 //
 // TODOs:
-//  - clean jumpToRegion(), I simply adapted the one from bam_index.h
-//  - implement Tabix index creation (and BAM index creation as well)
+//  - merge adjacent chunks and write pseudo-bins like tabix does
 // ==========================================================================
 
 #ifndef INCLUDE_SEQAN_TABIX_IO_TABIX_INDEX_TBI_H_
@@ -67,7 +68,11 @@ bool open(TabixIndex & index, char const * filename);
 
 struct TabixIndexBinData_
 {
+    __uint64 loffset;   // smallest offset of records overlapping the first window of the bin (CSI)
     String<Pair<__uint64, __uint64> > chunkBegEnds;
+
+    TabixIndexBinData_() : loffset(0)
+    {}
 };
 
 // ----------------------------------------------------------------------------
@@ -91,6 +96,10 @@ struct TabixRecord_
  * @brief Access to Tabix indexed files.
  *
  * @signature class TabixIndex;
+ *
+ * The index can be read from and written to TBI and CSI files.  TBI indices use a fixed binning scheme of 5 levels
+ * and are limited to contigs of 2^29 bp.  CSI indices store the number of levels (<tt>depth</tt>) and support longer
+ * contigs.
  */
 
 /*!
@@ -98,10 +107,9 @@ struct TabixRecord_
  * @brief Constructor.
  *
  * @signature TabixIndex::TabixIndex();
+ * @signature TabixIndex::TabixIndex(fileName);
  *
- * @section Remarks
- *
- * Only the default constructor is provided.
+ * @param[in] fileName  The path of a TBI or CSI file to load. Type: <tt>char const *</tt>.
  */
 
 class TabixIndex
@@ -111,16 +119,19 @@ public:
     typedef String<__uint64> TLinearIndex_;
     typedef StringSet<CharString, Owner<ConcatDirect<> > > TNameStore;
 
-    __int32 format;             // Format (0: generic; 1: SAM; 2: VCF)
+    __int32 format;             // Format (0: generic; 1: SAM; 2: VCF; | 0x10000: 0-based half-open coordinates)
     __int32 colSeq;             // Column for the sequence name
     __int32 colBeg;             // Column for the start of a region
     __int32 colEnd;             // Column for the end of a region
     __int32 meta;               // Leading character for comment lines
     __int32 skip;               // # lines to skip at the beginning
     __uint64 unalignedCount;    // # unmapped reads without coordinates set
+    __int32 minShift;           // log2 of the size of the smallest bin
+    __int32 depth;              // # binning levels (TBI: 5)
 
     // 1<<14 is the size of the minimum bin.
     static const __int32 BAM_LIDX_SHIFT = 14;
+    static const __int32 FORMAT_UCSC = 0x10000;
 
     String<TBinIndex_>          _binIndices;
     String<TLinearIndex_>       _linearIndices;
@@ -135,6 +146,8 @@ public:
         meta('#'),
         skip(0),
         unalignedCount(maxValue<__uint64>()),
+        minShift(BAM_LIDX_SHIFT),
+        depth(5),
         _nameStoreCache(_nameStore)
     {}
 
@@ -146,6 +159,8 @@ public:
         meta('#'),
         skip(0),
         unalignedCount(maxValue<__uint64>()),
+        minShift(BAM_LIDX_SHIFT),
+        depth(5),
         _nameStoreCache(_nameStore)
     {
         if (!open(*this, fileName))
@@ -157,23 +172,68 @@ public:
 // Functions
 // ============================================================================
 
+// ----------------------------------------------------------------------------
+// Function _tbiBinFirst()
+// ----------------------------------------------------------------------------
+
+// Returns the id of the first bin on the given level.
+
+inline __uint32
+_tbiBinFirst(__int32 level)
+{
+    return ((1u << (level * 3)) - 1) / 7;
+}
+
+// ----------------------------------------------------------------------------
+// Function _tbiBinLevel()
+// ----------------------------------------------------------------------------
+
+inline __int32
+_tbiBinLevel(__uint32 bin, __int32 depth)
+{
+    __int32 level = 0;
+    while (level < depth && bin >= _tbiBinFirst(level + 1))
+        ++level;
+    return level;
+}
+
+// ----------------------------------------------------------------------------
+// Function _tbiReg2bin()
+// ----------------------------------------------------------------------------
+
+// Returns the smallest bin that fully contains [beg, end).
+
+inline __uint32
+_tbiReg2bin(__int64 beg, __int64 end, __int32 minShift, __int32 depth)
+{
+    --end;
+    for (__int32 level = depth, s = minShift; level > 0; --level, s += 3)
+        if (beg >> s == end >> s)
+            return _tbiBinFirst(level) + static_cast<__uint32>(beg >> s);
+    return 0;
+}
+
 // ----------------------------------------------------------------------------
 // Function _tbiReg2bins()
 // ----------------------------------------------------------------------------
 
-static inline void
-_tbiReg2bins(String<__uint16> & list, __uint32 beg, __uint32 end)
+// Appends all bins that overlap [beg, end).
+
+inline void
+_tbiReg2bins(String<__uint32> & list, __int64 beg, __int64 end, __int32 minShift, __int32 depth)
 {
-    unsigned k;
-    if (beg >= end) return;
-    if (end >= 1u<<29) end = 1u<<29;
+    if (beg >= end)
+        return;
+    __int64 maxEnd = (__int64)1 << (minShift + depth * 3);
+    if (end > maxEnd)
+        end = maxEnd;
     --end;
-    appendValue(list, 0);
-    for (k =    1 + (beg>>26); k <=    1 + (end>>26); ++k) appendValue(list, k);
-    for (k =    9 + (beg>>23); k <=    9 + (end>>23); ++k) appendValue(list, k);
-    for (k =   73 + (beg>>20); k <=   73 + (end>>20); ++k) appendValue(list, k);
-    for (k =  585 + (beg>>17); k <=  585 + (end>>17); ++k) appendValue(list, k);
-    for (k = 4681 + (beg>>14); k <= 4681 + (end>>14); ++k) appendValue(list, k);
+    for (__int32 level = 0, s = minShift + depth * 3; level <= depth; ++level, s -= 3)
+    {
+        __uint32 first = _tbiBinFirst(level);
+        for (__uint32 k = first + (beg >> s); k <= first + (end >> s); ++k)
+            appendValue(list, k);
+    }
 }
 
 // ----------------------------------------------------------------------------
@@ -193,9 +253,15 @@ bool _readTabixRecord(TabixRecord_ & record, CharString & buffer, TIter & iter,
 
     if (atEnd(iter))
         return false;
-    
+
+    // VCF records end behind the reference allele (4th column).
+    bool isVcf = (index.format & 0xffff) == 2;
+    __int32 refLength = 1;
+
     // Extract columns.
     __int32 maxCol = std::max(index.colSeq, std::max(index.colBeg, index.colEnd));
+    if (isVcf)
+        maxCol = std::max(maxCol, 4);
     for (__int32 col = 1; col <= maxCol; ++col)
     {
         // Read column.
@@ -209,27 +275,118 @@ bool _readTabixRecord(TabixRecord_ & record, CharString & buffer, TIter & iter,
         {
             readUntil(buffer, iter, OrFunctor<IsTab, IsNewline>());
         }
-        
+
         if (col == index.colSeq)
             record.refName = buffer;
         else if (col == index.colBeg)
             record.posBeg = lexicalCast<__int32>(buffer);
         else if (col == index.colEnd)
             record.posEnd = lexicalCast<__int32>(buffer);
+
+        if (isVcf && col == 4)
+            refLength = std::max((__int32)length(buffer), (__int32)1);
     }
 
-    if (index.colEnd == 0 || index.colEnd == index.colBeg)
+    // Text-based file formats are 1-based with closed intervals unless UCSC-like (e.g. BED).  We use 0-based
+    // half-open intervals internally, so only the begin position needs to be shifted.
+    if (!(index.format & TabixIndex::FORMAT_UCSC))
+        --record.posBeg;
+
+    if (isVcf)
+        record.posEnd = record.posBeg + refLength;
+    else if (index.colEnd == 0 || index.colEnd == index.colBeg)
         record.posEnd = record.posBeg + 1;
-    
-    // all text-based file formats are 1-based (we use 0-based positions internally)
-    --record.posBeg;
-    --record.posEnd;
-    
+
     // Go to next line.
     skipLine(iter);
     return true;
 }
 
+// ----------------------------------------------------------------------------
+// Function _tabixMinOffset()
+// ----------------------------------------------------------------------------
+
+// Returns the smallest virtual offset of records overlapping position posBeg, i.e. a lower bound for the chunks that
+// must be scanned.
+
+inline __uint64
+_tabixMinOffset(TabixIndex const & index, unsigned refId, __int32 posBeg)
+{
+    typedef TabixIndex::TBinIndex_ TBinIndex;
+
+    if (!empty(index._linearIndices))
+    {
+        // TBI: Retrieve the smallest required offset from the linear index.
+        unsigned windowIdx = posBeg >> index.minShift;  // Linear index consists of 16kb windows.
+        if (windowIdx < length(index._linearIndices[refId]))
+            return index._linearIndices[refId][windowIdx];
+        if (!empty(index._linearIndices[refId]))
+            return back(index._linearIndices[refId]);
+        return 0;
+    }
+
+    // CSI: The bin of the window containing posBeg or the closest preceding bin on the same or a higher level
+    // provides the lower bound.
+    TBinIndex const & binIndex = index._binIndices[refId];
+    __uint32 bin = _tbiBinFirst(index.depth) + static_cast<__uint32>(posBeg >> index.minShift);
+    do
+    {
+        TBinIndex::const_iterator it = binIndex.find(bin);
+        if (it != binIndex.end())
+            return it->second.loffset;
+
+        __uint32 first = (((bin - 1) >> 3) << 3) + 1;   // first sibling
+        if (bin > first)
+            --bin;
+        else
+            bin = (bin - 1) >> 3;                       // parent
+    }
+    while (bin != 0);
+
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Function _getRegionChunks()
+// ----------------------------------------------------------------------------
+
+// Appends the chunks [begin, end) of virtual offsets that may contain records overlapping [posBeg, posEnd).
+
+inline void
+_getRegionChunks(String<Pair<__uint64, __uint64> > & chunks,
+                 TabixIndex const & index,
+                 unsigned refId,
+                 __int32 posBeg,
+                 __int32 posEnd)
+{
+    typedef TabixIndex::TBinIndex_                                              TBinIndex;
+    typedef Iterator<String<__uint32>, Rooted>::Type                            TCandidateIter;
+    typedef Iterator<String<Pair<__uint64, __uint64> > const, Rooted>::Type     TBegEndIter;
+
+    if (refId >= length(index._binIndices))
+        return;
+    if (posBeg < 0)
+        posBeg = 0;
+
+    TBinIndex const & binIndex = index._binIndices[refId];
+    __uint64 minOffset = _tabixMinOffset(index, refId, posBeg);
+
+    // Retrieve the candidate bin identifiers for [posBeg, posEnd).
+    String<__uint32> candidateBins;
+    _tbiReg2bins(candidateBins, posBeg, posEnd, index.minShift, index.depth);
+
+    for (TCandidateIter it = begin(candidateBins, Rooted()); !atEnd(it); goNext(it))
+    {
+        TBinIndex::const_iterator mIt = binIndex.find(*it);
+        if (mIt == binIndex.end())
+            continue;  // Candidate is not in index!
+
+        for (TBegEndIter it2 = begin(mIt->second.chunkBegEnds, Rooted()); !atEnd(it2); goNext(it2))
+            if (it2->i2 > minOffset)
+                appendValue(chunks, Pair<__uint64, __uint64>(std::max(it2->i1, minOffset), it2->i2));
+    }
+}
+
 // ----------------------------------------------------------------------------
 // Function jumpToRegion()
 // ----------------------------------------------------------------------------
@@ -271,6 +428,8 @@ jumpToRegion(FormattedFile<TFileFormat, Input, TSpec> & fileIn,
              TabixIndex const & index,
              bool firstMatch = true)
 {
+    typedef typename Iterator<String<Pair<__uint64, __uint64> >, Standard>::Type TChunkIter;
+
     hasEntries = false;
 
     // Get id of given contig name
@@ -278,126 +437,51 @@ jumpToRegion(FormattedFile<TFileFormat, Input, TSpec> & fileIn,
     if (!getIdByName(refId, index._nameStoreCache, refName))
         return false;
 
-    // ------------------------------------------------------------------------
-    // Compute offset in BGZF file.
-    // ------------------------------------------------------------------------
-    __uint64 offset = MaxValue<__uint64>::VALUE;
-
-    // Retrieve the candidate bin identifiers for [posBeg, posEnd).
-    String<__uint16> candidateBins;
-    _tbiReg2bins(candidateBins, posBeg, posEnd);
+    if (posBeg < 0)
+        posBeg = 0;
 
-    // Retrieve the smallest required offset from the linear index.
-    unsigned windowIdx = posBeg >> 14;  // Linear index consists of 16kb windows.
-    __uint64 linearMinOffset = 0;
-    if (windowIdx >= length(index._linearIndices[refId]))
-    {
-        // TODO(holtgrew): Can we simply always take case 1?
+    // The leftmost chunk is the first to scan.
+    String<Pair<__uint64, __uint64> > chunks;
+    _getRegionChunks(chunks, index, refId, posBeg, posEnd);
 
-        // This is the case were we want to jump in a non-existing window.
-        //
-        // If there are no linear indices for this reference then we use the linear min offset of the next
-        // reference that has an linear index.
-        if (empty(index._linearIndices[refId]))
-        {
-            for (unsigned i = refId; i < length(index._linearIndices); ++i)
-            {
-                if (!empty(index._linearIndices[i]))
-                {
-                    linearMinOffset = front(index._linearIndices[i]);
-                    if (linearMinOffset != 0u)
-                        break;
-                    for (unsigned j = 1; j < length(index._linearIndices[i]); ++j)
-                    {
-                        if (index._linearIndices[i][j] > linearMinOffset)
-                        {
-                            linearMinOffset = index._linearIndices[i][j];
-                            break;
-                        }
-                    }
-                    if (linearMinOffset != 0u)
-                        break;
-                }
-            }
-        }
-        else
-        {
-            linearMinOffset = back(index._linearIndices[refId]);
-        }
-    }
-    else
-    {
-        linearMinOffset = index._linearIndices[refId][windowIdx];
-    }
-
-    // Combine candidate bins and smallest required offset from linear index into candidate offset.
-    typedef std::set<__uint64> TOffsetCandidates;
-    TOffsetCandidates offsetCandidates;
-    typedef typename Iterator<String<__uint16>, Rooted>::Type TCandidateIter;
-    for (TCandidateIter it = begin(candidateBins, Rooted()); !atEnd(it); goNext(it))
-    {
-        typedef typename std::map<__uint32, TabixIndexBinData_>::const_iterator TMapIter;
-        TMapIter mIt = index._binIndices[refId].find(*it);
-        if (mIt == index._binIndices[refId].end())
-            continue;  // Candidate is not in index!
-
-        typedef typename Iterator<String<Pair<__uint64, __uint64> > const, Rooted>::Type TBegEndIter;
-        for (TBegEndIter it2 = begin(mIt->second.chunkBegEnds, Rooted()); !atEnd(it2); goNext(it2))
-            if (it2->i2 >= linearMinOffset)
-                offsetCandidates.insert(it2->i1);
-    }
+    __uint64 offset = MaxValue<__uint64>::VALUE;
+    for (TChunkIter it = begin(chunks, Standard()); it != end(chunks, Standard()); ++it)
+        offset = std::min(offset, it->i1);
 
-    // Search through candidate offsets, find rightmost possible.
-    //
-    // Note that it is not necessarily the first.
-    //
-    // TODO(holtgrew): Can this be optimized similar to how bamtools does it?
-    typedef typename TOffsetCandidates::const_iterator TOffsetCandidateIter;
+    if (offset == MaxValue<__uint64>::VALUE)
+        return true;  // No chunk overlaps the region.
 
+    // Scan forward to the first record overlapping [posBeg, posEnd).
+    __uint64 chunkOffset = offset;
     CharString buffer;
     TabixRecord_ record;
-    for (TOffsetCandidateIter candIt = offsetCandidates.begin(); candIt != offsetCandidates.end(); ++candIt)
+    setPosition(fileIn, offset);
+    while (!atEnd(fileIn))
     {
-        setPosition(fileIn, *candIt);
-
+        offset = position(fileIn);
         if (!_readTabixRecord(record, buffer, fileIn.iter, index))
             break;
 
         if (record.refName != refName)
-            continue;  // Wrong contig.
-        
-        if (!hasEntries || record.posBeg <= posBeg)
         {
-            // Found a valid record.
-            hasEntries = true;
-            offset = *candIt;
+            if (hasEntries)
+                break;
+            continue;  // Wrong contig.
         }
 
         if (record.posBeg >= posEnd)
             break;  // Cannot find overlapping any more.
-    }
 
-    if (offset != MaxValue<__uint64>::VALUE)
-    {
-        setPosition(fileIn, offset);
-        
-        if (firstMatch)
+        if (posBeg < record.posEnd)
         {
-            // skip to the first overlapping record
-            while (!atEnd(fileIn) && !(posBeg < record.posEnd && record.posBeg < posEnd))
-            {
-                offset = position(fileIn);
-                _readTabixRecord(record, buffer, fileIn.iter, index);
-                if (record.posBeg >= posEnd)
-                {
-                    hasEntries = false;
-                    return true;
-                }
-            }
-            setPosition(fileIn, offset);
+            hasEntries = true;
+            break;
         }
     }
 
+    if (hasEntries)
+        setPosition(fileIn, firstMatch ? offset : chunkOffset);
+
     // Finding no overlapping records is not an error, hasEntries is false.
     return true;
 }
@@ -422,13 +506,36 @@ getUnalignedCount(TabixIndex const & index)
     return index.unalignedCount;
 }
 
+// ----------------------------------------------------------------------------
+// Function _tabixUpdateBinOffsets()
+// ----------------------------------------------------------------------------
+
+// Derive the loffset of each bin from the linear index of its first window.
+
+inline void
+_tabixUpdateBinOffsets(TabixIndex & index)
+{
+    typedef TabixIndex::TBinIndex_::iterator TBinIndexIter;
+
+    for (unsigned i = 0; i < length(index._linearIndices) && i < length(index._binIndices); ++i)
+    {
+        TabixIndex::TLinearIndex_ const & linearIndex = index._linearIndices[i];
+        for (TBinIndexIter it = index._binIndices[i].begin(); it != index._binIndices[i].end(); ++it)
+        {
+            __int32 level = _tbiBinLevel(it->first, index.depth);
+            __uint64 window = (__uint64)(it->first - _tbiBinFirst(level)) << ((index.depth - level) * 3);
+            it->second.loffset = (window < length(linearIndex)) ? linearIndex[window] : 0;
+        }
+    }
+}
+
 // ----------------------------------------------------------------------------
 // Function open()
 // ----------------------------------------------------------------------------
 
 /*!
  * @fn TabixIndex#open
- * @brief Load a Tabix index from file.
+ * @brief Load a Tabix index from a TBI or CSI file.
  * @signature bool open(index, filename);
 
  * @param[in,out] index    Target data structure.
@@ -437,47 +544,82 @@ getUnalignedCount(TabixIndex const & index)
  * @return        bool     Returns <tt>true</tt> on success, false otherwise.
  */
 
+template <typename TIter>
+inline void
+_readTabixConfig(TabixIndex & index, CharString & names, TIter & iter)
+{
+    readRawPod(index.format, iter);
+    readRawPod(index.colSeq, iter);
+    readRawPod(index.colBeg, iter);
+    readRawPod(index.colEnd, iter);
+    readRawPod(index.meta, iter);
+    readRawPod(index.skip, iter);
+
+    // Read concatenated names.
+    __int32 lNm = 0;
+    readRawPod(lNm, iter);
+    clear(names);
+    read(names, iter, lNm);
+}
+
 inline bool
 open(TabixIndex & index, char const * filename)
 {
     typedef VirtualStream<char, Input> TInStream;
-    
-    TInStream tbi;
-    if (!open(tbi, filename))
+
+    std::fstream file(filename, std::ios::binary | std::ios::in);
+    if (!file.good())
         return false;  // Could not open file.
 
+    // TBI and CSI files are BGZF compressed.
+    TInStream tbi;
+    if (!open(tbi, file))
+        return false;
+
     DirectionIterator<TInStream, Input>::Type iter = directionIterator(tbi, Input());
 
     // Read magic header.
     String<char, Array<4> > magic;
     read(magic, iter, 4);
-    if (magic != "TBI\1")
-        SEQAN_THROW(ParseError("Not in TBI format."));
 
-    // Read parameters.
     __int32 nRef = 0;
-    readRawPod(nRef, iter);
-    readRawPod(index.format, iter);
-    readRawPod(index.colSeq, iter);
-    readRawPod(index.colBeg, iter);
-    readRawPod(index.colEnd, iter);
-    readRawPod(index.meta, iter);
-    readRawPod(index.skip, iter);
-
-    // Read concatenated names.
-    __int32 lNm = 0;
     CharString tmp;
-    readRawPod(lNm, iter);
-    read(tmp, iter, lNm);
+    bool isCsi = (magic == "CSI\1");
+    if (isCsi)
+    {
+        // The tabix configuration is stored as auxiliary data.
+        __int32 lAux = 0;
+        readRawPod(index.minShift, iter);
+        readRawPod(index.depth, iter);
+        readRawPod(lAux, iter);
+        if (lAux < 28)
+            SEQAN_THROW(ParseError("CSI index has no Tabix configuration."));
+        _readTabixConfig(index, tmp, iter);
+        readRawPod(nRef, iter);
+    }
+    else if (magic == "TBI\1")
+    {
+        index.minShift = TabixIndex::BAM_LIDX_SHIFT;
+        index.depth = 5;
+        readRawPod(nRef, iter);
+        _readTabixConfig(index, tmp, iter);
+    }
+    else
+    {
+        SEQAN_THROW(ParseError("Not in TBI or CSI format."));
+    }
 
     // Split concatenated names at \0's.
+    if (!empty(tmp) && back(tmp) == '\0')
+        resize(tmp, length(tmp) - 1);
     clear(index._nameStore);
     strSplit(index._nameStore, tmp, EqualsChar<'\0'>(), true, nRef - 1);
     refresh(index._nameStoreCache);
 
     clear(index._linearIndices);
     clear(index._binIndices);
-    resize(index._linearIndices, nRef);
+    if (!isCsi)
+        resize(index._linearIndices, nRef);
     resize(index._binIndices, nRef);
 
     TabixIndexBinData_ data;
@@ -492,6 +634,8 @@ open(TabixIndex & index, char const * filename)
             __uint32 bin = 0;
             __int32 nChunk = 0;
             readRawPod(bin, iter);
+            if (isCsi)
+                readRawPod(data.loffset, iter);
             readRawPod(nChunk, iter);
 
             resize(data.chunkBegEnds, nChunk);
@@ -505,6 +649,9 @@ open(TabixIndex & index, char const * filename)
             index._binIndices[i][bin] = data;
         }
 
+        if (isCsi)
+            continue;
+
         // Read linear index.
         __int32 nIntv = 0;
         readRawPod(nIntv, iter);
@@ -514,13 +661,374 @@ open(TabixIndex & index, char const * filename)
             readRawPod(index._linearIndices[i][j], iter);
     }
 
-
     // Read (optional) number of alignments without coordinate.
     if (!atEnd(iter))
         readRawPod(index.unalignedCount, iter);
     else
         index.unalignedCount = maxValue<__uint64>();
 
+    // Make the index savable in both formats.
+    if (!isCsi)
+        _tabixUpdateBinOffsets(index);
+
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Function save()
+// ---------------------------------------------------------------------------
+
+/*!
+ * @fn TabixIndex#save
+ * @brief Save a Tabix index to a TBI or CSI file.
+ *
+ * @signature bool save(index, fileName);
+ *
+ * @param[in] index     The TabixIndex to write out.
+ * @param[in] fileName  The name of the file to write to.  A CSI index is written if the name ends with
+ *                      <tt>.csi</tt>, a TBI index otherwise.  Type: <tt>char const *</tt>.
+ *
+ * @return bool <tt>true</tt> on success, <tt>false</tt> otherwise, e.g. if the index requires more binning levels
+ *              than TBI supports.
+ */
+
+template <typename TIter>
+inline void
+_writeTabixConfig(TIter & iter, TabixIndex const & index)
+{
+    __int32 lNm = 0;
+    for (unsigned i = 0; i < length(index._nameStore); ++i)
+        lNm += length(index._nameStore[i]) + 1;
+
+    appendRawPod(iter, index.format);
+    appendRawPod(iter, index.colSeq);
+    appendRawPod(iter, index.colBeg);
+    appendRawPod(iter, index.colEnd);
+    appendRawPod(iter, index.meta);
+    appendRawPod(iter, index.skip);
+    appendRawPod(iter, lNm);
+    for (unsigned i = 0; i < length(index._nameStore); ++i)
+    {
+        write(iter, index._nameStore[i]);
+        writeValue(iter, '\0');
+    }
+}
+
+inline bool
+save(TabixIndex const & index, char const * fileName)
+{
+    typedef VirtualStream<char, Output>                 TOutStream;
+    typedef DirectionIterator<TOutStream, Output>::Type TIter;
+    typedef TabixIndex::TBinIndex_ const                TBinIndex;
+    typedef TBinIndex::const_iterator                   TBinIndexIter;
+    typedef Iterator<String<Pair<__uint64> > const, Rooted>::Type TChunkIter;
+    typedef Iterator<String<__uint64> const, Rooted>::Type TLinearIndexIter;
+
+    bool isCsi = endsWith(CharString(fileName), ".csi");
+    if (!isCsi && (index.minShift != TabixIndex::BAM_LIDX_SHIFT || index.depth != 5))
+        return false;  // TBI only supports the fixed binning scheme.
+
+    std::ofstream file(fileName, std::ios::binary | std::ios::out);
+    if (!file.good())
+        return false;  // Could not open file.
+
+    {
+        // TBI and CSI files are BGZF compressed.
+        TOutStream out;
+        if (!open(out, file, BgzfFile()))
+            return false;
+
+        TIter iter = directionIterator(out, Output());
+
+        __int32 numRefSeqs = length(index._binIndices);
+        if (isCsi)
+        {
+            __int32 lAux = 28;
+            for (unsigned i = 0; i < length(index._nameStore); ++i)
+                lAux += length(index._nameStore[i]) + 1;
+
+            write(iter, "CSI\1");
+            appendRawPod(iter, index.minShift);
+            appendRawPod(iter, index.depth);
+            appendRawPod(iter, lAux);
+            _writeTabixConfig(iter, index);
+            appendRawPod(iter, numRefSeqs);
+        }
+        else
+        {
+            write(iter, "TBI\1");
+            appendRawPod(iter, numRefSeqs);
+            _writeTabixConfig(iter, index);
+        }
+
+        for (int i = 0; i < numRefSeqs; ++i)
+        {
+            // Write out binning index.
+            TBinIndex & binIndex = index._binIndices[i];
+            appendRawPod(iter, (__int32)binIndex.size());
+            for (TBinIndexIter itB = binIndex.begin(), itBEnd = binIndex.end(); itB != itBEnd; ++itB)
+            {
+                appendRawPod(iter, itB->first);
+                if (isCsi)
+                    appendRawPod(iter, itB->second.loffset);
+                appendRawPod(iter, (__int32)length(itB->second.chunkBegEnds));
+                for (TChunkIter itC = begin(itB->second.chunkBegEnds, Rooted()); !atEnd(itC); goNext(itC))
+                {
+                    appendRawPod(iter, itC->i1);
+                    appendRawPod(iter, itC->i2);
+                }
+            }
+
+            if (isCsi)
+                continue;
+
+            // Write out linear index.
+            if (static_cast<unsigned>(i) < length(index._linearIndices))
+            {
+                appendRawPod(iter, (__int32)length(index._linearIndices[i]));
+                for (TLinearIndexIter it = begin(index._linearIndices[i], Rooted()); !atEnd(it); goNext(it))
+                    appendRawPod(iter, *it);
+            }
+            else
+            {
+                appendRawPod(iter, (__int32)0);
+            }
+        }
+
+        // Write the number of unaligned reads if set.
+        if (index.unalignedCount != maxValue<__uint64>())
+            appendRawPod(iter, index.unalignedCount);
+
+        close(out);
+    }
+
+    return file.good();  // false on error, true on success.
+}
+
+// ---------------------------------------------------------------------------
+// Function _tabixSetPreset()
+// ---------------------------------------------------------------------------
+
+// Choose the columns and coordinate system from the file extension (as the tabix presets do).
+
+inline void
+_tabixSetPreset(TabixIndex & index, char const * fileName)
+{
+    CharString name = fileName;
+    char const * compressed[] = { ".gz", ".bgz", ".bgzf" };
+    for (unsigned i = 0; i < 3; ++i)
+        if (endsWith(name, compressed[i]))
+        {
+            resize(name, length(name) - strlen(compressed[i]));
+            break;
+        }
+
+    if (endsWith(name, ".vcf"))
+    {
+        index.format = 2;
+        index.colSeq = 1; index.colBeg = 2; index.colEnd = 0;
+        index.meta = '#'; index.skip = 0;
+    }
+    else if (endsWith(name, ".gff") || endsWith(name, ".gff3") || endsWith(name, ".gtf"))
+    {
+        index.format = 0;
+        index.colSeq = 1; index.colBeg = 4; index.colEnd = 5;
+        index.meta = '#'; index.skip = 0;
+    }
+    else if (endsWith(name, ".bed"))
+    {
+        index.format = TabixIndex::FORMAT_UCSC;
+        index.colSeq = 1; index.colBeg = 2; index.colEnd = 3;
+        index.meta = '#'; index.skip = 0;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Function _tabixIncreaseDepth()
+// ---------------------------------------------------------------------------
+
+// Add a new root level to the binning scheme.  Each bin keeps its position on its level, which becomes one deeper.
+
+inline __uint32
+_tbiDeeperBin(__uint32 bin, __int32 depth)
+{
+    __int32 level = _tbiBinLevel(bin, depth);
+    return bin - _tbiBinFirst(level) + _tbiBinFirst(level + 1);
+}
+
+inline void
+_tabixIncreaseDepth(TabixIndex & index)
+{
+    typedef TabixIndex::TBinIndex_ TBinIndex;
+
+    for (unsigned i = 0; i < length(index._binIndices); ++i)
+    {
+        TBinIndex binIndex;
+        for (TBinIndex::iterator it = index._binIndices[i].begin(); it != index._binIndices[i].end(); ++it)
+            binIndex[_tbiDeeperBin(it->first, index.depth)] = it->second;
+        index._binIndices[i].swap(binIndex);
+    }
+    ++index.depth;
+}
+
+// ---------------------------------------------------------------------------
+// Function _tabixFinalizeReference()
+// ---------------------------------------------------------------------------
+
+inline void
+_tabixFinalizeReference(TabixIndex::TLinearIndex_ & linearIndex)
+{
+    // Windows not covered by any record inherit the offset of the next covered window.
+    for (int i = (int)length(linearIndex) - 2; i >= 0; --i)
+        if (linearIndex[i] == MaxValue<__uint64>::VALUE)
+            linearIndex[i] = linearIndex[i + 1];
+}
+
+// ---------------------------------------------------------------------------
+// Function build()
+// ---------------------------------------------------------------------------
+
+/*!
+ * @fn TabixIndex#build
+ * @brief Create a Tabix index for a sorted and BGZF compressed file in a single pass.
+ *
+ * @signature bool build(index, fileName);
+ *
+ * @param[out] index    The TabixIndex to build into.
+ * @param[in]  fileName Path to the BGZF compressed file, e.g. <tt>variants.vcf.gz</tt>.  Type: <tt>char const *</tt>.
+ *
+ * @return bool <tt>true</tt> on success, <tt>false</tt> otherwise (e.g. if the file is not sorted or not BGZF
+ *              compressed).
+ *
+ * @section Remarks
+ *
+ * For files ending in <tt>.vcf</tt>, <tt>.gff</tt>, <tt>.gff3</tt>, <tt>.gtf</tt>, or <tt>.bed</tt> (followed by
+ * <tt>.gz</tt>, <tt>.bgz</tt>, or <tt>.bgzf</tt>) the columns are chosen like the tabix presets.  Otherwise, the
+ * configuration members of <tt>index</tt> are used.  The number of binning levels is increased as needed; indices
+ * for contigs longer than 2^29 bp must be saved as CSI.
+ */
+
+inline bool
+build(TabixIndex & index, char const * fileName)
+{
+    typedef VirtualStream<char, Input>                  TInStream;
+    typedef DirectionIterator<TInStream, Input>::Type   TIter;
+
+    std::fstream file(fileName, std::ios::binary | std::ios::in);
+    if (!file.good())
+        return false;  // Could not open file.
+
+    // Only BGZF compressed files provide virtual offsets.
+    TInStream stream;
+    if (!open(stream, file, BgzfFile()))
+        return false;
+
+    _tabixSetPreset(index, fileName);
+    index.minShift = TabixIndex::BAM_LIDX_SHIFT;
+    index.depth = 5;
+    index.unalignedCount = maxValue<__uint64>();
+    clear(index._binIndices);
+    clear(index._linearIndices);
+    clear(index._nameStore);
+    refresh(index._nameStoreCache);
+
+    TIter iter = directionIterator(stream, Input());
+
+    // Skip leading lines.
+    for (__int32 i = 0; i < index.skip && !atEnd(iter); ++i)
+        skipLine(iter);
+
+    CharString buffer;
+    TabixRecord_ record;
+    unsigned currRefId  = MaxValue<unsigned>::VALUE;
+    __uint32 currBin    = maxValue<__uint32>();
+    __int32 prevPos     = minValue<__int32>();
+    __uint64 chunkBeg   = 0;
+    __uint64 recordBeg  = 0;
+    __uint64 recordEnd  = 0;
+
+    while (true)
+    {
+        // Skip comment lines (before taking the offset of the record).
+        while (!atEnd(iter) && *iter == (char)index.meta)
+            skipLine(iter);
+        if (atEnd(iter))
+            break;
+
+        recordBeg = stream.tellg();
+        if (!_readTabixRecord(record, buffer, iter, index))
+            break;
+        __uint64 prevEnd = recordEnd;
+        recordEnd = stream.tellg();
+
+        unsigned refId = 0;
+        if (!getIdByName(refId, index._nameStoreCache, record.refName))
+        {
+            // A new contig starts.
+            refId = length(index._nameStore);
+            appendName(index._nameStoreCache, record.refName);
+            resize(index._binIndices, refId + 1);
+            resize(index._linearIndices, refId + 1);
+        }
+
+        if (refId != currRefId)
+        {
+            if (currRefId != MaxValue<unsigned>::VALUE && refId < currRefId)
+                return false;  // Not grouped by contig.
+
+            // Close the chunk of the previous contig.
+            if (currBin != maxValue<__uint32>())
+            {
+                appendValue(index._binIndices[currRefId][currBin].chunkBegEnds, Pair<__uint64>(chunkBeg, prevEnd));
+                _tabixFinalizeReference(index._linearIndices[currRefId]);
+            }
+
+            currRefId = refId;
+            currBin = maxValue<__uint32>();
+            prevPos = minValue<__int32>();
+        }
+
+        if (record.posBeg < 0 || prevPos > record.posBeg)
+            return false;  // Not sorted by position.
+        prevPos = record.posBeg;
+
+        __int64 beg = record.posBeg;
+        __int64 end = std::max((__int64)record.posEnd, beg + 1);
+        while (end > (__int64)1 << (index.minShift + index.depth * 3))
+        {
+            if (currBin != maxValue<__uint32>())
+                currBin = _tbiDeeperBin(currBin, index.depth);
+            _tabixIncreaseDepth(index);
+        }
+
+        // Store the first record offset for every covered window.
+        TabixIndex::TLinearIndex_ & linearIndex = index._linearIndices[refId];
+        __uint64 lastWindow = (end - 1) >> index.minShift;
+        if (length(linearIndex) <= lastWindow)
+            resize(linearIndex, lastWindow + 1, MaxValue<__uint64>::VALUE);
+        for (__uint64 w = beg >> index.minShift; w <= lastWindow; ++w)
+            if (linearIndex[w] == MaxValue<__uint64>::VALUE)
+                linearIndex[w] = recordBeg;
+
+        // Handle the case if we changed to a new bin.
+        __uint32 bin = _tbiReg2bin(beg, end, index.minShift, index.depth);
+        if (bin != currBin)
+        {
+            if (currBin != maxValue<__uint32>())
+                appendValue(index._binIndices[refId][currBin].chunkBegEnds, Pair<__uint64>(chunkBeg, prevEnd));
+            chunkBeg = recordBeg;
+            currBin = bin;
+        }
+    }
+
+    // Store the last chunk.
+    if (currBin != maxValue<__uint32>())
+    {
+        appendValue(index._binIndices[currRefId][currBin].chunkBegEnds, Pair<__uint64>(chunkBeg, recordEnd));
+        _tabixFinalizeReference(index._linearIndices[currRefId]);
+    }
+
+    _tabixUpdateBinOffsets(index);
     return true;
 }
 
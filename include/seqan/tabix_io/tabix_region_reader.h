@@ -0,0 +1,307 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2015, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: SeqAn Team <seqan-dev@lists.fu-berlin.de>
+// ==========================================================================
+// Multi-region queries on Tabix indexed files (VCF, GFF, BED, ...).
+//
+// The chunk lists of all query regions are merged and scanned once in file
+// order.  Each record is reported once together with the ids of all regions
+// it overlaps.
+// ==========================================================================
+
+#ifndef INCLUDE_SEQAN_TABIX_IO_TABIX_REGION_READER_H_
+#define INCLUDE_SEQAN_TABIX_IO_TABIX_REGION_READER_H_
+
+namespace seqan {
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Class TabixRegionReader
+// ----------------------------------------------------------------------------
+
+/*!
+ * @class TabixRegionReader
+ * @headerfile <seqan/tabix_io.h>
+ * @brief Read the records overlapping a list of genomic regions from a Tabix indexed file.
+ *
+ * @signature template <typename TFileFormat[, typename TFileSpec]>
+ *            class TabixRegionReader;
+ *
+ * @tparam TFileFormat The format of the input file, e.g. <tt>Vcf</tt>.
+ * @tparam TFileSpec   The specialization of the input file, defaults to <tt>void</tt>.
+ *
+ * The chunks of all regions are merged, so each part of the file is read at most once even if regions overlap or
+ * lie close to each other.  Every record is returned once, together with the ids (positions in the region list) of
+ * all regions it overlaps.  Records are returned in file order.
+ *
+ * Regions are resolved by their @link GenomicRegion::seqName @endlink.  A <tt>beginPos</tt> of <tt>-1</tt> selects
+ * the contig from its begin, an <tt>endPos</tt> of <tt>-1</tt> selects it to its end.  Regions on contigs missing in
+ * the index are ignored.
+ *
+ * @section Examples
+ *
+ * @code{.cpp}
+ * VcfFileIn vcfFile("test.vcf.gz");
+ * VcfHeader header;
+ * readHeader(header, vcfFile);
+ *
+ * TabixIndex index("test.vcf.gz.tbi");
+ *
+ * String<GenomicRegion> regions;
+ * appendValue(regions, GenomicRegion("20:14000-20000"));
+ * appendValue(regions, GenomicRegion("20:1100000-1300000"));
+ *
+ * TabixRegionReader<Vcf> reader(vcfFile, index, regions);
+ * VcfRecord record;
+ * String<unsigned> regionIds;
+ * while (!atEnd(reader))
+ *     readRecord(record, regionIds, reader);
+ * @endcode
+ */
+
+/*!
+ * @fn TabixRegionReader::TabixRegionReader
+ * @brief Constructor.
+ *
+ * @signature TabixRegionReader::TabixRegionReader(fileIn, index[, regions]);
+ *
+ * @param[in,out] fileIn  The file to read from, e.g. a @link VcfFileIn @endlink.  Its header must have been read.
+ * @param[in]     index   The @link TabixIndex @endlink of the file.
+ * @param[in]     regions A @link String @endlink of @link GenomicRegion @endlink objects to query.
+ */
+
+template <typename TFileFormat, typename TFileSpec = void>
+class TabixRegionReader
+{
+public:
+    typedef FormattedFile<TFileFormat, Input, TFileSpec>    TFileIn;
+    typedef Pair<__uint64, __uint64>                        TChunk;
+
+    TFileIn *               file;
+    TabixIndex const *      index;
+
+    String<GenomicRegion>   regions;        // resolved regions, sorted by (rID, beginPos)
+    String<unsigned>        regionIds;      // position of each region in the query list
+    String<TChunk>          chunks;         // merged virtual offset ranges to scan
+
+    unsigned                currentChunk;
+    unsigned                firstRegion;    // regions left of it end before the current record
+    bool                    _inChunk;
+    bool                    _pending;       // _recordOffset points to the next overlapping record
+    String<unsigned>        _pendingIds;
+    __uint64                _recordOffset;
+
+    TabixRecord_            _record;
+    CharString              _buffer;
+    CharString              _lastRefName;
+    unsigned                _lastRefId;
+
+    TabixRegionReader(TFileIn & file, TabixIndex const & index) :
+        file(&file), index(&index), currentChunk(0), firstRegion(0), _inChunk(false), _pending(false),
+        _recordOffset(0), _lastRefId(0)
+    {}
+
+    TabixRegionReader(TFileIn & file, TabixIndex const & index, String<GenomicRegion> const & regions) :
+        file(&file), index(&index), currentChunk(0), firstRegion(0), _inChunk(false), _pending(false),
+        _recordOffset(0), _lastRefId(0)
+    {
+        setRegions(*this, regions);
+    }
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function setRegions()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn TabixRegionReader#setRegions
+ * @brief Set the regions to query and restart reading.
+ *
+ * @signature void setRegions(reader, regions);
+ *
+ * @param[in,out] reader  The @link TabixRegionReader @endlink to configure.
+ * @param[in]     regions A @link String @endlink of @link GenomicRegion @endlink objects.  The ids reported by
+ *                        @link TabixRegionReader#readRecord @endlink are positions in this string.
+ */
+
+template <typename TFileFormat, typename TFileSpec>
+inline void
+setRegions(TabixRegionReader<TFileFormat, TFileSpec> & reader, String<GenomicRegion> const & regions)
+{
+    clear(reader.chunks);
+    reader.currentChunk = 0;
+    reader.firstRegion = 0;
+    reader._inChunk = false;
+    reader._pending = false;
+    clear(reader._lastRefName);
+
+    // The rID of a region is its position in the index, seqName is always used to resolve it.
+    String<GenomicRegion> named(regions);
+    for (unsigned i = 0; i < length(named); ++i)
+        named[i].rID = GenomicRegion::INVALID_ID;
+
+    _sortRegions(reader.regions, reader.regionIds, named, reader.index->_nameStoreCache);
+    for (unsigned i = 0; i < length(reader.regions); ++i)
+    {
+        GenomicRegion const & region = reader.regions[i];
+        _getRegionChunks(reader.chunks, *reader.index, region.rID, region.beginPos, region.endPos);
+    }
+    _mergeBgzfChunks(reader.chunks);
+}
+
+// ----------------------------------------------------------------------------
+// Function _advance()
+// ----------------------------------------------------------------------------
+
+// Scans the remaining chunks for the next record that overlaps a region.  Only the columns required by the index
+// are extracted while scanning.
+
+template <typename TFileFormat, typename TFileSpec>
+inline bool
+_advance(TabixRegionReader<TFileFormat, TFileSpec> & reader)
+{
+    typedef typename TabixRegionReader<TFileFormat, TFileSpec>::TChunk TChunk;
+
+    if (reader._pending)
+        return true;
+
+    while (reader.currentChunk < length(reader.chunks) && reader.firstRegion < length(reader.regions))
+    {
+        TChunk const & chunk = reader.chunks[reader.currentChunk];
+        if (!reader._inChunk)
+        {
+            if ((__uint64)position(*reader.file) != chunk.i1)
+                setPosition(*reader.file, chunk.i1);
+            reader._inChunk = true;
+        }
+
+        // Skip comment lines.
+        while (!atEnd(reader.file->iter) && *reader.file->iter == (char)reader.index->meta)
+            skipLine(reader.file->iter);
+
+        reader._recordOffset = position(*reader.file);
+        if (atEnd(reader.file->iter) || reader._recordOffset >= chunk.i2)
+        {
+            ++reader.currentChunk;
+            reader._inChunk = false;
+            continue;
+        }
+
+        TabixRecord_ & record = reader._record;
+        _readTabixRecord(record, reader._buffer, reader.file->iter, *reader.index);
+
+        if (record.refName != reader._lastRefName)
+        {
+            reader._lastRefName = record.refName;
+            if (!getIdByName(reader._lastRefId, reader.index->_nameStoreCache, record.refName))
+                reader._lastRefId = MaxValue<unsigned>::VALUE;
+        }
+        if (reader._lastRefId == MaxValue<unsigned>::VALUE)
+            continue;  // Contig is not indexed.
+
+        _getOverlappingRegions(reader._pendingIds, reader.firstRegion, reader.regions, reader.regionIds,
+                               reader._lastRefId, record.posBeg, record.posEnd);
+        if (!empty(reader._pendingIds))
+        {
+            reader._pending = true;
+            return true;
+        }
+    }
+    return false;
+}
+
+// ----------------------------------------------------------------------------
+// Function atEnd()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn TabixRegionReader#atEnd
+ * @brief Query whether all records overlapping the regions have been read.
+ *
+ * @signature bool atEnd(reader);
+ *
+ * @param[in,out] reader The @link TabixRegionReader @endlink to query.
+ *
+ * @return bool <tt>true</tt> if there are no more overlapping records.
+ */
+
+template <typename TFileFormat, typename TFileSpec>
+inline bool
+atEnd(TabixRegionReader<TFileFormat, TFileSpec> & reader)
+{
+    return !_advance(reader);
+}
+
+// ----------------------------------------------------------------------------
+// Function readRecord()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn TabixRegionReader#readRecord
+ * @brief Read the next record that overlaps one of the regions.
+ *
+ * @signature void readRecord(record, regionIds, reader);
+ *
+ * @param[out]    record    The record to read into, e.g. a @link VcfRecord @endlink.
+ * @param[out]    regionIds A <tt>String&lt;unsigned&gt;</tt> with the ascending ids of the overlapped regions.
+ * @param[in,out] reader    The @link TabixRegionReader @endlink to read from.
+ *
+ * @throw IOError On low-level I/O errors.
+ * @throw ParseError On high-level file format errors or if there are no more overlapping records.
+ */
+
+template <typename TRecord, typename TFileFormat, typename TFileSpec>
+inline void
+readRecord(TRecord & record,
+           String<unsigned> & regionIds,
+           TabixRegionReader<TFileFormat, TFileSpec> & reader)
+{
+    if (!_advance(reader))
+        SEQAN_THROW(ParseError("TabixRegionReader: No more records in the regions."));
+
+    // The scanned line is still in the current block, parse it again completely.
+    setPosition(*reader.file, reader._recordOffset);
+    readRecord(record, *reader.file);
+    regionIds = reader._pendingIds;
+    reader._pending = false;
+}
+
+}  // namespace seqan
+
+#endif  // INCLUDE_SEQAN_TABIX_IO_TABIX_REGION_READER_H_
@@ -60,5 +60,6 @@
 #include <seqan/vcf_io/write_vcf.h>
 
 #include <seqan/vcf_io/vcf_file.h>
+#include <seqan/vcf_io/vcf_record_view.h>
 
 #endif  // SEQAN_INCLUDE_SEQAN_VCF_IO_H_
@@ -0,0 +1,517 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2015, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: SeqAn Team <seqan-dev@lists.fu-berlin.de>
+// ==========================================================================
+// Lightweight VCF record that keeps the raw line and the column offsets and
+// decodes the columns, in particular the genotypes, on request.
+// ==========================================================================
+
+#ifndef INCLUDE_SEQAN_VCF_IO_VCF_RECORD_VIEW_H_
+#define INCLUDE_SEQAN_VCF_IO_VCF_RECORD_VIEW_H_
+
+namespace seqan {
+
+// ============================================================================
+// Classes
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Class VcfRecordView
+// ----------------------------------------------------------------------------
+
+/*!
+ * @class VcfRecordView
+ * @headerfile <seqan/vcf_io.h>
+ * @signature class VcfRecordView;
+ * @brief Lazy view on a VCF record.
+ *
+ * The fields <tt>rID</tt>, <tt>beginPos</tt> and <tt>qual</tt> are accessible as members like in
+ * @link VcfRecord @endlink.  All other columns are kept in the raw line and returned without copying by
+ * @link VcfRecordView#getId @endlink, @link VcfRecordView#getInfo @endlink, etc.  The genotypes are only parsed
+ * when requested via @link VcfRecordView#getGenotypes @endlink.
+ *
+ * The line and column buffers are reused by subsequent calls to @link VcfRecordView#readRecord @endlink, so that
+ * reading records into the same view does not allocate memory once the buffers have grown to the longest line.
+ * Use @link VcfRecordView#assign @endlink to obtain a @link VcfRecord @endlink.
+ *
+ * @see VcfRecord
+ * @see VcfFileIn
+ */
+
+/*!
+ * @var __int32 VcfRecordView::MISSING_ALLELE
+ * @brief Allele index for missing calls ("."), also used to pad genotypes below the ploidy.
+ */
+
+class VcfRecordView
+{
+public:
+    // Constant for missing alleles in genotypes.
+    static const __int32 MISSING_ALLELE = -1;
+
+    enum
+    {
+        CHROM_FIELD = 0,
+        POS_FIELD = 1,
+        ID_FIELD = 2,
+        REF_FIELD = 3,
+        ALT_FIELD = 4,
+        QUAL_FIELD = 5,
+        FILTER_FIELD = 6,
+        INFO_FIELD = 7,
+        FORMAT_FIELD = 8,
+        FIRST_SAMPLE_FIELD = 9
+    };
+
+    // Numeric id of the reference sequence.
+    __int32 rID;
+    // Position on the reference.
+    __int32 beginPos;
+    // Quality
+    float qual;
+
+    CharString _line;               // the raw line without line break
+    String<__uint32> _fieldBegins;  // begin of each column in _line, followed by length(_line) + 1
+    unsigned _numSamples;           // number of genotype columns, 0 if there is no FORMAT column
+
+    VcfRecordView() :
+        rID(VcfRecord::INVALID_REFID), beginPos(VcfRecord::INVALID_POS), qual(VcfRecord::MISSING_QUAL()),
+        _numSamples(0)
+    {}
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function clear()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn VcfRecordView#clear
+ * @brief Clear a VcfRecordView.
+ *
+ * @signature void clear(view);
+ *
+ * @param[in,out] view The VcfRecordView to clear.
+ */
+
+inline void
+clear(VcfRecordView & view)
+{
+    view.rID = VcfRecord::INVALID_REFID;
+    view.beginPos = VcfRecord::INVALID_POS;
+    view.qual = VcfRecord::MISSING_QUAL();
+    clear(view._line);
+    clear(view._fieldBegins);
+    view._numSamples = 0;
+}
+
+// ----------------------------------------------------------------------------
+// Function _getField()
+// ----------------------------------------------------------------------------
+
+inline Range<char const *>
+_getField(VcfRecordView const & view, unsigned fieldId)
+{
+    SEQAN_ASSERT_LT(fieldId + 1, length(view._fieldBegins));
+    char const * lineBegin = begin(view._line, Standard());
+    return Range<char const *>(lineBegin + view._fieldBegins[fieldId], lineBegin + view._fieldBegins[fieldId + 1] - 1);
+}
+
+// ----------------------------------------------------------------------------
+// Function getId(), getRef(), getAlt(), getFilter(), getInfo(), getFormat()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn VcfRecordView#getId
+ * @brief Return the ID column of a VcfRecordView without copying it.
+ *
+ * @signature Range<char const *> getId(view);
+ *
+ * @param[in] view The VcfRecordView to query.
+ *
+ * @return Range<char const *> The textual identifier of the variant.
+ */
+
+inline Range<char const *>
+getId(VcfRecordView const & view)
+{
+    return _getField(view, VcfRecordView::ID_FIELD);
+}
+
+/*!
+ * @fn VcfRecordView#getRef
+ * @brief Return the REF column of a VcfRecordView without copying it.
+ *
+ * @signature Range<char const *> getRef(view);
+ *
+ * @param[in] view The VcfRecordView to query.
+ *
+ * @return Range<char const *> The bases in the reference.
+ */
+
+inline Range<char const *>
+getRef(VcfRecordView const & view)
+{
+    return _getField(view, VcfRecordView::REF_FIELD);
+}
+
+/*!
+ * @fn VcfRecordView#getAlt
+ * @brief Return the ALT column of a VcfRecordView without copying it.
+ *
+ * @signature Range<char const *> getAlt(view);
+ *
+ * @param[in] view The VcfRecordView to query.
+ *
+ * @return Range<char const *> The alternative bases, comma-separated if multiple.
+ */
+
+inline Range<char const *>
+getAlt(VcfRecordView const & view)
+{
+    return _getField(view, VcfRecordView::ALT_FIELD);
+}
+
+/*!
+ * @fn VcfRecordView#getFilter
+ * @brief Return the FILTER column of a VcfRecordView without copying it.
+ *
+ * @signature Range<char const *> getFilter(view);
+ *
+ * @param[in] view The VcfRecordView to query.
+ *
+ * @return Range<char const *> The value of the FILTER column.
+ */
+
+inline Range<char const *>
+getFilter(VcfRecordView const & view)
+{
+    return _getField(view, VcfRecordView::FILTER_FIELD);
+}
+
+/*!
+ * @fn VcfRecordView#getInfo
+ * @brief Return the INFO column of a VcfRecordView without copying it.
+ *
+ * @signature Range<char const *> getInfo(view);
+ *
+ * @param[in] view The VcfRecordView to query.
+ *
+ * @return Range<char const *> The value of the INFO column.
+ */
+
+inline Range<char const *>
+getInfo(VcfRecordView const & view)
+{
+    return _getField(view, VcfRecordView::INFO_FIELD);
+}
+
+/*!
+ * @fn VcfRecordView#getFormat
+ * @brief Return the FORMAT column of a VcfRecordView without copying it.
+ *
+ * @signature Range<char const *> getFormat(view);
+ *
+ * @param[in] view The VcfRecordView to query.
+ *
+ * @return Range<char const *> The value of the FORMAT column, empty if there are no genotype columns.
+ */
+
+inline Range<char const *>
+getFormat(VcfRecordView const & view)
+{
+    if (view._numSamples == 0u)
+        return Range<char const *>(end(view._line, Standard()), end(view._line, Standard()));
+    return _getField(view, VcfRecordView::FORMAT_FIELD);
+}
+
+// ----------------------------------------------------------------------------
+// Function numSamples()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn VcfRecordView#numSamples
+ * @brief Return the number of genotype columns of a VcfRecordView.
+ *
+ * @signature unsigned numSamples(view);
+ *
+ * @param[in] view The VcfRecordView to query.
+ *
+ * @return unsigned The number of samples, 0 if the record has no FORMAT column.
+ */
+
+inline unsigned
+numSamples(VcfRecordView const & view)
+{
+    return view._numSamples;
+}
+
+// ----------------------------------------------------------------------------
+// Function getGenotypeInfo()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn VcfRecordView#getGenotypeInfo
+ * @brief Return the genotype column of a sample without copying it.
+ *
+ * @signature Range<char const *> getGenotypeInfo(view, sampleId);
+ *
+ * @param[in] view     The VcfRecordView to query.
+ * @param[in] sampleId The number of the sample, in <tt>[0, numSamples(view))</tt>.
+ *
+ * @return Range<char const *> The genotype information as in the VCF file.
+ */
+
+inline Range<char const *>
+getGenotypeInfo(VcfRecordView const & view, unsigned sampleId)
+{
+    SEQAN_ASSERT_LT(sampleId, view._numSamples);
+    return _getField(view, VcfRecordView::FIRST_SAMPLE_FIELD + sampleId);
+}
+
+// ----------------------------------------------------------------------------
+// Function getGenotypes()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn VcfRecordView#getGenotypes
+ * @brief Decode the GT subfield of all samples into a string of allele indices.
+ *
+ * @signature void getGenotypes(alleles, view[, ploidy]);
+ *
+ * @param[out] alleles The allele indices, <tt>ploidy</tt> consecutive entries per sample, e.g. a
+ *                     <tt>String&lt;__int32&gt;</tt> or a <tt>String&lt;__int8&gt;</tt>.  Missing alleles and
+ *                     entries of samples with less than <tt>ploidy</tt> alleles are set to
+ *                     @link VcfRecordView::MISSING_ALLELE @endlink.
+ * @param[in]  view    The VcfRecordView to decode.
+ * @param[in]  ploidy  The maximal number of alleles per sample, <tt>unsigned</tt>.  Default: 2.
+ *
+ * Only the sample columns are scanned, up to the first ':' each.  Phasing information is not retained.  If the
+ * FORMAT column does not start with GT, all alleles are missing.
+ *
+ * @throw ParseError If a genotype is malformed or has more than <tt>ploidy</tt> alleles.
+ */
+
+template <typename TAlleles>
+inline void
+getGenotypes(TAlleles & alleles, VcfRecordView const & view, unsigned ploidy)
+{
+    typedef typename Value<TAlleles>::Type TAllele;
+
+    resize(alleles, view._numSamples * ploidy, Exact());
+    arrayFill(begin(alleles, Standard()), end(alleles, Standard()), (TAllele)VcfRecordView::MISSING_ALLELE);
+
+    if (view._numSamples == 0u)
+        return;
+
+    // GT must be the first subfield if present.
+    Range<char const *> format = getFormat(view);
+    if (length(format) < 2u || format[0] != 'G' || format[1] != 'T' || (length(format) > 2u && format[2] != ':'))
+        return;
+
+    typename Iterator<TAlleles, Standard>::Type target = begin(alleles, Standard());
+    for (unsigned sampleId = 0; sampleId < view._numSamples; ++sampleId, target += ploidy)
+    {
+        Range<char const *> field = getGenotypeInfo(view, sampleId);
+        char const * it = field.begin;
+        char const * itEnd = field.end;
+
+        for (unsigned k = 0; it != itEnd && *it != ':'; ++k)
+        {
+            if (SEQAN_UNLIKELY(k == ploidy))
+                SEQAN_THROW(ParseError("Genotype has more alleles than the given ploidy."));
+
+            if (*it == '.')
+            {
+                ++it;
+            }
+            else
+            {
+                if (SEQAN_UNLIKELY(!IsDigit()(*it)))
+                    SEQAN_THROW(ParseError("Invalid allele in genotype."));
+                __int32 allele = 0;
+                for (; it != itEnd && IsDigit()(*it); ++it)
+                    allele = allele * 10 + (*it - '0');
+                target[k] = allele;
+            }
+
+            if (it == itEnd || *it == ':')
+                break;
+            if (SEQAN_UNLIKELY(*it != '/' && *it != '|'))
+                SEQAN_THROW(ParseError("Invalid separator in genotype."));
+            ++it;
+        }
+    }
+}
+
+template <typename TAlleles>
+inline void
+getGenotypes(TAlleles & alleles, VcfRecordView const & view)
+{
+    getGenotypes(alleles, view, 2u);
+}
+
+// ----------------------------------------------------------------------------
+// Function assign()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn VcfRecordView#assign
+ * @brief Copy all fields of a VcfRecordView into a VcfRecord.
+ *
+ * @signature void assign(record, view);
+ *
+ * @param[out] record The resulting @link VcfRecord @endlink.
+ * @param[in]  view   The VcfRecordView to copy.
+ */
+
+inline void
+assign(VcfRecord & record, VcfRecordView const & view)
+{
+    record.rID = view.rID;
+    record.beginPos = view.beginPos;
+    record.qual = view.qual;
+
+    assign(record.id, getId(view));
+    assign(record.ref, getRef(view));
+    assign(record.alt, getAlt(view));
+    assign(record.filter, getFilter(view));
+    assign(record.info, getInfo(view));
+    assign(record.format, getFormat(view));
+
+    clear(record.genotypeInfos);
+    for (unsigned i = 0; i < view._numSamples; ++i)
+        appendValue(record.genotypeInfos, getGenotypeInfo(view, i));
+}
+
+// ----------------------------------------------------------------------------
+// Function readRecord()                                          VcfRecordView
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn VcfRecordView#readRecord
+ * @brief Read the next VCF record into a VcfRecordView.
+ *
+ * @signature void readRecord(view, vcfFileIn);
+ *
+ * @param[out]    view      The VcfRecordView to read into.
+ * @param[in,out] vcfFileIn The @link VcfFileIn @endlink to read from.
+ *
+ * Only CHROM, POS and QUAL are parsed, the other columns are merely located.
+ *
+ * @throw IOError On low-level I/O errors.
+ * @throw ParseError On high-level file format errors.
+ */
+
+template <typename TForwardIter, typename TNameStore, typename TNameStoreCache, typename TStorageSpec>
+inline void
+readRecord(VcfRecordView & view,
+           VcfIOContext<TNameStore, TNameStoreCache, TStorageSpec> & context,
+           TForwardIter & iter,
+           Vcf const & /*tag*/)
+{
+    static char const * const FIELD_NAMES[] =
+    {
+        "CHROM", "POS", "ID", "REF", "ALT", "QUAL", "FILTER", "INFO", "FORMAT"
+    };
+
+    clear(view);
+    readLine(view._line, iter);
+
+    // Locate the columns.
+    char const * lineBegin = begin(view._line, Standard());
+    char const * lineEnd = end(view._line, Standard());
+    appendValue(view._fieldBegins, 0u);
+    for (char const * it = lineBegin; it != lineEnd; ++it)
+        if (*it == '\t')
+            appendValue(view._fieldBegins, (__uint32)(it - lineBegin) + 1);
+    appendValue(view._fieldBegins, (__uint32)length(view._line) + 1);
+
+    unsigned numFields = length(view._fieldBegins) - 1;
+    for (unsigned i = 0; i <= VcfRecordView::INFO_FIELD; ++i)
+        if (i >= numFields || view._fieldBegins[i + 1] - 1 == view._fieldBegins[i])
+            SEQAN_THROW(EmptyFieldError(FIELD_NAMES[i]));
+
+    // The FORMAT and sample columns are optional.
+    if (numFields > VcfRecordView::FORMAT_FIELD)
+    {
+        if (view._fieldBegins[VcfRecordView::FORMAT_FIELD + 1] - 1 == view._fieldBegins[VcfRecordView::FORMAT_FIELD])
+            SEQAN_THROW(EmptyFieldError("FORMAT"));
+
+        view._numSamples = length(sampleNames(context));
+        for (unsigned i = 0; i < view._numSamples; ++i)
+        {
+            unsigned fieldId = VcfRecordView::FIRST_SAMPLE_FIELD + i;
+            if (fieldId >= numFields || view._fieldBegins[fieldId + 1] - 1 == view._fieldBegins[fieldId])
+            {
+                char buffer[30];    // == 9 (GENOTYPE_) + 20 (#digits in MIN_INT64) + 1 (trailing zero)
+                sprintf(buffer, "GENOTYPE_%u", i + 1);
+                SEQAN_THROW(EmptyFieldError(buffer));
+            }
+        }
+    }
+
+    // CHROM
+    CharString &buffer = context.buffer;
+    assign(buffer, _getField(view, VcfRecordView::CHROM_FIELD));
+    view.rID = nameToId(contigNamesCache(context), buffer);
+
+    // POS
+    view.beginPos = lexicalCast<__int32>(_getField(view, VcfRecordView::POS_FIELD)) - 1; // Translate from 1-based to 0-based.
+
+    // QUAL
+    Range<char const *> qual = _getField(view, VcfRecordView::QUAL_FIELD);
+    if (length(qual) == 1u && qual[0] == '.')
+    {
+        view.qual = VcfRecord::MISSING_QUAL();
+    }
+    else
+    {
+        assign(buffer, qual);
+        lexicalCastWithException(view.qual, buffer);
+    }
+}
+
+// convient VcfFile variant
+template <typename TSpec>
+inline void
+readRecord(VcfRecordView & view, FormattedFile<Vcf, Input, TSpec> & file)
+{
+    readRecord(view, context(file), file.iter, file.format);
+}
+
+}  // namespace seqan
+
+#endif  // INCLUDE_SEQAN_VCF_IO_VCF_RECORD_VIEW_H_
@@ -485,6 +485,9 @@ SEQAN_BEGIN_TESTSUITE(test_align)
     // Global Alignment with Differnt Container Types
     SEQAN_CALL_TEST(test_alignment_algorithms_global_different_container);
 
+    // Global Alignment with a reused DPContext.
+    SEQAN_CALL_TEST(test_alignment_algorithms_global_dp_context);
+
     // Local Alignment.
     SEQAN_CALL_TEST(test_alignment_algorithms_align_local_linear);
     SEQAN_CALL_TEST(test_alignment_algorithms_gaps_local_linear);
@@ -496,6 +499,8 @@ SEQAN_BEGIN_TESTSUITE(test_align)
     SEQAN_CALL_TEST(test_alignment_algorithms_graph_local_affine);
     SEQAN_CALL_TEST(test_alignment_algorithms_fragments_local_affine);
 
+    SEQAN_CALL_TEST(test_alignment_algorithms_local_dp_context);
+
     // Dynamic Gaps.
     SEQAN_CALL_TEST(test_alignment_algorithms_global_dynamic_cost);
     SEQAN_CALL_TEST(test_alignment_algorithms_local_dynamic_cost);
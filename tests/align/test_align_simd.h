@@ -0,0 +1,567 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2015, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: SeqAn Team <seqan-dev@lists.fu-berlin.de>
+// ==========================================================================
+// Tests for the batch alignment interfaces.  The results of the batch are
+// compared against the results of the pairwise interfaces.
+// ==========================================================================
+
+#ifndef TESTS_ALIGN_TEST_ALIGN_SIMD_H_
+#define TESTS_ALIGN_TEST_ALIGN_SIMD_H_
+
+#include <sstream>
+
+#include <seqan/basic.h>
+#include <seqan/align.h>
+#include <seqan/random.h>
+
+// ==========================================================================
+// Helper Functions
+// ==========================================================================
+
+// Generates numSeqs random pairs of sequences with lengths in [minLength, maxLength].
+template <typename TString>
+void testAlignSimdGenerateSequences(seqan::StringSet<TString> & setH,
+                                    seqan::StringSet<TString> & setV,
+                                    unsigned numSeqs,
+                                    unsigned minLength,
+                                    unsigned maxLength)
+{
+    using namespace seqan;
+
+    typedef typename Value<TString>::Type TAlphabet;
+
+    Rng<MersenneTwister> rng(42);
+    for (unsigned i = 0; i < numSeqs; ++i)
+    {
+        TString seqH;
+        TString seqV;
+        unsigned lenH = minLength + pickRandomNumber(rng) % (maxLength - minLength + 1);
+        unsigned lenV = minLength + pickRandomNumber(rng) % (maxLength - minLength + 1);
+        for (unsigned j = 0; j < lenH; ++j)
+            appendValue(seqH, TAlphabet(pickRandomNumber(rng) % ValueSize<TAlphabet>::VALUE));
+        // Derive the vertical sequence partially from the horizontal one to get alignments with gaps.
+        for (unsigned j = 0; j < lenV; ++j)
+        {
+            if (j < lenH && pickRandomNumber(rng) % 4 != 0)
+                appendValue(seqV, seqH[j]);
+            else
+                appendValue(seqV, TAlphabet(pickRandomNumber(rng) % ValueSize<TAlphabet>::VALUE));
+        }
+        appendValue(setH, seqH);
+        appendValue(setV, seqV);
+    }
+}
+
+template <typename TString>
+void testAlignSimdFillAligns(seqan::StringSet<seqan::Align<TString> > & alignSet,
+                             seqan::StringSet<TString> const & setH,
+                             seqan::StringSet<TString> const & setV)
+{
+    using namespace seqan;
+
+    resize(alignSet, length(setH));
+    for (unsigned i = 0; i < length(setH); ++i)
+    {
+        resize(rows(alignSet[i]), 2);
+        assignSource(row(alignSet[i], 0), setH[i]);
+        assignSource(row(alignSet[i], 1), setV[i]);
+    }
+}
+
+template <typename TAlign>
+void testAlignSimdCompareAlign(TAlign const & batchAlign, TAlign const & scalarAlign)
+{
+    std::stringstream ssBatch, ssScalar;
+    ssBatch << batchAlign;
+    ssScalar << scalarAlign;
+    SEQAN_ASSERT_EQ(ssBatch.str(), ssScalar.str());
+}
+
+// The batch results computed with algoTag are compared with the pairwise results computed with pairwiseTag.
+template <typename TString, typename TScore, typename TAlignConfig, typename TAlgoTag, typename TPairwiseTag>
+void testAlignSimdGlobalScore(TScore const & scoringScheme, TAlignConfig const & alignConfig,
+                              TAlgoTag const & algoTag, TPairwiseTag const & pairwiseTag,
+                              unsigned numSeqs, unsigned minLength, unsigned maxLength)
+{
+    using namespace seqan;
+
+    StringSet<TString> setH;
+    StringSet<TString> setV;
+    testAlignSimdGenerateSequences(setH, setV, numSeqs, minLength, maxLength);
+
+    String<typename Value<TScore>::Type> scores = globalAlignmentScore(setH, setV, scoringScheme, alignConfig,
+                                                                       algoTag);
+    SEQAN_ASSERT_EQ(length(scores), numSeqs);
+    for (unsigned i = 0; i < numSeqs; ++i)
+        SEQAN_ASSERT_EQ(scores[i], globalAlignmentScore(setH[i], setV[i], scoringScheme, alignConfig, pairwiseTag));
+}
+
+template <typename TString, typename TScore, typename TAlignConfig, typename TAlgoTag>
+void testAlignSimdGlobalScore(TScore const & scoringScheme, TAlignConfig const & alignConfig,
+                              TAlgoTag const & algoTag, unsigned numSeqs, unsigned minLength, unsigned maxLength)
+{
+    testAlignSimdGlobalScore<TString>(scoringScheme, alignConfig, algoTag, algoTag, numSeqs, minLength, maxLength);
+}
+
+template <typename TString, typename TScore, typename TAlignConfig, typename TAlgoTag, typename TPairwiseTag>
+void testAlignSimdGlobalAlign(TScore const & scoringScheme, TAlignConfig const & alignConfig,
+                              TAlgoTag const & algoTag, TPairwiseTag const & pairwiseTag,
+                              unsigned numSeqs, unsigned minLength, unsigned maxLength)
+{
+    using namespace seqan;
+
+    StringSet<TString> setH;
+    StringSet<TString> setV;
+    testAlignSimdGenerateSequences(setH, setV, numSeqs, minLength, maxLength);
+
+    StringSet<Align<TString> > alignSet;
+    testAlignSimdFillAligns(alignSet, setH, setV);
+
+    String<typename Value<TScore>::Type> scores = globalAlignment(alignSet, scoringScheme, alignConfig, algoTag);
+    SEQAN_ASSERT_EQ(length(scores), numSeqs);
+    for (unsigned i = 0; i < numSeqs; ++i)
+    {
+        Align<TString> align;
+        resize(rows(align), 2);
+        assignSource(row(align, 0), setH[i]);
+        assignSource(row(align, 1), setV[i]);
+        SEQAN_ASSERT_EQ(scores[i], globalAlignment(align, scoringScheme, alignConfig, pairwiseTag));
+        testAlignSimdCompareAlign(alignSet[i], align);
+    }
+}
+
+template <typename TString, typename TScore, typename TAlignConfig, typename TAlgoTag>
+void testAlignSimdGlobalAlign(TScore const & scoringScheme, TAlignConfig const & alignConfig,
+                              TAlgoTag const & algoTag, unsigned numSeqs, unsigned minLength, unsigned maxLength)
+{
+    testAlignSimdGlobalAlign<TString>(scoringScheme, alignConfig, algoTag, algoTag, numSeqs, minLength, maxLength);
+}
+
+#ifdef SEQAN_SIMD_ENABLED
+
+// Computes an unbanded alignment like _computeAlignment() with either the anti-diagonal kernel or the column-wise
+// _computeUnbandedAlignment().
+template <typename TTraceSegments, typename TSequence, typename TScore, typename TAlgorithm, typename TGapModel,
+          typename TTraceFlag>
+typename seqan::Value<TScore>::Type
+testAlignSimdRunKernel(TTraceSegments & traceSegments,
+                       TSequence const & seqH,
+                       TSequence const & seqV,
+                       TScore const & scoringScheme,
+                       seqan::DPProfile_<TAlgorithm, TGapModel, TTraceFlag> const & dpProfile,
+                       bool antiDiagonal)
+{
+    using namespace seqan;
+
+    typedef typename Value<TScore>::Type TScoreValue;
+    typedef DPContext<TScoreValue, TGapModel> TDPContext;
+    typedef typename Value<typename GetDPScoreMatrix<TDPContext>::Type>::Type TDPCell;
+    typedef typename Value<typename GetDPTraceMatrix<TDPContext>::Type>::Type TTraceValue;
+    typedef DPMatrix_<TDPCell, typename DefaultScoreMatrixSpec_<TAlgorithm>::Type> TDPScoreMatrix;
+    typedef DPMatrix_<TTraceValue, FullDPMatrix> TDPTraceMatrix;
+    typedef DPMatrixNavigator_<TDPScoreMatrix, DPScoreMatrix, NavigateColumnWise> TDPScoreMatrixNavigator;
+    typedef DPMatrixNavigator_<TDPTraceMatrix, DPTraceMatrix<TTraceFlag>, NavigateColumnWise> TDPTraceMatrixNavigator;
+
+    TDPContext dpContext;
+    TDPScoreMatrix dpScoreMatrix;
+    TDPTraceMatrix dpTraceMatrix;
+    setLength(dpScoreMatrix, +DPMatrixDimension_::HORIZONTAL, length(seqH) + 1);
+    setLength(dpTraceMatrix, +DPMatrixDimension_::HORIZONTAL, length(seqH) + 1);
+    setLength(dpScoreMatrix, +DPMatrixDimension_::VERTICAL, length(seqV) + 1);
+    setLength(dpTraceMatrix, +DPMatrixDimension_::VERTICAL, length(seqV) + 1);
+    setHost(dpScoreMatrix, getDpScoreMatrix(dpContext));
+    setHost(dpTraceMatrix, getDpTraceMatrix(dpContext));
+    resize(dpScoreMatrix);
+    resize(dpTraceMatrix);
+
+    TDPScoreMatrixNavigator dpScoreMatrixNavigator;
+    TDPTraceMatrixNavigator dpTraceMatrixNavigator;
+    _init(dpScoreMatrixNavigator, dpScoreMatrix, DPBandConfig<BandOff>());
+    _init(dpTraceMatrixNavigator, dpTraceMatrix, DPBandConfig<BandOff>());
+
+    DPScout_<TDPCell, Default> dpScout;
+    if (antiDiagonal)
+        _computeAntiDiagonalAlignment(dpScout, dpTraceMatrix, seqH, seqV, scoringScheme, dpProfile);
+    else
+        _computeUnbandedAlignment(dpScout, dpScoreMatrixNavigator, dpTraceMatrixNavigator, seqH, seqV, scoringScheme,
+                                  dpProfile);
+
+    _correctTraceValue(dpTraceMatrixNavigator, dpScout);
+    _computeTraceback(traceSegments, dpTraceMatrixNavigator, dpScout, seqH, seqV, DPBandConfig<BandOff>(),
+                      dpProfile);
+    return maxScore(dpScout);
+}
+
+// Compares the score, the best cell and the trace of the anti-diagonal kernel with the column-wise algorithm.
+template <typename TSequence, typename TScore, typename TDPProfile>
+void testAlignSimdCrossCheckKernel(TScore const & scoringScheme, TDPProfile const & dpProfile,
+                                   unsigned numSeqs, unsigned minLength, unsigned maxLength)
+{
+    using namespace seqan;
+
+    typedef String<TraceSegment_<unsigned, unsigned> > TTraceSegments;
+
+    StringSet<TSequence> setH;
+    StringSet<TSequence> setV;
+    testAlignSimdGenerateSequences(setH, setV, numSeqs, minLength, maxLength);
+
+    for (unsigned i = 0; i < numSeqs; ++i)
+    {
+        TTraceSegments antiDiagonalTrace;
+        TTraceSegments columnWiseTrace;
+        SEQAN_ASSERT_EQ(testAlignSimdRunKernel(antiDiagonalTrace, setH[i], setV[i], scoringScheme, dpProfile, true),
+                        testAlignSimdRunKernel(columnWiseTrace, setH[i], setV[i], scoringScheme, dpProfile, false));
+        SEQAN_ASSERT_EQ(length(antiDiagonalTrace), length(columnWiseTrace));
+        for (unsigned k = 0; k < length(antiDiagonalTrace); ++k)
+            SEQAN_ASSERT(antiDiagonalTrace[k] == columnWiseTrace[k]);
+    }
+}
+
+#endif  // #ifdef SEQAN_SIMD_ENABLED
+
+// ==========================================================================
+// Tests
+// ==========================================================================
+
+SEQAN_DEFINE_TEST(test_align_simd_global_score_linear)
+{
+    using namespace seqan;
+
+    testAlignSimdGlobalScore<DnaString>(Score<short, Simple>(2, -1, -1), AlignConfig<>(), NeedlemanWunsch(),
+                                        37, 1, 60);
+    testAlignSimdGlobalScore<DnaString>(Score<int, Simple>(2, -1, -1), AlignConfig<>(), NeedlemanWunsch(),
+                                        21, 1, 60);
+    // Sequences of equal length.
+    testAlignSimdGlobalScore<Dna5String>(Score<short, Simple>(1, -2, -3), AlignConfig<>(), NeedlemanWunsch(),
+                                         16, 30, 30);
+}
+
+SEQAN_DEFINE_TEST(test_align_simd_global_score_affine)
+{
+    using namespace seqan;
+
+    testAlignSimdGlobalScore<DnaString>(Score<short, Simple>(2, -1, -1, -5), AlignConfig<>(), Gotoh(), 37, 1, 60);
+    testAlignSimdGlobalScore<DnaString>(Score<int, Simple>(2, -1, -1, -5), AlignConfig<>(), Gotoh(), 21, 1, 60);
+    testAlignSimdGlobalScore<DnaString>(Score<int, Simple>(4, -3, -2, -7), AlignConfig<>(), Gotoh(), 40, 100, 200);
+}
+
+SEQAN_DEFINE_TEST(test_align_simd_global_score_free_end_gaps)
+{
+    using namespace seqan;
+
+    Score<short, Simple> linear(2, -1, -1);
+    Score<short, Simple> affine(2, -1, -1, -4);
+
+    testAlignSimdGlobalScore<DnaString>(linear, AlignConfig<true, true, true, true>(), NeedlemanWunsch(), 33, 1, 50);
+    testAlignSimdGlobalScore<DnaString>(linear, AlignConfig<true, false, true, false>(), NeedlemanWunsch(), 33, 1, 50);
+    testAlignSimdGlobalScore<DnaString>(linear, AlignConfig<false, true, false, true>(), NeedlemanWunsch(), 33, 1, 50);
+    testAlignSimdGlobalScore<DnaString>(affine, AlignConfig<true, true, true, true>(), Gotoh(), 33, 1, 50);
+    testAlignSimdGlobalScore<DnaString>(affine, AlignConfig<false, true, true, false>(), Gotoh(), 33, 1, 50);
+    testAlignSimdGlobalScore<DnaString>(affine, AlignConfig<true, false, false, true>(), Gotoh(), 33, 1, 50);
+}
+
+SEQAN_DEFINE_TEST(test_align_simd_global_score_matrix)
+{
+    using namespace seqan;
+
+    testAlignSimdGlobalScore<Peptide>(Score<int, ScoreMatrix<AminoAcid, Blosum62_> >(-2, -10), AlignConfig<>(),
+                                      Gotoh(), 19, 1, 40);
+    testAlignSimdGlobalScore<Peptide>(Score<int, ScoreMatrix<AminoAcid, Blosum62_> >(-3), AlignConfig<>(),
+                                      NeedlemanWunsch(), 19, 1, 40);
+}
+
+SEQAN_DEFINE_TEST(test_align_simd_global_align_linear)
+{
+    using namespace seqan;
+
+    testAlignSimdGlobalAlign<DnaString>(Score<short, Simple>(2, -1, -1), AlignConfig<>(), NeedlemanWunsch(),
+                                        37, 1, 60);
+    testAlignSimdGlobalAlign<DnaString>(Score<int, Simple>(2, -1, -1), AlignConfig<>(), NeedlemanWunsch(),
+                                        21, 1, 60);
+
+    // Interface without algorithm tag and alignment configuration.
+    StringSet<DnaString> setH;
+    StringSet<DnaString> setV;
+    appendValue(setH, "ATGT");
+    appendValue(setV, "ATAGAT");
+    appendValue(setH, "AAAAAAAA");
+    appendValue(setV, "AAAA");
+
+    StringSet<Align<DnaString> > alignSet;
+    testAlignSimdFillAligns(alignSet, setH, setV);
+    String<int> scores = globalAlignment(alignSet, Score<int, Simple>(2, -1, -1));
+
+    SEQAN_ASSERT_EQ(scores[0], 6);
+    SEQAN_ASSERT_EQ(scores[1], 4);
+
+    std::stringstream ssH, ssV;
+    ssH << row(alignSet[0], 0);
+    ssV << row(alignSet[0], 1);
+    SEQAN_ASSERT_EQ(ssH.str(), "AT-G-T");
+    SEQAN_ASSERT_EQ(ssV.str(), "ATAGAT");
+}
+
+SEQAN_DEFINE_TEST(test_align_simd_global_align_affine)
+{
+    using namespace seqan;
+
+    testAlignSimdGlobalAlign<DnaString>(Score<short, Simple>(2, -1, -1, -5), AlignConfig<>(), Gotoh(), 37, 1, 60);
+    testAlignSimdGlobalAlign<Dna5String>(Score<int, Simple>(5, -4, -1, -11), AlignConfig<>(), Gotoh(), 21, 1, 60);
+    testAlignSimdGlobalAlign<Peptide>(Score<int, ScoreMatrix<AminoAcid, Blosum62_> >(-2, -10), AlignConfig<>(),
+                                      Gotoh(), 19, 1, 40);
+}
+
+SEQAN_DEFINE_TEST(test_align_simd_global_align_free_end_gaps)
+{
+    using namespace seqan;
+
+    Score<short, Simple> linear(2, -1, -1);
+    Score<short, Simple> affine(2, -1, -1, -4);
+
+    testAlignSimdGlobalAlign<DnaString>(linear, AlignConfig<true, true, true, true>(), NeedlemanWunsch(), 33, 1, 50);
+    testAlignSimdGlobalAlign<DnaString>(linear, AlignConfig<false, true, false, true>(), NeedlemanWunsch(), 33, 1, 50);
+    testAlignSimdGlobalAlign<DnaString>(affine, AlignConfig<true, true, true, true>(), Gotoh(), 33, 1, 50);
+    testAlignSimdGlobalAlign<DnaString>(affine, AlignConfig<true, false, true, false>(), Gotoh(), 33, 1, 50);
+}
+
+SEQAN_DEFINE_TEST(test_align_simd_local_score)
+{
+    using namespace seqan;
+
+    StringSet<DnaString> setH;
+    StringSet<DnaString> setV;
+    testAlignSimdGenerateSequences(setH, setV, 37, 1, 60);
+
+    Score<short, Simple> linear(2, -1, -1);
+    Score<short, Simple> affine(2, -1, -1, -4);
+
+    String<short> scoresLinear = localAlignmentScore(setH, setV, linear);
+    String<short> scoresAffine = localAlignmentScore(setH, setV, affine);
+    SEQAN_ASSERT_EQ(length(scoresLinear), 37u);
+    SEQAN_ASSERT_EQ(length(scoresAffine), 37u);
+    for (unsigned i = 0; i < length(setH); ++i)
+    {
+        SEQAN_ASSERT_EQ(scoresLinear[i], localAlignmentScore(setH[i], setV[i], linear));
+        SEQAN_ASSERT_EQ(scoresAffine[i], localAlignmentScore(setH[i], setV[i], affine));
+
+        Align<DnaString> align;
+        resize(rows(align), 2);
+        assignSource(row(align, 0), setH[i]);
+        assignSource(row(align, 1), setV[i]);
+        SEQAN_ASSERT_EQ(scoresAffine[i], localAlignment(align, affine));
+    }
+}
+
+SEQAN_DEFINE_TEST(test_align_simd_local_align)
+{
+    using namespace seqan;
+
+    StringSet<Dna5String> setH;
+    StringSet<Dna5String> setV;
+    testAlignSimdGenerateSequences(setH, setV, 37, 1, 60);
+
+    Score<short, Simple> linear(2, -1, -1);
+    Score<int, Simple> affine(2, -1, -1, -4);
+
+    StringSet<Align<Dna5String> > alignSetLinear;
+    StringSet<Align<Dna5String> > alignSetAffine;
+    testAlignSimdFillAligns(alignSetLinear, setH, setV);
+    testAlignSimdFillAligns(alignSetAffine, setH, setV);
+
+    String<short> scoresLinear = localAlignment(alignSetLinear, linear);
+    String<int> scoresAffine = localAlignment(alignSetAffine, affine);
+    for (unsigned i = 0; i < length(setH); ++i)
+    {
+        Align<Dna5String> align;
+        resize(rows(align), 2);
+        assignSource(row(align, 0), setH[i]);
+        assignSource(row(align, 1), setV[i]);
+        SEQAN_ASSERT_EQ(scoresLinear[i], localAlignment(align, linear));
+        testAlignSimdCompareAlign(alignSetLinear[i], align);
+
+        SEQAN_ASSERT_EQ(scoresAffine[i], localAlignment(align, affine));
+        testAlignSimdCompareAlign(alignSetAffine[i], align);
+    }
+}
+
+// Gap models that are not supported by the vectorized kernel fall back to the scalar implementation.
+SEQAN_DEFINE_TEST(test_align_simd_dynamic_gaps)
+{
+    using namespace seqan;
+
+    StringSet<DnaString> setH;
+    StringSet<DnaString> setV;
+    testAlignSimdGenerateSequences(setH, setV, 11, 1, 30);
+
+    Score<int, Simple> scoringScheme(2, -1, -1, -3);
+    String<int> scores = localAlignmentScore(setH, setV, scoringScheme, DynamicGaps());
+    for (unsigned i = 0; i < length(setH); ++i)
+        SEQAN_ASSERT_EQ(scores[i], localAlignmentScore(setH[i], setV[i], scoringScheme, DynamicGaps()));
+}
+
+// Scoring matrices of small alphabets are vectorized with a substitution profile.
+SEQAN_DEFINE_TEST(test_align_simd_score_matrix_profile)
+{
+    using namespace seqan;
+
+    StringSet<Dna5String> setH;
+    StringSet<Dna5String> setV;
+    testAlignSimdGenerateSequences(setH, setV, 21, 1, 60);
+
+    Score<short, ScoreMatrix<Dna5> > scoringScheme(-2, -6);
+    for (unsigned c = 0; c < ValueSize<Dna5>::VALUE; ++c)
+        for (unsigned d = 0; d < ValueSize<Dna5>::VALUE; ++d)
+            setScore(scoringScheme, Dna5(c), Dna5(d), (c == d) ? 3 + c : -1 - ((c + d) % 3));
+
+    StringSet<Align<Dna5String> > alignSet;
+    testAlignSimdFillAligns(alignSet, setH, setV);
+    String<short> scores = localAlignment(alignSet, scoringScheme);
+    for (unsigned i = 0; i < length(setH); ++i)
+    {
+        Align<Dna5String> align;
+        resize(rows(align), 2);
+        assignSource(row(align, 0), setH[i]);
+        assignSource(row(align, 1), setV[i]);
+        SEQAN_ASSERT_EQ(scores[i], localAlignment(align, scoringScheme));
+        testAlignSimdCompareAlign(alignSet[i], align);
+    }
+
+    testAlignSimdGlobalAlign<Dna5String>(scoringScheme, AlignConfig<>(), Gotoh(), 21, 1, 60);
+}
+
+// Scores that might leave the range of the lanes fall back to the scalar implementation.
+SEQAN_DEFINE_TEST(test_align_simd_score_range)
+{
+    using namespace seqan;
+
+    StringSet<DnaString> setH;
+    StringSet<DnaString> setV;
+    testAlignSimdGenerateSequences(setH, setV, 11, 90, 100);
+
+    Score<short, Simple> scoringScheme(300, -300, -300);
+    String<short> scores = localAlignmentScore(setH, setV, scoringScheme);
+    for (unsigned i = 0; i < length(setH); ++i)
+        SEQAN_ASSERT_EQ(scores[i], localAlignmentScore(setH[i], setV[i], scoringScheme));
+}
+
+// The pairwise interfaces compute the alignments with the anti-diagonal kernel if AntiDiagonalSimd is passed.  They
+// are compared against the inter-sequence kernel of the batch interfaces.
+SEQAN_DEFINE_TEST(test_align_simd_intra_global)
+{
+    using namespace seqan;
+
+    testAlignSimdGlobalScore<DnaString>(Score<short, Simple>(2, -1, -1), AlignConfig<>(), NeedlemanWunsch(),
+                                        AntiDiagonalSimd(), 7, 1, 400);
+    testAlignSimdGlobalScore<DnaString>(Score<int, Simple>(2, -1, -1, -5), AlignConfig<true, true, true, true>(),
+                                        Gotoh(), AntiDiagonalSimd(), 7, 1, 400);
+    testAlignSimdGlobalAlign<DnaString>(Score<int, Simple>(2, -1, -1), AlignConfig<>(), NeedlemanWunsch(),
+                                        AntiDiagonalSimd(), 7, 1, 400);
+    testAlignSimdGlobalAlign<Dna5String>(Score<short, Simple>(5, -4, -1, -11), AlignConfig<>(), Gotoh(),
+                                         AntiDiagonalSimd(), 7, 1, 400);
+    testAlignSimdGlobalAlign<DnaString>(Score<int, Simple>(2, -1, -1), AlignConfig<true, false, false, true>(),
+                                        NeedlemanWunsch(), AntiDiagonalSimd(), 7, 1, 400);
+    testAlignSimdGlobalAlign<DnaString>(Score<int, Simple>(2, -1, -1, -4), AlignConfig<false, true, true, false>(),
+                                        Gotoh(), AntiDiagonalSimd(), 7, 1, 400);
+    testAlignSimdGlobalAlign<Peptide>(Score<int, ScoreMatrix<AminoAcid, Blosum62_> >(-1, -11), AlignConfig<>(),
+                                      Gotoh(), AntiDiagonalSimd(), 7, 1, 300);
+}
+
+SEQAN_DEFINE_TEST(test_align_simd_intra_local)
+{
+    using namespace seqan;
+
+    StringSet<DnaString> setH;
+    StringSet<DnaString> setV;
+    testAlignSimdGenerateSequences(setH, setV, 7, 1, 400);
+
+    Score<short, Simple> linear(2, -1, -2);
+    Score<int, Simple> affine(2, -1, -1, -4);
+
+    StringSet<Align<DnaString> > alignSetLinear;
+    StringSet<Align<DnaString> > alignSetAffine;
+    testAlignSimdFillAligns(alignSetLinear, setH, setV);
+    testAlignSimdFillAligns(alignSetAffine, setH, setV);
+
+    String<short> scoresLinear = localAlignment(alignSetLinear, linear);
+    String<int> scoresAffine = localAlignment(alignSetAffine, affine);
+    for (unsigned i = 0; i < length(setH); ++i)
+    {
+        Align<DnaString> align;
+        resize(rows(align), 2);
+        assignSource(row(align, 0), setH[i]);
+        assignSource(row(align, 1), setV[i]);
+        SEQAN_ASSERT_EQ(scoresLinear[i], localAlignment(align, linear, AntiDiagonalSimd()));
+        testAlignSimdCompareAlign(alignSetLinear[i], align);
+
+        SEQAN_ASSERT_EQ(scoresAffine[i], localAlignment(align, affine, AntiDiagonalSimd()));
+        testAlignSimdCompareAlign(alignSetAffine[i], align);
+        SEQAN_ASSERT_EQ(scoresAffine[i], localAlignmentScore(setH[i], setV[i], affine, AntiDiagonalSimd()));
+    }
+}
+
+// The anti-diagonal kernel is compared cell by cell with the column-wise scalar algorithm, including the traceback.
+SEQAN_DEFINE_TEST(test_align_simd_intra_cross_check)
+{
+#ifdef SEQAN_SIMD_ENABLED
+    using namespace seqan;
+
+    typedef TracebackOn<TracebackConfig_<SingleTrace, GapsLeft> > TTrace;
+    typedef TracebackOn<TracebackConfig_<SingleTrace, GapsRight> > TTraceRight;
+
+    Score<short, Simple> linear(2, -1, -2);
+    Score<int, Simple> affine(2, -1, -1, -4);
+    // Long stretches of equal scores exercise the tie breaking of the scout.
+    Score<short, Simple> ties(1, 0, -1, -1);
+    Score<int, ScoreMatrix<AminoAcid, Blosum62_> > blosum(-1, -11);
+
+    testAlignSimdCrossCheckKernel<DnaString>(linear, DPProfile_<LocalAlignment_<>, LinearGaps, TTrace>(), 5, 128, 400);
+    testAlignSimdCrossCheckKernel<DnaString>(affine, DPProfile_<LocalAlignment_<>, AffineGaps, TTrace>(), 5, 128, 400);
+    testAlignSimdCrossCheckKernel<DnaString>(ties, DPProfile_<LocalAlignment_<>, AffineGaps, TTraceRight>(),
+                                             5, 128, 200);
+    testAlignSimdCrossCheckKernel<Peptide>(blosum, DPProfile_<LocalAlignment_<>, AffineGaps, TTrace>(), 3, 128, 300);
+
+    testAlignSimdCrossCheckKernel<DnaString>(linear, DPProfile_<GlobalAlignment_<>, LinearGaps, TTrace>(),
+                                             5, 128, 400);
+    testAlignSimdCrossCheckKernel<Dna5String>(affine, DPProfile_<GlobalAlignment_<>, AffineGaps, TTraceRight>(),
+                                              5, 128, 400);
+    testAlignSimdCrossCheckKernel<DnaString>(ties,
+                                             DPProfile_<GlobalAlignment_<FreeEndGaps_<True, False, True, False> >,
+                                                        AffineGaps, TTrace>(), 5, 128, 200);
+    testAlignSimdCrossCheckKernel<DnaString>(affine,
+                                             DPProfile_<GlobalAlignment_<FreeEndGaps_<False, True, False, True> >,
+                                                        AffineGaps, TTrace>(), 5, 128, 400);
+    testAlignSimdCrossCheckKernel<Peptide>(blosum, DPProfile_<GlobalAlignment_<>, AffineGaps, TTrace>(), 3, 128, 300);
+#endif  // #ifdef SEQAN_SIMD_ENABLED
+}
+
+#endif  // #ifndef TESTS_ALIGN_TEST_ALIGN_SIMD_H_
@@ -2727,4 +2727,86 @@ SEQAN_DEFINE_TEST(test_alignment_algorithms_global_different_container)
     }
 }
 
+SEQAN_DEFINE_TEST(test_alignment_algorithms_global_dp_context)
+{
+    using namespace seqan;
+
+    Dna5String strH = "AAGTACGTTACGATCGATCGGATCGATCTAGTACGTAC";
+    Dna5String strV = "AAGTTACGTTACGATCGATCGGTCGATTAGTACCGTAC";
+
+    // Gotoh with a reused context.
+    {
+        Score<int, Simple> scoringScheme(2, -1, -1, -3);
+        DPContext<int, AffineGaps> dpContext;
+        void const * traceBegin = NULL;
+
+        for (unsigned len = length(strH); len > 20; len -= 4)
+        {
+            Dna5String seqH = prefix(strH, len);
+            Dna5String seqV = prefix(strV, len - 2);
+
+            Align<Dna5String> refAlign;
+            resize(rows(refAlign), 2);
+            assignSource(row(refAlign, 0), seqH);
+            assignSource(row(refAlign, 1), seqV);
+
+            Align<Dna5String> align;
+            resize(rows(align), 2);
+            assignSource(row(align, 0), seqH);
+            assignSource(row(align, 1), seqV);
+
+            int refScore = globalAlignment(refAlign, scoringScheme, AlignConfig<>(), Gotoh());
+            int score = globalAlignment(align, scoringScheme, dpContext);
+            SEQAN_ASSERT_EQ(score, refScore);
+
+            std::stringstream ssRef, ss;
+            ssRef << refAlign;
+            ss << align;
+            SEQAN_ASSERT_EQ(ss.str(), ssRef.str());
+
+            SEQAN_ASSERT_EQ(globalAlignmentScore(seqH, seqV, scoringScheme, dpContext), refScore);
+
+            // Shorter alignments reuse the trace matrix of the first one.
+            if (traceBegin == NULL)
+                traceBegin = begin(getDpTraceMatrix(dpContext), Standard());
+            SEQAN_ASSERT(begin(getDpTraceMatrix(dpContext), Standard()) == traceBegin);
+        }
+
+        clear(dpContext);
+        SEQAN_ASSERT_EQ(capacity(getDpTraceMatrix(dpContext)), 0u);
+    }
+
+    // Needleman-Wunsch with free end gaps and a reused context.
+    {
+        Score<int, Simple> scoringScheme(2, -1, -1);
+        AlignConfig<true, false, false, true> alignConfig;
+        DPContext<int, LinearGaps> dpContext;
+
+        for (unsigned len = 24; len <= length(strH); len += 7)
+        {
+            Dna5String seqH = prefix(strH, len);
+            Dna5String seqV = suffix(strV, 6);
+
+            Gaps<Dna5String> refGapsH(seqH);
+            Gaps<Dna5String> refGapsV(seqV);
+            Gaps<Dna5String> gapsH(seqH);
+            Gaps<Dna5String> gapsV(seqV);
+
+            int refScore = globalAlignment(refGapsH, refGapsV, scoringScheme, alignConfig, NeedlemanWunsch());
+            int score = globalAlignment(gapsH, gapsV, scoringScheme, alignConfig, dpContext);
+            SEQAN_ASSERT_EQ(score, refScore);
+
+            std::stringstream ssRefH, ssRefV, ssH, ssV;
+            ssRefH << refGapsH;
+            ssRefV << refGapsV;
+            ssH << gapsH;
+            ssV << gapsV;
+            SEQAN_ASSERT_EQ(ssH.str(), ssRefH.str());
+            SEQAN_ASSERT_EQ(ssV.str(), ssRefV.str());
+
+            SEQAN_ASSERT_EQ(globalAlignmentScore(seqH, seqV, scoringScheme, alignConfig, dpContext), refScore);
+        }
+    }
+}
+
 #endif  // #ifndef SANDBOX_RMAERKER_TESTS_ALIGN2_TEST_ALIGNMENT_ALGORITHMS_GLOBAL_H_
@@ -371,6 +371,82 @@ SEQAN_DEFINE_TEST(test_alignment_algorithms_fragments_local_affine)
 // Local Alignment Enumeration
 // ==========================================================================
 
+SEQAN_DEFINE_TEST(test_alignment_algorithms_local_dp_context)
+{
+    using namespace seqan;
+
+    DnaString strH("CACACTTAACTTCACAA");
+    Dna5String strV("GGGGCTTGAGAGCTTGGGG");
+    SimpleScore scoringScheme(2, -1, -1, -3);
+
+    // The same context is used for several alignments in a row.
+    DPContext<int, AffineGaps> dpContext;
+    for (unsigned i = 0; i < 3; ++i)
+    {
+        Gaps<DnaString> gapsH(strH);
+        Gaps<Dna5String> gapsV(strV);
+
+        int score = localAlignment(gapsH, gapsV, scoringScheme, dpContext);
+
+        SEQAN_ASSERT_EQ(score, 8);
+
+        std::stringstream ssH, ssV;
+        ssH << gapsH;
+        ssV << gapsV;
+
+        SEQAN_ASSERT_EQ(ssH.str(), "CTT---AACTT");
+        SEQAN_ASSERT_EQ(ssV.str(), "CTTGAGAGCTT");
+
+        SEQAN_ASSERT_EQ(localAlignmentScore(strH, strV, scoringScheme, dpContext), 8);
+    }
+
+    // A longer alignment grows the matrices of the context, the next shorter one reuses them.
+    {
+        DnaString longH = "ACGTTGCAACGTTGCAACGTTGCACTTAACTTCACAAGTACGTAC";
+        Dna5String longV = "TTGCAAGTTGCAACGGGGCTTGAGAGCTTGGGGTACGTACACGT";
+        int longScore = localAlignmentScore(longH, longV, scoringScheme);
+        SEQAN_ASSERT_EQ(localAlignmentScore(longH, longV, scoringScheme, dpContext), longScore);
+
+        Gaps<DnaString> gapsH(strH);
+        Gaps<Dna5String> gapsV(strV);
+        SEQAN_ASSERT_EQ(localAlignment(gapsH, gapsV, scoringScheme, dpContext), 8);
+
+        std::stringstream ssH, ssV;
+        ssH << gapsH;
+        ssV << gapsV;
+        SEQAN_ASSERT_EQ(ssH.str(), "CTT---AACTT");
+        SEQAN_ASSERT_EQ(ssV.str(), "CTTGAGAGCTT");
+    }
+
+    // The gap model of the context selects the algorithm.
+    {
+        Dna5String seqH("GGGGCTTAAGCTTGGGG");
+        Dna5String seqV("AAAACTTAGCTCTAAAA");
+
+        Align<Dna5String> refAlign;
+        resize(rows(refAlign), 2);
+        assignSource(row(refAlign, 0), seqH);
+        assignSource(row(refAlign, 1), seqV);
+
+        Align<Dna5String> align;
+        resize(rows(align), 2);
+        assignSource(row(align, 0), seqH);
+        assignSource(row(align, 1), seqV);
+
+        DPContext<int, LinearGaps> linearContext;
+        int refScore = localAlignment(refAlign, SimpleScore(2, -1, -2, -2), LinearGaps());
+        int score = localAlignment(align, SimpleScore(2, -1, -2, -2), linearContext);
+
+        SEQAN_ASSERT_EQ(score, 12);
+        SEQAN_ASSERT_EQ(score, refScore);
+
+        std::stringstream ssRef, ss;
+        ssRef << refAlign;
+        ss << align;
+        SEQAN_ASSERT_EQ(ss.str(), ssRef.str());
+    }
+}
+
 SEQAN_DEFINE_TEST(test_align_local_alignment_enumeration_align)
 {
     using namespace seqan;
@@ -0,0 +1,187 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2015, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: SeqAn Team <seqan-dev@lists.fu-berlin.de>
+// ==========================================================================
+
+#ifndef TESTS_BAM_IO_TEST_BAM_ALIGNMENT_RECORD_VIEW_H_
+#define TESTS_BAM_IO_TEST_BAM_ALIGNMENT_RECORD_VIEW_H_
+
+#include <seqan/basic.h>
+#include <seqan/sequence.h>
+
+#include <seqan/bam_io.h>
+
+// Check that a view decodes to exactly the same record as the eager reader.
+inline void testBamIOCompareRecordView(seqan::BamAlignmentRecord const & expected,
+                                       seqan::BamAlignmentRecordView const & view)
+{
+    using namespace seqan;
+
+    SEQAN_ASSERT_EQ(view.rID, expected.rID);
+    SEQAN_ASSERT_EQ(view.beginPos, expected.beginPos);
+    SEQAN_ASSERT_EQ(view.mapQ, expected.mapQ);
+    SEQAN_ASSERT_EQ(view.flag, expected.flag);
+    SEQAN_ASSERT_EQ(view.rNextId, expected.rNextId);
+    SEQAN_ASSERT_EQ(view.pNext, expected.pNext);
+    SEQAN_ASSERT_EQ(view.tLen, expected.tLen);
+    SEQAN_ASSERT_EQ(hasFlagUnmapped(view), hasFlagUnmapped(expected));
+    SEQAN_ASSERT_EQ(getAlignmentLengthInRef(view), getAlignmentLengthInRef(expected));
+
+    SEQAN_ASSERT_EQ(CharString(getQName(view)), expected.qName);
+    SEQAN_ASSERT_EQ(CharString(getTags(view)), expected.tags);
+
+    String<CigarElement<> > cigar;
+    getCigar(cigar, view);
+    SEQAN_ASSERT(cigar == expected.cigar);
+
+    IupacString seq;
+    getSeq(seq, view);
+    SEQAN_ASSERT_EQ(seq, expected.seq);
+
+    CharString qual;
+    getQual(qual, view);
+    SEQAN_ASSERT_EQ(qual, expected.qual);
+
+    BamAlignmentRecord record;
+    assign(record, view);
+    SEQAN_ASSERT_EQ(record.qName, expected.qName);
+    SEQAN_ASSERT(record.cigar == expected.cigar);
+    SEQAN_ASSERT_EQ(record.seq, expected.seq);
+    SEQAN_ASSERT_EQ(record.qual, expected.qual);
+    SEQAN_ASSERT_EQ(record.tags, expected.tags);
+}
+
+SEQAN_DEFINE_TEST(test_bam_io_bam_read_alignment_view)
+{
+    using namespace seqan;
+
+    CharString bamFilename;
+    append(bamFilename, SEQAN_PATH_TO_ROOT());
+    append(bamFilename, "/tests/bam_io/test_small.bam");
+
+    String<char, MMap<> > in;
+    open(in, toCString(bamFilename));
+
+    StringSet<CharString> referenceNameStore;
+    NameStoreCache<StringSet<CharString> > referenceNameStoreCache(referenceNameStore);
+    BamIOContext<StringSet<CharString> > bamIOContext(referenceNameStore, referenceNameStoreCache);
+    BamHeader header;
+
+    // Read all records eagerly.
+    typename Iterator<String<char, MMap<> >, Rooted>::Type iter = begin(in);
+    readHeader(header, bamIOContext, iter, Bam());
+    String<BamAlignmentRecord> alignments;
+    while (!atEnd(iter))
+    {
+        resize(alignments, length(alignments) + 1);
+        readRecord(back(alignments), bamIOContext, iter, Bam());
+    }
+    SEQAN_ASSERT_EQ(length(alignments), 3u);
+
+    // Read them again through a view.
+    iter = begin(in);
+    readHeader(header, bamIOContext, iter, Bam());
+    BamAlignmentRecordView view;
+    unsigned i = 0;
+    for (; !atEnd(iter); ++i)
+    {
+        readRecord(view, bamIOContext, iter, Bam());
+        SEQAN_ASSERT_LT(i, length(alignments));
+        // The view references the mapped file directly.
+        SEQAN_ASSERT(view._data >= begin(in, Standard()) && view._data < end(in, Standard()));
+        testBamIOCompareRecordView(alignments[i], view);
+    }
+    SEQAN_ASSERT_EQ(i, length(alignments));
+}
+
+inline void testBamIOBamFileReadRecordViews(char const * filePath, unsigned expectedRecords)
+{
+    using namespace seqan;
+
+    BamFileIn bamIn(filePath);
+    BamFileIn bamViewIn(filePath);
+    BamHeader header;
+    readHeader(header, bamIn);
+    readHeader(header, bamViewIn);
+
+    BamAlignmentRecord record;
+    BamAlignmentRecordView view;
+    unsigned numRecords = 0;
+    while (!atEnd(bamIn))
+    {
+        SEQAN_ASSERT_NOT(atEnd(bamViewIn));
+        readRecord(record, bamIn);
+        readRecord(view, bamViewIn);
+        testBamIOCompareRecordView(record, view);
+        ++numRecords;
+    }
+    SEQAN_ASSERT(atEnd(bamViewIn));
+    SEQAN_ASSERT_EQ(numRecords, expectedRecords);
+}
+
+SEQAN_DEFINE_TEST(test_bam_io_bam_file_sam_read_view)
+{
+    seqan::CharString filePath = SEQAN_PATH_TO_ROOT();
+    append(filePath, "/tests/bam_io/small.sam");
+
+    testBamIOBamFileReadRecordViews(toCString(filePath), 3u);
+}
+
+SEQAN_DEFINE_TEST(test_bam_io_bam_file_bam_read_ex1_view)
+{
+    seqan::CharString filePath = SEQAN_PATH_TO_ROOT();
+    append(filePath, "/tests/bam_io/ex1.bam");
+
+    // ex1.bam was written by samtools which never splits records between BGZF blocks.
+    testBamIOBamFileReadRecordViews(toCString(filePath), 3307u);
+
+    // Rewrite it with SeqAn so that some records span two blocks and must be copied into the view.
+    seqan::CharString tmpPath = SEQAN_TEMP_FILENAME();
+    append(tmpPath, ".bam");
+    {
+        seqan::BamFileIn bamIn(toCString(filePath));
+        seqan::BamHeader header;
+        readHeader(header, bamIn);
+        seqan::BamFileOut bamOut(context(bamIn), toCString(tmpPath));
+        writeHeader(bamOut, header);
+
+        seqan::BamAlignmentRecord record;
+        while (!atEnd(bamIn))
+        {
+            readRecord(record, bamIn);
+            writeRecord(bamOut, record);
+        }
+    }
+    testBamIOBamFileReadRecordViews(toCString(tmpPath), 3307u);
+}
+
+#endif  // TESTS_BAM_IO_TEST_BAM_ALIGNMENT_RECORD_VIEW_H_
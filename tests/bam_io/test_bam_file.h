@@ -35,6 +35,7 @@
 #ifndef TESTS_BAM_IO_TEST_EASY_BAM_IO_H_
 #define TESTS_BAM_IO_TEST_EASY_BAM_IO_H_
 
+#include <fstream>
 #include <sstream>
 
 #include <seqan/basic.h>
@@ -237,6 +238,110 @@ SEQAN_DEFINE_TEST(test_bam_io_bam_file_bam_read_ex1)
     SEQAN_ASSERT_EQ(counts[1], 1806);
 }
 
+// Read a file once record by record and once in parallel batches, both must give the same records.
+inline void testBamIOBamFileReadRecordsBatch(char const * filePath, unsigned expectedRecords)
+{
+    seqan::BamHeader header;
+    seqan::String<seqan::BamAlignmentRecord> expected;
+    seqan::StringSet<seqan::CharString> expectedContigNames;
+    {
+        seqan::BamFileIn bamIn(filePath);
+        readHeader(header, bamIn);
+        while (!atEnd(bamIn))
+        {
+            resize(expected, length(expected) + 1);
+            readRecord(back(expected), bamIn);
+        }
+        expectedContigNames = contigNames(context(bamIn));
+    }
+    SEQAN_ASSERT_EQ(length(expected), expectedRecords);
+
+    seqan::BamFileIn bamIn(filePath);
+    readHeader(header, bamIn);
+
+    seqan::String<seqan::BamAlignmentRecord> records;
+    unsigned numRecords = 0;
+    while (!atEnd(bamIn))
+    {
+        unsigned size = readRecords(records, bamIn, 1000u);
+        SEQAN_ASSERT_GT(size, 0u);
+        SEQAN_ASSERT_LEQ(numRecords + size, length(expected));
+        for (unsigned i = 0; i < size; ++i)
+        {
+            seqan::BamAlignmentRecord const & a = records[i];
+            seqan::BamAlignmentRecord const & b = expected[numRecords + i];
+            SEQAN_ASSERT_EQ(a.qName, b.qName);
+            SEQAN_ASSERT_EQ(a.flag, b.flag);
+            SEQAN_ASSERT_EQ(a.rID, b.rID);
+            SEQAN_ASSERT_EQ(a.beginPos, b.beginPos);
+            SEQAN_ASSERT_EQ(a.mapQ, b.mapQ);
+            SEQAN_ASSERT(a.cigar == b.cigar);
+            SEQAN_ASSERT_EQ(a.rNextId, b.rNextId);
+            SEQAN_ASSERT_EQ(a.pNext, b.pNext);
+            SEQAN_ASSERT_EQ(a.tLen, b.tLen);
+            SEQAN_ASSERT_EQ(a.seq, b.seq);
+            SEQAN_ASSERT_EQ(a.qual, b.qual);
+            SEQAN_ASSERT_EQ(a.tags, b.tags);
+        }
+        numRecords += size;
+    }
+    SEQAN_ASSERT_EQ(numRecords, expectedRecords);
+    SEQAN_ASSERT(contigNames(context(bamIn)) == expectedContigNames);
+}
+
+SEQAN_DEFINE_TEST(test_bam_io_bam_file_read_records_batch)
+{
+#if defined(_OPENMP)
+    int numThreads = omp_get_max_threads();
+    omp_set_num_threads(4);
+#endif
+
+    seqan::CharString filePath = SEQAN_PATH_TO_ROOT();
+    append(filePath, "/tests/bam_io/ex1.bam");
+    testBamIOBamFileReadRecordsBatch(toCString(filePath), 3307u);
+
+    // Convert to SAM and read it again.
+    seqan::CharString tmpPath = SEQAN_TEMP_FILENAME();
+    append(tmpPath, ".sam");
+    {
+        seqan::BamFileIn bamIn(toCString(filePath));
+        seqan::BamHeader header;
+        readHeader(header, bamIn);
+        seqan::BamFileOut samOut(context(bamIn), toCString(tmpPath));
+        writeHeader(samOut, header);
+
+        seqan::String<seqan::BamAlignmentRecord> records;
+        while (!atEnd(bamIn))
+        {
+            unsigned size = readRecords(records, bamIn, 1000u);
+            writeRecords(samOut, prefix(records, size));
+        }
+    }
+    testBamIOBamFileReadRecordsBatch(toCString(tmpPath), 3307u);
+
+    // Contigs missing from the header get their ids in order of appearance.
+    seqan::CharString noSqPath = SEQAN_TEMP_FILENAME();
+    append(noSqPath, ".sam");
+    {
+        std::ofstream samOut(toCString(noSqPath));
+        samOut << "@HD\tVN:1.4\n";
+        for (unsigned i = 0; i < 3000; ++i)
+        {
+            samOut << "r" << i << "\t0\tctg" << (i * 7919) % 1009 << "\t" << i + 1 << "\t60\t4M\t";
+            if (i % 3 == 0)
+                samOut << "=";
+            else
+                samOut << "mate" << i % 5;
+            samOut << "\t1\t0\tACGT\tIIII\n";
+        }
+    }
+    testBamIOBamFileReadRecordsBatch(toCString(noSqPath), 3000u);
+
+#if defined(_OPENMP)
+    omp_set_num_threads(numThreads);
+#endif
+}
+
 // ---------------------------------------------------------------------------
 // Write Header
 // ---------------------------------------------------------------------------
@@ -112,5 +112,268 @@ SEQAN_DEFINE_TEST(test_bam_io_bam_index_save)
     SEQAN_ASSERT(_compareBinaryFiles(toCString(tmpOutPath), toCString(baiFilename)));
 }
 
+// ---------------------------------------------------------------------------
+// CSI Index
+// ---------------------------------------------------------------------------
+
+// Compare the alignments found via jumpToRegion() with a linear scan over the file.
+
+template <typename TIndex>
+void testBamIOCompareRegionQueries(char const * bamFilename, TIndex const & index, __int32 step, __int32 width)
+{
+    BamFileIn bamFile(bamFilename);
+    BamHeader header;
+    readHeader(header, bamFile);
+
+    String<BamAlignmentRecord> records;
+    BamAlignmentRecord record;
+    while (!atEnd(bamFile))
+    {
+        readRecord(record, bamFile);
+        appendValue(records, record);
+    }
+
+    for (unsigned rID = 0; rID < length(contigLengths(context(bamFile))); ++rID)
+    {
+        __int32 contigLength = contigLengths(context(bamFile))[rID];
+        for (__int32 pos = 0; pos < contigLength; pos += step)
+        {
+            __int32 posEnd = pos + width;
+
+            unsigned expectedCount = 0;
+            for (unsigned i = 0; i < length(records); ++i)
+                if (records[i].rID == (__int32)rID && records[i].beginPos < posEnd &&
+                    records[i].beginPos + (__int32)std::max(getAlignmentLengthInRef(records[i]), 1u) > pos)
+                    ++expectedCount;
+
+            bool hasAlignments = false;
+            SEQAN_ASSERT(jumpToRegion(bamFile, hasAlignments, rID, pos, posEnd, index));
+            SEQAN_ASSERT_EQ(hasAlignments, expectedCount != 0u);
+            if (!hasAlignments)
+                continue;
+
+            unsigned count = 0;
+            for (bool first = true; !atEnd(bamFile); first = false)
+            {
+                readRecord(record, bamFile);
+                if (record.rID != (__int32)rID || record.beginPos >= posEnd)
+                    break;
+
+                bool overlaps = record.beginPos + (__int32)std::max(getAlignmentLengthInRef(record), 1u) > pos;
+                if (first)
+                    SEQAN_ASSERT(overlaps);  // jumped to the first overlapping alignment
+                if (overlaps)
+                    ++count;
+            }
+            SEQAN_ASSERT_EQ(count, expectedCount);
+        }
+    }
+}
+
+SEQAN_DEFINE_TEST(test_bam_io_bam_index_csi_build)
+{
+    CharString bamFilename = SEQAN_PATH_TO_ROOT();
+    append(bamFilename, "/tests/bam_io/ex1.bam");
+
+    CharString tmpOutPath = SEQAN_TEMP_FILENAME();
+    append(tmpOutPath, ".csi");
+
+    BamIndex<Csi> csiIndex;
+    SEQAN_ASSERT(build(csiIndex, toCString(bamFilename)));
+    SEQAN_ASSERT_EQ(csiIndex.minShift, 14);
+    SEQAN_ASSERT_EQ(csiIndex.depth, 0);         // both contigs are shorter than 2^14 bp
+    SEQAN_ASSERT_EQ(length(csiIndex._binIndices), 2u);
+    SEQAN_ASSERT_EQ(getUnalignedCount(csiIndex), 0u);
+    SEQAN_ASSERT(save(csiIndex, toCString(tmpOutPath)));
+
+    // Reload the index and compare.
+    BamIndex<Csi> csiIndex2;
+    SEQAN_ASSERT(open(csiIndex2, toCString(tmpOutPath)));
+    SEQAN_ASSERT_EQ(csiIndex2.minShift, csiIndex.minShift);
+    SEQAN_ASSERT_EQ(csiIndex2.depth, csiIndex.depth);
+    SEQAN_ASSERT_EQ(getUnalignedCount(csiIndex2), 0u);
+    SEQAN_ASSERT_EQ(length(csiIndex2._binIndices), 2u);
+    for (unsigned i = 0; i < 2u; ++i)
+    {
+        SEQAN_ASSERT_EQ(csiIndex2._binIndices[i].size(), csiIndex._binIndices[i].size());
+        BamIndex<Csi>::TBinIndex_::const_iterator it2 = csiIndex2._binIndices[i].begin();
+        for (BamIndex<Csi>::TBinIndex_::const_iterator it = csiIndex._binIndices[i].begin();
+             it != csiIndex._binIndices[i].end(); ++it, ++it2)
+        {
+            SEQAN_ASSERT_EQ(it->first, it2->first);
+            SEQAN_ASSERT_EQ(it->second.loffset, it2->second.loffset);
+            SEQAN_ASSERT(it->second.chunkBegEnds == it2->second.chunkBegEnds);
+        }
+    }
+
+    testBamIOCompareRegionQueries(toCString(bamFilename), csiIndex2, 37, 1);
+    testBamIOCompareRegionQueries(toCString(bamFilename), csiIndex2, 101, 250);
+
+    // Smaller bins yield more levels.
+    BamIndex<Csi> fineIndex;
+    fineIndex.minShift = 6;
+    SEQAN_ASSERT(build(fineIndex, toCString(bamFilename)));
+    SEQAN_ASSERT_EQ(fineIndex.depth, 2);
+    testBamIOCompareRegionQueries(toCString(bamFilename), fineIndex, 37, 1);
+    testBamIOCompareRegionQueries(toCString(bamFilename), fineIndex, 101, 250);
+}
+
+SEQAN_DEFINE_TEST(test_bam_io_bam_index_csi_long_contig)
+{
+    // Alignments behind 2^29 bp cannot be indexed by BAI.
+    CharString tmpPath = SEQAN_TEMP_FILENAME();
+    append(tmpPath, ".bam");
+
+    __int32 const contigLength = 1500000000;
+    {
+        BamFileOut bamFile(toCString(tmpPath));
+        appendName(contigNamesCache(context(bamFile)), "chrLong");
+        appendValue(contigLengths(context(bamFile)), contigLength);
+
+        BamHeader header;
+        resize(header, 2);
+        header[0].type = BAM_HEADER_FIRST;
+        appendValue(header[0].tags, Pair<CharString>("VN", "1.4"));
+        appendValue(header[0].tags, Pair<CharString>("SO", "coordinate"));
+        header[1].type = BAM_HEADER_REFERENCE;
+        appendValue(header[1].tags, Pair<CharString>("SN", "chrLong"));
+        appendValue(header[1].tags, Pair<CharString>("LN", "1500000000"));
+        writeHeader(bamFile, header);
+
+        BamAlignmentRecord record;
+        record.rID = 0;
+        record.seq = "ACGTACGTAC";
+        record.qual = "IIIIIIIIII";
+        appendValue(record.cigar, CigarElement<>('M', 10));
+        for (__int32 i = 0; i < 2000; ++i)
+        {
+            record.qName = "read";
+            appendNumber(record.qName, i);
+            record.beginPos = (__int32)((__int64)i * (contigLength - 100) / 2000);
+            writeRecord(bamFile, record);
+        }
+    }
+
+    BamIndex<Csi> csiIndex;
+    SEQAN_ASSERT(build(csiIndex, toCString(tmpPath)));
+    SEQAN_ASSERT_EQ(csiIndex.depth, 6);
+    CharString csiPath = tmpPath;
+    append(csiPath, ".csi");
+    SEQAN_ASSERT(save(csiIndex, toCString(csiPath)));
+
+    BamIndex<Csi> csiIndex2;
+    SEQAN_ASSERT(open(csiIndex2, toCString(csiPath)));
+    testBamIOCompareRegionQueries(toCString(tmpPath), csiIndex2, 9999991, 1000);
+
+    BamFileIn bamFile(toCString(tmpPath));
+    BamHeader header;
+    readHeader(header, bamFile);
+
+    bool hasAlignments = false;
+    BamAlignmentRecord record;
+    __int32 pos = (__int32)((__int64)1866 * (contigLength - 100) / 2000);
+    SEQAN_ASSERT(jumpToRegion(bamFile, hasAlignments, 0, pos + 5, pos + 6, csiIndex2));
+    SEQAN_ASSERT(hasAlignments);
+    readRecord(record, bamFile);
+    SEQAN_ASSERT_EQ(record.qName, "read1866");
+    SEQAN_ASSERT_EQ(record.beginPos, pos);
+}
+
+// Reads the regions with a BamRegionReader and compares with a linear scan.
+template <typename TIndexSpec>
+void testBamIORegionReader(char const * bamFilename, BamIndex<TIndexSpec> const & index,
+                           String<GenomicRegion> const & regions)
+{
+    BamFileIn bamFile(bamFilename);
+    BamHeader header;
+    readHeader(header, bamFile);
+
+    // Collect the expected alignments and their region ids by a linear scan.
+    String<BamAlignmentRecord> expected;
+    StringSet<String<unsigned> > expectedIds;
+    BamAlignmentRecord record;
+    while (!atEnd(bamFile))
+    {
+        readRecord(record, bamFile);
+        if (record.rID < 0)
+            continue;
+
+        String<unsigned> ids;
+        __int32 endPos = record.beginPos + (__int32)std::max(getAlignmentLengthInRef(record), 1u);
+        for (unsigned i = 0; i < length(regions); ++i)
+        {
+            unsigned rID = 0;
+            if (!getIdByName(rID, contigNamesCache(context(bamFile)), regions[i].seqName) || (__int32)rID != record.rID)
+                continue;
+            __int32 regionEnd = (regions[i].endPos < 0) ? MaxValue<__int32>::VALUE : regions[i].endPos;
+            if (record.beginPos < regionEnd && endPos > std::max(regions[i].beginPos, (__int32)0))
+                appendValue(ids, i);
+        }
+        if (!empty(ids))
+        {
+            appendValue(expected, record);
+            appendValue(expectedIds, ids);
+        }
+    }
+
+    // The reader must return the same alignments in file order.
+    BamFileIn bamFile2(bamFilename);
+    readHeader(header, bamFile2);
+    BamRegionReader<TIndexSpec> reader(bamFile2, index, regions);
+    String<unsigned> ids;
+    unsigned count = 0;
+    while (!atEnd(reader))
+    {
+        readRecord(record, ids, reader);
+        SEQAN_ASSERT_LT(count, length(expected));
+        SEQAN_ASSERT_EQ(record.qName, expected[count].qName);
+        SEQAN_ASSERT_EQ(record.rID, expected[count].rID);
+        SEQAN_ASSERT_EQ(record.beginPos, expected[count].beginPos);
+        SEQAN_ASSERT(ids == expectedIds[count]);
+        ++count;
+    }
+    SEQAN_ASSERT_EQ(count, length(expected));
+}
+
+SEQAN_DEFINE_TEST(test_bam_io_bam_region_reader)
+{
+    CharString bamFilename = SEQAN_PATH_TO_ROOT();
+    append(bamFilename, "/tests/bam_io/ex1.bam");
+
+    BamIndex<Csi> csiIndex;
+    SEQAN_ASSERT(build(csiIndex, toCString(bamFilename)));
+
+    // Unsorted, overlapping, open-ended and unknown regions.
+    String<GenomicRegion> regions;
+    appendValue(regions, GenomicRegion("seq2:1000-1200"));
+    appendValue(regions, GenomicRegion("seq1:100-200"));
+    appendValue(regions, GenomicRegion("seq1:150-400"));
+    appendValue(regions, GenomicRegion("seq3:1-100"));
+    appendValue(regions, GenomicRegion("seq1:1500"));
+    appendValue(regions, GenomicRegion("seq2:1100-1101"));
+    testBamIORegionReader(toCString(bamFilename), csiIndex, regions);
+
+    // Whole contigs.
+    clear(regions);
+    appendValue(regions, GenomicRegion("seq2"));
+    appendValue(regions, GenomicRegion("seq1"));
+    testBamIORegionReader(toCString(bamFilename), csiIndex, regions);
+
+    // No regions.
+    clear(regions);
+    testBamIORegionReader(toCString(bamFilename), csiIndex, regions);
+
+    // BAI index.
+    CharString smallFilename = SEQAN_PATH_TO_ROOT();
+    append(smallFilename, "/tests/bam_io/small.bam");
+    CharString baiFilename = smallFilename;
+    append(baiFilename, ".bai");
+
+    BamIndex<Bai> baiIndex;
+    SEQAN_ASSERT(open(baiIndex, toCString(baiFilename)));
+    appendValue(regions, GenomicRegion("REFERENCE:1-30"));
+    appendValue(regions, GenomicRegion("REFERENCE:10-12"));
+    testBamIORegionReader(toCString(smallFilename), baiIndex, regions);
+}
 
 #endif  // TESTS_BAM_IO_TEST_BAM_INDEX_H_
@@ -49,6 +49,7 @@
 #if SEQAN_HAS_ZLIB
 #include "test_bam_index.h"
 #include "test_bam_file.h"
+#include "test_bam_alignment_record_view.h"
 #endif
 
 SEQAN_BEGIN_TESTSUITE(test_bam_io)
@@ -168,9 +169,13 @@ SEQAN_BEGIN_TESTSUITE(test_bam_io)
     SEQAN_CALL_TEST(test_bam_io_bam_file_bam_read_header);
     SEQAN_CALL_TEST(test_bam_io_bam_file_bam_read_records);
     SEQAN_CALL_TEST(test_bam_io_bam_file_bam_read_ex1);
+    SEQAN_CALL_TEST(test_bam_io_bam_file_read_records_batch);
     SEQAN_CALL_TEST(test_bam_io_bam_file_bam_write_header);
     SEQAN_CALL_TEST(test_bam_io_bam_file_bam_write_records);
     SEQAN_CALL_TEST(test_bam_io_bam_file_bam_file_seek);
+    SEQAN_CALL_TEST(test_bam_io_bam_read_alignment_view);
+    SEQAN_CALL_TEST(test_bam_io_bam_file_sam_read_view);
+    SEQAN_CALL_TEST(test_bam_io_bam_file_bam_read_ex1_view);
 
     // Issue 489
     SEQAN_CALL_TEST(test_bam_io_sam_file_issue_489);
@@ -180,6 +185,9 @@ SEQAN_BEGIN_TESTSUITE(test_bam_io)
 //  TODO(dadi): uncomment when BamIndex.build index is fixed
 //    SEQAN_CALL_TEST(test_bam_io_bam_index_build);
     SEQAN_CALL_TEST(test_bam_io_bam_index_open);
+    SEQAN_CALL_TEST(test_bam_io_bam_index_csi_build);
+    SEQAN_CALL_TEST(test_bam_io_bam_index_csi_long_contig);
+    SEQAN_CALL_TEST(test_bam_io_bam_region_reader);
 #endif
 }
 SEQAN_END_TESTSUITE
@@ -48,6 +48,7 @@ SEQAN_BEGIN_TESTSUITE(test_basic_allocator)
     SEQAN_CALL_TEST(test_basic_allocator_pool);
     SEQAN_CALL_TEST(test_basic_allocator_multi_pool);
     SEQAN_CALL_TEST(test_basic_allocator_chunk_pool);
+    SEQAN_CALL_TEST(test_basic_allocator_arena);
     // TODO(holtgrew): Test for std:: adaption!
 
 }
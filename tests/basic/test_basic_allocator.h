@@ -213,4 +213,46 @@ SEQAN_DEFINE_TEST(test_basic_allocator_chunk_pool)
     SEQAN_ASSERT_EQ(countDeallocs(parentAllocator(parentAllocator(allo1))), 2);
 }
 
+SEQAN_DEFINE_TEST(test_basic_allocator_arena)
+{
+    int * dat1;
+    int * dat2;
+    char * dat3;
+
+    typedef Allocator<SimpleAlloc<TestAllocator> > TParentAlloc;
+    typedef Allocator<Arena<TParentAlloc> > TArena;
+    TArena allo1;
+    allocate(allo1, dat1, 20);
+    allocate(allo1, dat2, 3);
+    allocate(allo1, dat3, 1);
+
+    SEQAN_ASSERT_EQ((char *)dat2, (char *)dat1 + 80);
+    SEQAN_ASSERT_EQ((char *)dat3, (char *)dat2 + 16);
+    SEQAN_ASSERT_EQ(countAllocs(parentAllocator(parentAllocator(allo1))), 1);
+
+    // Deallocation is a no-op, reset releases everything at once.
+    deallocate(allo1, dat1, 20);
+    allocate(allo1, dat2, 20);
+    SEQAN_ASSERT_NEQ(dat1, dat2);
+
+    reset(allo1);
+    allocate(allo1, dat2, 20);
+    SEQAN_ASSERT_EQ(dat1, dat2);
+    SEQAN_ASSERT_EQ(countAllocs(parentAllocator(parentAllocator(allo1))), 1);
+
+    // Large requests get a block of their own, which is reused after a reset.
+    allocate(allo1, dat3, (size_t)TArena::BLOCK_SIZE);
+    SEQAN_ASSERT_EQ(countAllocs(parentAllocator(parentAllocator(allo1))), 2);
+    reset(allo1);
+    allocate(allo1, dat1, 20);
+    allocate(allo1, dat3, (size_t)TArena::BLOCK_SIZE);
+    SEQAN_ASSERT_EQ(dat1, dat2);
+    SEQAN_ASSERT_EQ(countAllocs(parentAllocator(parentAllocator(allo1))), 2);
+    SEQAN_ASSERT_EQ(countDeallocs(parentAllocator(parentAllocator(allo1))), 0);
+
+    clear(allo1);
+
+    SEQAN_ASSERT_EQ(countDeallocs(parentAllocator(parentAllocator(allo1))), 2);
+}
+
 #endif  // #ifndef TESTS_BASIC_TEST_BASIC_ALLOCATOR_H_
@@ -44,6 +44,10 @@ SEQAN_BEGIN_TESTSUITE(test_find_backtracking_exp)
     // Call tests.
     SEQAN_CALL_TEST(test_find_backtracking_multiple_hamming_banana_vs_ada_ana);
     SEQAN_CALL_TEST(test_find_backtracking_multiple_edit_banana_vs_ada_ana);
+    SEQAN_CALL_TEST(test_find_backtracking_bidirectional_hamming_banana_vs_ada);
+#ifdef SEQAN_CXX11_STANDARD
+    SEQAN_CALL_TEST(test_find_backtracking_fm_batch_exact);
+#endif
 //    SEQAN_CALL_TEST(test_find_backtracking_single_hamming_banana_vs_ada);
 //    SEQAN_CALL_TEST(test_find_backtracking_single_edit_banana_vs_ada);
 }
@@ -245,6 +245,40 @@ SEQAN_DEFINE_TEST(test_find_backtracking_single_hamming_banana_vs_ada)
 //    test(tester);
 }
 
+// ----------------------------------------------------------------------------
+// Test test_find_backtracking_bidirectional_hamming_banana_vs_ada
+// ----------------------------------------------------------------------------
+
+SEQAN_DEFINE_TEST(test_find_backtracking_bidirectional_hamming_banana_vs_ada)
+{
+    typedef CharString                              TText;
+    typedef CharString                              TPattern;
+    typedef Index<TText, BidirectionalIndex<> >     TTextIndex;
+    typedef HammingDistance                         TDistance;
+
+    typedef Backtracking<TDistance>                                 TBacktracking;
+    typedef FinderTester<TTextIndex, TPattern, TBacktracking>       TTester;
+    typedef Finder_<TTextIndex, TPattern, TBacktracking>            TFinder;
+
+    typedef typename Fibre<TTextIndex, FibreSA>::Type               TTextSAFibre;
+    typedef typename Value<TTextSAFibre>::Type                      TTextSAPos;
+
+    TText text = "banana";
+
+    TPattern pattern = "ada";
+
+    TTextIndex textIndex(text);
+
+    TTester tester;
+    TFinder finder;
+
+    addSolution(tester, TTextSAPos(3), 0, 1);
+    addSolution(tester, TTextSAPos(1), 0, 1);
+
+    _find(finder, textIndex, pattern, 1u, tester);
+    test(tester);
+}
+
 // ----------------------------------------------------------------------------
 // Test test_find_backtracking_single_edit_banana_vs_ada
 // ----------------------------------------------------------------------------
@@ -283,4 +317,94 @@ SEQAN_DEFINE_TEST(test_find_backtracking_single_edit_banana_vs_ada)
 //    test(tester);
 }
 
+// ----------------------------------------------------------------------------
+// Test test_find_backtracking_fm_batch_exact
+// ----------------------------------------------------------------------------
+
+#ifdef SEQAN_CXX11_STANDARD
+template <typename TIndex, typename TNeedles, typename TThreading>
+inline void
+_testFindBacktrackingFMBatchExact(TIndex & index, TNeedles const & needles, TThreading)
+{
+    typedef typename Iterator<TIndex, TopDown<> >::Type                 TIndexIt;
+    typedef typename Iterator<TNeedles const, Rooted>::Type             TNeedlesIt;
+    typedef typename Size<TIndex>::Type                                 TSize;
+    typedef Pair<TSize>                                                 TRange;
+
+    // Batched search.
+    String<unsigned> hits;
+    String<TRange> ranges;
+    resize(hits, length(needles), 0u);
+    resize(ranges, length(needles));
+
+    find(index, needles, 0u, [&](TIndexIt const & indexIt, TNeedlesIt const & needlesIt, unsigned errors)
+    {
+        SEQAN_ASSERT_EQ(errors, 0u);
+        SEQAN_ASSERT_EQ(repLength(indexIt), length(value(needlesIt)));
+        hits[position(needlesIt)]++;
+        ranges[position(needlesIt)] = value(indexIt).range;
+    },
+    Backtracking<Exact>(), TThreading());
+
+    // Single needle search.
+    for (unsigned i = 0; i < length(needles); ++i)
+    {
+        TIndexIt indexIt(index);
+
+        if (goDown(indexIt, needles[i]))
+        {
+            SEQAN_ASSERT_EQ(hits[i], 1u);
+            SEQAN_ASSERT_EQ(ranges[i], value(indexIt).range);
+        }
+        else
+        {
+            SEQAN_ASSERT_EQ(hits[i], 0u);
+        }
+    }
+}
+
+SEQAN_DEFINE_TEST(test_find_backtracking_fm_batch_exact)
+{
+    typedef Index<DnaString, FMIndex<> >            TIndex;
+    typedef StringSet<DnaString>                    TNeedles;
+    typedef StringSet<DnaString, Owner<ConcatDirect<> > > TConcatNeedles;
+
+    Rng<MersenneTwister> rng(42);
+
+    DnaString text;
+    for (unsigned i = 0; i < 20000; ++i)
+        appendValue(text, Dna(pickRandomNumber(rng) % 4));
+
+    // Mix occurring and random needles of different lengths, including empty ones.
+    TNeedles needles;
+    for (unsigned i = 0; i < 1000; ++i)
+    {
+        unsigned needleLength = pickRandomNumber(rng) % 25;
+        if (i % 2)
+        {
+            unsigned needleBegin = pickRandomNumber(rng) % (length(text) - needleLength);
+            appendValue(needles, infix(text, needleBegin, needleBegin + needleLength));
+        }
+        else
+        {
+            DnaString needle;
+            for (unsigned j = 0; j < needleLength; ++j)
+                appendValue(needle, Dna(pickRandomNumber(rng) % 4));
+            appendValue(needles, needle);
+        }
+    }
+
+    TConcatNeedles concatNeedles;
+    for (unsigned i = 0; i < length(needles); ++i)
+        appendValue(concatNeedles, needles[i]);
+
+    TIndex index(text);
+    indexRequire(index, FibreSALF());
+
+    _testFindBacktrackingFMBatchExact(index, needles, Serial());
+    _testFindBacktrackingFMBatchExact(index, needles, Parallel());
+    _testFindBacktrackingFMBatchExact(index, concatNeedles, Serial());
+}
+#endif
+
 #endif  // TESTS_FIND_BACKTRACKING_EXP_H_
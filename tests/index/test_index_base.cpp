@@ -42,6 +42,45 @@ using namespace seqan;
 
 SEQAN_TYPED_TEST_CASE(IndexTest, FMIndexTypes);
 
+// --------------------------------------------------------------------------
+// Class MMapIndexTest
+// --------------------------------------------------------------------------
+// Indices are built in memory and reopened with memory mapped fibres.
+
+template <typename TIndexPair_>
+class MMapIndexTest : public Test
+{
+public:
+    typedef typename Value<TIndexPair_, 1>::Type    TIndex;
+    typedef typename Value<TIndexPair_, 2>::Type    TMMapIndex;
+    typedef typename Host<TIndex>::Type             TText;
+
+    TText       text;
+    TIndex      index;
+
+    MMapIndexTest() :
+        index(text)
+    {}
+
+    void setUp()
+    {
+        generateText(text, 10000);
+        setHost(index, text);
+    }
+};
+
+typedef
+    TagList<Pair<Index<DnaString, FMIndex<> >,
+                 Index<String<Dna, MMap<> >, FMIndex<void, FMIndexConfig<void, size_t, MMap<> > > > >,
+    TagList<Pair<Index<DnaString, IndexEsa<> >,
+                 Index<String<Dna, MMap<> >, IndexEsa<> > >,
+    TagList<Pair<Index<DnaString, IndexQGram<UngappedShape<3> > >,
+                 Index<String<Dna, MMap<> >, IndexQGram<UngappedShape<3> > > >
+    > > >
+    MMapIndexTypes;
+
+SEQAN_TYPED_TEST_CASE(MMapIndexTest, MMapIndexTypes);
+
 // ==========================================================================
 // Index Tests
 // ========================================================================== 
@@ -111,6 +150,49 @@ SEQAN_TYPED_TEST(IndexTest, OpenSave)
     SEQAN_ASSERT_EQ(length(this->index), lengthSum(this->text));
 }
 
+// --------------------------------------------------------------------------
+// Test open() read-only of memory mapped fibres
+// --------------------------------------------------------------------------
+
+SEQAN_TYPED_TEST(MMapIndexTest, OpenReadOnly)
+{
+    typedef typename TestFixture::TIndex            TIndex;
+    typedef typename TestFixture::TMMapIndex        TMMapIndex;
+
+    String<Dna> needle;
+    resize(needle, 3);
+
+    // Searching all 3-mers creates the fibres to be saved.
+    String<unsigned> counts;
+    resize(counts, 64, 0u);
+    for (unsigned code = 0; code < 64; ++code)
+    {
+        for (unsigned i = 0; i < 3; ++i)
+            needle[i] = Dna((code >> (2 * i)) & 3);
+
+        Finder<TIndex> finder(this->index);
+        while (find(finder, needle)) ++counts[code];
+    }
+
+    const char * fileName = SEQAN_TEMP_FILENAME();
+    SEQAN_ASSERT(save(this->index, fileName));
+
+    TMMapIndex mmapIndex;
+    SEQAN_ASSERT(open(mmapIndex, fileName, OPEN_RDONLY));
+    SEQAN_ASSERT_EQ(length(mmapIndex), length(this->text));
+
+    for (unsigned code = 0; code < 64; ++code)
+    {
+        for (unsigned i = 0; i < 3; ++i)
+            needle[i] = Dna((code >> (2 * i)) & 3);
+
+        Finder<TMMapIndex> finder(mmapIndex);
+        unsigned count = 0;
+        while (find(finder, needle)) ++count;
+        SEQAN_ASSERT_EQ(count, counts[code]);
+    }
+}
+
 // ========================================================================== 
 // Functions
 // ========================================================================== 
@@ -0,0 +1,252 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2015, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: SeqAn Team <seqan-dev@lists.fu-berlin.de>
+// ==========================================================================
+
+#include <seqan/basic.h>
+#include <seqan/index.h>
+
+using namespace seqan;
+
+// ==========================================================================
+// Functions
+// ==========================================================================
+
+// --------------------------------------------------------------------------
+// Function _countOccurrencesNaive()
+// --------------------------------------------------------------------------
+
+template <typename TText, typename TPattern>
+inline unsigned _countOccurrencesNaive(TText const & text, TPattern const & pattern)
+{
+    unsigned count = 0;
+    for (unsigned i = 0; i + length(pattern) <= length(text); ++i)
+        count += (infix(text, i, i + length(pattern)) == pattern);
+    return count;
+}
+
+template <typename TText, typename TSSetSpec, typename TPattern>
+inline unsigned _countOccurrencesNaive(StringSet<TText, TSSetSpec> const & text, TPattern const & pattern)
+{
+    unsigned count = 0;
+    for (unsigned i = 0; i < length(text); ++i)
+        count += _countOccurrencesNaive(text[i], pattern);
+    return count;
+}
+
+// --------------------------------------------------------------------------
+// Function _extendPattern()
+// --------------------------------------------------------------------------
+
+template <typename TPattern, typename TValue>
+inline void _extendPattern(TPattern & pattern, TValue c, Fwd)
+{
+    appendValue(pattern, c);
+}
+
+template <typename TPattern, typename TValue>
+inline void _extendPattern(TPattern & pattern, TValue c, Rev)
+{
+    insertValue(pattern, 0, c);
+}
+
+// --------------------------------------------------------------------------
+// Function _oppositeDirection()
+// --------------------------------------------------------------------------
+
+inline Rev _oppositeDirection(Fwd)
+{
+    return Rev();
+}
+
+inline Fwd _oppositeDirection(Rev)
+{
+    return Fwd();
+}
+
+// --------------------------------------------------------------------------
+// Function _testBidirectionalDfs()
+// --------------------------------------------------------------------------
+
+// Enumerates all children of the current node in direction dir and checks their counts.
+template <typename TIter, typename TText, typename TPattern, typename TDirection>
+inline void _testBidirectionalDfs(TIter & it, TText const & text, TPattern & pattern, unsigned depth, TDirection const & dir)
+{
+    typedef typename Value<TPattern>::Type  TAlphabet;
+
+    if (depth == 0) return;
+
+    String<bool> visited;
+    resize(visited, ValueSize<TAlphabet>::VALUE, false);
+
+    if (goDown(it, dir))
+    {
+        do
+        {
+            TAlphabet c = parentEdgeLabel(it);
+            visited[ordValue(c)] = true;
+
+            TPattern child = pattern;
+            _extendPattern(child, c, dir);
+
+            SEQAN_ASSERT_EQ(repLength(it), length(child));
+            SEQAN_ASSERT_EQ(countOccurrences(it), _countOccurrencesNaive(text, child));
+            SEQAN_ASSERT_EQ(representative(it), child);
+
+            // Alternate the directions on the way down.
+            _testBidirectionalDfs(it, text, child, depth - 1, _oppositeDirection(dir));
+        }
+        while (goRight(it, dir));
+
+        goUp(it);
+    }
+
+    // Characters skipped by goRight() must not occur.
+    for (unsigned ord = 0; ord < ValueSize<TAlphabet>::VALUE; ++ord)
+    {
+        if (visited[ordValue(TAlphabet(ord))]) continue;
+
+        TPattern child = pattern;
+        _extendPattern(child, TAlphabet(ord), dir);
+
+        SEQAN_ASSERT_EQ(_countOccurrencesNaive(text, child), 0u);
+    }
+}
+
+// ==========================================================================
+// Tests
+// ==========================================================================
+
+// --------------------------------------------------------------------------
+// Test test_index_bifm_extend
+// --------------------------------------------------------------------------
+
+SEQAN_DEFINE_TEST(test_index_bifm_extend)
+{
+    typedef Index<DnaString, BidirectionalIndex<> >         TIndex;
+    typedef Iterator<TIndex, TopDown<ParentLinks<> > >::Type TIter;
+
+    DnaString text = "ACGACGTTACGACAGT";
+    TIndex index(text);
+
+    {
+        TIter it(index);
+        SEQAN_ASSERT(isRoot(it));
+        SEQAN_ASSERT(extendRight(it, 'C'));
+        SEQAN_ASSERT_EQ(countOccurrences(it), 4u);
+        SEQAN_ASSERT(extendLeft(it, 'A'));
+        SEQAN_ASSERT_EQ(countOccurrences(it), 4u);
+        SEQAN_ASSERT(extendRight(it, 'G'));
+        SEQAN_ASSERT_EQ(countOccurrences(it), 3u);
+        SEQAN_ASSERT(extendLeft(it, 'G'));
+        SEQAN_ASSERT_EQ(countOccurrences(it), 1u);
+        SEQAN_ASSERT_EQ(representative(it), "GACG");
+        SEQAN_ASSERT_NOT(extendRight(it, 'G'));
+        SEQAN_ASSERT_EQ(representative(it), "GACG");
+        SEQAN_ASSERT(extendRight(it, 'T'));
+        SEQAN_ASSERT_EQ(representative(it), "GACGT");
+        SEQAN_ASSERT_EQ(getOccurrences(it)[0], 2u);
+
+        SEQAN_ASSERT(goUp(it));
+        SEQAN_ASSERT_EQ(representative(it), "GACG");
+        SEQAN_ASSERT(goUp(it));
+        SEQAN_ASSERT_EQ(representative(it), "ACG");
+    }
+    {
+        TIter it(index);
+        SEQAN_ASSERT(goDown(it, "ACG", Fwd()));
+        SEQAN_ASSERT(goDown(it, "CG", Rev()));
+        SEQAN_ASSERT_EQ(representative(it), "CGACG");
+        SEQAN_ASSERT_EQ(countOccurrences(it), 1u);
+        SEQAN_ASSERT_NOT(goDown(it, "G", Rev()));
+        goRoot(it);
+        SEQAN_ASSERT(isRoot(it));
+        SEQAN_ASSERT_EQ(countOccurrences(it), length(text) + 1);
+    }
+}
+
+// --------------------------------------------------------------------------
+// Test test_index_bifm_dfs
+// --------------------------------------------------------------------------
+
+SEQAN_DEFINE_TEST(test_index_bifm_dfs)
+{
+    typedef Index<DnaString, BidirectionalIndex<> >         TIndex;
+    typedef Iterator<TIndex, TopDown<ParentLinks<> > >::Type TIter;
+
+    DnaString text;
+    for (unsigned i = 0; i < 500; ++i)
+        appendValue(text, Dna((i * 7 + i / 13 + (i * i) % 5) % 4));
+
+    TIndex index(text);
+    TIter it(index);
+    DnaString pattern;
+
+    _testBidirectionalDfs(it, text, pattern, 6, Fwd());
+    SEQAN_ASSERT(isRoot(it));
+    _testBidirectionalDfs(it, text, pattern, 6, Rev());
+    SEQAN_ASSERT(isRoot(it));
+}
+
+// --------------------------------------------------------------------------
+// Test test_index_bifm_dfs_stringset
+// --------------------------------------------------------------------------
+
+SEQAN_DEFINE_TEST(test_index_bifm_dfs_stringset)
+{
+    typedef StringSet<DnaString>                            TText;
+    typedef Index<TText, BidirectionalIndex<> >             TIndex;
+    typedef Iterator<TIndex, TopDown<ParentLinks<> > >::Type TIter;
+
+    TText text;
+    appendValue(text, "ACGTTGCA");
+    appendValue(text, "TTGCAACG");
+
+    TIndex index(text);
+    TIter it(index);
+    DnaString pattern;
+
+    _testBidirectionalDfs(it, text, pattern, 5, Fwd());
+    _testBidirectionalDfs(it, text, pattern, 5, Rev());
+}
+
+// ==========================================================================
+// Test Suite
+// ==========================================================================
+
+SEQAN_BEGIN_TESTSUITE(test_index_bifm)
+{
+    SEQAN_CALL_TEST(test_index_bifm_extend);
+    SEQAN_CALL_TEST(test_index_bifm_dfs);
+    SEQAN_CALL_TEST(test_index_bifm_dfs_stringset);
+}
+SEQAN_END_TESTSUITE
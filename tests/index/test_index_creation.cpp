@@ -57,6 +57,8 @@ SEQAN_BEGIN_TESTSUITE(test_index)
     SEQAN_CALL_TEST(testIndexModifiedStringViewEsa);
     SEQAN_CALL_TEST(testIndexModifiedStringViewFM);
     SEQAN_CALL_TEST(testIssue519);
+    SEQAN_CALL_TEST(testIndexCreationSais);
+    SEQAN_CALL_TEST(testIndexCreationParallel);
     SEQAN_CALL_TEST(testIndexCreation);
 }
 SEQAN_END_TESTSUITE
@@ -126,6 +126,103 @@ SEQAN_DEFINE_TEST(testIssue519)
 //                  << suffix(getValue(strSet, getSeqNo(*iterSet)), getSeqOffset(*iterSet)) << std::endl;
 }
 
+SEQAN_DEFINE_TEST(testIndexCreationSais)
+{
+    DnaString text = "ACGTACGTTTACGAAAAAAAAAAAAAACCGTTTACGTACGTAC";
+    String<unsigned> sa1, sa2;
+    resize(sa1, length(text));
+    resize(sa2, length(text));
+
+    createSuffixArray(sa1, text, SAQSort());
+    createSuffixArray(sa2, text, Sais());
+    SEQAN_ASSERT_EQ(sa1, sa2);
+
+    StringSet<CharString> strSet;
+    appendValue(strSet, "bananamama");
+    appendValue(strSet, "");
+    appendValue(strSet, "bananajoe");
+    appendValue(strSet, "joesmama");
+    appendValue(strSet, "mama");
+    Index<StringSet<CharString>, IndexEsa<> > index1(strSet);
+    Index<StringSet<CharString>, IndexEsa<> > index2(strSet);
+
+    indexCreate(index1, EsaSA(), SAQSort());
+    indexCreate(index2, EsaSA(), Sais());
+    SEQAN_ASSERT_EQ(indexSA(index1), indexSA(index2));
+
+    // A longer text with repeats needs several levels of reduced problems.
+    CharString longText;
+    Rng<MersenneTwister> rng(42);
+    for (unsigned i = 0; i < 20000; ++i)
+        appendValue(longText, (i % 1000 < 300) ? 'a' + i % 7 : 'a' + pickRandomNumber(rng) % 4);
+    String<unsigned> sa3;
+    resize(sa3, length(longText));
+    createSuffixArray(sa3, longText, Sais());
+    SEQAN_ASSERT(isSuffixArray(sa3, longText));
+
+    // The same for a StringSet with empty and equal strings.
+    StringSet<DnaString, Owner<ConcatDirect<> > > dnaSet;
+    for (unsigned i = 0; i < 40; ++i)
+    {
+        DnaString str;
+        for (unsigned j = 0; j < (i % 5) * 200; ++j)
+            appendValue(str, Dna((j % 100 < 30) ? j % 3 : pickRandomNumber(rng) % 4));
+        appendValue(dnaSet, str);
+        if (i % 10 == 0)
+            appendValue(dnaSet, str);
+    }
+    String<Pair<unsigned, unsigned, Pack> > sa4, sa5;
+    resize(sa4, lengthSum(dnaSet));
+    resize(sa5, lengthSum(dnaSet));
+    createSuffixArray(sa4, dnaSet, SAQSort());
+    createSuffixArray(sa5, dnaSet, Sais());
+    SEQAN_ASSERT(sa4 == sa5);
+
+    // In-memory strings and all StringSets use Sais as the default of the FM index.
+    typedef DefaultIndexCreator<Index<DnaString, FMIndex<> >, FibreSA>::Type TStringCreator;
+    typedef DefaultIndexCreator<Index<StringSet<DnaString>, FMIndex<> >, FibreSA>::Type TStringSetCreator;
+    typedef DefaultIndexCreator<Index<String<Dna, External<> >, FMIndex<> >, FibreSA>::Type TExternalCreator;
+    SEQAN_STATIC_ASSERT_MSG((IsSameType<TStringCreator, Sais>::VALUE), "Strings must default to Sais.");
+    SEQAN_STATIC_ASSERT_MSG((IsSameType<TStringSetCreator, Sais>::VALUE), "StringSets must default to Sais.");
+    SEQAN_STATIC_ASSERT_MSG((IsSameType<TExternalCreator, Skew7>::VALUE), "External strings must default to Skew7.");
+}
+
+SEQAN_DEFINE_TEST(testIndexCreationParallel)
+{
+    // Let the large groups be split among several threads.
+    int threads = omp_get_max_threads();
+    omp_set_num_threads(4);
+
+    DnaString text;
+    for (unsigned i = 0; i < 20000; ++i)
+        appendValue(text, Dna((i * 7 + i / 13) % 4));
+    for (unsigned i = 0; i < 30000; ++i)
+        appendValue(text, Dna(i % 3));
+    String<unsigned> sa1, sa2;
+    resize(sa1, length(text));
+    resize(sa2, length(text));
+
+    createSuffixArray(sa1, text, Sais());
+    createSuffixArray(sa2, text, Parallel());
+    SEQAN_ASSERT_EQ(sa1, sa2);
+
+    StringSet<CharString> strSet;
+    appendValue(strSet, "bananamama");
+    appendValue(strSet, "");
+    appendValue(strSet, "bananajoe");
+    appendValue(strSet, "joesmama");
+    appendValue(strSet, "mama");
+    appendValue(strSet, "bananamama");
+    Index<StringSet<CharString>, IndexEsa<> > index1(strSet);
+    Index<StringSet<CharString>, IndexEsa<> > index2(strSet);
+
+    indexCreate(index1, EsaSA(), SAQSort());
+    indexCreate(index2, EsaSA(), Parallel());
+    SEQAN_ASSERT_EQ(indexSA(index1), indexSA(index2));
+
+    omp_set_num_threads(threads);
+}
+
 SEQAN_DEFINE_TEST(testIndexCreation)
 {
     typedef String<char>        TText;
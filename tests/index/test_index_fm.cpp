@@ -65,6 +65,14 @@ struct SmallLVFMIndexConfig : FMIndexConfig<TSpec, TLengthSum>
     typedef Naive<TSpec, RDConfig<LengthSum> >          Sentinels;
 };
 
+template <typename TSpec = void, typename TLengthSum = size_t>
+struct EprFMIndexConfig : FMIndexConfig<TSpec, TLengthSum>
+{
+    typedef TLengthSum                                  LengthSum;
+    typedef Epr<TSpec, EprRDConfig<LengthSum> >         Bwt;
+    typedef Naive<TSpec, RDConfig<LengthSum> >          Sentinels;
+};
+
 // --------------------------------------------------------------------------
 // FMIndex Specs
 // --------------------------------------------------------------------------
@@ -72,6 +80,8 @@ struct SmallLVFMIndexConfig : FMIndexConfig<TSpec, TLengthSum>
 typedef FMIndex<void, WTFMIndexConfig<> >       WTFMIndex;
 typedef FMIndex<void, SmallWTFMIndexConfig<> >  SmallWTFMIndex;
 typedef FMIndex<void, SmallLVFMIndexConfig<> >  SmallLVFMIndex;
+typedef FMIndex<void, EprFMIndexConfig<> >      EprFMIndex;
+typedef FMIndex<void, EprFMIndexConfig<void, __uint32> >    SmallEprFMIndex;
 
 // --------------------------------------------------------------------------
 // FMIndex Types
@@ -82,8 +92,11 @@ typedef
     TagList<Index<CharString, WTFMIndex>,
     TagList<Index<StringSet<CharString>, WTFMIndex>,
     TagList<Index<StringSet<CharString>, SmallWTFMIndex>,
-    TagList<Index<StringSet<DnaString>, SmallLVFMIndex>
-    > > > > >
+    TagList<Index<StringSet<DnaString>, SmallLVFMIndex>,
+    TagList<Index<DnaString, EprFMIndex>,
+    TagList<Index<StringSet<DnaString>, EprFMIndex>,
+    TagList<Index<StringSet<DnaString>, SmallEprFMIndex>
+    > > > > > > > >
     FMIndexTypes2;
 
 // ========================================================================== 
@@ -174,6 +187,28 @@ SEQAN_TYPED_TEST(CSATest, IndexSA)
 // Test getValue()
 // --------------------------------------------------------------------------
 
+// --------------------------------------------------------------------------
+// Test indexCreate(Parallel)
+// --------------------------------------------------------------------------
+
+SEQAN_TYPED_TEST(CSATest, Parallel)
+{
+    typedef typename TestFixture::TIndex                TIndex;
+    typedef typename Size<typename TestFixture::TFibre>::Type   TSize;
+
+    TIndex index(this->text);
+    indexCreate(index, FibreSALF(), Parallel());
+
+    SEQAN_ASSERT_EQ(length(indexSA(index)), length(this->fibre));
+    for (TSize pos = 0; pos < length(this->fibre); ++pos)
+    {
+        SEQAN_ASSERT_EQ(indexSA(index)[pos], this->fibre[pos]);
+        SEQAN_ASSERT_EQ(isSentinel(indexLF(index), pos), isSentinel(indexLF(this->index), pos));
+        if (!isSentinel(indexLF(index), pos))
+            SEQAN_ASSERT_EQ(getValue(indexLF(index).bwt, pos), getValue(indexLF(this->index).bwt, pos));
+    }
+}
+
 // --------------------------------------------------------------------------
 // Test begin() and end()
 // --------------------------------------------------------------------------
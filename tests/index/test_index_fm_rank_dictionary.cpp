@@ -69,6 +69,8 @@ typedef
     TagList<RankDictionary<bool,            Levels<> >,
     TagList<RankDictionary<Dna,             Levels<> >,
     TagList<RankDictionary<char,            Levels<> >,
+    TagList<RankDictionary<Dna,             Epr<> >,
+    TagList<RankDictionary<Dna,             Epr<void, EprRDConfig<unsigned> > >,
     TagList<RankDictionary<Dna,             WaveletTree<> >,
     TagList<RankDictionary<Dna5,            WaveletTree<> >,
     TagList<RankDictionary<DnaQ,            WaveletTree<> >,
@@ -76,7 +78,7 @@ typedef
     TagList<RankDictionary<AminoAcid,       WaveletTree<> >,
     TagList<RankDictionary<char,            WaveletTree<> >,
     TagList<RankDictionary<unsigned char,   WaveletTree<> >
-    > > > > > > > > > > >
+    > > > > > > > > > > > > >
     RankDictionaryTypes;
 
 // ========================================================================== 
@@ -198,6 +200,39 @@ SEQAN_TYPED_TEST(RankDictionaryTest, GetRank)
     }
 }
 
+// ----------------------------------------------------------------------------
+// Test getRank() across superblocks
+// ----------------------------------------------------------------------------
+// With two levels the Epr blocks store counts relative to superblocks of 2^16 blocks.
+
+SEQAN_TEST(RankDictionaryEprTest, GetRankSuperBlocks)
+{
+    typedef RankDictionary<Dna, Epr<void, EprRDConfig<__uint64, Alloc<OverAligned>, 2> > > TRankDict;
+    typedef Size<TRankDict>::Type                                                         TSize;
+
+    TSize superBlockSize = TRankDict::_VALUES_PER_BLOCK * TRankDict::_BLOCKS_PER_SUPERBLOCK;
+
+    DnaString text;
+    Rng<MersenneTwister> rng(42);
+    resize(text, 2 * superBlockSize + 1000);
+    for (TSize i = 0; i < length(text); ++i)
+        text[i] = Dna(pickRandomNumber(rng) % 4);
+
+    TRankDict dict(text);
+    SEQAN_ASSERT_EQ(length(dict.superBlocks), 3u);
+
+    // Check all positions around both superblock boundaries.
+    String<TSize> prefixSum;
+    resize(prefixSum, 4, 0);
+    for (TSize i = 0; i < length(text); ++i)
+    {
+        prefixSum[ordValue(text[i])]++;
+        if (i % superBlockSize < 1000 || i % superBlockSize >= superBlockSize - 1000)
+            for (unsigned c = 0; c < 4; ++c)
+                SEQAN_ASSERT_EQ(getRank(dict, i, Dna(c)), prefixSum[c]);
+    }
+}
+
 // ----------------------------------------------------------------------------
 // Test setValue()
 // ----------------------------------------------------------------------------
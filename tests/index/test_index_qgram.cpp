@@ -61,5 +61,8 @@ SEQAN_BEGIN_TESTSUITE(test_index)
 	SEQAN_CALL_TEST(testUngappedQGramIndex);
 	SEQAN_CALL_TEST(testUngappedQGramIndexMulti);
 	SEQAN_CALL_TEST(testQGramFind);
+	SEQAN_CALL_TEST(testMinimizerQGramIndex);
+	SEQAN_CALL_TEST(testMinimizerQGramIndexReverseComplement);
+	SEQAN_CALL_TEST(testQGramIndexParallel);
 }
 SEQAN_END_TESTSUITE
@@ -344,6 +344,228 @@ SEQAN_DEFINE_TEST(testQGramFind)
 
 //////////////////////////////////////////////////////////////////////////////
 
+template <typename TIndex, typename TText>
+void testQGramIndexParallel(TText const & text, unsigned stepSize)
+{
+    typedef typename Fibre<TIndex, QGramSA>::Type   TSA;
+    typedef typename Fibre<TIndex, QGramShape>::Type TShape;
+    typedef typename Value<TSA>::Type               TSAValue;
+
+    TIndex serialIndex(text);
+    TIndex parallelIndex(text);
+    setStepSize(serialIndex, stepSize);
+    setStepSize(parallelIndex, stepSize);
+
+    indexCreate(serialIndex, QGramSADir());
+    indexCreate(parallelIndex, QGramSADir(), Parallel());
+    SEQAN_ASSERT_EQ(length(indexSA(serialIndex)), length(indexSA(parallelIndex)));
+
+    // Open addressing buckets depend on the insertion order, thus compare the occurrences of each q-gram.
+    TShape shape = indexShape(serialIndex);
+    for (unsigned i = 0; i < length(indexSA(serialIndex)); ++i)
+    {
+        TSAValue pos = indexSA(serialIndex)[i];
+        hash(shape, begin(suffix(text, pos), Standard()));
+        SEQAN_ASSERT(getOccurrences(serialIndex, shape) == getOccurrences(parallelIndex, shape));
+    }
+
+    TIndex dirIndex(text);
+    setStepSize(dirIndex, stepSize);
+    indexCreate(dirIndex, QGramDir(), Parallel());
+    SEQAN_ASSERT_EQ(back(indexDir(dirIndex)), length(indexSA(serialIndex)));
+}
+
+SEQAN_DEFINE_TEST(testQGramIndexParallel)
+{
+    DnaString text;
+    generateText(text, 50000);
+
+    StringSet<DnaString> texts;
+    for (unsigned i = 0; i < 50; ++i)
+        appendValue(texts, infix(text, i * 1000, i * 1000 + 300 + i * 10));
+
+    testQGramIndexParallel<Index<DnaString, IndexQGram<UngappedShape<6> > > >(text, 1);
+    testQGramIndexParallel<Index<DnaString, IndexQGram<UngappedShape<6> > > >(text, 3);
+    testQGramIndexParallel<Index<DnaString, IndexQGram<UngappedShape<10>, OpenAddressing> > >(text, 1);
+    testQGramIndexParallel<Index<DnaString, IndexQGram<MinimizerShape<10, 6> > > >(text, 1);
+    testQGramIndexParallel<Index<StringSet<DnaString>, IndexQGram<UngappedShape<6> > > >(texts, 1);
+    testQGramIndexParallel<Index<StringSet<DnaString>, IndexQGram<UngappedShape<6> > > >(texts, 4);
+    testQGramIndexParallel<Index<StringSet<DnaString>, IndexQGram<UngappedShape<10>, OpenAddressing> > >(texts, 1);
+}
+
+template <typename TText, typename TShape>
+__uint64 _naiveKmerHash(TShape & kmerShape, TText const & text, unsigned pos, False)
+{
+    return hash(kmerShape, begin(text, Standard()) + pos);
+}
+
+template <typename TText, typename TShape>
+__uint64 _naiveKmerHash(TShape & kmerShape, TText const & text, unsigned pos, True)
+{
+    DnaString kmer = infix(text, pos, pos + weight(kmerShape));
+    __uint64 fwdHash = hash(kmerShape, begin(kmer, Standard()));
+    reverseComplement(kmer);
+    return std::min(fwdHash, (__uint64)hash(kmerShape, begin(kmer, Standard())));
+}
+
+template <typename TText, typename TShape, typename TPositions, typename TCanonical>
+void _naiveMinimizers(TPositions & positions, TText const & text, TShape const & shape, TCanonical)
+{
+    Shape<Dna, UngappedShape<WEIGHT<TShape>::VALUE> > kmerShape;
+    unsigned windowSize = length(shape) - weight(shape) + 1;
+
+    for (unsigned windowPos = 0; windowPos + length(shape) <= length(text); ++windowPos)
+    {
+        unsigned minPos = windowPos;
+        __uint64 minHash = _naiveKmerHash(kmerShape, text, windowPos, TCanonical());
+        for (unsigned kmerPos = windowPos + 1; kmerPos < windowPos + windowSize; ++kmerPos)
+        {
+            __uint64 hValue = _naiveKmerHash(kmerShape, text, kmerPos, TCanonical());
+            if (hValue < minHash)
+            {
+                minHash = hValue;
+                minPos = kmerPos;
+            }
+        }
+        if (empty(positions) || back(positions) != minPos)
+            appendValue(positions, minPos);
+    }
+}
+
+template <typename TText, typename TShape, typename TPositions>
+void _naiveMinimizers(TPositions & positions, TText const & text, TShape const & shape)
+{
+    _naiveMinimizers(positions, text, shape, False());
+}
+
+SEQAN_DEFINE_TEST(testMinimizerQGramIndex)
+{
+    typedef MinimizerShape<20, 8>                               TShapeSpec;
+    typedef Index<DnaString, IndexQGram<TShapeSpec, MinimizerSampling> > TIndex;
+    typedef Index<StringSet<DnaString>, IndexQGram<TShapeSpec, MinimizerSampling> > TSetIndex;
+    typedef Fibre<TIndex, FibreSA>::Type                        TSA;
+    typedef Fibre<TSetIndex, FibreSA>::Type                     TSetSA;
+
+    DnaString text;
+    generateText(text, 20000);
+
+    // The sampled positions are the leftmost smallest k-mers of all windows.
+    TIndex index(text);
+    indexRequire(index, QGramSADir());
+
+    String<unsigned> positions;
+    _naiveMinimizers(positions, text, indexShape(index));
+    SEQAN_ASSERT_EQ(length(indexSA(index)), length(positions));
+    SEQAN_ASSERT_LT(length(indexSA(index)), length(text) / 4);
+
+    TSA sa = indexSA(index);
+    std::sort(begin(sa, Standard()), end(sa, Standard()));
+    SEQAN_ASSERT(sa == positions);
+
+    // Each sampled position is stored in the bucket of its k-mer.
+    Shape<Dna, UngappedShape<8> > kmerShape;
+    for (unsigned i = 0; i < length(positions); ++i)
+    {
+        hash(kmerShape, begin(text, Standard()) + positions[i]);
+        Infix<TSA const>::Type occs = getOccurrences(index, kmerShape);
+        SEQAN_ASSERT(std::find(begin(occs, Standard()), end(occs, Standard()), positions[i]) != end(occs, Standard()));
+    }
+
+    // Patterns are found at their position.
+    String<unsigned> candidates;
+    for (unsigned patternPos = 0; patternPos + 200 <= length(text); patternPos += 997)
+    {
+        getCandidates(candidates, index, infix(text, patternPos, patternPos + 200));
+        SEQAN_ASSERT(std::binary_search(begin(candidates, Standard()), end(candidates, Standard()), patternPos));
+
+        getCandidates(candidates, index, infix(text, patternPos, patternPos + 200), 5u);
+        SEQAN_ASSERT(std::binary_search(begin(candidates, Standard()), end(candidates, Standard()), patternPos));
+    }
+
+    // Patterns shorter than the window have no minimizers.
+    getCandidates(candidates, index, infix(text, 0, 19));
+    SEQAN_ASSERT(empty(candidates));
+
+    // Multiple sequences.
+    StringSet<DnaString> texts;
+    appendValue(texts, infix(text, 0, 7000));
+    appendValue(texts, infix(text, 7000, 7010));
+    appendValue(texts, infix(text, 7010, 20000));
+
+    TSetIndex setIndex(texts);
+    indexRequire(setIndex, QGramSADir());
+
+    TSetSA setSa = indexSA(setIndex);
+    std::sort(begin(setSa, Standard()), end(setSa, Standard()));
+
+    String<unsigned> setPositions;
+    for (unsigned seqNo = 0; seqNo < length(texts); ++seqNo)
+    {
+        clear(setPositions);
+        _naiveMinimizers(setPositions, texts[seqNo], indexShape(setIndex));
+        for (unsigned i = 0; i < length(setPositions); ++i)
+            SEQAN_ASSERT(std::binary_search(begin(setSa, Standard()), end(setSa, Standard()),
+                                            Pair<unsigned, unsigned>(seqNo, setPositions[i])));
+    }
+
+    String<Pair<unsigned, unsigned> > setCandidates;
+    getCandidates(setCandidates, setIndex, infix(texts[2], 500, 700));
+    SEQAN_ASSERT(std::binary_search(begin(setCandidates, Standard()), end(setCandidates, Standard()),
+                                    Pair<unsigned, unsigned>(2, 500)));
+}
+
+SEQAN_DEFINE_TEST(testMinimizerQGramIndexReverseComplement)
+{
+    typedef MinimizerShape<20, 8, ReverseComplement>            TShapeSpec;
+    typedef Index<DnaString, IndexQGram<TShapeSpec, MinimizerSampling> > TIndex;
+    typedef Fibre<TIndex, FibreSA>::Type                        TSA;
+
+    DnaString text;
+    generateText(text, 20000);
+
+    // The sampled positions are the leftmost smallest canonical k-mers of all windows.
+    TIndex index(text);
+    indexRequire(index, QGramSADir());
+
+    String<unsigned> positions;
+    _naiveMinimizers(positions, text, indexShape(index), True());
+    SEQAN_ASSERT_EQ(length(indexSA(index)), length(positions));
+
+    TSA sa = indexSA(index);
+    std::sort(begin(sa, Standard()), end(sa, Standard()));
+    SEQAN_ASSERT(sa == positions);
+
+    // Both strands share their minimizers, only the leftmost ones of ties differ.
+    DnaString rcText = text;
+    reverseComplement(rcText);
+    TIndex rcIndex(rcText);
+    indexRequire(rcIndex, QGramSADir());
+    TSA rcPositions = indexSA(rcIndex);
+
+    Shape<Dna, UngappedShape<8> > kmerShape;
+    String<__uint64> minimizers, rcMinimizers;
+    for (unsigned i = 0; i < length(positions); ++i)
+        appendValue(minimizers, _naiveKmerHash(kmerShape, text, positions[i], True()));
+    for (unsigned i = 0; i < length(rcPositions); ++i)
+        appendValue(rcMinimizers, _naiveKmerHash(kmerShape, rcText, rcPositions[i], True()));
+    std::sort(begin(minimizers, Standard()), end(minimizers, Standard()));
+    std::sort(begin(rcMinimizers, Standard()), end(rcMinimizers, Standard()));
+    resize(minimizers, std::unique(begin(minimizers, Standard()), end(minimizers, Standard())) -
+                       begin(minimizers, Standard()));
+    resize(rcMinimizers, std::unique(begin(rcMinimizers, Standard()), end(rcMinimizers, Standard())) -
+                         begin(rcMinimizers, Standard()));
+    SEQAN_ASSERT(minimizers == rcMinimizers);
+
+    String<unsigned> candidates;
+    for (unsigned patternPos = 0; patternPos + 200 <= length(text); patternPos += 997)
+    {
+        getCandidates(candidates, index, infix(text, patternPos, patternPos + 200));
+        SEQAN_ASSERT(std::binary_search(begin(candidates, Standard()), end(candidates, Standard()), patternPos));
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 
 } //namespace SEQAN_NAMESPACE_MAIN
 
@@ -47,6 +47,7 @@
 #include "test_parallel_splitting.h"
 #include "test_parallel_algorithms.h"
 #include "test_parallel_queue.h"
+#include "test_parallel_thread_pool.h"
 
 SEQAN_BEGIN_TESTSUITE(test_parallel) {
 #if defined(_OPENMP)
@@ -79,11 +80,21 @@ SEQAN_BEGIN_TESTSUITE(test_parallel) {
     SEQAN_CALL_TEST(test_parallel_splitting_compute_splitters);
     SEQAN_CALL_TEST(test_parallel_sum);
     SEQAN_CALL_TEST(test_parallel_partial_sum);
+    SEQAN_CALL_TEST(test_parallel_sort);
+    SEQAN_CALL_TEST(test_parallel_stable_sort);
+    SEQAN_CALL_TEST(test_parallel_radix_sort);
 
     // Tests for parallel queue.
     SEQAN_CALL_TEST(test_parallel_queue_simple);
     SEQAN_CALL_TEST(test_parallel_queue_resize);
     SEQAN_CALL_TEST(test_parallel_queue_non_pod);
+    SEQAN_CALL_TEST(test_parallel_queue_lockfree_simple);
+
+    // Tests for thread pool.
+    SEQAN_CALL_TEST(test_parallel_thread_pool_spawn);
+    SEQAN_CALL_TEST(test_parallel_thread_pool_parallel_for);
+    SEQAN_CALL_TEST(test_parallel_thread_pool_parallel_reduce);
+    SEQAN_CALL_TEST(test_parallel_thread_pool_explicit);
 
 #if defined(_OPENMP) || defined(SEQAN_CXX11_STANDARD)
 #ifdef SEQAN_CXX11_STL
@@ -97,6 +108,7 @@ SEQAN_BEGIN_TESTSUITE(test_parallel) {
         SEQAN_CALL_TEST(test_parallel_queue_spmc_fixedsize);
         SEQAN_CALL_TEST(test_parallel_queue_spmc_dynamicsize);
         SEQAN_CALL_TEST(test_parallel_queue_mpsc_fixedsize);
+        SEQAN_CALL_TEST(test_parallel_queue_lockfree_mpmc);
 //        SEQAN_CALL_TEST(test_parallel_queue_mpsc_dynamicsize);
 //        SEQAN_CALL_TEST(test_parallel_queue_mpmc_fixedsize);
 //        SEQAN_CALL_TEST(test_parallel_queue_mpmc_dynamicsize);
@@ -40,6 +40,7 @@
 #include <seqan/basic.h>
 #include <seqan/sequence.h>
 #include <seqan/parallel.h>
+#include <seqan/random.h>
 
 template <typename T1, typename T2>
 void compare(T1 &t1, T2 &t2)
@@ -119,4 +120,167 @@ SEQAN_DEFINE_TEST(test_parallel_partial_sum)
     SEQAN_ASSERT_EQ(sum1, ints);
 }
 
+template <typename TString>
+void _fillRandom(TString & str, unsigned len, unsigned seed)
+{
+    typedef typename seqan::Value<TString>::Type TValue;
+
+    seqan::Rng<seqan::MersenneTwister> rng(seed);
+    resize(str, len);
+    for (unsigned i = 0; i < len; ++i)
+        str[i] = static_cast<TValue>(pickRandomNumber(rng) % (len / 4 + 1)) - static_cast<TValue>(len / 8);
+}
+
+struct TestParallelLessI1_
+{
+    template <typename TPair>
+    bool operator()(TPair const & a, TPair const & b) const
+    {
+        return a.i1 < b.i1;
+    }
+};
+
+SEQAN_DEFINE_TEST(test_parallel_sort)
+{
+    // Sizes around the number of threads, and a large one.
+    for (unsigned len = 0; len < 300000; len = len * 7 + 1)
+    {
+        seqan::String<int> ints, expected;
+        _fillRandom(ints, len, len);
+        expected = ints;
+
+        std::sort(begin(expected, seqan::Standard()), end(expected, seqan::Standard()));
+        sort(ints, seqan::Parallel());
+        SEQAN_ASSERT_EQ(ints, expected);
+
+        std::sort(begin(expected, seqan::Standard()), end(expected, seqan::Standard()), std::greater<int>());
+        sort(ints, std::greater<int>(), seqan::Parallel());
+        SEQAN_ASSERT_EQ(ints, expected);
+    }
+
+    // Sort an infix.
+    seqan::String<int> ints, expected;
+    _fillRandom(ints, 10000, 1);
+    expected = ints;
+    std::sort(begin(expected, seqan::Standard()) + 100, begin(expected, seqan::Standard()) + 9000);
+    seqan::Infix<seqan::String<int> >::Type inf = infix(ints, 100, 9000);
+    sort(inf, seqan::Parallel());
+    SEQAN_ASSERT_EQ(ints, expected);
+
+    // Sort a packed string, whose neighbouring values share host words.
+    seqan::String<seqan::Dna, seqan::Packed<> > packed;
+    for (unsigned i = 0; i < 10000; ++i)
+        appendValue(packed, seqan::Dna((unsigned)ints[i] % 4));
+    seqan::DnaString expectedPacked = packed;
+    std::sort(begin(expectedPacked, seqan::Standard()), end(expectedPacked, seqan::Standard()));
+    sort(packed, seqan::Parallel());
+    SEQAN_ASSERT(packed == expectedPacked);
+
+    // Sort a StringSet.
+    seqan::StringSet<seqan::CharString> strings, expectedStrings;
+    for (unsigned i = 0; i < 1000; ++i)
+    {
+        std::stringstream ss;
+        ss << (i * 7919) % 1000;
+        appendValue(strings, ss.str());
+    }
+    expectedStrings = strings;
+    std::sort(begin(expectedStrings, seqan::Standard()), end(expectedStrings, seqan::Standard()));
+    sort(strings, seqan::Parallel());
+    for (unsigned i = 0; i < length(strings); ++i)
+        SEQAN_ASSERT_EQ(strings[i], expectedStrings[i]);
+}
+
+SEQAN_DEFINE_TEST(test_parallel_stable_sort)
+{
+    typedef seqan::Pair<int, unsigned> TPair;
+
+    for (unsigned len = 0; len < 300000; len = len * 7 + 1)
+    {
+        seqan::String<int> keys;
+        _fillRandom(keys, len, len + 1);
+
+        seqan::String<TPair> pairs, expected;
+        for (unsigned i = 0; i < len; ++i)
+            appendValue(pairs, TPair(keys[i], i));
+        expected = pairs;
+
+        std::stable_sort(begin(expected, seqan::Standard()), end(expected, seqan::Standard()), TestParallelLessI1_());
+        stableSort(pairs, TestParallelLessI1_(), seqan::Parallel());
+        SEQAN_ASSERT(pairs == expected);
+    }
+}
+
+SEQAN_DEFINE_TEST(test_parallel_radix_sort)
+{
+    for (unsigned len = 0; len < 300000; len = len * 7 + 1)
+    {
+        // Signed integers.
+        seqan::String<int> ints, expectedInts;
+        _fillRandom(ints, len, len);
+        expectedInts = ints;
+        std::sort(begin(expectedInts, seqan::Standard()), end(expectedInts, seqan::Standard()));
+        radixSort(ints, seqan::Parallel());
+        SEQAN_ASSERT_EQ(ints, expectedInts);
+
+        // 64 bit integers.
+        seqan::String<__uint64> longs, expectedLongs;
+        _fillRandom(longs, len, len + 1);
+        for (unsigned i = 0; i < len; ++i)
+            longs[i] *= 1000000007ull;
+        expectedLongs = longs;
+        std::sort(begin(expectedLongs, seqan::Standard()), end(expectedLongs, seqan::Standard()));
+        radixSort(longs);
+        SEQAN_ASSERT_EQ(longs, expectedLongs);
+
+        // Pairs, in a packed string.
+        typedef seqan::Pair<unsigned, __int16, seqan::Pack> TPair;
+        seqan::String<TPair> pairs, expectedPairs;
+        _fillRandom(ints, len, len + 2);
+        for (unsigned i = 0; i < len; ++i)
+            appendValue(pairs, TPair(ints[i] & 0xff, (__int16)(ints[i] >> 8)));
+        expectedPairs = pairs;
+        std::sort(begin(expectedPairs, seqan::Standard()), end(expectedPairs, seqan::Standard()));
+        radixSort(pairs, seqan::Parallel());
+        SEQAN_ASSERT(pairs == expectedPairs);
+    }
+
+    // Packed string.
+    seqan::String<unsigned char, seqan::Packed<> > packed, expectedPacked;
+    seqan::Rng<seqan::MersenneTwister> rng(42);
+    for (unsigned i = 0; i < 10000; ++i)
+        appendValue(packed, pickRandomNumber(rng) % 256);
+    seqan::String<unsigned char> tmp = packed;
+    std::sort(begin(tmp, seqan::Standard()), end(tmp, seqan::Standard()));
+    expectedPacked = tmp;
+    radixSort(packed, seqan::Parallel());
+    SEQAN_ASSERT(packed == expectedPacked);
+
+    // StringSets, each string is sorted on its own.
+    seqan::StringSet<seqan::String<int> > owner, expectedOwner;
+    seqan::String<int> ints;
+    for (unsigned i = 0; i < 100; ++i)
+    {
+        _fillRandom(ints, i * 37 % 1000, i);
+        appendValue(owner, ints);
+        std::sort(begin(ints, seqan::Standard()), end(ints, seqan::Standard()));
+        appendValue(expectedOwner, ints);
+    }
+    seqan::StringSet<seqan::String<int>, seqan::Owner<seqan::ConcatDirect<> > > concat = owner;
+    seqan::StringSet<seqan::String<int> > few;
+    appendValue(few, owner[1]);
+    appendValue(few, owner[2]);
+
+    radixSort(owner, seqan::Parallel());
+    radixSort(concat);
+    radixSort(few, seqan::Parallel());
+    for (unsigned i = 0; i < 100; ++i)
+    {
+        SEQAN_ASSERT_EQ(owner[i], expectedOwner[i]);
+        SEQAN_ASSERT_EQ(concat[i], expectedOwner[i]);
+    }
+    SEQAN_ASSERT_EQ(few[0], expectedOwner[1]);
+    SEQAN_ASSERT_EQ(few[1], expectedOwner[2]);
+}
+
 #endif  // TEST_PARALLEL_TEST_PARALLEL_ALGORITHMS_H_
@@ -309,4 +309,113 @@ SEQAN_DEFINE_TEST(test_parallel_queue_mpmc_fixedsize)
     testMPMCQueue<seqan::Limit, seqan::Parallel, seqan::Parallel>(30u);
 }
 
+SEQAN_DEFINE_TEST(test_parallel_queue_lockfree_simple)
+{
+    typedef seqan::ConcurrentQueue<int, seqan::Suspendable<seqan::LockFree> > TQueue;
+
+    // the queue never grows, try all offsets of the ring buffer
+    for (int ofs = 0; ofs < 5; ++ofs)
+    {
+        TQueue queue(3);
+        SEQAN_ASSERT_EQ(capacity(queue), 3u);
+
+        for (int i = 0; i < ofs; ++i)
+        {
+            int x = -1;
+            SEQAN_ASSERT(appendValue(queue, i));
+            SEQAN_ASSERT(tryPopFront(x, queue));
+            SEQAN_ASSERT_EQ(x, i);
+        }
+        SEQAN_ASSERT(empty(queue));
+
+        // without readers a full queue rejects values instead of blocking
+        for (int i = 0; i < 3; ++i)
+        {
+            SEQAN_ASSERT(appendValue(queue, 10 + i));
+            SEQAN_ASSERT_EQ(length(queue), (unsigned)(i + 1));
+        }
+        SEQAN_ASSERT_NOT(appendValue(queue, 13));
+        SEQAN_ASSERT(waitForMinSize(queue, 3u));
+
+        // without writers an empty queue returns false instead of blocking
+        for (int i = 0; i < 3; ++i)
+        {
+            int x = -1;
+            SEQAN_ASSERT(popFront(x, queue));
+            SEQAN_ASSERT_EQ(x, 10 + i);
+        }
+        int x = -1;
+        SEQAN_ASSERT_NOT(popFront(x, queue));
+        SEQAN_ASSERT(empty(queue));
+        SEQAN_ASSERT_NOT(waitForMinSize(queue, 1u));
+    }
+}
+
+SEQAN_DEFINE_TEST(test_parallel_queue_lockfree_mpmc)
+{
+    typedef seqan::ConcurrentQueue<unsigned, seqan::Suspendable<seqan::LockFree> > TQueue;
+
+    seqan::String<unsigned> random;
+    seqan::Rng<seqan::MersenneTwister> rng(0);
+
+    unsigned chkSum = 0;
+    resize(random, 100000);
+    for (unsigned i = 0; i < length(random); ++i)
+    {
+        random[i] = pickRandomNumber(rng);
+        chkSum ^= random[i];
+    }
+
+    // a small capacity suspends writers and readers alike
+    TQueue queue(7);
+    volatile unsigned chkSum2 = 0;
+    volatile unsigned count = 0;
+
+    size_t writerCount = 2;
+    size_t threadCount = 5;
+    setReaderWriterCount(queue, threadCount - writerCount, writerCount);
+    seqan::Splitter<unsigned> splitter(0, length(random), writerCount);
+
+#ifdef SEQAN_CXX11_STL
+    std::vector<std::thread> workers;
+    for (size_t tid = 0; tid < threadCount; ++tid)
+    {
+        workers.push_back(std::thread([&,tid]()
+        {
+#else
+    SEQAN_OMP_PRAGMA(parallel num_threads(threadCount))
+    {
+        size_t tid = omp_get_thread_num();
+#endif
+        if (tid < writerCount)
+        {
+            seqan::ScopedWriteLock<TQueue> writeLock(queue);
+            for (unsigned j = splitter[tid]; j != splitter[tid + 1]; ++j)
+                SEQAN_ASSERT(appendValue(queue, random[j]));
+        }
+        else
+        {
+            seqan::ScopedReadLock<TQueue> readLock(queue);
+            unsigned chkSumLocal = 0, val = 0, cnt = 0;
+            while (popFront(val, queue))
+            {
+                chkSumLocal ^= val;
+                ++cnt;
+            }
+            seqan::atomicXor(chkSum2, chkSumLocal);
+            seqan::atomicAdd(count, cnt);
+        }
+    }
+#ifdef SEQAN_CXX11_STL
+    ));
+    }
+    for (auto &t : workers)
+        t.join();
+#endif
+
+    SEQAN_ASSERT(empty(queue));
+    SEQAN_ASSERT_EQ(count, length(random));
+    SEQAN_ASSERT_EQ(chkSum, chkSum2);
+}
+
 #endif  // TEST_PARALLEL_TEST_PARALLEL_QUEUE_H_
@@ -0,0 +1,185 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2015, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: SeqAn Team <seqan-dev@lists.fu-berlin.de>
+// ==========================================================================
+// Tests for the work-stealing thread pool.
+// ==========================================================================
+
+#ifndef TEST_PARALLEL_TEST_PARALLEL_THREAD_POOL_H_
+#define TEST_PARALLEL_TEST_PARALLEL_THREAD_POOL_H_
+
+#include <seqan/basic.h>
+#include <seqan/sequence.h>
+#include <seqan/parallel.h>
+
+// Computes Fibonacci numbers by nested spawning.
+struct TestThreadPoolFib_
+{
+    seqan::ThreadPool *pool;
+    unsigned n;
+    unsigned *result;
+
+    void operator()()
+    {
+        if (n < 2)
+        {
+            *result = n;
+            return;
+        }
+
+        unsigned a = 0, b = 0;
+        TestThreadPoolFib_ left = { pool, n - 1, &a };
+        TestThreadPoolFib_ right = { pool, n - 2, &b };
+
+        seqan::TaskGroup group(*pool);
+        spawn(group, left);
+        right();
+        waitFor(group);
+        *result = a + b;
+    }
+};
+
+struct TestThreadPoolMark_
+{
+    seqan::String<unsigned> & marks;
+
+    TestThreadPoolMark_(seqan::String<unsigned> & marks) : marks(marks)
+    {}
+
+    void operator()(unsigned i)
+    {
+        seqan::atomicInc(marks[i]);
+    }
+};
+
+struct TestThreadPoolSquare_
+{
+    __uint64 operator()(unsigned i) const
+    {
+        return (__uint64)i * i;
+    }
+};
+
+struct TestThreadPoolPlus_
+{
+    __uint64 operator()(__uint64 a, __uint64 b) const
+    {
+        return a + b;
+    }
+};
+
+struct TestThreadPoolToString_
+{
+    seqan::CharString operator()(unsigned i) const
+    {
+        return seqan::CharString((char)('a' + i % 26));
+    }
+};
+
+struct TestThreadPoolConcat_
+{
+    seqan::CharString operator()(seqan::CharString a, seqan::CharString const & b) const
+    {
+        append(a, b);
+        return a;
+    }
+};
+
+SEQAN_DEFINE_TEST(test_parallel_thread_pool_spawn)
+{
+    seqan::ThreadPool pool(3);
+    unsigned result = 0;
+    TestThreadPoolFib_ fib = { &pool, 20, &result };
+    fib();
+    SEQAN_ASSERT_EQ(result, 6765u);
+}
+
+SEQAN_DEFINE_TEST(test_parallel_thread_pool_parallel_for)
+{
+    using namespace seqan;
+
+    // without workers, all tasks run in the calling thread
+    ThreadPool pool(0);
+    String<unsigned> marks;
+    resize(marks, 10000, 0u);
+    TestThreadPoolMark_ mark(marks);
+
+    parallelFor(pool, 0u, 10000u, mark);
+    for (unsigned i = 0; i < length(marks); ++i)
+        SEQAN_ASSERT_EQ(marks[i], 1u);
+
+    parallelFor(pool, 100u, 200u, mark, 1u);
+    parallelFor(pool, 300u, 300u, mark);
+    for (unsigned i = 0; i < length(marks); ++i)
+        SEQAN_ASSERT_EQ(marks[i], (100u <= i && i < 200u) ? 2u : 1u);
+}
+
+SEQAN_DEFINE_TEST(test_parallel_thread_pool_parallel_reduce)
+{
+    using namespace seqan;
+
+    ThreadPool pool(3);
+    TestThreadPoolSquare_ square;
+    TestThreadPoolPlus_ plus;
+    SEQAN_ASSERT_EQ(parallelReduce(pool, 0u, 100000u, (__uint64)0, square, plus), 333328333350000ull);
+    SEQAN_ASSERT_EQ(parallelReduce(pool, 5u, 5u, (__uint64)7, square, plus), 7ull);
+
+    // concatenation is not commutative
+    TestThreadPoolToString_ toString;
+    TestThreadPoolConcat_ concat;
+    CharString expected;
+    for (unsigned i = 0; i < 1000; ++i)
+        appendValue(expected, (char)('a' + i % 26));
+    SEQAN_ASSERT_EQ(parallelReduce(pool, 0u, 1000u, CharString(), toString, concat, 3u), expected);
+}
+
+SEQAN_DEFINE_TEST(test_parallel_thread_pool_explicit)
+{
+    using namespace seqan;
+
+    ThreadPool pool(3);
+    SEQAN_ASSERT_EQ(numThreads(pool), 4u);
+
+    String<unsigned> marks;
+    resize(marks, 1000, 0u);
+    TestThreadPoolMark_ mark(marks);
+    for (unsigned round = 0; round < 10; ++round)
+        parallelFor(pool, 0u, 1000u, mark, 7u);
+    for (unsigned i = 0; i < length(marks); ++i)
+        SEQAN_ASSERT_EQ(marks[i], 10u);
+
+    TestThreadPoolSquare_ square;
+    TestThreadPoolPlus_ plus;
+    SEQAN_ASSERT_EQ(parallelReduce(pool, 0u, 1000u, (__uint64)0, square, plus, 1u), 332833500ull);
+}
+
+#endif  // TEST_PARALLEL_TEST_PARALLEL_THREAD_POOL_H_
@@ -139,4 +139,92 @@ SEQAN_DEFINE_TEST(test_seq_io_genomic_fai_index_read_region)
     }
 }
 
+SEQAN_DEFINE_TEST(test_seq_io_genomic_fai_index_read_region_parallel)
+{
+    seqan::CharString filePath = SEQAN_PATH_TO_ROOT();
+    append(filePath, "/tests/seq_io/adeno_genome.fa");
+
+    seqan::FaiIndex faiIndex;
+    SEQAN_ASSERT_EQ(open(faiIndex, toCString(filePath)), true);
+
+    seqan::Dna5String seq;
+    readSequence(seq, faiIndex, 0);
+    SEQAN_ASSERT_EQ(length(seq), 4718u);
+
+    // Read many overlapping regions concurrently from the same index.
+    int const numRegions = 1000;
+    seqan::String<seqan::Dna5String> regions;
+    resize(regions, numRegions);
+
+    SEQAN_OMP_PRAGMA(parallel for)
+    for (int i = 0; i < numRegions; ++i)
+        readRegion(regions[i], faiIndex, 0, (i * 37) % 4718, (i * 37) % 4718 + i % 150);
+
+    for (int i = 0; i < numRegions; ++i)
+    {
+        unsigned beginPos = (i * 37) % 4718;
+        unsigned endPos = std::min(beginPos + i % 150, 4718u);
+        SEQAN_ASSERT_EQ(regions[i], infix(seq, beginPos, endPos));
+    }
+}
+
+SEQAN_DEFINE_TEST(test_seq_io_genomic_fai_index_bgzf)
+{
+    seqan::CharString filePath = SEQAN_PATH_TO_ROOT();
+    append(filePath, "/tests/seq_io/adeno_genome.fa");
+
+    // Compress the FASTA file with BGZF, using small blocks to get more than one of them.
+    seqan::CharString bgzfPath = SEQAN_TEMP_FILENAME();
+    append(bgzfPath, ".fa.gz");
+    {
+        std::ifstream in(toCString(filePath), std::ios::binary | std::ios::in);
+        std::ofstream file(toCString(bgzfPath), std::ios::binary | std::ios::out);
+        seqan::VirtualStream<char, seqan::Output> out;
+        SEQAN_ASSERT(open(out, file, seqan::BgzfFile()));
+        char buffer[1000];
+        while (in.read(buffer, sizeof(buffer)) || in.gcount() != 0)
+        {
+            out.write(buffer, in.gcount());
+            out.flush();
+        }
+        close(out);
+    }
+
+    seqan::FaiIndex plainIndex;
+    SEQAN_ASSERT_EQ(open(plainIndex, toCString(filePath)), true);
+
+    // Build the FAI and GZI index and compare with the uncompressed file.
+    {
+        seqan::FaiIndex faiIndex;
+        SEQAN_ASSERT_EQ(build(faiIndex, toCString(bgzfPath)), true);
+        SEQAN_ASSERT_GT(length(faiIndex.gziIndex), 2u);
+        SEQAN_ASSERT_EQ(numSeqs(faiIndex), 2u);
+        SEQAN_ASSERT_EQ(sequenceLength(faiIndex, 0), 4718u);
+        SEQAN_ASSERT_EQ(faiIndex.indexEntryStore[0].offset, plainIndex.indexEntryStore[0].offset);
+        SEQAN_ASSERT_EQ(faiIndex.indexEntryStore[1].offset, plainIndex.indexEntryStore[1].offset);
+        SEQAN_ASSERT_EQ(save(faiIndex), true);
+    }
+
+    // Load the saved GZI, then scan the block headers if it is missing.
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        seqan::FaiIndex faiIndex;
+        SEQAN_ASSERT_EQ(open(faiIndex, toCString(bgzfPath)), true);
+
+        seqan::Dna5String expected, str;
+        for (unsigned beginPos = 0; beginPos < 4718u; beginPos += 331)
+        {
+            readRegion(expected, plainIndex, 0, beginPos, beginPos + 1200);
+            readRegion(str, faiIndex, 0, beginPos, beginPos + 1200);
+            SEQAN_ASSERT_EQ(str, expected);
+        }
+        readRegion(str, faiIndex, 1, 0, 8);
+        SEQAN_ASSERT_EQ(str, "CGATCGAT");
+
+        seqan::CharString gziPath = bgzfPath;
+        append(gziPath, ".gzi");
+        std::remove(toCString(gziPath));
+    }
+}
+
 #endif  // #ifndef TESTS_SEQ_IO_TEST_FAI_INDEX_H_
@@ -36,6 +36,7 @@
 #include <seqan/stream.h>
 
 #include <seqan/seq_io.h>
+#include <seqan/random.h>
 
 #include "test_seq_io_generic.h"
 #include "test_stream_write_fasta.h"
@@ -60,6 +61,7 @@ SEQAN_BEGIN_TESTSUITE(test_seq_io)
     // Test reading with different interfaces.
     SEQAN_CALL_TEST(test_seq_io_sequence_file_read_record_text_fasta);
     SEQAN_CALL_TEST(test_seq_io_sequence_file_read_all_text_fasta);
+    SEQAN_CALL_TEST(test_seq_io_sequence_file_read_all_parallel);
 
     // Test writing with different interfaces.
     SEQAN_CALL_TEST(test_seq_io_sequence_file_write_record_text_fasta);
@@ -85,6 +87,8 @@ SEQAN_BEGIN_TESTSUITE(test_seq_io)
     SEQAN_CALL_TEST(test_seq_io_genomic_fai_index_read);
     SEQAN_CALL_TEST(test_seq_io_genomic_fai_index_read_sequence);
     SEQAN_CALL_TEST(test_seq_io_genomic_fai_index_read_region);
+    SEQAN_CALL_TEST(test_seq_io_genomic_fai_index_read_region_parallel);
+    SEQAN_CALL_TEST(test_seq_io_genomic_fai_index_bgzf);
 
     // Tests for EMBL
     SEQAN_CALL_TEST(test_stream_read_embl_single_char_array_stream);
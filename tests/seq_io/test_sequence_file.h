@@ -169,6 +169,121 @@ SEQAN_DEFINE_TEST(test_seq_io_sequence_file_read_all_text_fasta)
     SEQAN_ASSERT(atEnd(seqIO));
 }
 
+// ---------------------------------------------------------------------------
+// Test parallel reading.
+// ---------------------------------------------------------------------------
+
+template <typename TSeqString, typename TQualString>
+void testSeqIOSequenceFileReadParallel(seqan::CharString const & filePath, unsigned batchSize)
+{
+    seqan::StringSet<seqan::CharString> ids, parIds;
+    seqan::StringSet<TSeqString> seqs, parSeqs;
+    seqan::StringSet<TQualString> quals, parQuals;
+
+    SeqFileIn seqIO(toCString(filePath));
+    readRecords(ids, seqs, quals, seqIO);
+
+    SeqFileIn parSeqIO(toCString(filePath));
+    while (!atEnd(parSeqIO))
+    {
+        __uint64 oldLength = length(parIds);
+        readRecords(parIds, parSeqs, parQuals, parSeqIO, batchSize, seqan::Parallel());
+        SEQAN_ASSERT_LEQ(length(parIds) - oldLength, batchSize);
+    }
+
+    SEQAN_ASSERT_EQ(length(parIds), length(ids));
+    SEQAN_ASSERT_EQ(length(parSeqs), length(seqs));
+    SEQAN_ASSERT_EQ(length(parQuals), length(quals));
+    for (unsigned i = 0; i < length(ids); ++i)
+    {
+        SEQAN_ASSERT_EQ(parIds[i], ids[i]);
+        SEQAN_ASSERT_EQ(parSeqs[i], seqs[i]);
+        SEQAN_ASSERT_EQ(parQuals[i], quals[i]);
+    }
+
+    // Qualities inside the sequence alphabet.
+    seqan::StringSet<seqan::CharString> qIds, parQIds;
+    seqan::StringSet<seqan::Dna5QString> qSeqs, parQSeqs;
+
+    SeqFileIn qSeqIO(toCString(filePath));
+    readRecords(qIds, qSeqs, qSeqIO);
+
+    SeqFileIn parQSeqIO(toCString(filePath));
+    readRecords(parQIds, parQSeqs, parQSeqIO, seqan::MaxValue<__uint64>::VALUE, seqan::Parallel());
+
+    SEQAN_ASSERT_EQ(length(parQSeqs), length(qSeqs));
+    for (unsigned i = 0; i < length(qSeqs); ++i)
+    {
+        SEQAN_ASSERT_EQ(parQIds[i], qIds[i]);
+        SEQAN_ASSERT_EQ(length(parQSeqs[i]), length(qSeqs[i]));
+        for (unsigned j = 0; j < length(qSeqs[i]); ++j)
+        {
+            SEQAN_ASSERT_EQ(parQSeqs[i][j], qSeqs[i][j]);
+            SEQAN_ASSERT_EQ(getQualityValue(parQSeqs[i][j]), getQualityValue(qSeqs[i][j]));
+        }
+    }
+}
+
+SEQAN_DEFINE_TEST(test_seq_io_sequence_file_read_all_parallel)
+{
+    seqan::CharString filePath = SEQAN_PATH_TO_ROOT();
+    append(filePath, "/tests/seq_io/test_dna.fq");
+    testSeqIOSequenceFileReadParallel<seqan::Dna5String, seqan::CharString>(filePath, 2);
+
+    filePath = SEQAN_PATH_TO_ROOT();
+    append(filePath, "/tests/seq_io/adeno_genome.fa");
+    testSeqIOSequenceFileReadParallel<seqan::Dna5String, seqan::CharString>(filePath, 1);
+
+    // Write files spanning several chunks.
+    seqan::StringSet<seqan::CharString> ids;
+    seqan::StringSet<seqan::Dna5String> seqs;
+    seqan::StringSet<seqan::CharString> quals;
+
+    seqan::Rng<seqan::MersenneTwister> rng(42);
+    resize(ids, 20000);
+    resize(seqs, 20000);
+    resize(quals, 20000);
+    for (unsigned i = 0; i < length(ids); ++i)
+    {
+        appendNumber(ids[i], i);
+        if (i % 7 == 0)
+            append(ids[i], " >fasta @fastq");   // record markers inside ids
+        resize(seqs[i], pickRandomNumber(rng) % 300);
+        resize(quals[i], length(seqs[i]));
+        for (unsigned j = 0; j < length(seqs[i]); ++j)
+        {
+            seqs[i][j] = pickRandomNumber(rng) % 5;
+            quals[i][j] = '!' + pickRandomNumber(rng) % 40;
+        }
+    }
+
+    seqan::CharString fastqPath = SEQAN_TEMP_FILENAME();
+    append(fastqPath, ".fq");
+    seqan::CharString fastaPath = SEQAN_TEMP_FILENAME();
+    append(fastaPath, ".fa");
+    {
+        SeqFileOut fastqOut(toCString(fastqPath));
+        SeqFileOut fastaOut(toCString(fastaPath));
+        writeRecords(fastqOut, ids, seqs, quals);
+        writeRecords(fastaOut, ids, seqs);
+    }
+
+    testSeqIOSequenceFileReadParallel<seqan::Dna5String, seqan::CharString>(fastqPath, 5000);
+    testSeqIOSequenceFileReadParallel<seqan::CharString, seqan::CharString>(fastqPath, 100000);
+    testSeqIOSequenceFileReadParallel<seqan::Dna5String, seqan::CharString>(fastaPath, 3333);
+
+    // Windows line endings.
+    seqan::CharString crlfPath = SEQAN_TEMP_FILENAME();
+    append(crlfPath, ".fq");
+    {
+        std::ofstream crlfOut(toCString(crlfPath), std::ios::binary);
+        for (unsigned i = 0; i < length(ids); ++i)
+            crlfOut << '@' << ids[i] << "\r\n" << seqs[i] << "\r\n+\r\n" << quals[i] << "\r\n";
+    }
+
+    testSeqIOSequenceFileReadParallel<seqan::Dna5String, seqan::CharString>(crlfPath, 7000);
+}
+
 // ---------------------------------------------------------------------------
 // Test writing with different interfaces.
 // ---------------------------------------------------------------------------
@@ -81,6 +81,7 @@ SEQAN_BEGIN_TESTSUITE(Sequence tests)
 	SEQAN_CALL_TEST(Sequence_Interface);
 	SEQAN_CALL_TEST(String_Base);
 	SEQAN_CALL_TEST(String_Alloc);
+	SEQAN_CALL_TEST(String_Alloc_Arena);
 	SEQAN_CALL_TEST(String_Array);
 	SEQAN_CALL_TEST(String_Stack);
 	SEQAN_CALL_TEST(String_Pointer);
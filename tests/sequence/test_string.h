@@ -496,6 +496,37 @@ SEQAN_DEFINE_TEST(String_Alloc)
 
 //////////////////////////////////////////////////////////////////////////////
 
+SEQAN_DEFINE_TEST(String_Alloc_Arena)
+{
+    typedef String<char, Alloc<Arena<> > > TString;
+
+    TestStringBasics<TString>();
+    TestStringResize<TString>();
+    reset(threadLocalArena());
+
+    TString str1 = "hello";
+    SEQAN_ASSERT_EQ(str1[1], 'e');
+    char const * storage = begin(str1, Standard());
+
+    StringSet<TString, Owner<ConcatDirect<> > > set;
+    appendValue(set, "ACGT");
+    appendValue(set, str1);
+    SEQAN_ASSERT_EQ(length(set), 2u);
+    SEQAN_ASSERT_EQ(set[0], "ACGT");
+    SEQAN_ASSERT_EQ(set[1], "hello");
+    SEQAN_ASSERT_EQ(str1, "hello");
+
+    // After a reset, the next batch reuses the storage of the first one.
+    clear(set);
+    shrinkToFit(str1);
+    reset(threadLocalArena());
+    TString str2 = "world";
+    SEQAN_ASSERT_EQ(begin(str2, Standard()), storage);
+    SEQAN_ASSERT_EQ(str2, "world");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 SEQAN_DEFINE_TEST(String_Array)
 {
     SEQAN_CHECKPOINT;
@@ -360,4 +360,82 @@ SEQAN_TYPED_TEST(TokenizationTest, SkipLine)
     SEQAN_ASSERT(atEnd(ctx.iter));
 }
 
+// --------------------------------------------------------------------------
+// Vectorized scanning
+// --------------------------------------------------------------------------
+
+// Hides the functor type from VectorizedTokenizer_ to get the scalar results.
+template <typename TFunctor>
+struct ScalarTokenizationFunctor
+{
+    TFunctor func;
+
+    template <typename TValue>
+    bool operator() (TValue const & val)
+    {
+        return func(val);
+    }
+};
+
+template <typename TStream, typename TFunctor>
+void testTokenizationVectorized(char const * text)
+{
+    TokenizationContext<TStream> ctx(text);
+    TokenizationContext<TStream> scalarCtx(text);
+    TokenizationContext<TStream> skipCtx(text);
+
+    CharString buf, scalarBuf;
+    while (!atEnd(scalarCtx.iter))
+    {
+        clear(buf);
+        clear(scalarBuf);
+        readUntil(buf, ctx.iter, TFunctor());
+        readUntil(scalarBuf, scalarCtx.iter, ScalarTokenizationFunctor<TFunctor>());
+        SEQAN_ASSERT_EQ(buf, scalarBuf);
+        SEQAN_ASSERT_EQ(atEnd(ctx.iter), atEnd(scalarCtx.iter));
+
+        skipUntil(skipCtx.iter, TFunctor());
+        SEQAN_ASSERT_EQ(atEnd(skipCtx.iter), atEnd(scalarCtx.iter));
+
+        if (atEnd(scalarCtx.iter))
+            break;
+
+        SEQAN_ASSERT_EQ(value(ctx.iter), value(scalarCtx.iter));
+        SEQAN_ASSERT_EQ(value(skipCtx.iter), value(scalarCtx.iter));
+        skipOne(ctx.iter);
+        skipOne(scalarCtx.iter);
+        skipOne(skipCtx.iter);
+    }
+    SEQAN_ASSERT(atEnd(ctx.iter));
+}
+
+SEQAN_TYPED_TEST(TokenizationTest, Vectorized)
+{
+    typedef typename TestFixture::TStream TStream;
+
+    // Delimiters at all offsets of 16 and 32 byte vectors, long runs without them.
+    std::string text;
+    for (unsigned i = 0; i < 70; ++i)
+    {
+        text.append(i, 'A');
+        text += "\tC\n\r ~!z09\a";
+    }
+    text.append(EXAMPLE_STR1);
+
+    testTokenizationVectorized<TStream, EqualsChar<'\t'> >(text.c_str());
+    testTokenizationVectorized<TStream, IsNewline>(text.c_str());
+    testTokenizationVectorized<TStream, IsWhitespace>(text.c_str());
+    testTokenizationVectorized<TStream, IsGraph>(text.c_str());
+    testTokenizationVectorized<TStream, IsAlphaNum>(text.c_str());
+    testTokenizationVectorized<TStream, NotFunctor<IsInRange<'A', 'C'> > >(text.c_str());
+    testTokenizationVectorized<TStream, AndFunctor<IsAlpha, NotFunctor<EqualsChar<'A'> > > >(text.c_str());
+
+    // Conversion into another alphabet.
+    TokenizationContext<TStream> ctx(text.c_str());
+    Dna5String seq;
+    skipUntil(ctx.iter, EqualsChar<'A'>());
+    readUntil(seq, ctx.iter, IsBlank());
+    SEQAN_ASSERT_EQ(seq, "A");
+}
+
 #endif // ifndef TEST_STREAM_TEST_STREAM_TOKENIZATION_H_
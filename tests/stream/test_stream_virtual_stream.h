@@ -179,4 +179,181 @@ SEQAN_TYPED_TEST(VStreamTest, AutoDetection)
     SEQAN_ASSERT_NOT((bool)vstream);
 }
 
+// generates a FASTQ-like text that spans multiple compression blocks
+inline void _generateLargeText(CharString &text, unsigned records)
+{
+    static const char DNA[] = "ACGT";
+    unsigned rng = 42u;
+
+    clear(text);
+    for (unsigned i = 0; i != records; ++i)
+    {
+        appendValue(text, '@');
+        appendNumber(text, i);
+        appendValue(text, '\n');
+        for (unsigned j = 0; j != 100; ++j)
+        {
+            rng = rng * 1103515245u + 12345u;
+            appendValue(text, DNA[(rng >> 16) & 3]);
+        }
+        append(text, "\n+\n");
+        for (unsigned j = 0; j != 100; ++j)
+        {
+            rng = rng * 1103515245u + 12345u;
+            appendValue(text, (char)('!' + ((rng >> 16) % 41)));
+        }
+        appendValue(text, '\n');
+    }
+}
+
+SEQAN_TYPED_TEST(VStreamTest, LargeDecompression)
+{
+    CharString buffer;
+    _generateLargeText(buffer, 20000);
+
+    typedef typename TestFixture::Type TCompressionTag;
+    CharString fileName = SEQAN_TEMP_FILENAME();
+    append(fileName, FileExtensions<TCompressionTag>::VALUE[0]);
+    {
+        VirtualStream<char, Output> vostream(toCString(fileName), OPEN_WRONLY);
+        SEQAN_ASSERT((bool)vostream);
+        vostream << buffer;
+    }
+
+    VirtualStream<char, Input> vistream(toCString(fileName), OPEN_RDONLY);
+    SEQAN_ASSERT((bool)vistream);
+    std::stringstream sstr;
+    sstr << vistream.streamBuf;
+    SEQAN_ASSERT(CharString(sstr.str()) == buffer);
+    close(vistream);
+}
+
+#if SEQAN_HAS_ZLIB
+
+SEQAN_TEST(VStreamGzipTest, ParallelCompression)
+{
+    CharString buffer;
+    _generateLargeText(buffer, 10000);
+
+    CharString fileName = SEQAN_TEMP_FILENAME();
+    append(fileName, ".gz");
+    {
+        VirtualStream<char, Output> vostream;
+        vostream.numThreads = 3;
+        SEQAN_ASSERT(open(vostream, toCString(fileName), OPEN_WRONLY));
+        vostream << buffer;
+    }
+
+    // the output must be readable by standard gzip tools
+    CharString content;
+    gzFile gzfile = gzopen(toCString(fileName), "rb");
+    SEQAN_ASSERT(gzfile != NULL);
+    char chunk[4096];
+    int n;
+    while ((n = gzread(gzfile, chunk, sizeof(chunk))) > 0)
+        append(content, prefix(chunk, n));
+    gzclose(gzfile);
+    SEQAN_ASSERT(content == buffer);
+}
+
+SEQAN_TEST(VStreamBgzfTest, RandomSeek)
+{
+    CharString buffer;
+    _generateLargeText(buffer, 5000);     // 20000 lines
+
+    CharString fileName = SEQAN_TEMP_FILENAME();
+    append(fileName, ".bgzf");
+    {
+        VirtualStream<char, Output> vostream(toCString(fileName), OPEN_WRONLY);
+        SEQAN_ASSERT((bool)vostream);
+        vostream << buffer;
+    }
+
+    // Remember the virtual offset of every line.
+    VirtualStream<char, Input> vistream(toCString(fileName), OPEN_RDONLY);
+    SEQAN_ASSERT((bool)vistream);
+    String<std::streampos> offsets;
+    std::vector<std::string> lines;
+    std::string line;
+    while (true)
+    {
+        std::streampos offset = vistream.tellg();
+        if (!std::getline(vistream, line))
+            break;
+        appendValue(offsets, offset);
+        lines.push_back(line);
+    }
+    SEQAN_ASSERT_EQ(length(offsets), 20000u);
+    vistream.clear();
+
+    // Jump back and forth, revisiting nearby blocks to exercise the block cache.
+    unsigned rng = 1;
+    unsigned lineNo = 0;
+    for (unsigned i = 0; i < 2000; ++i)
+    {
+        rng = rng * 1103515245u + 12345u;
+        lineNo = (i % 4 == 0) ? (rng >> 8) % 20000 : (lineNo + (rng >> 8) % 2000) % 20000;
+        vistream.seekg(offsets[lineNo]);
+        SEQAN_ASSERT(!std::getline(vistream, line).fail());
+        SEQAN_ASSERT(line == lines[lineNo]);
+
+        // continue reading behind the block of the sought line
+        if (lineNo + 1201 < 20000)
+        {
+            for (unsigned j = 1; j <= 1200; ++j)
+                std::getline(vistream, line);
+            SEQAN_ASSERT(line == lines[lineNo + 1200]);
+            SEQAN_ASSERT(vistream.tellg() == offsets[lineNo + 1201]);
+        }
+    }
+    close(vistream);
+}
+
+#endif  // #if SEQAN_HAS_ZLIB
+
+#if SEQAN_HAS_BZIP2
+
+SEQAN_TEST(VStreamBzip2Test, ParallelBlocks)
+{
+    CharString buffer;
+    _generateLargeText(buffer, 10000);
+
+    // two concatenated streams of 100k blocks, starting at arbitrary bit offsets
+    std::stringstream compressed;
+    for (unsigned i = 0; i < 2; ++i)
+    {
+        bzip2_stream::bzip2_ostream bzstream(compressed, 1);
+        bzstream.write(toCString(buffer), length(buffer));
+    }
+
+    CharString expected = buffer;
+    append(expected, buffer);
+
+    for (unsigned numThreads = 1; numThreads <= 4; numThreads += 3)
+    {
+        std::istringstream istr(compressed.str());
+        basic_unbzip2_parallel_streambuf<char> streamBuf(istr, numThreads, 2);
+        std::stringstream sstr;
+        sstr << &streamBuf;
+        SEQAN_ASSERT(CharString(sstr.str()) == expected);
+    }
+
+    // truncated input
+    std::string truncated = compressed.str().substr(0, compressed.str().size() / 3);
+    std::istringstream istr(truncated);
+    basic_bzip2_parallel_istream<char> bzistream(istr);
+    bool thrown = false;
+    try
+    {
+        while (bzistream.rdbuf()->sbumpc() != EOF) {}
+    }
+    catch (IOError &)
+    {
+        thrown = true;
+    }
+    SEQAN_ASSERT(thrown);
+}
+
+#endif  // #if SEQAN_HAS_BZIP2
+
 #endif // ndef TEST_STREAM_TEST_VIRTUAL_STREAM_H_
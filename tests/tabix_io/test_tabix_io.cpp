@@ -41,5 +41,8 @@
 SEQAN_BEGIN_TESTSUITE(test_tabix_io)
 {
     SEQAN_CALL_TEST(test_tabix_io_read_indexed_vcf);
+    SEQAN_CALL_TEST(test_tabix_io_build_vcf);
+    SEQAN_CALL_TEST(test_tabix_io_build_bed_long_contig);
+    SEQAN_CALL_TEST(test_tabix_io_region_reader_vcf);
 }
 SEQAN_END_TESTSUITE
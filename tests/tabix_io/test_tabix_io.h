@@ -40,10 +40,11 @@
 #include <seqan/basic.h>
 #include <seqan/sequence.h>
 #include <seqan/vcf_io.h>
+#include <seqan/bed_io.h>
 #include <seqan/tabix_io.h>
 
 
-SEQAN_DEFINE_TEST(test_tabix_io_read_indexed_vcf)
+void testTabixIOQueryVcf(seqan::TabixIndex const & tabixIndex)
 {
     // Open TABIX file
     seqan::CharString vcfPath = SEQAN_PATH_TO_ROOT();
@@ -53,11 +54,6 @@ SEQAN_DEFINE_TEST(test_tabix_io_read_indexed_vcf)
     // Read header (to get the contig names)
     seqan::VcfHeader header;
     readHeader(header, vcfFile);
-    
-    // Open Tabix index
-    seqan::CharString tbiPath = vcfPath;
-    append(tbiPath, ".tbi");
-    seqan::TabixIndex tabixIndex(toCString(tbiPath));
 
     // Search overlapping variants
 
@@ -116,5 +112,279 @@ SEQAN_DEFINE_TEST(test_tabix_io_read_indexed_vcf)
     SEQAN_ASSERT_NOT(atEnd(vcfFile));
 }
 
+// Compare the records found via jumpToRegion() with a linear scan over the file.
+
+inline __int32 _testTabixIORecordEnd(seqan::VcfRecord const & record)
+{
+    return record.beginPos + std::max((__int32)length(record.ref), (__int32)1);
+}
+
+inline __int32 _testTabixIORecordEnd(seqan::BedRecord<seqan::Bed3> const & record)
+{
+    return std::max(record.endPos, record.beginPos + 1);
+}
+
+inline seqan::CharString _testTabixIORecordRef(seqan::VcfRecord const & record, seqan::VcfFileIn & fileIn)
+{
+    return contigNames(context(fileIn))[record.rID];
+}
+
+inline seqan::CharString _testTabixIORecordRef(seqan::BedRecord<seqan::Bed3> const & record, seqan::BedFileIn &)
+{
+    return record.ref;
+}
+
+inline void _testTabixIOReadHeader(seqan::VcfFileIn & fileIn)
+{
+    seqan::VcfHeader header;
+    readHeader(header, fileIn);
+}
+
+inline void _testTabixIOReadHeader(seqan::BedFileIn &)
+{}
+
+template <typename TFileIn, typename TRecord>
+void testTabixIOCompareRegionQueries(char const * path, seqan::TabixIndex const & tabixIndex,
+                                     TRecord record, __int32 step, __int32 width)
+{
+    typedef seqan::Triple<seqan::CharString, __int32, __int32> TInterval;
+
+    // Collect all records by a linear scan.
+    seqan::String<TInterval> intervals;
+    {
+        TFileIn fileIn(path);
+        _testTabixIOReadHeader(fileIn);
+        while (!atEnd(fileIn))
+        {
+            readRecord(record, fileIn);
+            appendValue(intervals, TInterval(_testTabixIORecordRef(record, fileIn), record.beginPos,
+                                             _testTabixIORecordEnd(record)));
+        }
+    }
+
+    TFileIn fileIn(path);
+    _testTabixIOReadHeader(fileIn);
+
+    for (unsigned rID = 0; rID < length(tabixIndex._nameStore); ++rID)
+    {
+        seqan::CharString refName = tabixIndex._nameStore[rID];
+
+        __int32 maxEnd = 0;
+        for (unsigned i = 0; i < length(intervals); ++i)
+            if (intervals[i].i1 == refName)
+                maxEnd = std::max(maxEnd, intervals[i].i3);
+
+        for (__int32 pos = 0; pos < maxEnd + step; pos += step)
+        {
+            __int32 posEnd = pos + width;
+
+            unsigned expectedCount = 0;
+            for (unsigned i = 0; i < length(intervals); ++i)
+                if (intervals[i].i1 == refName && intervals[i].i2 < posEnd && intervals[i].i3 > pos)
+                    ++expectedCount;
+
+            bool hasEntries = false;
+            SEQAN_ASSERT(jumpToRegion(fileIn, hasEntries, refName, pos, posEnd, tabixIndex));
+            SEQAN_ASSERT_EQ(hasEntries, expectedCount != 0u);
+            if (!hasEntries)
+                continue;
+
+            // All overlapping records follow the first one.
+            unsigned count = 0;
+            for (bool first = true; !atEnd(fileIn); first = false)
+            {
+                readRecord(record, fileIn);
+                if (_testTabixIORecordRef(record, fileIn) != refName || record.beginPos >= posEnd)
+                    break;
+
+                bool overlaps = _testTabixIORecordEnd(record) > pos;
+                if (first)
+                    SEQAN_ASSERT(overlaps);
+                if (overlaps)
+                    ++count;
+            }
+            SEQAN_ASSERT_EQ(count, expectedCount);
+        }
+    }
+}
+
+// Read the regions with a TabixRegionReader and compare with a linear scan over the file.
+
+template <typename TFileIn, typename TFileFormat, typename TRecord>
+void testTabixIORegionReader(char const * path, seqan::TabixIndex const & tabixIndex,
+                             seqan::String<seqan::GenomicRegion> const & regions, TRecord record)
+{
+    // Collect the expected records and their region ids.
+    seqan::String<TRecord> expected;
+    seqan::StringSet<seqan::CharString> expectedRefs;
+    seqan::StringSet<seqan::String<unsigned> > expectedIds;
+    {
+        TFileIn fileIn(path);
+        _testTabixIOReadHeader(fileIn);
+        while (!atEnd(fileIn))
+        {
+            readRecord(record, fileIn);
+            seqan::CharString ref = _testTabixIORecordRef(record, fileIn);
+            __int32 recordEnd = _testTabixIORecordEnd(record);
+
+            seqan::String<unsigned> ids;
+            for (unsigned i = 0; i < length(regions); ++i)
+            {
+                __int32 regionEnd = (regions[i].endPos < 0) ? seqan::MaxValue<__int32>::VALUE : regions[i].endPos;
+                if (regions[i].seqName == ref && record.beginPos < regionEnd &&
+                    recordEnd > std::max(regions[i].beginPos, (__int32)0))
+                    appendValue(ids, i);
+            }
+            if (!empty(ids))
+            {
+                appendValue(expected, record);
+                appendValue(expectedRefs, ref);
+                appendValue(expectedIds, ids);
+            }
+        }
+    }
+
+    // The reader must return the same records in file order.
+    TFileIn fileIn(path);
+    _testTabixIOReadHeader(fileIn);
+    seqan::TabixRegionReader<TFileFormat> reader(fileIn, tabixIndex, regions);
+    seqan::String<unsigned> ids;
+    unsigned count = 0;
+    while (!atEnd(reader))
+    {
+        readRecord(record, ids, reader);
+        SEQAN_ASSERT_LT(count, length(expected));
+        SEQAN_ASSERT_EQ(_testTabixIORecordRef(record, fileIn), expectedRefs[count]);
+        SEQAN_ASSERT_EQ(record.beginPos, expected[count].beginPos);
+        SEQAN_ASSERT(ids == expectedIds[count]);
+        ++count;
+    }
+    SEQAN_ASSERT_EQ(count, length(expected));
+}
+
+SEQAN_DEFINE_TEST(test_tabix_io_region_reader_vcf)
+{
+    seqan::CharString vcfPath = SEQAN_PATH_TO_ROOT();
+    append(vcfPath, "/tests/tabix_io/test.vcf.gz");
+    seqan::CharString tbiPath = vcfPath;
+    append(tbiPath, ".tbi");
+    seqan::TabixIndex tabixIndex(toCString(tbiPath));
+
+    // Unsorted, overlapping, open-ended and unknown regions.
+    seqan::String<seqan::GenomicRegion> regions;
+    appendValue(regions, seqan::GenomicRegion("chr7:10000-62370"));
+    appendValue(regions, seqan::GenomicRegion("chr1:10100-10400"));
+    appendValue(regions, seqan::GenomicRegion("chr1:10350-16000"));
+    appendValue(regions, seqan::GenomicRegion("chr8:1-100000"));
+    appendValue(regions, seqan::GenomicRegion("chr21:9411318-9411318"));
+    appendValue(regions, seqan::GenomicRegion("chr1:66000"));
+    appendValue(regions, seqan::GenomicRegion("chr7:62369-62369"));
+    testTabixIORegionReader<seqan::VcfFileIn, seqan::Vcf>(toCString(vcfPath), tabixIndex, regions,
+                                                          seqan::VcfRecord());
+
+    // Whole contigs.
+    clear(regions);
+    appendValue(regions, seqan::GenomicRegion("chr21"));
+    appendValue(regions, seqan::GenomicRegion("chr1"));
+    testTabixIORegionReader<seqan::VcfFileIn, seqan::Vcf>(toCString(vcfPath), tabixIndex, regions,
+                                                          seqan::VcfRecord());
+}
+
+SEQAN_DEFINE_TEST(test_tabix_io_read_indexed_vcf)
+{
+    // Open Tabix index
+    seqan::CharString tbiPath = SEQAN_PATH_TO_ROOT();
+    append(tbiPath, "/tests/tabix_io/test.vcf.gz.tbi");
+    seqan::TabixIndex tabixIndex(toCString(tbiPath));
+
+    testTabixIOQueryVcf(tabixIndex);
+}
+
+SEQAN_DEFINE_TEST(test_tabix_io_build_vcf)
+{
+    seqan::CharString vcfPath = SEQAN_PATH_TO_ROOT();
+    append(vcfPath, "/tests/tabix_io/test.vcf.gz");
+
+    seqan::TabixIndex tabixIndex;
+    SEQAN_ASSERT(build(tabixIndex, toCString(vcfPath)));
+    SEQAN_ASSERT_EQ(tabixIndex.format, 2);
+    SEQAN_ASSERT_EQ(tabixIndex.colSeq, 1);
+    SEQAN_ASSERT_EQ(tabixIndex.colBeg, 2);
+    SEQAN_ASSERT_EQ(tabixIndex.colEnd, 0);
+    SEQAN_ASSERT_EQ(tabixIndex.depth, 5);
+    testTabixIOQueryVcf(tabixIndex);
+
+    // The contig names match the ones of the original index.
+    seqan::CharString tbiPath = vcfPath;
+    append(tbiPath, ".tbi");
+    seqan::TabixIndex origIndex(toCString(tbiPath));
+    SEQAN_ASSERT(tabixIndex._nameStore == origIndex._nameStore);
+
+    // Save and reload as TBI and CSI.
+    seqan::CharString tmpPath = SEQAN_TEMP_FILENAME();
+    seqan::CharString tmpTbiPath = tmpPath;
+    append(tmpTbiPath, ".tbi");
+    seqan::CharString tmpCsiPath = tmpPath;
+    append(tmpCsiPath, ".csi");
+    SEQAN_ASSERT(save(tabixIndex, toCString(tmpTbiPath)));
+    SEQAN_ASSERT(save(tabixIndex, toCString(tmpCsiPath)));
+
+    seqan::TabixIndex tbiIndex(toCString(tmpTbiPath));
+    SEQAN_ASSERT(tbiIndex._nameStore == origIndex._nameStore);
+    SEQAN_ASSERT_EQ(tbiIndex.format, 2);
+    testTabixIOQueryVcf(tbiIndex);
+
+    seqan::TabixIndex csiIndex(toCString(tmpCsiPath));
+    SEQAN_ASSERT(csiIndex._nameStore == origIndex._nameStore);
+    SEQAN_ASSERT_EQ(csiIndex.format, 2);
+    SEQAN_ASSERT_EQ(csiIndex.colEnd, 0);
+    SEQAN_ASSERT(empty(csiIndex._linearIndices));
+    testTabixIOQueryVcf(csiIndex);
+
+    seqan::VcfRecord record;
+    testTabixIOCompareRegionQueries<seqan::VcfFileIn>(toCString(vcfPath), origIndex, record, 997, 1);
+    testTabixIOCompareRegionQueries<seqan::VcfFileIn>(toCString(vcfPath), tbiIndex, record, 997, 1);
+    testTabixIOCompareRegionQueries<seqan::VcfFileIn>(toCString(vcfPath), csiIndex, record, 997, 1);
+    testTabixIOCompareRegionQueries<seqan::VcfFileIn>(toCString(vcfPath), csiIndex, record, 4999, 20000);
+}
+
+SEQAN_DEFINE_TEST(test_tabix_io_build_bed_long_contig)
+{
+    // Regions behind 2^29 bp require a CSI index.
+    seqan::CharString bedPath = SEQAN_TEMP_FILENAME();
+    append(bedPath, ".bed.bgzf");
+    {
+        std::ofstream file(toCString(bedPath), std::ios::binary | std::ios::out);
+        seqan::VirtualStream<char, seqan::Output> out;
+        SEQAN_ASSERT(open(out, file, seqan::BgzfFile()));
+        for (__int64 i = 0; i < 1000; ++i)
+            out << "chrLong\t" << i * 1000003 << '\t' << i * 1000003 + 100 + (i % 7) * 300000 << "\n";
+        for (__int64 i = 0; i < 100; ++i)
+            out << "chrShort\t" << i * 10 << '\t' << i * 10 + 5 << "\n";
+        close(out);
+    }
+
+    seqan::TabixIndex tabixIndex;
+    SEQAN_ASSERT(build(tabixIndex, toCString(bedPath)));
+    SEQAN_ASSERT_EQ(tabixIndex.format, (__int32)seqan::TabixIndex::FORMAT_UCSC);
+    SEQAN_ASSERT_EQ(tabixIndex.depth, 6);
+    SEQAN_ASSERT_EQ(length(tabixIndex._nameStore), 2u);
+
+    seqan::CharString tmpPath = SEQAN_TEMP_FILENAME();
+    seqan::CharString tmpTbiPath = tmpPath;
+    append(tmpTbiPath, ".tbi");
+    seqan::CharString tmpCsiPath = tmpPath;
+    append(tmpCsiPath, ".csi");
+    SEQAN_ASSERT_NOT(save(tabixIndex, toCString(tmpTbiPath)));
+    SEQAN_ASSERT(save(tabixIndex, toCString(tmpCsiPath)));
+
+    seqan::TabixIndex csiIndex(toCString(tmpCsiPath));
+    SEQAN_ASSERT_EQ(csiIndex.depth, 6);
+
+    seqan::BedRecord<seqan::Bed3> record;
+    testTabixIOCompareRegionQueries<seqan::BedFileIn>(toCString(bedPath), tabixIndex, record, 1999993, 1);
+    testTabixIOCompareRegionQueries<seqan::BedFileIn>(toCString(bedPath), csiIndex, record, 1999993, 1);
+    testTabixIOCompareRegionQueries<seqan::BedFileIn>(toCString(bedPath), csiIndex, record, 1999993, 3000000);
+}
 
 #endif  // SEQAN_TESTS_TABIX_TEST_TABIX_IO_H_
@@ -42,6 +42,8 @@ SEQAN_BEGIN_TESTSUITE(test_vcf_io)
 {
     SEQAN_CALL_TEST(test_vcf_io_read_vcf_header);
     SEQAN_CALL_TEST(test_vcf_io_read_vcf_record);
+    SEQAN_CALL_TEST(test_vcf_io_read_vcf_record_view);
+    SEQAN_CALL_TEST(test_vcf_io_vcf_record_view_genotypes);
     SEQAN_CALL_TEST(test_vcf_io_vcf_file_read_record);
 
     SEQAN_CALL_TEST(test_vcf_io_write_vcf_header);
@@ -169,6 +169,114 @@ SEQAN_DEFINE_TEST(test_vcf_io_read_vcf_record)
     }
 }
 
+SEQAN_DEFINE_TEST(test_vcf_io_read_vcf_record_view)
+{
+    seqan::CharString vcfPath = SEQAN_PATH_TO_ROOT();
+    append(vcfPath, "/tests/vcf_io/example_records_with_errors.vcf");
+
+    seqan::String<char, seqan::MMap<> > mmapString;
+    open(mmapString, toCString(vcfPath));
+
+    seqan::VcfIOContext<> vcfIOContext;
+    resize(sampleNames(vcfIOContext), 3);
+
+    // The eager and the lazy reader must agree.
+    seqan::Iterator<seqan::String<char, seqan::MMap<> >, seqan::Rooted>::Type iter = begin(mmapString);
+    seqan::String<seqan::VcfRecord> expected;
+    seqan::VcfRecord record;
+    for (unsigned i = 0; i < 3; ++i)
+    {
+        readRecord(record, vcfIOContext, iter, seqan::Vcf());
+        appendValue(expected, record);
+    }
+
+    iter = begin(mmapString);
+    seqan::VcfRecordView view;
+    seqan::VcfRecordView const & constView = view;
+    for (unsigned i = 0; i < 3; ++i)
+    {
+        readRecord(view, vcfIOContext, iter, seqan::Vcf());
+        assign(record, constView);
+        SEQAN_ASSERT_EQ(record.rID, expected[i].rID);
+        SEQAN_ASSERT_EQ(record.beginPos, expected[i].beginPos);
+        SEQAN_ASSERT_EQ(record.id, expected[i].id);
+        SEQAN_ASSERT_EQ(record.ref, expected[i].ref);
+        SEQAN_ASSERT_EQ(record.alt, expected[i].alt);
+        SEQAN_ASSERT_EQ(record.qual, expected[i].qual);
+        SEQAN_ASSERT_EQ(record.filter, expected[i].filter);
+        SEQAN_ASSERT_EQ(record.info, expected[i].info);
+        SEQAN_ASSERT_EQ(record.format, expected[i].format);
+        SEQAN_ASSERT_EQ(length(record.genotypeInfos), 3u);
+        for (unsigned j = 0; j < 3; ++j)
+            SEQAN_ASSERT_EQ(record.genotypeInfos[j], expected[i].genotypeInfos[j]);
+    }
+    SEQAN_ASSERT_EQ(seqan::CharString(getInfo(view)), "NS=2;DP=10;AF=0.333,0.667;AA=T;DB");
+    SEQAN_ASSERT_EQ(seqan::CharString(getGenotypeInfo(view, 2)), "2/2:35:4");
+
+    seqan::String<__int32> alleles;
+    getGenotypes(alleles, view);
+    SEQAN_ASSERT_EQ(length(alleles), 6u);
+    SEQAN_ASSERT_EQ(alleles[0], 1);
+    SEQAN_ASSERT_EQ(alleles[1], 2);
+    SEQAN_ASSERT_EQ(alleles[2], 2);
+    SEQAN_ASSERT_EQ(alleles[3], 1);
+    SEQAN_ASSERT_EQ(alleles[4], 2);
+    SEQAN_ASSERT_EQ(alleles[5], 2);
+
+    for (unsigned i = 0; i < 21; ++i)
+        SEQAN_TEST_EXCEPTION(seqan::ParseError,
+                             seqan::readRecord(view, vcfIOContext, iter, seqan::Vcf()));
+    SEQAN_ASSERT(atEnd(iter));
+}
+
+SEQAN_DEFINE_TEST(test_vcf_io_vcf_record_view_genotypes)
+{
+    seqan::CharString buffer = "1\t100\t.\tA\tC\t.\t.\t.\tGT:DP\t0/1:3\t./.\t1\t.|12:4\n"
+                               "1\t200\t.\tA\tC\t10\t.\t.\tDP:GT\t3:0/1\t3:./.\t3:1\t3:1|1\n"
+                               "2\t300\t.\tA\tC\t10\t.\t.\n";
+    seqan::Iterator<seqan::CharString, seqan::Rooted>::Type iter = begin(buffer);
+
+    seqan::VcfIOContext<> vcfIOContext;
+    resize(sampleNames(vcfIOContext), 4);
+
+    seqan::VcfRecordView view;
+    seqan::String<__int8> alleles;
+
+    readRecord(view, vcfIOContext, iter, seqan::Vcf());
+    SEQAN_ASSERT_EQ(view.rID, 0);
+    SEQAN_ASSERT_EQ(view.beginPos, 99);
+    SEQAN_ASSERT(view.qual != view.qual);
+    SEQAN_ASSERT_EQ(numSamples(view), 4u);
+    getGenotypes(alleles, view);
+    SEQAN_ASSERT_EQ(length(alleles), 8u);
+    SEQAN_ASSERT_EQ(alleles[0], 0);
+    SEQAN_ASSERT_EQ(alleles[1], 1);
+    SEQAN_ASSERT_EQ(alleles[2], -1);
+    SEQAN_ASSERT_EQ(alleles[3], -1);
+    SEQAN_ASSERT_EQ(alleles[4], 1);
+    SEQAN_ASSERT_EQ(alleles[5], -1);
+    SEQAN_ASSERT_EQ(alleles[6], -1);
+    SEQAN_ASSERT_EQ(alleles[7], 12);
+    SEQAN_TEST_EXCEPTION(seqan::ParseError, getGenotypes(alleles, view, 1u));
+
+    // GT is not the first subfield.
+    readRecord(view, vcfIOContext, iter, seqan::Vcf());
+    SEQAN_ASSERT_EQ(view.qual, 10);
+    getGenotypes(alleles, view);
+    SEQAN_ASSERT_EQ(length(alleles), 8u);
+    for (unsigned i = 0; i < length(alleles); ++i)
+        SEQAN_ASSERT_EQ(alleles[i], -1);
+
+    // No genotype columns.
+    readRecord(view, vcfIOContext, iter, seqan::Vcf());
+    SEQAN_ASSERT_EQ(view.rID, 1);
+    SEQAN_ASSERT_EQ(numSamples(view), 0u);
+    SEQAN_ASSERT(empty(getFormat(view)));
+    getGenotypes(alleles, view);
+    SEQAN_ASSERT(empty(alleles));
+    SEQAN_ASSERT(atEnd(iter));
+}
+
 SEQAN_DEFINE_TEST(test_vcf_io_vcf_file_read_record)
 {
     seqan::CharString vcfPath = SEQAN_PATH_TO_ROOT();